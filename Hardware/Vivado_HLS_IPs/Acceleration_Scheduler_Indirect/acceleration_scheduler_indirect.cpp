@@ -44,6 +44,17 @@
 #define XSOBEL_FILTER_S_AXI4_LITE_ADDR_AP_CTRL   0x00
 #define XSOBEL_FILTER_S_AXI4_LITE_ADDR_ROWS_DATA 0x18
 #define XSOBEL_FILTER_S_AXI4_LITE_ADDR_COLS_DATA 0x20
+#define XSOBEL_FILTER_S_AXI4_LITE_ADDR_PACKED_OUTPUT_EN_DATA 0x38
+#define XSOBEL_FILTER_S_AXI4_LITE_ADDR_INPUT_FORMAT_DATA     0x40
+
+/*
+ * ---------------------------------
+ * Input Formats of the Sobel Filter
+ * ---------------------------------
+ */
+#define INPUT_FORMAT_BGRX 0 // One 32 Bit Beat per Pixel.
+#define INPUT_FORMAT_BGR  1 // Packed 24 Bit Pixels with each Row Padded to a Multiple of 4 Bytes.
+#define INPUT_FORMAT_LUMA 2 // 8 Bit Luminance Values with each Row Padded to a Multiple of 4 Bytes.
 
 /*
  * ------------------------------
@@ -134,7 +145,7 @@
  * 01 --------> The AXI Master Interface of the Core Used to Access External Devices and Memories.
  * 02 --------> Single Bit Input Used to Receive External Start Signals from the Fetch Scheduler.
  * 03 --------> Single Bit Input Used to Receive External Interrupts from the DMA.
- * 04 to 27 --> Registers of the Core that are Accessed through the AXI Slave Lite Interface of the Core.
+ * 04 to 29 --> Registers of the Core that are Accessed through the AXI Slave Lite Interface of the Core.
  */
 int acceleration_scheduler_indirect(/*01*/volatile ap_uint<32> *ext_cfg,
 		                            /*02*/volatile ap_uint<1> *start,
@@ -162,7 +173,9 @@ int acceleration_scheduler_indirect(/*01*/volatile ap_uint<32> *ext_cfg,
 									/*24*/unsigned int accel_group,
 									/*25*/unsigned int shared_apm_base_address,
 									/*26*/unsigned int shared_metrics_base_address,
-									/*27*/unsigned int apm_base_address
+									/*27*/unsigned int apm_base_address,
+									/*28*/unsigned int packed_output,
+									/*29*/unsigned int input_format
 									)
 {
 
@@ -340,6 +353,21 @@ int acceleration_scheduler_indirect(/*01*/volatile ap_uint<32> *ext_cfg,
  */
 #pragma HLS INTERFACE  s_axilite  port=apm_base_address bundle=int_cfg
 
+/*
+ * The packed_output is a Register to Store a Value that Enables/Disables the Packed Output Mode of the Sobel Filter.
+ * When Enabled the Sobel Filter Sends 4 Grayscale Pixels (One Byte each) per 32 Bit Beat so the Processed Image is 4 Times Smaller.
+ * This Register is Accessed through the AXI Slave Lite Interface (int_cfg) of the Core.
+ */
+#pragma HLS INTERFACE  s_axilite  port=packed_output bundle=int_cfg
+
+/*
+ * The input_format is a Register to Store the Format of the Initial Image Data (INPUT_FORMAT_BGRX, INPUT_FORMAT_BGR or INPUT_FORMAT_LUMA)
+ * which is Forwarded to the Sobel Filter and Determines the Size of the Data that are Read from the Host Memory.
+ * The Packed Input Formats are Smaller than the Processed Image Unless the Packed Output Mode is Enabled so the Host Enables both.
+ * This Register is Accessed through the AXI Slave Lite Interface (int_cfg) of the Core.
+ */
+#pragma HLS INTERFACE  s_axilite  port=input_format bundle=int_cfg
+
 #pragma HLS INTERFACE  s_axilite  port=return bundle=int_cfg
 
 
@@ -347,6 +375,9 @@ int acceleration_scheduler_indirect(/*01*/volatile ap_uint<32> *ext_cfg,
 ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 ap_uint<32> initial_data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 
+ap_uint<32> input_image_size; // The Size in Bytes of the Initial Image Data According to the Input Format.
+ap_uint<32> row_bytes; // The Size in Bytes of a Single Image Row. The Transfer Sizes are Calculated from it in Unsigned 32 Bit Arithmetic (3840x2160 Images Need 33177600 Bytes).
+
 ap_uint<1> start_value; // Used to Read the Last Value of the start Input Port.
 ap_uint<1> dma_intr_in_value; // Used to Read the Last Value of the dma_intr_in Input Port.
 
@@ -400,8 +431,25 @@ data_register = offset_f;
 memcpy((ap_uint<32> *)(ext_cfg + (scheduler_buffer_base_address_f + offset_reg_offset_f) / 4), &data_register, sizeof(ap_uint<32>));
 
 
-//Calculate from the Internal Registers (image_cols, image_rows) the Data Size for the CDMA Fetch Transfer.
-data_register = (image_cols * image_rows * 4);
+//Calculate the Size of the Initial Image Data According to the Internal Registers (image_cols, image_rows, input_format) of the Core.
+//The Packed Input Formats Carry 3 (INPUT_FORMAT_BGR) or 1 (INPUT_FORMAT_LUMA) Bytes per Pixel and each Row is Padded to a Multiple of 4 Bytes.
+if(input_format == INPUT_FORMAT_BGR)
+{
+	row_bytes = ((((ap_uint<32>)image_cols * 3) + 3) / 4) * 4;
+}
+else if(input_format == INPUT_FORMAT_LUMA)
+{
+	row_bytes = (((ap_uint<32>)image_cols + 3) / 4) * 4;
+}
+else
+{
+	row_bytes = (ap_uint<32>)image_cols * 4;
+}
+
+input_image_size = row_bytes * image_rows;
+
+//The CDMA Fetch Transfer Reads only the Initial Image Data.
+data_register = input_image_size;
 
 //Write the Data Size for the CDMA Fetch Transfer to the Data Size Register in the Scheduler Buffer of the Fetch Scheduler.
 memcpy((ap_uint<32> *)(ext_cfg + (scheduler_buffer_base_address_f + data_size_reg_offset_f) / 4), &data_register, sizeof(ap_uint<32>));
@@ -486,6 +534,18 @@ data_register = image_rows;
 memcpy((ap_uint<32> *)(ext_cfg + (sobel_base_address + XSOBEL_FILTER_S_AXI4_LITE_ADDR_ROWS_DATA) / 4), &data_register, sizeof(ap_uint<32>));
 
 
+//Get the Packed Output Mode from the Internal Register (packed_output) of the Core.
+data_register = packed_output;
+
+//Write the Packed Output Mode to a Specific Offset of the Sobel Filter Device.
+memcpy((ap_uint<32> *)(ext_cfg + (sobel_base_address + XSOBEL_FILTER_S_AXI4_LITE_ADDR_PACKED_OUTPUT_EN_DATA) / 4), &data_register, sizeof(ap_uint<32>));
+
+//Get the Input Format from the Internal Register (input_format) of the Core.
+data_register = input_format;
+
+//Write the Input Format to a Specific Offset of the Sobel Filter Device.
+memcpy((ap_uint<32> *)(ext_cfg + (sobel_base_address + XSOBEL_FILTER_S_AXI4_LITE_ADDR_INPUT_FORMAT_DATA) / 4), &data_register, sizeof(ap_uint<32>));
+
 //Read the Control Register of the Sobel Filter.
 memcpy(&data_register, (const ap_uint<32> *)(ext_cfg + (sobel_base_address + XSOBEL_FILTER_S_AXI4_LITE_ADDR_AP_CTRL) / 4), sizeof(ap_uint<32>));
 
@@ -520,8 +580,18 @@ data_register = data_register | XAXIDMA_CR_RUNSTOP_MASK;
 //Write the new Value Back to the Control Register of the DMA in Order to Enable the S2MM Channel.
 memcpy((ap_uint<32> *)(ext_cfg + (dma_base_address + XAXIDMA_RX_OFFSET + XAXIDMA_CR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
 
-//Calculate the Image/Transfer Size According to the Internal Registers (image_cols, image_rows) of the Core.
-data_register = (image_cols * image_rows * 4);
+//Calculate the Processed Image/Transfer Size According to the Internal Registers (image_cols, image_rows, packed_output) of the Core.
+//In Packed Output Mode each Row is (image_cols + 3) / 4 Beats of 4 Bytes.
+if(packed_output == 1)
+{
+	row_bytes = (((ap_uint<32>)image_cols + 3) / 4) * 4;
+}
+else
+{
+	row_bytes = (ap_uint<32>)image_cols * 4;
+}
+
+data_register = row_bytes * image_rows;
 
 //Write the Transfer Size to the S2MM Length Register of the DMA which Starts the S2MM Transfer.
 memcpy((ap_uint<32> *)(ext_cfg + (dma_base_address + XAXIDMA_RX_OFFSET + XAXIDMA_BUFFLEN_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
@@ -550,8 +620,8 @@ data_register = data_register | XAXIDMA_CR_RUNSTOP_MASK;
 //Write the new Value Back to the Control Register of the DMA in Order to Enable the MM2S Channel.
 memcpy((ap_uint<32> *)(ext_cfg + (dma_base_address + XAXIDMA_TX_OFFSET + XAXIDMA_CR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
 
-//Calculate the Image/Transfer Size According to the Internal Registers (image_cols, image_rows) of the Core.
-data_register = (image_cols * image_rows * 4);
+//The MM2S Transfer Size is the Size of the Initial Image Data that was Fetched by the CDMA.
+data_register = input_image_size;
 
 //Write the Transfer Size to the MM2S Length Register of the DMA which Starts the MM2S Transfer.
 memcpy((ap_uint<32> *)(ext_cfg + (dma_base_address + XAXIDMA_TX_OFFSET + XAXIDMA_BUFFLEN_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
@@ -728,8 +798,18 @@ data_register = offset_s;
 memcpy((ap_uint<32> *)(ext_cfg + (scheduler_buffer_base_address_s + offset_reg_offset_s) / 4), &data_register, sizeof(ap_uint<32>));
 
 
-//Calculate from the Internal Registers (image_cols, image_rows) the Data Size for the CDMA Send Transfer.
-data_register = (image_cols * image_rows * 4);
+//Calculate from the Internal Registers (image_cols, image_rows, packed_output) the Data Size for the CDMA Send Transfer.
+//The CDMA Send Transfer Carries the Processed Image so it is 4 Times Smaller in Packed Output Mode.
+if(packed_output == 1)
+{
+	row_bytes = (((ap_uint<32>)image_cols + 3) / 4) * 4;
+}
+else
+{
+	row_bytes = (ap_uint<32>)image_cols * 4;
+}
+
+data_register = row_bytes * image_rows;
 
 //Write the Data Size for the CDMA Send Transfer to the Data Size Register in the Scheduler Buffer of the Send Scheduler.
 memcpy((ap_uint<32> *)(ext_cfg + (scheduler_buffer_base_address_s + data_size_reg_offset_s) / 4), &data_register, sizeof(ap_uint<32>));
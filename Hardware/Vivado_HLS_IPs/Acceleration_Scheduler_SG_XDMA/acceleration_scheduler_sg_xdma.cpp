@@ -45,6 +45,17 @@
 #define XSOBEL_FILTER_S_AXI4_LITE_ADDR_AP_CTRL   0x00
 #define XSOBEL_FILTER_S_AXI4_LITE_ADDR_ROWS_DATA 0x18
 #define XSOBEL_FILTER_S_AXI4_LITE_ADDR_COLS_DATA 0x20
+#define XSOBEL_FILTER_S_AXI4_LITE_ADDR_PACKED_OUTPUT_EN_DATA 0x38
+#define XSOBEL_FILTER_S_AXI4_LITE_ADDR_INPUT_FORMAT_DATA     0x40
+
+/*
+ * ---------------------------------
+ * Input Formats of the Sobel Filter
+ * ---------------------------------
+ */
+#define INPUT_FORMAT_BGRX 0 // One 32 Bit Beat per Pixel.
+#define INPUT_FORMAT_BGR  1 // Packed 24 Bit Pixels with each Row Padded to a Multiple of 4 Bytes.
+#define INPUT_FORMAT_LUMA 2 // 8 Bit Luminance Values with each Row Padded to a Multiple of 4 Bytes.
 
 
 /*
@@ -79,6 +90,7 @@
 #define XDMA_SG_PCIE_SCHEDULER_CFG_ADDR_IER                          0x08 // Interrupt Enable Register Offset.
 #define XDMA_SG_PCIE_SCHEDULER_CFG_ADDR_ISR                          0x0C // Interrupt Interrupt Status Register Offset.
 #define XDMA_SG_PCIE_SCHEDULER_CFG_ADDR_REQUESTED_DATA_SIZE_DATA     0x20 // Data Size Register for the Scatter/Gather Transfer.
+#define XDMA_SG_PCIE_SCHEDULER_CFG_ADDR_REQUESTED_S2MM_DATA_SIZE_DATA 0x60 // Data Size Register for the S2MM Channel of the Scatter/Gather Transfer.
 
 /*
  * acceleration_scheduler_sg_xdma()
@@ -108,7 +120,7 @@
  *
  * 01 --------> The AXI Master Interface of the Core Used to Access External Devices and Memories.
  * 02 --------> Single Bit Input Used to Receive External Interrupts from the DMA SG PCIe Scheduler.
- * 03 to 11 --> Registers of the Core that are Accessed through the AXI Slave Lite Interface of the Core.
+ * 03 to 13 --> Registers of the Core that are Accessed through the AXI Slave Lite Interface of the Core.
  */
 int acceleration_scheduler_sg_xdma(/*01*/volatile ap_uint<32> *ext_cfg,
                                    /*02*/volatile ap_uint<1> *scheduler_intr_in,
@@ -120,7 +132,9 @@ int acceleration_scheduler_sg_xdma(/*01*/volatile ap_uint<32> *ext_cfg,
                                    /*08*/unsigned int shared_metrics_address,
                                    /*09*/unsigned int image_cols,
                                    /*10*/unsigned int image_rows,
-                                   /*11*/unsigned int accel_group
+                                   /*11*/unsigned int accel_group,
+                                   /*12*/unsigned int packed_output,
+                                   /*13*/unsigned int input_format
 					 )
 {
 
@@ -194,6 +208,21 @@ int acceleration_scheduler_sg_xdma(/*01*/volatile ap_uint<32> *ext_cfg,
  */
 #pragma HLS INTERFACE  s_axilite  port=accel_group bundle=mm2s_cfg
 
+/*
+ * The packed_output is a Register to Store a Value that Enables/Disables the Packed Output Mode of the Sobel Filter.
+ * When Enabled the Sobel Filter Sends 4 Grayscale Pixels (One Byte each) per 32 Bit Beat so the Processed Image is 4 Times Smaller.
+ * This Register is Accessed through the AXI Slave Lite Interface (mm2s_cfg) of the Core.
+ */
+#pragma HLS INTERFACE  s_axilite  port=packed_output bundle=mm2s_cfg
+
+/*
+ * The input_format is a Register to Store the Format of the Initial Image Data (INPUT_FORMAT_BGRX, INPUT_FORMAT_BGR or INPUT_FORMAT_LUMA)
+ * which is Forwarded to the Sobel Filter and Determines the Size of the Data that are Read from the Host Memory.
+ * The Packed Input Formats are Smaller than the Processed Image Unless the Packed Output Mode is Enabled so the Host Enables both.
+ * This Register is Accessed through the AXI Slave Lite Interface (mm2s_cfg) of the Core.
+ */
+#pragma HLS INTERFACE  s_axilite  port=input_format bundle=mm2s_cfg
+
 #pragma HLS INTERFACE  s_axilite  port=return bundle=mm2s_cfg
 
 
@@ -201,6 +230,9 @@ int acceleration_scheduler_sg_xdma(/*01*/volatile ap_uint<32> *ext_cfg,
 ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 ap_uint<32> initial_data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 
+ap_uint<32> input_image_size; // The Size in Bytes of the Initial Image Data According to the Input Format.
+ap_uint<32> row_bytes; // The Size in Bytes of a Single Image Row. The Transfer Sizes are Calculated from it in Unsigned 32 Bit Arithmetic (3840x2160 Images Need 33177600 Bytes).
+
 ap_uint<32> read_transactions; // Store the Read Transactions from the APM.
 ap_uint<32> read_bytes; // Store the Read Bytes from the APM.
 
@@ -279,6 +311,18 @@ data_register = image_rows;
 memcpy((ap_uint<32> *)(ext_cfg + (sobel_device_address + XSOBEL_FILTER_S_AXI4_LITE_ADDR_ROWS_DATA) / 4), &data_register, sizeof(ap_uint<32>));
 
 
+//Get the Packed Output Mode from the Internal Register (packed_output) of the Core.
+data_register = packed_output;
+
+//Write the Packed Output Mode to a Specific Offset of the Sobel Filter Device.
+memcpy((ap_uint<32> *)(ext_cfg + (sobel_device_address + XSOBEL_FILTER_S_AXI4_LITE_ADDR_PACKED_OUTPUT_EN_DATA) / 4), &data_register, sizeof(ap_uint<32>));
+
+//Get the Input Format from the Internal Register (input_format) of the Core.
+data_register = input_format;
+
+//Write the Input Format to a Specific Offset of the Sobel Filter Device.
+memcpy((ap_uint<32> *)(ext_cfg + (sobel_device_address + XSOBEL_FILTER_S_AXI4_LITE_ADDR_INPUT_FORMAT_DATA) / 4), &data_register, sizeof(ap_uint<32>));
+
 //Read the Control Register of the Sobel Filter.
 memcpy(&data_register, (const ap_uint<32> *)(ext_cfg + (sobel_device_address + XSOBEL_FILTER_S_AXI4_LITE_ADDR_AP_CTRL) / 4), sizeof(ap_uint<32>));
 
@@ -317,12 +361,44 @@ memcpy((ap_uint<32> *)(ext_cfg + (dma_sg_pcie_scheduler_base_address + XDMA_SG_P
  * -----------------------------------------
  */
 
-//Calculate the Image/Transfer Size According to the Internal Registers (image_cols, image_rows) of the Core.
-data_register = image_rows * image_cols * 4;
+//Calculate the Size of the Initial Image Data According to the Internal Registers (image_cols, image_rows, input_format) of the Core.
+//The Packed Input Formats Carry 3 (INPUT_FORMAT_BGR) or 1 (INPUT_FORMAT_LUMA) Bytes per Pixel and each Row is Padded to a Multiple of 4 Bytes.
+if(input_format == INPUT_FORMAT_BGR)
+{
+	row_bytes = ((((ap_uint<32>)image_cols * 3) + 3) / 4) * 4;
+}
+else if(input_format == INPUT_FORMAT_LUMA)
+{
+	row_bytes = (((ap_uint<32>)image_cols + 3) / 4) * 4;
+}
+else
+{
+	row_bytes = (ap_uint<32>)image_cols * 4;
+}
+
+input_image_size = row_bytes * image_rows;
+
+data_register = input_image_size;
 
 //Write the Transfer Size to the Requested Data Size Register of the DMA SG PCIe Scheduler.
 memcpy((ap_uint<32> *)(ext_cfg + (dma_sg_pcie_scheduler_base_address + XDMA_SG_PCIE_SCHEDULER_CFG_ADDR_REQUESTED_DATA_SIZE_DATA) / 4), &data_register, sizeof(ap_uint<32>));
 
+//Calculate the Processed Image Size which is 4 Times Smaller in Packed Output Mode (Each Row is (image_cols + 3) / 4 Beats of 4 Bytes).
+//The Size is Always Written since the Requested Data Size Depends on the Input Format and May Differ from the Processed Image Size.
+if(packed_output == 1)
+{
+	row_bytes = (((ap_uint<32>)image_cols + 3) / 4) * 4;
+}
+else
+{
+	row_bytes = (ap_uint<32>)image_cols * 4;
+}
+
+data_register = row_bytes * image_rows;
+
+//Write the Processed Image Size to the Requested S2MM Data Size Register of the DMA SG PCIe Scheduler.
+memcpy((ap_uint<32> *)(ext_cfg + (dma_sg_pcie_scheduler_base_address + XDMA_SG_PCIE_SCHEDULER_CFG_ADDR_REQUESTED_S2MM_DATA_SIZE_DATA) / 4), &data_register, sizeof(ap_uint<32>));
+
 
 //Read the Control  Register of the DMA SG PCIe Scheduler.
 memcpy(&data_register, (const ap_uint<32> *)(ext_cfg + (dma_sg_pcie_scheduler_base_address + XDMA_SG_PCIE_SCHEDULER_CFG_ADDR_AP_CTRL) / 4), sizeof(ap_uint<32>));
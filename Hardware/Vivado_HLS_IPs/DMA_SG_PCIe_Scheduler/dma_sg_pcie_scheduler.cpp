@@ -68,11 +68,31 @@
 #define XAXIDMA_CR_RUNSTOP_MASK	0x00000001 // Start/Stop DMA Channel Mask.
 #define XAXIDMA_CR_RESET_MASK   0x00000004 // Reset DMA Mask.
 
+#define XAXIDMA_HALTED_MASK     0x00000001 // Halted Channel Mask (Status Register).
+
 #define XAXIDMA_IRQ_IOC_MASK    0x00001000 // Completion Interrupt Mask.
 #define XAXIDMA_IRQ_DELAY_MASK  0x00002000 // Delay Interrupt Mask.
 #define XAXIDMA_IRQ_ERROR_MASK  0x00004000 // Error Interrupt Mask.
 #define XAXIDMA_IRQ_ALL_MASK    0x00007000 // All Interrupts Mask.
 
+/*
+ * Registers of the Scatter/Gather Engine of the DMA which are Applicable for both Channels.
+ */
+#define XAXIDMA_CDESC_OFFSET    0x00000008 // Current Descriptor Pointer Register.
+#define XAXIDMA_TDESC_OFFSET    0x00000010 // Tail Descriptor Pointer Register.
+
+/*
+ * Fields of a Scatter/Gather Descriptor of the DMA.
+ */
+#define XAXIDMA_BD_NDESC_OFFSET      0x00000000 // Next Descriptor Pointer.
+#define XAXIDMA_BD_BUFA_OFFSET       0x00000008 // Buffer Address.
+#define XAXIDMA_BD_CTRL_LEN_OFFSET   0x00000018 // Control and Buffer Length.
+#define XAXIDMA_BD_STS_OFFSET        0x0000001C // Status.
+
+#define XAXIDMA_BD_CTRL_TXSOF_MASK   0x08000000 // First Descriptor of a Packet (MM2S Only).
+#define XAXIDMA_BD_CTRL_TXEOF_MASK   0x04000000 // Last Descriptor of a Packet (MM2S Only).
+#define XAXIDMA_BD_STS_COMPLETE_MASK 0x80000000 // Completed Descriptor.
+
 /*
  * serve_mm2s_transfer()
  *
@@ -80,53 +100,51 @@
  *
  * The Usability of this Function is as Follows:
  *
- * a --> Get from the Scatter/Gather List of the Source Memory the Physical Address of the Current Page to Transfer.
- * b --> Set the Address Translation Register of the PCIe Bridge's Source AXI BAR with the Physical Address of the Current Page to Transfer.
- * c --> Setup and Start the DMA.
+ * a --> Set the Address Translation Register of the PCIe Bridge's Source AXI BAR with the Physical Address of the Window that Includes the Current Transfer
+ *       unless the AXI BAR Already Translates that Window since the Previous Transfer.
+ * b --> Setup and Start the DMA at the Offset of the Current Transfer inside the Source AXI BAR with only the Address and the Length Registers.
  *
  * The Function Parameters are:
  *
  * 01 --> The AXI Master Interface of the Core (cfg).
  * 02 --> The Base Address of the DMA.
- * 03 --> The Data Size of the MM2S Transfer.
- * 04 --> The Address of the Scatter/Gather List of the Source Memory.
- * 05 --> The Address of the BCIe Bridge's Source AXI BAR.
- * 06 --> The Offset in the PCIe Bridge of the Address Translation Register that Refers to the Source AXI BAR.
- * 07 --> The Current Value of the Page Counter in order to Know which Physical Address to Extract from the Source Scatter/Gather List.
- * 08 --> The Transfer Size for the Current Page which Might be Less than the Page Size.
+ * 03 --> The Address of the BCIe Bridge's Source AXI BAR.
+ * 04 --> The Offset in the PCIe Bridge of the Address Translation Register that Refers to the Source AXI BAR.
+ * 05 --> The Physical Address where the Window of the Source AXI BAR Starts (See the next_transfer() Function).
+ * 06 --> The Offset of the Current Transfer inside the Window.
+ * 07 --> The Transfer Size which Might be up to the Size of the AXI BAR.
+ * 08 --> Set if the Window Differs from the Window that the AXI BAR Translates.
  */
 int serve_mm2s_transfer(/*01*/volatile ap_uint<32> *cfg,
                         /*02*/unsigned int dma_device_address,
-                        /*03*/unsigned int src_data_size,
-                        /*04*/unsigned int sgl_address,
-                        /*05*/unsigned int axi_bar_src_address,
-                        /*06*/unsigned int axi_bar_src_cfg_address,
-                        /*07*/int page_counter,
-                        /*08*/ap_uint<32>current_transfer_size
+                        /*03*/unsigned int axi_bar_src_address,
+                        /*04*/unsigned int axi_bar_src_cfg_address,
+                        /*05*/ap_uint<64> window_address,
+                        /*06*/unsigned int window_offset,
+                        /*07*/ap_uint<32> current_transfer_size,
+                        /*08*/ap_uint<1> window_changed
 						)
 {
-	ap_uint<32> data_register_array[2]; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 	ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 
 
-	/*
-	 * ---------------------------------------------------------------------------------------------------------------------
-	 * Get the Physical Address of the Current Page of the Scatter/Gather List and Set the Source AXI BAR of the PCIe Bridge
-	 * ---------------------------------------------------------------------------------------------------------------------
-	 */
-
-	//Get the 64 Bit Physical Address of the Current Page from the Source Scatter/Gather List.
-	//The data_register_array[0] Holds the 32 LSBs of the Physical Address.
-	//The data_register_array[1] Holds the 32 MSBs of the Physical Address.
-	memcpy(data_register_array, (const ap_uint<32> *)(cfg + ((sgl_address + (page_counter * sizeof(ap_uint<64>))) / 4)), sizeof(ap_uint<64>));
-
-	data_register = data_register_array[0];
-	//Write the 32 LSBs of the Physical Address of the Current Page to the Lower Register of the Source AXI BAR.
-	memcpy((ap_uint<32> *)(cfg + (axi_bar_src_cfg_address) / 4), &data_register, sizeof(ap_uint<32>));
-
-	data_register = data_register_array[1];
-	//Write the 32 MSBs of the Physical Address of the Current Page to the Upper Register of the Source AXI BAR.
-	memcpy((ap_uint<32> *)(cfg + (axi_bar_src_cfg_address - 4) / 4), &data_register, sizeof(ap_uint<32>));
+	//The Address Translation Register is Written only when the Current Transfer Belongs to Another Window.
+	if(window_changed == 1)
+	{
+		/*
+		 * -----------------------------------------------------------------------------------
+		 * Set the Source AXI BAR of the PCIe Bridge with the Physical Address of the Window
+		 * -----------------------------------------------------------------------------------
+		 */
+
+		data_register = window_address.range(31, 0);
+		//Write the 32 LSBs of the Physical Address of the Window to the Lower Register of the Source AXI BAR.
+		memcpy((ap_uint<32> *)(cfg + (axi_bar_src_cfg_address) / 4), &data_register, sizeof(ap_uint<32>));
+
+		data_register = window_address.range(63, 32);
+		//Write the 32 MSBs of the Physical Address of the Window to the Upper Register of the Source AXI BAR.
+		memcpy((ap_uint<32> *)(cfg + (axi_bar_src_cfg_address - 4) / 4), &data_register, sizeof(ap_uint<32>));
+	}
 
 
 
@@ -136,22 +154,13 @@ int serve_mm2s_transfer(/*01*/volatile ap_uint<32> *cfg,
 	 * ---------------------------------------------
 	 */
 
-	//Get from the Internal Register (axi_bar_src_address) of the Core the Source Address that the DMA will Use to Read the Initial Image Data.
-	//The Source Address of the DMA MM2S Channel will be the Source AXI BAR which Corresponds to the Physical Address of the Current Page.
-	data_register = axi_bar_src_address;
+	//The Source Address of the DMA MM2S Channel is the Offset of the Current Transfer inside the Source AXI BAR.
+	data_register = axi_bar_src_address + window_offset;
 
 	//Write the Source Address to the Source Register of the DMA.
 	memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_TX_OFFSET + XAXIDMA_SRCADDR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
 
-	//Read the MM2S Control Register of the DMA.
-	memcpy(&data_register, (const ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_TX_OFFSET + XAXIDMA_CR_OFFSET) / 4), sizeof(ap_uint<32>));
-
-	//Set the Recently Read Value with the Mask Required to Enable the MM2S DMA Channel.
-	data_register = data_register | XAXIDMA_CR_RUNSTOP_MASK;
-
-	//Write the new Value Back to the Control Register of the DMA in Order to Enable the MM2S Channel.
-	memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_TX_OFFSET + XAXIDMA_CR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
-
+	//The MM2S Channel is Already Running since the Top Function Sets the Run/Stop Bit when it Enables the Interrupts (See the dma_sg_pcie_scheduler() Top Function).
 	//Write the Transfer Size to the MM2S Length Register of the DMA which Starts the MM2S Transfer.
 	memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_TX_OFFSET + XAXIDMA_BUFFLEN_OFFSET) / 4), &current_transfer_size, sizeof(ap_uint<32>));
 
@@ -167,51 +176,49 @@ int serve_mm2s_transfer(/*01*/volatile ap_uint<32> *cfg,
  *
  * The Usability of this Function is as Follows:
  *
- * a --> Get from the Scatter/Gather List of the Destination Memory the Physical Address of the Current Page to Transfer.
- * b --> Set the Address Translation Register of the PCIe Bridge's Destination AXI BAR with the Physical Address of the Current Page to Transfer.
- * c --> Setup and Start the DMA.
+ * a --> Set the Address Translation Register of the PCIe Bridge's Destination AXI BAR with the Physical Address of the Window that Includes the Current Transfer
+ *       unless the AXI BAR Already Translates that Window since the Previous Transfer.
+ * b --> Setup and Start the DMA at the Offset of the Current Transfer inside the Destination AXI BAR with only the Address and the Length Registers.
  *
  * The Function Parameters are:
  *
  * 01 --> The AXI Master Interface of the Core (cfg).
  * 02 --> The Base Address of the DMA.
- * 03 --> The Data Size of the S2MM Transfer.
- * 04 --> The Address of the Scatter/Gather List of the Destination Memory.
- * 05 --> The Address of the BCIe Bridge's Destination AXI BAR.
- * 06 --> The Offset in the PCIe Bridge of the Address Translation Register that Refers to the Source AXI BAR.
- * 07 --> The Current Value of the Page Counter in order to Know which Physical Address to Extract from the Source Scatter/Gather List.
- * 08 --> The Transfer Size for the Current Page which Might be Less than the Page Size.
+ * 03 --> The Address of the BCIe Bridge's Destination AXI BAR.
+ * 04 --> The Offset in the PCIe Bridge of the Address Translation Register that Refers to the Destination AXI BAR.
+ * 05 --> The Physical Address where the Window of the Destination AXI BAR Starts (See the next_transfer() Function).
+ * 06 --> The Offset of the Current Transfer inside the Window.
+ * 07 --> The Transfer Size which Might be up to the Size of the AXI BAR.
+ * 08 --> Set if the Window Differs from the Window that the AXI BAR Translates.
  */
 int serve_s2mm_transfer(/*01*/volatile ap_uint<32> *cfg,
                         /*02*/unsigned int dma_device_address,
-                        /*03*/unsigned int src_data_size,
-                        /*04*/unsigned int sgl_address,
-                        /*05*/unsigned int axi_bar_dst_address,
-                        /*06*/unsigned int axi_bar_dst_cfg_address,
-                        /*07*/int page_counter,
-                        /*08*/ap_uint<32>current_transfer_size)
+                        /*03*/unsigned int axi_bar_dst_address,
+                        /*04*/unsigned int axi_bar_dst_cfg_address,
+                        /*05*/ap_uint<64> window_address,
+                        /*06*/unsigned int window_offset,
+                        /*07*/ap_uint<32> current_transfer_size,
+                        /*08*/ap_uint<1> window_changed)
 {
-	ap_uint<32> data_register_array[2]; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 	ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 
-	/*
-	 * ---------------------------------------------------------------------------------------------------------------------
-	 * Get the Physical Address of the Current Page of the Scatter/Gather List and Set the Destination AXI BAR of the PCIe Bridge
-	 * ---------------------------------------------------------------------------------------------------------------------
-	 */
-
-	//Get the 64 Bit Physical Address of the Current Page from the Destination Scatter/Gather List.
-	//The data_register_array[0] Holds the 32 LSBs of the Physical Address.
-	//The data_register_array[1] Holds the 32 MSBs of the Physical Address.
-	memcpy(data_register_array, (const ap_uint<32> *)(cfg + ((sgl_address + (page_counter * sizeof(ap_uint<64>))) / 4)), sizeof(ap_uint<64>));
-
-	data_register = data_register_array[0];
-	//Write the 32 LSBs of the Physical Address of the Current Page to the Lower Register of the Destination AXI BAR.
-	memcpy((ap_uint<32> *)(cfg + (axi_bar_dst_cfg_address) / 4), &data_register, sizeof(ap_uint<32>));
-
-	data_register = data_register_array[1];
-	//Write the 32 MSBs of the Physical Address of the Current Page to the Upper Register of the Destination AXI BAR.
-	memcpy((ap_uint<32> *)(cfg + (axi_bar_dst_cfg_address - 4) / 4), &data_register, sizeof(ap_uint<32>));
+	//The Address Translation Register is Written only when the Current Transfer Belongs to Another Window.
+	if(window_changed == 1)
+	{
+		/*
+		 * ---------------------------------------------------------------------------------------
+		 * Set the Destination AXI BAR of the PCIe Bridge with the Physical Address of the Window
+		 * ---------------------------------------------------------------------------------------
+		 */
+
+		data_register = window_address.range(31, 0);
+		//Write the 32 LSBs of the Physical Address of the Window to the Lower Register of the Destination AXI BAR.
+		memcpy((ap_uint<32> *)(cfg + (axi_bar_dst_cfg_address) / 4), &data_register, sizeof(ap_uint<32>));
+
+		data_register = window_address.range(63, 32);
+		//Write the 32 MSBs of the Physical Address of the Window to the Upper Register of the Destination AXI BAR.
+		memcpy((ap_uint<32> *)(cfg + (axi_bar_dst_cfg_address - 4) / 4), &data_register, sizeof(ap_uint<32>));
+	}
 
 
 
@@ -221,22 +228,13 @@ int serve_s2mm_transfer(/*01*/volatile ap_uint<32> *cfg,
 	 * ---------------------------------------------
 	 */
 
-	//Get from the Internal Register (axi_bar_dst_address) of the Core the Destination Address that the DMA will Use to Read the Initial Image Data.
-	//The Destination Address of the DMA S2MM Channel will be the Destination AXI BAR which Corresponds to the Physical Address of the Current Page.
-	data_register = axi_bar_dst_address;
+	//The Destination Address of the DMA S2MM Channel is the Offset of the Current Transfer inside the Destination AXI BAR.
+	data_register = axi_bar_dst_address + window_offset;
 
 	//Write the Destination Address to the Source Register of the DMA.
 	memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_RX_OFFSET + XAXIDMA_DESTADDR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
 
-	//Read the S2MM Control Register of the DMA.
-	memcpy(&data_register, (const ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_RX_OFFSET + XAXIDMA_CR_OFFSET) / 4), sizeof(ap_uint<32>));
-
-	//Set the Recently Read Value with the Mask Required to Enable the S2MM DMA Channel.
-	data_register = data_register | XAXIDMA_CR_RUNSTOP_MASK;
-
-	//Write the new Value Back to the Control Register of the DMA in Order to Enable the S2MM Channel.
-	memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_RX_OFFSET + XAXIDMA_CR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
-
+	//The S2MM Channel is Already Running since the Top Function Sets the Run/Stop Bit when it Enables the Interrupts (See the dma_sg_pcie_scheduler() Top Function).
 	//Write the Transfer Size to the S2MM Length Register of the DMA which Starts the S2MM Transfer.
 	memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_RX_OFFSET + XAXIDMA_BUFFLEN_OFFSET) / 4), &current_transfer_size, sizeof(ap_uint<32>));
 
@@ -244,6 +242,102 @@ int serve_s2mm_transfer(/*01*/volatile ap_uint<32> *cfg,
 
 }
 
+/*
+ * next_transfer()
+ *
+ * Invoked from the dma_sg_pcie_scheduler() Top Function.
+ *
+ * Calculates the Next Transfer of a DMA Channel from its Scatter/Gather List of Extents (See the SG_EXTENT_PAGES_MASK).
+ * The Next Extent is Read from the List when the Current Extent Has been Transferred.
+ *
+ * The AXI BAR Translates a window_size Range so the Window Starts at the Physical Address of the Transfer Aligned to the window_size.
+ * A Transfer Ends at the End of the Extent, at the End of the Data, at the End of the Window or after max_transfer_size Bytes whichever Comes First.
+ * As a Result a Single DMA Command Moves up to window_size Bytes of Contiguous Pages instead of a Single Page.
+ *
+ * The max_transfer_size Keeps the Transfers of the S2MM Channel Aligned to the Packets of the Sobel Filter which Asserts the TLAST every Page
+ * (the S2MM Channel Completes a Transfer on TLAST) while the MM2S Channel is Limited only by the Window.
+ *
+ * The Function Parameters are:
+ *
+ * 01 --> The AXI Master Interface of the Core (cfg).
+ * 02 --> The Address of the Scatter/Gather List of the Channel.
+ * 03 --> The Page Size.
+ * 04 --> The Size of the AXI BAR of the Channel (a Power of 2).
+ * 05 --> The Maximum Size of a Single Transfer.
+ * 06 --> The Transfer State of the Channel.
+ * 07 --> Returns the Window, the Offset inside the Window and the Size of the Transfer
+ *        and whether the AXI BAR Has to be Set with the Window (Consecutive Transfers in the Same Window Keep the Translation).
+ *
+ * Returns the Transfer Size.
+ */
+ap_uint<32> next_transfer(/*01*/volatile ap_uint<32> *cfg,
+                          /*02*/unsigned int sgl_address,
+                          /*03*/unsigned int page_size,
+                          /*04*/unsigned int window_size,
+                          /*05*/unsigned int max_transfer_size,
+                          /*06*/struct sg_channel *channel,
+                          /*07*/struct sg_transfer *transfer)
+{
+	ap_uint<32> data_register_array[2]; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
+	ap_uint<64> extent; // The Current Entry of the Scatter/Gather List.
+
+	unsigned int transfer_size;
+
+	if(channel->extent_bytes == 0)
+	{
+		//Get the 64 Bit Extent from the Scatter/Gather List.
+		//The data_register_array[0] Holds the 32 LSBs and the data_register_array[1] Holds the 32 MSBs of the Extent.
+		memcpy(data_register_array, (const ap_uint<32> *)(cfg + ((sgl_address + (channel->extent_index * sizeof(ap_uint<64>))) / 4)), sizeof(ap_uint<64>));
+
+		extent.range(31, 0) = data_register_array[0];
+		extent.range(63, 32) = data_register_array[1];
+
+		channel->extent_address = extent - (extent & SG_EXTENT_PAGES_MASK);
+		channel->extent_bytes = ((unsigned int)(extent & SG_EXTENT_PAGES_MASK) + 1) * page_size;
+		channel->extent_index++;
+	}
+
+	transfer->window_offset = (unsigned int)(channel->extent_address & (window_size - 1));
+	transfer->window_address = channel->extent_address - transfer->window_offset;
+
+	if(channel->translated == 0 || channel->translated_window != transfer->window_address)
+	{
+		transfer->window_changed = 1;
+
+		channel->translated_window = transfer->window_address;
+		channel->translated = 1;
+	}
+	else
+	{
+		transfer->window_changed = 0;
+	}
+
+	transfer_size = window_size - transfer->window_offset;
+
+	if(max_transfer_size < transfer_size)
+	{
+		transfer_size = max_transfer_size;
+	}
+
+	if(channel->extent_bytes < transfer_size)
+	{
+		transfer_size = channel->extent_bytes;
+	}
+
+	if(channel->remaining_bytes < transfer_size)
+	{
+		transfer_size = channel->remaining_bytes;
+	}
+
+	channel->extent_address = channel->extent_address + transfer_size;
+	channel->extent_bytes = channel->extent_bytes - transfer_size;
+	channel->remaining_bytes = channel->remaining_bytes - transfer_size;
+
+	transfer->transfer_size = transfer_size;
+
+	return transfer_size;
+}
+
 /*
  * serve_mm2s_interrupt()
  *
@@ -255,6 +349,8 @@ int serve_s2mm_transfer(/*01*/volatile ap_uint<32> *cfg,
  *
  * 01 --> The AXI Master Interface of the Core (cfg).
  * 02 --> The Base Address of the DMA.
+ *
+ * Returns the IRQs that were Acknowledged so that the Descriptor Ring Mode Can Detect the Error IRQ.
  */
 int serve_mm2s_interrupt(volatile ap_uint<32> *cfg, unsigned int dma_device_address)
 {
@@ -269,7 +365,7 @@ int serve_mm2s_interrupt(volatile ap_uint<32> *cfg, unsigned int dma_device_addr
 	//Write the new Value Back to the MM2S Status Register of the DMA which Acknowledges the Triggered Interrupts on the MM2S Channel.
 	memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_TX_OFFSET + XAXIDMA_SR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
 
-	return 1;
+	return (int)data_register;
 
 }
 
@@ -284,6 +380,8 @@ int serve_mm2s_interrupt(volatile ap_uint<32> *cfg, unsigned int dma_device_addr
  *
  * 01 --> The AXI Master Interface of the Core (cfg).
  * 02 --> The Base Address of the DMA.
+ *
+ * Returns the IRQs that were Acknowledged so that the Descriptor Ring Mode Can Detect the Error IRQ.
  */
 int serve_s2mm_interrupt(volatile ap_uint<32> *cfg, unsigned int dma_device_address)
 {
@@ -298,6 +396,323 @@ int serve_s2mm_interrupt(volatile ap_uint<32> *cfg, unsigned int dma_device_addr
 	//Write the new Value Back to the S2MM Status Register of the DMA which Acknowledges the Triggered Interrupts on the S2MM Channel.
 	memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_RX_OFFSET + XAXIDMA_SR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
 
+	return (int)data_register;
+
+}
+
+/*
+ * ring_start()
+ *
+ * Invoked from the dma_sg_pcie_scheduler() Top Function in the Descriptor Ring Mode.
+ *
+ * The Usability of this Function is as Follows:
+ *
+ * a --> Link each Descriptor of the Ring to the Next One and the Last Descriptor to the First One.
+ * b --> Clear the Status of each Descriptor since the DMA Treats a Fetched Descriptor that is Already Completed as an Error.
+ * c --> Set the Current Descriptor Pointer Register of the DMA Channel with the First Descriptor of the Ring.
+ *       This Register Can only be Written while the Channel is Halted so the Function is Called before the Channel Starts.
+ *
+ * The Function Parameters are:
+ *
+ * 01 --> The AXI Master Interface of the Core (cfg).
+ * 02 --> The Base Address of the DMA.
+ * 03 --> The Offset of the Registers of the DMA Channel (XAXIDMA_TX_OFFSET or XAXIDMA_RX_OFFSET).
+ * 04 --> The State of the Descriptor Ring of the Channel.
+ */
+int ring_start(/*01*/volatile ap_uint<32> *cfg,
+               /*02*/unsigned int dma_device_address,
+               /*03*/unsigned int channel_offset,
+               /*04*/struct sg_ring *ring)
+{
+	ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
+
+	unsigned int descriptor_address;
+	unsigned int repeat;
+
+	for(repeat = 0; repeat < SG_RING_DESCRIPTORS; repeat++)
+	{
+		descriptor_address = ring->base_address + (repeat * SG_RING_DESCRIPTOR_SIZE);
+
+		//The Next Descriptor of the Last Descriptor is the First Descriptor of the Ring.
+		if(repeat == SG_RING_DESCRIPTORS - 1)
+		{
+			data_register = ring->base_address;
+		}
+		else
+		{
+			data_register = descriptor_address + SG_RING_DESCRIPTOR_SIZE;
+		}
+
+		//Write the Next Descriptor Pointer of the Descriptor.
+		memcpy((ap_uint<32> *)(cfg + (descriptor_address + XAXIDMA_BD_NDESC_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
+
+		data_register = 0;
+
+		//Clear the Status of the Descriptor.
+		memcpy((ap_uint<32> *)(cfg + (descriptor_address + XAXIDMA_BD_STS_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
+	}
+
+	data_register = ring->base_address;
+
+	//Write the First Descriptor of the Ring to the Current Descriptor Pointer Register of the DMA Channel.
+	memcpy((ap_uint<32> *)(cfg + (dma_device_address + channel_offset + XAXIDMA_CDESC_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
+
+	ring->head = 0;
+	ring->tail = 0;
+	ring->in_flight = 0;
+
+	return 1;
+
+}
+
+/*
+ * ring_fill()
+ *
+ * Invoked from the dma_sg_pcie_scheduler() Top Function in the Descriptor Ring Mode.
+ *
+ * Fills the Free Descriptors of the Ring of a DMA Channel with the Next Transfers of the Channel (See the next_transfer() Function)
+ * and Writes the Last Filled Descriptor to the Tail Descriptor Pointer Register so that the DMA Walks all of them without the Core.
+ *
+ * The Buffer Addresses of the Descriptors are Offsets inside the AXI BAR so all the Descriptors that the DMA Holds Belong to the Same Window.
+ * A Transfer of Another Window Stays Staged until the DMA Completes every Descriptor of the Ring and only then the Address Translation Register is Set.
+ *
+ * The Function Parameters are:
+ *
+ * 01 --> The AXI Master Interface of the Core (cfg).
+ * 02 --> The Base Address of the DMA.
+ * 03 --> The Offset of the Registers of the DMA Channel (XAXIDMA_TX_OFFSET or XAXIDMA_RX_OFFSET).
+ * 04 --> The Address of the BCIe Bridge's AXI BAR of the Channel.
+ * 05 --> The Offset in the PCIe Bridge of the Address Translation Register that Refers to the AXI BAR of the Channel.
+ * 06 --> The Address of the Scatter/Gather List of the Channel.
+ * 07 --> The Page Size.
+ * 08 --> The Size of the AXI BAR of the Channel.
+ * 09 --> The Maximum Size of a Single Transfer.
+ * 10 --> The Control Bits of the Descriptors (the Start and End of Packet Bits for the MM2S Channel).
+ * 11 --> The Transfer State of the Channel.
+ * 12 --> The State of the Descriptor Ring of the Channel.
+ * 13 --> The Staged Transfer of the Channel.
+ * 14 --> Flag to Know if the Staged Transfer Holds a Transfer that is not Given to the DMA.
+ *
+ * Returns the Number of Descriptors that were Given to the DMA.
+ */
+int ring_fill(/*01*/volatile ap_uint<32> *cfg,
+              /*02*/unsigned int dma_device_address,
+              /*03*/unsigned int channel_offset,
+              /*04*/unsigned int axi_bar_address,
+              /*05*/unsigned int axi_bar_cfg_address,
+              /*06*/unsigned int sgl_address,
+              /*07*/unsigned int page_size,
+              /*08*/unsigned int window_size,
+              /*09*/unsigned int max_transfer_size,
+              /*10*/unsigned int control_bits,
+              /*11*/struct sg_channel *channel,
+              /*12*/struct sg_ring *ring,
+              /*13*/struct sg_transfer *staged,
+              /*14*/int *staged_valid)
+{
+	ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
+
+	unsigned int descriptor_address = 0;
+	int descriptors = 0;
+
+	while(ring->in_flight < SG_RING_DESCRIPTORS)
+	{
+		if(*staged_valid == 0)
+		{
+			//There are no Transfers Left for the Channel.
+			if(channel->remaining_bytes == 0)
+			{
+				break;
+			}
+
+			next_transfer(cfg, sgl_address, page_size, window_size, max_transfer_size, channel, staged);
+
+			*staged_valid = 1;
+		}
+
+		if(staged->window_changed == 1)
+		{
+			//The Window Cannot Move while the DMA Holds Descriptors of the Current Window.
+			if(ring->in_flight > 0)
+			{
+				break;
+			}
+
+			data_register = staged->window_address.range(31, 0);
+			//Write the 32 LSBs of the Physical Address of the Window to the Lower Register of the AXI BAR.
+			memcpy((ap_uint<32> *)(cfg + (axi_bar_cfg_address) / 4), &data_register, sizeof(ap_uint<32>));
+
+			data_register = staged->window_address.range(63, 32);
+			//Write the 32 MSBs of the Physical Address of the Window to the Upper Register of the AXI BAR.
+			memcpy((ap_uint<32> *)(cfg + (axi_bar_cfg_address - 4) / 4), &data_register, sizeof(ap_uint<32>));
+
+			staged->window_changed = 0;
+		}
+
+		descriptor_address = ring->base_address + (ring->tail * SG_RING_DESCRIPTOR_SIZE);
+
+		//The Buffer Address of the Descriptor is the Offset of the Transfer inside the AXI BAR.
+		data_register = axi_bar_address + staged->window_offset;
+		memcpy((ap_uint<32> *)(cfg + (descriptor_address + XAXIDMA_BD_BUFA_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
+
+		//The Control Field of the Descriptor Holds the Transfer Size and the control_bits.
+		data_register = staged->transfer_size;
+		data_register = data_register | control_bits;
+		memcpy((ap_uint<32> *)(cfg + (descriptor_address + XAXIDMA_BD_CTRL_LEN_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
+
+		data_register = 0;
+
+		//Clear the Status that the DMA Wrote when it Completed the Descriptor in the Previous Round of the Ring.
+		memcpy((ap_uint<32> *)(cfg + (descriptor_address + XAXIDMA_BD_STS_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
+
+		if(ring->tail == SG_RING_DESCRIPTORS - 1)
+		{
+			ring->tail = 0;
+		}
+		else
+		{
+			ring->tail++;
+		}
+
+		ring->in_flight++;
+
+		*staged_valid = 0;
+
+		descriptors++;
+	}
+
+	//Move the Tail Descriptor Pointer to the Last Filled Descriptor which Lets the DMA Process the New Descriptors.
+	if(descriptors > 0)
+	{
+		data_register = descriptor_address;
+		memcpy((ap_uint<32> *)(cfg + (dma_device_address + channel_offset + XAXIDMA_TDESC_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
+	}
+
+	return descriptors;
+
+}
+
+/*
+ * ring_complete()
+ *
+ * Invoked from the dma_sg_pcie_scheduler() Top Function in the Descriptor Ring Mode.
+ *
+ * Releases the Descriptors of the Ring that the DMA Has Completed Starting from the Oldest One.
+ * A Single Interrupt of the Channel Might Stand for more than One Completed Descriptor so the Status of each Descriptor is Checked.
+ *
+ * The Function Parameters are:
+ *
+ * 01 --> The AXI Master Interface of the Core (cfg).
+ * 02 --> The State of the Descriptor Ring of the Channel.
+ *
+ * Returns the Number of Released Descriptors.
+ */
+int ring_complete(/*01*/volatile ap_uint<32> *cfg,
+                  /*02*/struct sg_ring *ring)
+{
+	ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
+
+	int completed = 0;
+
+	while(ring->in_flight > 0)
+	{
+		//Read the Status of the Oldest Descriptor that is Given to the DMA.
+		memcpy(&data_register, (const ap_uint<32> *)(cfg + (ring->base_address + (ring->head * SG_RING_DESCRIPTOR_SIZE) + XAXIDMA_BD_STS_OFFSET) / 4), sizeof(ap_uint<32>));
+
+		if((data_register & XAXIDMA_BD_STS_COMPLETE_MASK) == 0)
+		{
+			break;
+		}
+
+		if(ring->head == SG_RING_DESCRIPTORS - 1)
+		{
+			ring->head = 0;
+		}
+		else
+		{
+			ring->head++;
+		}
+
+		ring->in_flight--;
+
+		completed++;
+	}
+
+	return completed;
+
+}
+
+/*
+ * ring_stop()
+ *
+ * Invoked from the dma_sg_pcie_scheduler() Top Function at the End of the Descriptor Ring Mode.
+ *
+ * Clears the Run/Stop Bit of a DMA Channel and Waits until the Status Register of the Channel Reports that it is Halted
+ * so that the ring_start() of the Next Image Can Set its Current Descriptor Pointer Register.
+ *
+ * The Function Parameters are:
+ *
+ * 01 --> The AXI Master Interface of the Core (cfg).
+ * 02 --> The Base Address of the DMA.
+ * 03 --> The Offset of the Registers of the DMA Channel (XAXIDMA_TX_OFFSET or XAXIDMA_RX_OFFSET).
+ */
+int ring_stop(/*01*/volatile ap_uint<32> *cfg,
+              /*02*/unsigned int dma_device_address,
+              /*03*/unsigned int channel_offset)
+{
+	ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
+
+	//Read the Control Register of the DMA Channel.
+	memcpy(&data_register, (const ap_uint<32> *)(cfg + (dma_device_address + channel_offset + XAXIDMA_CR_OFFSET) / 4), sizeof(ap_uint<32>));
+
+	//Clear the Run/Stop Bit.
+	data_register = data_register & ~XAXIDMA_CR_RUNSTOP_MASK;
+
+	//Write the new Value Back to the Control Register of the DMA Channel.
+	memcpy((ap_uint<32> *)(cfg + (dma_device_address + channel_offset + XAXIDMA_CR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
+
+	//Poll the Status Register of the DMA Channel until the Halted Bit is Set.
+	do
+	{
+		memcpy(&data_register, (const ap_uint<32> *)(cfg + (dma_device_address + channel_offset + XAXIDMA_SR_OFFSET) / 4), sizeof(ap_uint<32>));
+	}
+	while((data_register & XAXIDMA_HALTED_MASK) == 0);
+
+	return 1;
+
+}
+
+/*
+ * ring_reset()
+ *
+ * Invoked from the dma_sg_pcie_scheduler() Top Function when a Channel Reports an Error in the Descriptor Ring Mode.
+ *
+ * A DMA that Has Reported an Error Halts and only Recovers through a Reset.
+ * The Reset Bit of the MM2S Control Register Resets both Channels and it is Cleared by the DMA when the Reset is Done.
+ * Both Channels are then Halted so the ring_start() of the Next Image Can Set their Current Descriptor Pointer Registers.
+ *
+ * The Function Parameters are:
+ *
+ * 01 --> The AXI Master Interface of the Core (cfg).
+ * 02 --> The Base Address of the DMA.
+ */
+int ring_reset(/*01*/volatile ap_uint<32> *cfg,
+               /*02*/unsigned int dma_device_address)
+{
+	ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
+
+	data_register = XAXIDMA_CR_RESET_MASK;
+
+	//Write the Reset Bit to the Control Register of the MM2S Channel.
+	memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_TX_OFFSET + XAXIDMA_CR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
+
+	//Poll the Control Register of the MM2S Channel until the DMA Clears the Reset Bit.
+	do
+	{
+		memcpy(&data_register, (const ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_TX_OFFSET + XAXIDMA_CR_OFFSET) / 4), sizeof(ap_uint<32>));
+	}
+	while((data_register & XAXIDMA_CR_RESET_MASK) != 0);
+
 	return 1;
 
 }
@@ -313,23 +728,33 @@ int serve_s2mm_interrupt(volatile ap_uint<32> *cfg, unsigned int dma_device_addr
  *
  * The Sequential Steps of the Core's Functionality are as Follows:
  *
- * a --> Calculate the Number of Pages to Transfer for the MM2S and S2MM Channels of the DMA.
- * b --> Enable the DMA MM2S Interrupts.
- * c --> Enable the DMA S2MM Interrupts.
- * d --> Start a Page Transfer over the MM2S Channel (See the serve_mm2s_transfer() Function for Details).
- * e --> Start a Page Transfer over the S2MM Channel (See the serve_s2mm_transfer() Function for Details).
- * f --> Loop for as long as Both Channels Require to Complete the Transfer of all the Pages (both_done).
- * g --> In Every Loop Check if Either the MM2S or the S2MM Channels Have Triggered an Interrupt on Completion of the Page Transfer.
- * h --> If any of the Channels Triggers an Interrupt then Clear the Channel's Interrupt
+ * a --> Initialize the Transfer State of the MM2S and S2MM Channels of the DMA with the Number of Bytes to Transfer.
+ * b --> Enable the DMA MM2S Interrupts and Start the MM2S Channel.
+ * c --> Enable the DMA S2MM Interrupts and Start the S2MM Channel.
+ * d --> Start the First Transfer of an Extent over the MM2S Channel (See the next_transfer() and serve_mm2s_transfer() Functions for Details).
+ * e --> Start the First Transfer of an Extent over the S2MM Channel (See the next_transfer() and serve_s2mm_transfer() Functions for Details).
+ * f --> Loop for as long as any of the Channels Has a Transfer in Progress.
+ * g --> In Every Loop Stage the Next Transfer of each Channel that Has Bytes Left and no Staged Transfer.
+ * h --> In Every Loop Check if Either the MM2S or the S2MM Channels Have Triggered an Interrupt on Completion of their Transfer.
+ * i --> If any of the Channels Triggers an Interrupt then Clear the Channel's Interrupt
  *       (See the serve_mm2s_interrupt() and serve_s2MM_interrupt Functions for Details)
- *       and Start the Channel's next Page Transfer.
+ *       and Start the Channel's Staged Transfer if there is One.
+ *
+ * In the Descriptor Ring Mode (a Non Zero descriptor_ring_address when the DMA Includes its Scatter/Gather Engine) the Steps d to i are Replaced as Follows:
+ *
+ * d --> Before the Channels Start Link the Descriptor Rings of the MM2S and S2MM Channels (See the ring_start() Function for Details).
+ * e --> Loop for as long as any of the Channels Has Bytes Left or Descriptors that are not Completed.
+ * f --> In Every Loop Fill the Free Descriptors of each Ring and Move the Tail Descriptor Pointer (See the ring_fill() Function for Details).
+ * g --> If any of the Channels Triggers an Interrupt then Clear the Channel's Interrupt and Release its Completed Descriptors (See the ring_complete() Function for Details).
+ *       If the Interrupt is an Error then Stop Looping since the DMA Halts and will not Complete the Remaining Descriptors.
+ * h --> Halt the Channels (See the ring_stop() Function for Details) or Reset the DMA after an Error (See the ring_reset() Function for Details).
  *
  * The Function Parameters are the Input/Output Ports/Interfaces of the Core:
  *
  * 01 --------> The AXI Master Interface of the Core Used to Access External Devices and Memories.
  * 02 --------> Single Bit Input Used to Receive External Interrupts from the DMA MM2S Channel.
  * 03 --------> Single Bit Input Used to Receive External Interrupts from the DMA S2MM Channel.
- * 04 to 12 --> Registers of the Core that are Accessed through the AXI Slave Lite Interface of the Core.
+ * 04 to 15 --> Registers of the Core that are Accessed through the AXI Slave Lite Interface of the Core.
  */
 int dma_sg_pcie_scheduler(/*01*/volatile ap_uint<32> *cfg,
                           /*02*/volatile ap_uint<1> *mm2s_intr_in,
@@ -342,7 +767,10 @@ int dma_sg_pcie_scheduler(/*01*/volatile ap_uint<32> *cfg,
                           /*09*/unsigned int axi_bar_src_cfg_address,
                           /*10*/unsigned int s2mm_sgl_address,
                           /*11*/unsigned int axi_bar_dst_address,
-                          /*12*/unsigned int axi_bar_dst_cfg_address
+                          /*12*/unsigned int axi_bar_dst_cfg_address,
+                          /*13*/unsigned int requested_s2mm_data_size,
+                          /*14*/unsigned int axi_bar_size,
+                          /*15*/unsigned int descriptor_ring_address
 					 )
 {
 
@@ -416,68 +844,99 @@ int dma_sg_pcie_scheduler(/*01*/volatile ap_uint<32> *cfg,
  */
 #pragma HLS INTERFACE  s_axilite  port=axi_bar_dst_cfg_address bundle=cfg
 
+/*
+ * The requested_s2mm_data_size is a Register to Store the Size of the Data that will be Transferred over the S2MM Channel.
+ * It Differs from the requested_data_size when the Accelerator Produces Less Data than it Receives (e.g. the Packed Output Mode of the Sobel Filter).
+ * A Zero Value Means that the S2MM Channel Transfers as many Bytes as the MM2S Channel (requested_data_size).
+ * This Register is Accessed through the AXI Slave Lite Interface (s_axilite_cfg) of the Core.
+ */
+#pragma HLS INTERFACE  s_axilite  port=requested_s2mm_data_size bundle=cfg
+
+/*
+ * The axi_bar_size is a Register to Store the Size of the Source and Destination AXI BARs which Limits the Size of a Single DMA Transfer.
+ * It Should be a Power of 2 that is not Smaller than the Page Size. A Zero Value Means that the AXI BARs are as Large as a Page.
+ * This Register is Accessed through the AXI Slave Lite Interface (s_axilite_cfg) of the Core.
+ */
+#pragma HLS INTERFACE  s_axilite  port=axi_bar_size bundle=cfg
+
+/*
+ * The descriptor_ring_address is a Register to Store the Address of the Descriptor Ring of the MM2S Channel.
+ * The Descriptor Ring of the S2MM Channel Follows it. A Zero Value Means that the DMA has no Scatter/Gather Engine and each Transfer is Started through the Registers of the DMA.
+ * This Register is Accessed through the AXI Slave Lite Interface (s_axilite_cfg) of the Core.
+ */
+#pragma HLS INTERFACE  s_axilite  port=descriptor_ring_address bundle=cfg
+
 #pragma HLS INTERFACE  s_axilite  port=return bundle=cfg
 
 
 
-ap_uint<32> data_register_array[2]; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 ap_uint<32> data_register; // Used to Temporalily Store Values when Reading or Writing from/to Registers of External Devices.
 
-ap_uint<32> mm2s_data_size; // The Data Size to Transfer for a Page of the MM2S Channel (The Last Page may not be Full).
-ap_uint<32> s2mm_data_size; // The Data Size to Transfer for a Page of the S2MM Channel (The Last Page may not be Full).
-
 ap_uint<1> dma_mm2s_intr_in_value; // Used to Read the Last Value of the dma_mm2s_intr_in_value Input Port.
 ap_uint<1> dma_s2mm_intr_in_value; // Used to Read the Last Value of the dma_s2mm_intr_in_value Input Port.
 
-int mm2s_pages_counter = 0; // Used to Count the Number of Tranferred Pages for the MM2S Channel.
-int s2mm_pages_counter = 0; // Used to Count the Number of Tranferred Pages for the S2MM Channel.
+struct sg_channel mm2s_channel; // The Transfer State of the MM2S Channel.
+struct sg_channel s2mm_channel; // The Transfer State of the S2MM Channel.
 
-int mm2s_pages_number; // The Number of Pages to Transfer for the MM2S Channel.
-int s2mm_pages_number; // The Number of Pages to Transfer for the S2MM Channel.
-int mm2s_remaining_bytes; // Used to Count the Remaining Bytes of the MM2S Transfer.
-int s2mm_remaining_bytes; // Used to Count the Remaining Bytes of the S2MM Transfer.
+struct sg_transfer mm2s_staged; // The Next Transfer of the MM2S Channel.
+struct sg_transfer s2mm_staged; // The Next Transfer of the S2MM Channel.
 
-ap_uint<32> current_transfer_size;
+unsigned int window_size; // The Size of the AXI BARs.
 
-int both_done = 0; // Flag to Know When Both Channels (MM2S/S2MM) are Done.
+int mm2s_busy = 0; // Flag to Know if the MM2S Channel Has a Transfer in Progress.
+int s2mm_busy = 0; // Flag to Know if the S2MM Channel Has a Transfer in Progress.
 
+int mm2s_staged_valid = 0; // Flag to Know if the mm2s_staged Holds a Transfer that has not Started.
+int s2mm_staged_valid = 0; // Flag to Know if the s2mm_staged Holds a Transfer that has not Started.
 
+struct sg_ring mm2s_ring; // The Descriptor Ring of the MM2S Channel.
+struct sg_ring s2mm_ring; // The Descriptor Ring of the S2MM Channel.
 
-//Divide the Size of the Data to Transfer by the Page Size to Get the Number of Pages to Transfer over the MM2S and S2mm Channels.
-mm2s_pages_number = requested_data_size / page_size;
-s2mm_pages_number = requested_data_size / page_size;
+int ring_error = 0; // Flag to Know if any of the Channels Reported an Error in the Descriptor Ring Mode.
 
 
-/*
- * If the Value of the MM2S Pages Number Multiplied by the Page Size is Less than the Initial Data Size
- * then there is One More Page with Less Data than the Page Size.
- *
- * So, Increment mm2s_pages_number Variable by 1.
- */
-if((mm2s_pages_number * page_size) < requested_data_size)
+
+//The AXI BARs are as Large as a Page if the axi_bar_size is not Set.
+if(axi_bar_size != 0)
 {
-	mm2s_pages_number = mm2s_pages_number + 1;
+	window_size = axi_bar_size;
+}
+else
+{
+	window_size = page_size;
 }
 
+mm2s_channel.extent_address = 0;
+mm2s_channel.extent_bytes = 0;
+mm2s_channel.extent_index = 0;
+mm2s_channel.remaining_bytes = requested_data_size;
+mm2s_channel.translated = 0;
 
-//Initialize the Remaining Bytes for the MM2S Channel to be Equal to the Data Transfer Size.
-mm2s_remaining_bytes = requested_data_size;
-
+s2mm_channel.extent_address = 0;
+s2mm_channel.extent_bytes = 0;
+s2mm_channel.extent_index = 0;
+s2mm_channel.translated = 0;
 
-/*
- * If the Value of the S2MM Pages Number Multiplied by the Page Size is Less than the Initial Data Size
- * then there is One More Page with Less Data than the Page Size.
- *
- * So, Increment s2mm_pages_number Variable by 1.
- */
-if((s2mm_pages_number * page_size) < requested_data_size)
+//The S2MM Channel Transfers the requested_s2mm_data_size if Set, Otherwise as many Bytes as the MM2S Channel.
+if(requested_s2mm_data_size != 0)
+{
+	s2mm_channel.remaining_bytes = requested_s2mm_data_size;
+}
+else
 {
-	s2mm_pages_number = s2mm_pages_number + 1;
+	s2mm_channel.remaining_bytes = requested_data_size;
 }
 
 
-//Initialize the Remaining Bytes for the S2MM Channel to be Equal to the Data Transfer Size.
-s2mm_remaining_bytes = requested_data_size;
+//The Descriptor Rings are Linked before the Channels Start since the Current Descriptor Pointer Registers Can only be Written while the Channels are Halted.
+if(descriptor_ring_address != 0)
+{
+	mm2s_ring.base_address = descriptor_ring_address;
+	s2mm_ring.base_address = descriptor_ring_address + (SG_RING_DESCRIPTORS * SG_RING_DESCRIPTOR_SIZE);
+
+	ring_start(cfg, dma_device_address, XAXIDMA_TX_OFFSET, &mm2s_ring);
+	ring_start(cfg, dma_device_address, XAXIDMA_RX_OFFSET, &s2mm_ring);
+}
 
 
 
@@ -494,7 +953,10 @@ memcpy(&data_register, (const ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA
 //NOTE that IOC Stands for Interrupt On Complete.
 data_register = data_register | (XAXIDMA_IRQ_ERROR_MASK | XAXIDMA_IRQ_IOC_MASK | XAXIDMA_IRQ_DELAY_MASK);
 
-//Write the new Value Back to the Control Register of the DMA to Enable the MM2S Interrupts.
+//Set the Run/Stop Bit Once for all the Transfers of the Image so that each Transfer only Needs its Address and Length Registers.
+data_register = data_register | XAXIDMA_CR_RUNSTOP_MASK;
+
+//Write the new Value Back to the Control Register of the DMA to Enable the MM2S Interrupts and Start the MM2S Channel.
 memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_TX_OFFSET + XAXIDMA_CR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
 
 
@@ -512,79 +974,125 @@ memcpy(&data_register, (const ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA
 //NOTE that IOC Stands for Interrupt On Complete.
 data_register = data_register | (XAXIDMA_IRQ_ERROR_MASK | XAXIDMA_IRQ_IOC_MASK | XAXIDMA_IRQ_DELAY_MASK);
 
-//Write the new Value Back to the Control Register of the DMA to Enable the S2MM Interrupts.
+//Set the Run/Stop Bit Once for all the Transfers of the Image so that each Transfer only Needs its Address and Length Registers.
+data_register = data_register | XAXIDMA_CR_RUNSTOP_MASK;
+
+//Write the new Value Back to the Control Register of the DMA to Enable the S2MM Interrupts and Start the S2MM Channel.
 memcpy((ap_uint<32> *)(cfg + (dma_device_address + XAXIDMA_RX_OFFSET + XAXIDMA_CR_OFFSET) / 4), &data_register, sizeof(ap_uint<32>));
 
 
 /*
- * If the Value of the Remaining Bytes is Larger that a Page Size then we Can Set the DMA to Transfer a whole Page over the MM2S Channel.
+ * --------------------
+ * Descriptor Ring Mode
+ * --------------------
  */
-if(mm2s_remaining_bytes >= page_size)
-{
-	mm2s_data_size = page_size;
-}
 
-/*
- * If the Value of the Remaining Bytes is Less that a Page Size then we Can Set the DMA to Transfer the Remaining Bytes over the MM2S Channel.
- */
-if((mm2s_remaining_bytes > 0) && (mm2s_remaining_bytes < page_size))
+if(descriptor_ring_address != 0)
 {
-	mm2s_data_size = mm2s_remaining_bytes;
-}
+	//Loop for as Long as any of the MM2S and S2MM Channels Has Bytes Left or Descriptors that are not Completed.
+	while(mm2s_channel.remaining_bytes > 0 || mm2s_staged_valid == 1 || mm2s_ring.in_flight > 0 || s2mm_channel.remaining_bytes > 0 || s2mm_staged_valid == 1 || s2mm_ring.in_flight > 0)
+	{
+		//Give the DMA as many Transfers as the Free Descriptors of each Ring.
+		//Each MM2S Transfer is a Whole Packet while the S2MM Packets are Delimited by the TLAST of the Sobel Filter.
+		ring_fill(cfg, dma_device_address, XAXIDMA_TX_OFFSET, axi_bar_src_address, axi_bar_src_cfg_address, mm2s_sgl_address, page_size, window_size, window_size, XAXIDMA_BD_CTRL_TXSOF_MASK | XAXIDMA_BD_CTRL_TXEOF_MASK, &mm2s_channel, &mm2s_ring, &mm2s_staged, &mm2s_staged_valid);
+		ring_fill(cfg, dma_device_address, XAXIDMA_RX_OFFSET, axi_bar_dst_address, axi_bar_dst_cfg_address, s2mm_sgl_address, page_size, window_size, page_size, 0, &s2mm_channel, &s2mm_ring, &s2mm_staged, &s2mm_staged_valid);
 
-current_transfer_size = mm2s_data_size;
+		//Read the Current State of the mm2s_intr_in Input.
+		dma_mm2s_intr_in_value = *mm2s_intr_in;
 
-//Start a DMA Page Transfer over the MM2S Channel
-//The Transfer Can be of Size Equal to a whole Page Size or Just the Remaining Bytes According to the current_transfer_size Variable.
-serve_mm2s_transfer(cfg,
-		 	 	 	dma_device_address,
-					requested_data_size,
-					mm2s_sgl_address,
-					axi_bar_src_address,
-					axi_bar_src_cfg_address,
-					0,
-					current_transfer_size);
+		//Read the Current State of the s2mm_intr_in Input.
+		dma_s2mm_intr_in_value = *s2mm_intr_in;
 
-//Decrement the MM2S Channel's Remaining Bytes According to the mm2s_data_size Variable in order to Know Hom Many Bytes are left to be Transferred.
-mm2s_remaining_bytes = mm2s_remaining_bytes - mm2s_data_size;
+		//Clear the Interrupt of the MM2S Channel and Release the Descriptors that the DMA Completed.
+		if(dma_mm2s_intr_in_value == 1)
+		{
+			if((serve_mm2s_interrupt(cfg, dma_device_address) & XAXIDMA_IRQ_ERROR_MASK) != 0)
+			{
+				ring_error = 1;
+			}
 
+			ring_complete(cfg, &mm2s_ring);
+		}
 
-/*
- * If the Value of the Remaining Bytes is Larger that a Page Size then we Can Set the DMA to Transfer a whole Page over the S2MM Channel.
- */
-if(s2mm_remaining_bytes >= page_size)
-{
-	s2mm_data_size = page_size;
+		//Clear the Interrupt of the S2MM Channel and Release the Descriptors that the DMA Completed.
+		if(dma_s2mm_intr_in_value == 1)
+		{
+			if((serve_s2mm_interrupt(cfg, dma_device_address) & XAXIDMA_IRQ_ERROR_MASK) != 0)
+			{
+				ring_error = 1;
+			}
+
+			ring_complete(cfg, &s2mm_ring);
+		}
+
+		//A Descriptor Error Halts the DMA with Descriptors that will Never Complete so the Image is Abandoned.
+		if(ring_error == 1)
+		{
+			break;
+		}
+	}
+
+	if(ring_error == 1)
+	{
+		ring_reset(cfg, dma_device_address);
+	}
+	else
+	{
+		ring_stop(cfg, dma_device_address, XAXIDMA_TX_OFFSET);
+		ring_stop(cfg, dma_device_address, XAXIDMA_RX_OFFSET);
+	}
+
+	//Reset the Variables.
+	dma_mm2s_intr_in_value = 0;
+	dma_s2mm_intr_in_value = 0;
+
+	return (ring_error == 1) ? 0 : 1;
 }
 
-/*
- * If the Value of the Remaining Bytes is Less that a Page Size then we Can Set the DMA to Transfer the Remaining Bytes over the S2MM Channel.
- */
-if((s2mm_remaining_bytes > 0) && (s2mm_remaining_bytes < page_size))
+
+//Start the First Transfer over the MM2S Channel.
+if(mm2s_channel.remaining_bytes > 0)
 {
-	s2mm_data_size = s2mm_remaining_bytes;
+	next_transfer(cfg, mm2s_sgl_address, page_size, window_size, window_size, &mm2s_channel, &mm2s_staged);
+
+	serve_mm2s_transfer(cfg, dma_device_address, axi_bar_src_address, axi_bar_src_cfg_address, mm2s_staged.window_address, mm2s_staged.window_offset, mm2s_staged.transfer_size, mm2s_staged.window_changed);
+
+	mm2s_busy = 1;
 }
 
-current_transfer_size = s2mm_data_size;
+//Start the First Transfer over the S2MM Channel.
+if(s2mm_channel.remaining_bytes > 0)
+{
+	next_transfer(cfg, s2mm_sgl_address, page_size, window_size, page_size, &s2mm_channel, &s2mm_staged);
 
-//Start a DMA Page Transfer over the S2MM Channel
-//The Transfer Can be of Size Equal to a whole Page Size or Just the Remaining Bytes According to the current_transfer_size Variable.
-serve_s2mm_transfer(cfg,
-		 	 	 	dma_device_address,
-					requested_data_size,
-					s2mm_sgl_address,
-					axi_bar_dst_address,
-					axi_bar_dst_cfg_address,
-					0,
-					current_transfer_size);
+	serve_s2mm_transfer(cfg, dma_device_address, axi_bar_dst_address, axi_bar_dst_cfg_address, s2mm_staged.window_address, s2mm_staged.window_offset, s2mm_staged.transfer_size, s2mm_staged.window_changed);
 
-//Decrement the S2MM Channel's Remaining Bytes According to the s2mm_data_size Variable in order to Know Hom Many Bytes are left to be Transferred.
-s2mm_remaining_bytes = s2mm_remaining_bytes - s2mm_data_size;
+	s2mm_busy = 1;
+}
 
 
-//Start Looping for as Long as the Rest of the Pages for the MM2S and S2MM Channels are Being Transferred.
-while(both_done < 2)
+//Start Looping for as Long as any of the MM2S and S2MM Channels Has a Transfer in Progress.
+while(mm2s_busy == 1 || s2mm_busy == 1)
 {
+	/*
+	 * Stage the Next Transfer of each Channel while its Current Transfer is in Flight.
+	 * Reading the Next Extent from the Scatter/Gather List and Calculating the Window are, therefore, Overlapped with the Transfer
+	 * and the Completion of a Transfer is Followed Immediately by the Register Writes of the Staged Transfer.
+	 */
+	if(mm2s_staged_valid == 0 && mm2s_channel.remaining_bytes > 0)
+	{
+		next_transfer(cfg, mm2s_sgl_address, page_size, window_size, window_size, &mm2s_channel, &mm2s_staged);
+
+		mm2s_staged_valid = 1;
+	}
+
+	if(s2mm_staged_valid == 0 && s2mm_channel.remaining_bytes > 0)
+	{
+		next_transfer(cfg, s2mm_sgl_address, page_size, window_size, page_size, &s2mm_channel, &s2mm_staged);
+
+		s2mm_staged_valid = 1;
+	}
+
 	//Read the Current State of the mm2s_intr_in Input.
 	dma_mm2s_intr_in_value = *mm2s_intr_in;
 
@@ -592,124 +1100,43 @@ while(both_done < 2)
 	dma_s2mm_intr_in_value = *s2mm_intr_in;
 
 	/*
-	 * If we Have an Interrupt from the MM2S Channel than we Should Clear the Interrupt and Start the Next Page Transfer.
+	 * If we Have an Interrupt from the MM2S Channel than we Should Clear the Interrupt and Start the Staged Transfer.
 	 */
 	if(dma_mm2s_intr_in_value == 1)
 	{
 		//Acknowledge the Triggered Interrupt of the DMA MM2S Channel.
 		serve_mm2s_interrupt(cfg, dma_device_address);
 
-		//If the MM2S Pages Counter of the Current Page Has Not Reached the Total Number of Pages then Proceed to Start the Next Page Transfer.
-		if(mm2s_pages_counter < (mm2s_pages_number - 1))
-		{
-			/*
-			 * If the Value of the Remaining Bytes is Larger that a Page Size then we Can Set the DMA to Transfer a whole Page over the MM2S Channel.
-			 */
-			if(mm2s_remaining_bytes >= page_size)
-			{
-				mm2s_data_size = page_size;
-			}
-
-			/*
-			 * If the Value of the Remaining Bytes is Less that a Page Size then we Can Set the DMA to Transfer the Remaining Bytes over the MM2S Channel.
-			 */
-			if((mm2s_remaining_bytes > 0) && (mm2s_remaining_bytes < page_size))
-			{
-				mm2s_data_size = mm2s_remaining_bytes;
-			}
+		mm2s_busy = 0;
 
-			current_transfer_size = mm2s_data_size;
-
-			//Start a DMA Page Transfer over the MM2S Channel According to the current_transfer_size Variable.
-			serve_mm2s_transfer(cfg,
-								 dma_device_address,
-								 requested_data_size,
-								 mm2s_sgl_address,
-								 axi_bar_src_address,
-								 axi_bar_src_cfg_address,
-								 mm2s_pages_counter + 1,
-								 current_transfer_size);
+		//If there is a Staged Transfer then Start it.
+		if(mm2s_staged_valid == 1)
+		{
+			serve_mm2s_transfer(cfg, dma_device_address, axi_bar_src_address, axi_bar_src_cfg_address, mm2s_staged.window_address, mm2s_staged.window_offset, mm2s_staged.transfer_size, mm2s_staged.window_changed);
 
-			//Decrement the MM2S Channel's Remaining Bytes According to the mm2s_data_size Variable in order to Know Hom Many Bytes are left to be Transferred.
-			mm2s_remaining_bytes = mm2s_remaining_bytes - mm2s_data_size;
+			mm2s_busy = 1;
+			mm2s_staged_valid = 0;
 		}
-
-		//Increment the MM2S Pages Counter to Keep Track of the Remaining MM2S Pages to Transfer.
-		mm2s_pages_counter++;
-
 	}
 
 	/*
-	 * If we Have an Interrupt from the S2MM Channel than we Should Clear the Interrupt and Start the Next Page Transfer.
+	 * If we Have an Interrupt from the S2MM Channel than we Should Clear the Interrupt and Start the Staged Transfer.
 	 */
 	if(dma_s2mm_intr_in_value == 1)
 	{
 		//Acknowledge the Triggered Interrupt of the DMA S2MM Channel.
 		serve_s2mm_interrupt(cfg, dma_device_address);
 
-		//If the S2MM Pages Counter of the Current Page Has Not Reached the Total Number of Pages then Proceed to Start the Next Page Transfer.
-		if(s2mm_pages_counter < (s2mm_pages_number - 1))
-		{
-			/*
-			 * If the Value of the Remaining Bytes is Larger that a Page Size then we Can Set the DMA to Transfer a whole Page over the S2MM Channel.
-			 */
-			if(s2mm_remaining_bytes >= page_size)
-			{
-				s2mm_data_size = page_size;
-			}
+		s2mm_busy = 0;
 
-			/*
-			 * If the Value of the Remaining Bytes is Less that a Page Size then we Can Set the DMA to Transfer the Remaining Bytes over the S2MM Channel.
-			 */
-			if((s2mm_remaining_bytes > 0) && (s2mm_remaining_bytes < page_size))
-			{
-				s2mm_data_size = s2mm_remaining_bytes;
-			}
-
-			current_transfer_size = s2mm_data_size;
-
-			//Start a DMA Page Transfer over the S2MM Channel According to the current_transfer_size Variable.
-			serve_s2mm_transfer(cfg,
-								 dma_device_address,
-								 requested_data_size,
-								 s2mm_sgl_address,
-								 axi_bar_dst_address,
-								 axi_bar_dst_cfg_address,
-								 s2mm_pages_counter + 1,
-								 current_transfer_size);
-
-			//Decrement the S2MM Channel's Remaining Bytes According to the s2mm_data_size Variable in order to Know Hom Many Bytes are left to be Transferred.
-			s2mm_remaining_bytes = s2mm_remaining_bytes - s2mm_data_size;
+		//If there is a Staged Transfer then Start it.
+		if(s2mm_staged_valid == 1)
+		{
+			serve_s2mm_transfer(cfg, dma_device_address, axi_bar_dst_address, axi_bar_dst_cfg_address, s2mm_staged.window_address, s2mm_staged.window_offset, s2mm_staged.transfer_size, s2mm_staged.window_changed);
 
+			s2mm_busy = 1;
+			s2mm_staged_valid = 0;
 		}
-
-		//Increment the S2MM Pages Counter to Keep Track of the Remaining S2MM Pages to Transfer.
-		s2mm_pages_counter++;
-
-	}
-
-	//If the MM2S Pages Counter Has Reached the Total Number of Pages then the MM2S Channel Has Finished the Data Transfer.
-	if(mm2s_pages_counter == (mm2s_pages_number))
-	{
-		//Increment the mm2s_pages_counter Variable so that will not Enter the Current if Condition Again.
-		mm2s_pages_counter++;
-
-		//Increment the both_done Variable on Behalf of the MM2S Channel.
-		//The both_done Variable will ONLY be Incremented Once on Behalf of the MM2S Channel because we will not Enter this if Condition Again.
-		//When the S2MM Channel, also, Increments the both_done Variable the Data Transfer is Completed (both_done =2).
-		both_done++;
-	}
-
-	//If the S2MM Pages Counter Has Reached the Total Number of Pages then the S2MM Channel Has Finished the Data Transfer.
-	if(s2mm_pages_counter == (s2mm_pages_number))
-	{
-		//Increment the s2mm_pages_counter Variable so that will not Enter the Current if Condition Again.
-		s2mm_pages_counter++;
-
-		//Increment the both_done Variable on Behalf of the S2MM Channel.
-		//The both_done Variable will ONLY be Incremented Once on Behalf of the S2MM Channel because we will not Enter this if Condition Again.
-		//When the MM2S Channel, also, Increments the both_done Variable the Data Transfer is Completed (both_done =2).
-		both_done++;
 	}
 
 }
@@ -717,7 +1144,6 @@ while(both_done < 2)
 //Reset the Variables.
 dma_mm2s_intr_in_value = 0;
 dma_s2mm_intr_in_value = 0;
-both_done = 0;
 
 return 1;
 
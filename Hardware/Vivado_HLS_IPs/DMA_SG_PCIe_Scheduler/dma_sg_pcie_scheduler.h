@@ -57,6 +57,58 @@
 #define DMA_ACCEL_TIME_END_U_OFFSET 76
 
 
+/*
+ * Each 64 Bit Entry of the Source and Destination Scatter/Gather Lists is an Extent of Physically Contiguous Pages.
+ * The Upper Bits Hold the Page Aligned Physical Address of the First Page of the Extent and the SG_EXTENT_PAGES_MASK Bits
+ * Hold the Number of Pages that Follow the First Page.
+ * A List of Single Page Addresses is, therefore, Read as a List of Single Page Extents.
+ */
+#define SG_EXTENT_PAGES_MASK 0xFFF
+
+/*
+ * The Transfer State of each DMA Channel while it Walks its Scatter/Gather List (See the next_transfer() Function).
+ */
+struct sg_channel
+{
+	ap_uint<64> extent_address; // The Physical Address of the Next Byte of the Current Extent.
+	unsigned int extent_bytes; // The Bytes that are Left in the Current Extent.
+	unsigned int extent_index; // The Index of the Next Extent in the Scatter/Gather List.
+	unsigned int remaining_bytes; // The Bytes that are Left to Transfer over the Channel.
+	ap_uint<64> translated_window; // The Physical Address that the AXI BAR of the Channel Currently Translates.
+	ap_uint<1> translated; // Set when the translated_window Holds a Value that was Written to the AXI BAR.
+};
+
+/*
+ * A Transfer that next_transfer() Has Calculated for a DMA Channel.
+ * The Top Function Stages the Next Transfer of each Channel while the Current Transfer is in Flight so only the Register Writes Remain on Completion.
+ */
+struct sg_transfer
+{
+	ap_uint<64> window_address; // The Physical Address where the Window of the AXI BAR Starts.
+	unsigned int window_offset; // The Offset of the Transfer inside the Window.
+	ap_uint<32> transfer_size; // The Bytes of the Transfer.
+	ap_uint<1> window_changed; // Set when the AXI BAR Has to be Set with the window_address before the Transfer.
+};
+
+/*
+ * The Descriptor Ring Mode of the Core (See the descriptor_ring_address Register) Keeps a Ring of SG_RING_DESCRIPTORS Descriptors for each Channel
+ * of the DMA when the DMA Includes its Scatter/Gather Engine.
+ * The DMA Requires its Descriptors to be Aligned to 16 Words so each Descriptor Occupies SG_RING_DESCRIPTOR_SIZE Bytes.
+ */
+#define SG_RING_DESCRIPTORS 64
+#define SG_RING_DESCRIPTOR_SIZE 64
+
+/*
+ * The State of the Descriptor Ring of a DMA Channel.
+ */
+struct sg_ring
+{
+	unsigned int base_address; // The Address of the First Descriptor of the Ring.
+	unsigned int head; // The Index of the Oldest Descriptor that the DMA has not Completed.
+	unsigned int tail; // The Index of the Next Free Descriptor.
+	unsigned int in_flight; // The Number of Descriptors that are Given to the DMA and are not Completed.
+};
+
 struct image_info
 {
 	ap_uint<32> rows;
@@ -51,8 +51,8 @@ ALL TIMES.
 #define WHITE 255
 
 // Maximum image size 
-#define MAX_ROWS 1080
-#define MAX_COLS 1920
+#define MAX_ROWS 2160
+#define MAX_COLS 3840
 
 //File Information Header
 typedef struct{
@@ -31,10 +31,10 @@
 
 #define PAGE_SIZE 4096
 
-int is_packet_complete(int *count, int size) {
+int is_packet_complete(int *count, int size, int beat_bytes) {
 
-	//Increase by 4 Bytes.
-	*count += 4;
+	//Increase by the Number of Bytes of the Transmitted Beat (4 Bytes per Lane).
+	*count += beat_bytes;
 
 	//If the Current Count Value is Equal to the Packet Size then Return 1.
 	if (*count == size)
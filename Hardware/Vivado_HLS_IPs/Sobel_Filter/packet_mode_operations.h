@@ -30,6 +30,6 @@
 #ifndef _PACKET_MODE_OPERATIONS_H_
 #define _PACKET_MODE_OPERATIONS_H_
 
-int is_packet_complete(int *count, int size);
+int is_packet_complete(int *count, int size, int beat_bytes);
 
 #endif
@@ -1,17 +1,57 @@
 open_project Sobel_Filter
 
-set_top sobel_filter
+#The Number of Pixels per Beat of the AXI Stream Interfaces (1, 2 or 4).
+#The Block Designs Use the Single Lane Core so the Multi Lane Cores Require Wider AXI Stream and DMA Interfaces.
+set lanes 1
 
-add_files sobel.cpp
-add_files sobel_operations.cpp
+#If 1, the Fused Blur/Sobel/Non-Maximum Suppression Core (sobel_pipeline) is Generated instead (Single Lane Only).
+#It Has the Registers of the sobel_filter Plus the Pipeline Stages Register so it Can Replace it in the Block Designs.
+set pipeline 0
+
+if {$pipeline == 1} {
+	set_top sobel_pipeline
+} elseif {$lanes == 4} {
+	set_top sobel_filter_x4
+} elseif {$lanes == 2} {
+	set_top sobel_filter_x2
+} else {
+	set_top sobel_filter
+}
+
+#The Line Buffer Engine Parameters (See sobel.h).
+#More Sectors Process more Pixels in Parallel at the Cost of more BRAMs.
+set sectors 16
+set max_width 3840
+set kernel_size 3
+
+set engine_flags "-DSECTORS=$sectors -DMAX_WIDTH=$max_width -DKERNEL_SIZE=$kernel_size"
+
+add_files sobel.cpp -cflags $engine_flags
+add_files sobel_operations.cpp -cflags $engine_flags
+add_files sobel_pipeline.cpp -cflags $engine_flags
 add_files packet_mode_operations.cpp
 
+#The C Simulation Testbench that Compares the sobel_filter with the Golden Model on the Images of the Application (See sobel_tb.cpp).
+add_files -tb sobel_tb.cpp -cflags $engine_flags
+add_files -tb sobel_golden.cpp
+
 open_solution "solution1"
 
 #The Part Refers to the Xilinx Virtex 7 VC707 FPGA Development Board
 set_part {xc7vx485tffg1761-2}
 create_clock -period 10 -name default
 
+#If 1, the C Simulation Runs before the Synthesis and the Script Stops if any Image does not Match the Golden Model.
+set csim 0
+
+if {$csim == 1} {
+	set images [list]
+	foreach image {qvga.bmp vga.bmp hd.bmp} {
+		lappend images [file normalize ../../../Software/Linux_App_Driver/Results/$image]
+	}
+	csim_design -argv [join $images " "]
+}
+
 csynth_design
 
 export_design -format ip_catalog -display_name "Sobel Filter" -version "5.8"
@@ -31,6 +31,325 @@
 #include "sobel_operations.h"
 #include "packet_mode_operations.h"
 
+/*
+ * sobel_filter_lanes()
+ *
+ * The Common Functionality of the sobel_filter(), sobel_filter_x2() and sobel_filter_x4() Cores.
+ * The LANES is the Number of Pixels that are Carried in each Beat of the AXI Stream Interfaces.
+ *
+ * The Bytes of the Received and Sent Image are Identical for any Number of Lanes.
+ * The Pixels of a Row do not Have to Start at a New Beat so the Image is Transferred as a Contiguous Byte Stream of 4 * LANES Bytes per Beat.
+ * If the Image Bytes are not an Integer Multiple of the Beat Size the Last Beat is Sent with only the Strobe Bits of the Valid Bytes Set.
+ *
+ * The ENGINE Defines the Number and the Size of the Sector Buffers and the Size of the Neighborhood (Kernel) of each Pixel (See the LINE_BUFFER_ENGINE).
+ *
+ * NOTE that the Image Width Should be at Least ENGINE::SECTOR_COUNT * LANES Pixels so that every Sector Buffer Gets Pixels.
+ */
+template<class ENGINE, int LANES>
+int sobel_filter_lanes(typename AXI_LANES<LANES>::BEAT *STREAM_IN,
+                       typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+                       int rows,
+                       int cols,
+                       int packet_mode_en,
+                       int packet_size,
+                       int packed_output_en,
+                       int input_format,
+                       int filter_mode,
+                       COEFFICIENTS x_coefficients,
+                       COEFFICIENTS y_coefficients,
+                       int coefficient_shift,
+                       int threshold_low,
+                       int threshold_high,
+                       int output_format)
+{
+	#pragma HLS INLINE
+
+	int bytes_count; //Count the Number of Tranferred Bytes.
+	int temp; //Used to Know where the Newest Received Row Should be Temporalily Located in the Input Sector Buffers.
+
+	/*
+	 * Used to Know where each of the Rows to Process is Located in the Input Sector Buffers.
+	 * The line_index[0] is the Line of the First (Oldest) Received Row and the line_index[ENGINE::WINDOW_SIZE - 1] is the Line of the Last Received Row.
+	 */
+	int  line_index[ENGINE::WINDOW_SIZE];
+	#pragma HLS ARRAY_PARTITION variable=line_index dim=1 complete
+
+	/*
+	 * The Number of Iterations Required to Receive or Send each Sector of a Row.
+	 * The sector_iter is an Array with as many Fields as the Number of Sectors.
+	 * The sector_iter Array is Configured to be Completely Partitioned according to the #pragma HLS ARRAY_PARTITION.
+	 */
+	int  sector_iter[ENGINE::SECTOR_COUNT];
+	#pragma HLS ARRAY_PARTITION variable=sector_iter dim=1 complete
+
+	int  sector_size; //The Number of Columns that each Sector Should Store.
+	int  sector_cols; //The Number of Columns of the Widest Sector which Defines the Iterations of the Sobel Operations.
+	int  input_padding; //The Number of Padding Bytes at the End of each Received Row.
+	int  output_padding; //The Number of Padding Bytes at the End of each Sent Row.
+	int  remaining_pixels; //If the Number of Columns is not an Integer Multiple of the Number of Sectors then we Have Remaining Pixels that Should be Distributed in all the Sectors.
+
+	const RGB zero_pixel = {0, 0, 0}; //This is a Dark Pixel Used to Set the First and Last Row and all the First and Last Columns of the Image.
+
+	int in_index; //The Index of the Next Beat to Receive through the AXI Stream In Interface.
+	typename AXI_LANES<LANES>::HOLD held_bytes; //The Received Bytes that are not Used yet.
+	int held_count; //The Number of Valid Bytes in the held_bytes.
+
+	FILTER_CONFIG filter; //The Filter Registers that are Given to each Processing Unit.
+
+	int out_index; //The Index of the Next Beat to Send through the AXI Stream Out Interface.
+	typename AXI_LANES<LANES>::HOLD out_bytes; //The Processed Bytes that are not Sent yet.
+	int out_count; //The Number of Valid Bytes in the out_bytes.
+
+	/*
+	 * Declare the Input Sector Buffers of Type ENGINE::INPUT_BUFFER.
+	 * The Array is Completely Partitioned so that each Sector Buffer is a Separate Dual Port BRAM according to the #pragma HLS RESOURCE.
+	 * The Columns of each Buffer (Third Dimension after the Partitioning of the Lines) are Cyclically Partitioned
+	 * so that the LANES Neighbor Pixels that are Accessed in each Cycle are in Different Memories.
+	 *
+	 * These Buffers are Used to Receive the Image Rows before being Processed.
+	 */
+	typename ENGINE::INPUT_BUFFER LINE_BUFFER_SECTOR[ENGINE::SECTOR_COUNT];
+	#pragma HLS ARRAY_PARTITION variable=LINE_BUFFER_SECTOR complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=LINE_BUFFER_SECTOR cyclic factor=LANES dim=3
+	#pragma HLS RESOURCE variable=LINE_BUFFER_SECTOR core=RAM_2P_BRAM
+
+	/*
+	 * Declare the Output Sector Buffers of Type ENGINE::OUTPUT_BUFFER.
+	 * The Buffers are Partitioned the Same Way as the Input Sector Buffers.
+	 *
+	 * These Buffers are Used to Store the Image Rows after being Processed.
+	 */
+	typename ENGINE::OUTPUT_BUFFER OUTPUT_BUFFER_SECTOR[ENGINE::SECTOR_COUNT];
+	#pragma HLS ARRAY_PARTITION variable=OUTPUT_BUFFER_SECTOR complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=OUTPUT_BUFFER_SECTOR cyclic factor=LANES dim=3
+	#pragma HLS RESOURCE variable=OUTPUT_BUFFER_SECTOR core=RAM_2P_BRAM
+
+	/*
+	 * Set Initial Values.
+	 */
+	bytes_count = 0;
+	temp = 0;
+
+	in_index = 0;
+	held_bytes = 0;
+	held_count = 0;
+
+	out_index = 0;
+	out_bytes = 0;
+	out_count = 0;
+
+	//Unknown Filter Modes Fall Back to the Sobel Edge Detection.
+	filter.mode = ((filter_mode == FILTER_MODE_LINEAR) || (filter_mode == FILTER_MODE_GRADIENT)) ? filter_mode : FILTER_MODE_SOBEL;
+	filter.x_coefficients = x_coefficients;
+	filter.y_coefficients = y_coefficients;
+	filter.shift = coefficient_shift & 0x1F;
+	filter.threshold_low = threshold_low;
+	filter.threshold_high = threshold_high;
+
+	//Unknown Output Formats Fall Back to the Filtered Pixels.
+	filter.output_format = ((output_format == OUTPUT_FORMAT_GRADIENTS) || (output_format == OUTPUT_FORMAT_MAGNITUDE)) ? output_format : OUTPUT_FORMAT_PIXEL;
+
+	//The Gradients Need the Whole 32 Bit Word of each Pixel so they Cannot be Packed.
+	if (filter.output_format != OUTPUT_FORMAT_PIXEL)
+	{
+		packed_output_en = 0;
+	}
+
+
+	//Calculate the Number of Columns that Should be Stored to each Sector Buffer.
+	//NOTE that this is the Initial Sector Size that is Equal to All the Sector Buffers.
+	//NOTE also that the Sector Size is a Multiple of LANES so that each Sector Starts with a New Group of LANES Pixels.
+	sector_size = (int)(cols / (ENGINE::SECTOR_COUNT * LANES)) * LANES;
+
+	/*
+	 * Calculate any Remaining Bytes in Case the Number of Columns is not an Integer Multiple of the Number of Sector Buffers.
+	 *
+	 * For Example, for an Image of Width 524 Pixels we Have 524 Pixels / 16 Sectors = 32.75 Pixels which is Not an Integer Multiple of the 16 Sector Buffers.
+	 * For each Sector Buffer we Have a Sector Size of 32 Pixels so 32 Pixels * 16 Sectors = 512 which Leads to Have 12 Remaining Pixels from the Initial 524.
+	 *
+	 * As a Result each of the 16 Sector Buffers Initially Has a Sector Size of 32.
+	 * The Remaining Pixels Should be Distributed to the Sector Buffers so the First 12 Sector Buffers will Have a Sector Size with one More Pixel which Leads to 33 Pixels Sector Size.
+	 *
+	 * |Sector0  |Sector1  |Sector2  |Sector3  |Sector4  |Sector5  |Sector6  |Sector7  |Sector8  |Sector9  |Sector10  |Sector11  |Sector12  |Sector13  |Sector14  |Sector15|
+	 * |33       |33       |33       |33       |33       |33       |33       |33       |33       |33       |33        |33        |32        |32        |32        |32      |
+	 *
+	 * In the Multi Lane Cores the Remaining Pixels are Distributed in Groups of LANES Pixels and the Last Group which May Have Fewer than LANES Pixels is Given to the Last Sector Buffer.
+	 * For Example, for 4 Lanes and the Same Width the Sector Size is 32 and the 12 Remaining Pixels are Given as 4 Pixels to each of the First 3 Sector Buffers.
+	 */
+	remaining_pixels = cols - (sector_size * ENGINE::SECTOR_COUNT);
+
+	//Loop to Distribute the Remaining Bytes to the Sector Buffers.
+	for (int i = 0; i < ENGINE::SECTOR_COUNT; i++)
+	{
+	#pragma HLS PIPELINE II=1
+
+		//Set the Array Field of the Corresponding Sector Buffer with the Initial Sector Size.
+		sector_iter[i] = sector_size;
+
+		//Check if we still Have a Whole Group of Remaining Pixels
+		if (remaining_pixels >= LANES)
+		{
+			//Decrease the Number of Remaining Pixels.
+			remaining_pixels -= LANES;
+
+			//Increment by LANES the Sector Size of the Corresponding Sector Buffer
+			sector_iter[i] += LANES;
+		}
+	}
+
+	//Give the Last Group of Remaining Pixels (Fewer than LANES) to the Last Sector Buffer.
+	sector_iter[ENGINE::SECTOR_COUNT - 1] += remaining_pixels;
+
+	//The Sobel Operations Iterate over the Columns of the Widest Sector Buffer.
+	sector_cols = (sector_iter[0] > sector_iter[ENGINE::SECTOR_COUNT - 1]) ? sector_iter[0] : sector_iter[ENGINE::SECTOR_COUNT - 1];
+
+	//In the INPUT_FORMAT_BGR and INPUT_FORMAT_LUMA Formats each Received Row is Padded to a Multiple of 4 Bytes.
+	if (input_format == INPUT_FORMAT_LUMA)
+	{
+		input_padding = (4 - (cols % 4)) % 4;
+	}
+	else if (input_format == INPUT_FORMAT_BGR)
+	{
+		input_padding = (4 - ((cols * 3) % 4)) % 4;
+	}
+	else
+	{
+		input_padding = 0;
+	}
+
+	//In Packed Output Mode each Sent Row is Padded to a Multiple of 4 Bytes.
+	if (packed_output_en == 1)
+	{
+		output_padding = (4 - (cols % 4)) % 4;
+	}
+	else
+	{
+		output_padding = 0;
+	}
+
+	/*
+	 * The First ENGINE::HALO Lines/Rows of an Image Processed with Sobel Edge Detection are Always Filled with Zero Pixels.
+	 * So, Send the First Rows of Zero Pixels.
+	 */
+	send_1st_lines:
+	for (int row=0; row<ENGINE::HALO; row++)
+	{
+		send_zero_line<LANES>(STREAM_OUT, &out_index, &out_bytes, &out_count, cols, output_padding, packed_output_en, packet_mode_en, packet_size, &bytes_count);
+	}
+
+	/*
+	 * The Sobel Edge Detection Algorithm Requires ENGINE::WINDOW_SIZE (3) Rows in Order to Produce one Processed Row.
+	 * So, Pre-Fetch the First Rows.
+	 */
+	prefetch_lines:
+	for (int row=0; row<ENGINE::WINDOW_SIZE; row++)
+	{
+		//Receive a Row which is Distributed to the Input Sector Buffers.
+		receive_post_line<ENGINE, LANES>(STREAM_IN,
+		                                 LINE_BUFFER_SECTOR,
+		                                 temp,
+		                                 sector_iter,
+		                                 input_format,
+		                                 input_padding,
+		                                 &in_index,
+		                                 &held_bytes,
+		                                 &held_count
+		                                 );
+
+		//Calculate the Vertical Position where the Next Received Row Should be Stored in the Input Sector Buffers.
+		temp = (temp+ENGINE::WINDOW_SIZE)%ENGINE::LINES;
+	}
+
+	/*
+	 * Produce a Processed Row from the Pre-Fetched Rows.
+	 * Send the Processed Row and then Receive a New Row in Order to Produce again a Processed Row.
+	 *
+	 * Loop Until Receiving all the Rows of the Image.
+	 * The Last Processed Row is Produced after the Loop since there is no Next Row to Receive.
+	 */
+	proc_module:
+	for (int row=0; row<=rows-ENGINE::WINDOW_SIZE; row++)
+	{
+	#pragma HLS DEPENDENCE variable=LINE_BUFFER_SECTOR   array //false
+	#pragma HLS DEPENDENCE variable=OUTPUT_BUFFER_SECTOR array //false
+
+		//Calculate which Lines Should be Considered as the First, Second, ... and Last Line for Producing the Processed Row.
+		//The Newest Received Row is Stored in the Line Right Before the temp (See the Indexing Technique C Above).
+		for (int i=0; i<ENGINE::WINDOW_SIZE; i++)
+		{
+		#pragma HLS UNROLL
+			line_index[i] = (temp + ENGINE::WINDOW_SIZE - i) % ENGINE::LINES;
+		}
+
+		//Process the Rows that are Received in the Input Sector Buffers and Produce one Processed Row.
+		start_sobel_operations<ENGINE, LANES>(LINE_BUFFER_SECTOR,
+		                                      OUTPUT_BUFFER_SECTOR,
+		                                      sector_cols,
+		                                      line_index,
+		                                      filter
+		                                      );
+
+		//Set the First Pixels of the First Output Sector Buffer and the Last Pixels of the Last Output Sector Buffer to be Dark/Zero Pixels.
+		//NOTE these are Actually the First and Last Pixels of a Row.
+		for (int halo=0; halo<ENGINE::HALO; halo++)
+		{
+		#pragma HLS UNROLL
+			OUTPUT_BUFFER_SECTOR[0].insert(zero_pixel, 0, halo);
+			OUTPUT_BUFFER_SECTOR[ENGINE::SECTOR_COUNT - 1].insert(zero_pixel, 0, sector_iter[ENGINE::SECTOR_COUNT - 1] - 1 - halo);
+		}
+
+		//The Produced Row is Stored in the Output Sector Buffers.
+		//Send the Produced Row over the AXI Stream Out Interface.
+		send_line<ENGINE, LANES>(STREAM_OUT,
+		                         OUTPUT_BUFFER_SECTOR,
+		                         sector_iter,
+		                         packet_mode_en,
+		                         packet_size,
+		                         &bytes_count,
+		                         packed_output_en,
+		                         output_padding,
+		                         &out_index,
+		                         &out_bytes,
+		                         &out_count
+		                         );
+
+		//Receive the Next Row which is Distributed to the Input Sector Buffers.
+		if (row < rows-ENGINE::WINDOW_SIZE)
+		{
+			receive_post_line<ENGINE, LANES>(STREAM_IN,
+			                                 LINE_BUFFER_SECTOR,
+			                                 temp,
+			                                 sector_iter,
+			                                 input_format,
+			                                 input_padding,
+			                                 &in_index,
+			                                 &held_bytes,
+			                                 &held_count
+			                                 );
+
+			//Calculate where the Next Received Row Should be Stored in the Input Sector Buffers.
+			temp = (temp+ENGINE::WINDOW_SIZE)%ENGINE::LINES;
+		}
+	}
+
+	/*
+	 * The Last ENGINE::HALO Lines/Rows of an Image Processed with Sobel Edge Detection are Always Filled with Zero Pixels.
+	 * So, Send the Last Rows of Zero Pixels.
+	 */
+	send_last_lines:
+	for (int row=0; row<ENGINE::HALO; row++)
+	{
+		send_zero_line<LANES>(STREAM_OUT, &out_index, &out_bytes, &out_count, cols, output_padding, packed_output_en, packet_mode_en, packet_size, &bytes_count);
+	}
+
+	//Send the Last Beat of the Image with TLAST=1.
+	flush_output<LANES>(STREAM_OUT, &out_index, &out_bytes, &out_count);
+
+	bytes_count = 0; // Byte Counter
+
+	return 1;
+}
+
 /*
  * sobel_filter()
  *
@@ -68,7 +387,7 @@
  *
  * 01 --------> The AXI Stream Input/Slave Interface of the Core Used to Receive the Image Data.
  * 02 --------> The AXI Stream Output/Master Interface of the Core Used to Forward the Processed Image Data.
- * 03 to 06 --> Registers of the Core that are Accessed through the AXI Slave Lite Interface of the Core.
+ * 03 to 14 --> Registers of the Core that are Accessed through the AXI Slave Lite Interface of the Core.
  *
  *
  * IMPORTANT TECHNIQUES Used to Improve the Overall Performance:
@@ -77,6 +396,7 @@
  *   Instead, while it is being Received it is Equally Splitted and Distributed in 16 Sector Buffers.
  *   Each Sector Buffer has no Dependence with the Rest Sector Buffers so the 16 Pieces of the Image Row Can be Processed in Parallel.
  *   The HLS Tool Creates 16 Processing Units to Make Parallel Processing Possible.
+ *   The Number of Sector Buffers (16 by Default) and the Neighborhood Size are Parameters of the LINE_BUFFER_ENGINE that are Set at Synthesis.
  *
  *
  * B)Another Improvement Technique is the Usage of Four Line Sector Buffers which Allows
@@ -116,13 +436,28 @@
  *
  *   In order to Calculate the Next Indexing for each Row we Used the Formula Below:
  *   Index = (Index + 3) % 4
+ *
+ *
+ * D)Each Beat of the AXI Stream Interfaces Can Carry 1, 2 or 4 Pixels (Lanes).
+ *   The sobel_filter() is the Single Lane Core while the sobel_filter_x2() and sobel_filter_x4() Receive and Send 2 or 4 Pixels per Beat.
+ *   In the Multi Lane Cores each Sector Buffer Processes as many Pixels per Cycle as the Lanes so a Row is Processed in cols / (16 * Lanes) Cycles.
+ *   All the Cores Share the Same Registers and Produce the Same Image Bytes in the Destination Memory (See the sobel_filter_lanes()).
  */
 int sobel_filter(/*01*/AXI_PIXEL STREAM_IN[MAX_WIDTH],
                  /*02*/AXI_PIXEL STREAM_OUT[MAX_WIDTH],
                  /*03*/int rows,
                  /*04*/int cols,
                  /*05*/int packet_mode_en,
-                 /*06*/int packet_size
+                 /*06*/int packet_size,
+                 /*07*/int packed_output_en,
+                 /*08*/int input_format,
+                 /*09*/int filter_mode,
+                 /*10*/COEFFICIENTS x_coefficients,
+                 /*11*/COEFFICIENTS y_coefficients,
+                 /*12*/int coefficient_shift,
+                 /*13*/int threshold_low,
+                 /*14*/int threshold_high,
+                 /*15*/int output_format
                  )
 {
 	/*
@@ -156,485 +491,161 @@ int sobel_filter(/*01*/AXI_PIXEL STREAM_IN[MAX_WIDTH],
 	 * This Register is Accessed through the AXI Slave Lite Interface (S_AXI4_LITE) of the Core.
 	 */
 	#pragma HLS INTERFACE  s_axilite  port=packet_size     bundle=S_AXI4_LITE
-	#pragma HLS INTERFACE  s_axilite  port=return          bundle=S_AXI4_LITE
-
-	/*
-	 * Set the STREAM_OUT and STREAM_IN Interfaces of the Core to be AXI Stream Interfaces.
-	 * The Fifo Depth is Set to 1920 which is the Maximum Image Width that the Core Can Support to Process.
-	 */
-	#pragma HLS INTERFACE axis depth=1920 port=STREAM_IN
-	#pragma HLS INTERFACE axis depth=1920 port=STREAM_OUT
-
-	int bytes_count; //Count the Number of Tranferred Bytes.
-	int first; //Used to Know where the First Received Row is Located in the LINE4_SECTOR_BUFFER.
-	int second; //Used to Know where the Second Received Row is Located in the LINE4_SECTOR_BUFFER.
-	int last; //Used to Know where the Last Received Row is Located in the LINE4_SECTOR_BUFFER.
-	int temp; //Used to Know where the Newest Received Row Should be Temporalily Located in the LINE4_SECTOR_BUFFER.
 
 	/*
-	 * The Number of Iterations Required to Receive or Send each Sector of a Row.
-	 * The sector_iter is an Array with as many Fields as the Number of Sectors.
-	 * The sector_iter Array is Configured to be Completely Partitioned according to the #pragma HLS ARRAY_PARTITION.
-	 */
-	int  sector_iter[SECTORS];
-	#pragma HLS ARRAY_PARTITION variable=sector_iter dim=1 complete
-
-	int  sector_size; //The Number of Columns that each Sector Should Store.
-	int  remaining_pixels; //If the Number of Columns is not an Integer Multiple of the Number of Sectors then we Have Remaining Pixels that Should be Distributed in all the Sectors.
-
-	const RGB zero_pixel = {0, 0, 0}; //This is a Dark Pixel Used to Set the First and Last Row and all the First and Last Columns of the Image.
-
-	/*
-	 * Declare 16 Memory Buffers of Type LINE4_SECTOR_BUFFER.
-	 * Each Buffer is Set to be Dual Port BRAM according to the #pragma HLS RESOURCE.
-	 *
-	 * These Buffers are Used to Receive the Image Rows before being Processed.
+	 * The packed_output_en is a Register to Store a Value that Enables/Disables the Packed Output Mode.
+	 * The Processed Image is Grayscale so the Blue, Green and Red Bytes of each Output Pixel Carry the Same Edge Value.
+	 * When the Packed Output Mode is Enabled the Core Sends only the Edge Value of each Pixel and Packs 4 Pixels in each 32 Bit Beat
+	 * which Reduces the Output Data of the Core by 4.
+	 * Each Output Row is then Padded to (cols + 3) / 4 * 4 Bytes where the Padding Bytes are Zero.
+	 * This Register is Accessed through the AXI Slave Lite Interface (S_AXI4_LITE) of the Core.
 	 */
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR0;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR0 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR1;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR1 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR2;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR2 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR3;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR3 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR4;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR4 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR5;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR5 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR6;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR6 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR7;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR7 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR8;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR8 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR9;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR9 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR10;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR10 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR11;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR11 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR12;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR12 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR13;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR13 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR14;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR14 core=RAM_2P_BRAM
-	LINE4_SECTOR_BUFFER LINE4_BUFFER_SECTOR15;
-	#pragma HLS RESOURCE variable=LINE4_BUFFER_SECTOR15 core=RAM_2P_BRAM
+	#pragma HLS INTERFACE  s_axilite  port=packed_output_en bundle=S_AXI4_LITE
 
 	/*
-	 * Declare 16 Memory Buffers of Type LINE1_SECTOR_BUFFER.
-	 * Each Buffer is Set to be Dual Port BRAM according to the #pragma HLS RESOURCE.
-	 *
-	 * These Buffers are Used to Store the Image Rows after being Processed.
+	 * The input_format is a Register to Store the Format of the Received Image Data.
+	 * INPUT_FORMAT_BGRX (0) is the Default Format of one 32 Bit Beat per Pixel where the Fourth Byte is Padding.
+	 * INPUT_FORMAT_BGR (1) Removes the Padding Byte so 4 Pixels are Received in 3 Beats.
+	 * INPUT_FORMAT_LUMA (2) Receives the Luminance Values Computed by the Host so 4 Pixels are Received in a Single Beat.
+	 * In the Last Two Formats each Row is Padded to a Multiple of 4 Bytes.
+	 * This Register is Accessed through the AXI Slave Lite Interface (S_AXI4_LITE) of the Core.
 	 */
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR0;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR0 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR1;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR1 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR2;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR2 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR3;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR3 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR4;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR4 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR5;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR5 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR6;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR6 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR7;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR7 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR8;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR8 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR9;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR9 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR10;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR10 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR11;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR11 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR12;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR12 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR13;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR13 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR14;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR14 core=RAM_2P_BRAM
-	LINE1_SECTOR_BUFFER LINE1_BUFFER_SECTOR15;
-	#pragma HLS RESOURCE variable=LINE1_BUFFER_SECTOR15 core=RAM_2P_BRAM
+	#pragma HLS INTERFACE  s_axilite  port=input_format     bundle=S_AXI4_LITE
 
 	/*
-	 * Set Initial Values.
-	 */
-	bytes_count = 0;
-	first = 0;
-	second = 3;
-	last = 2;
-	temp = 0;
-
-
-	//Calculate the Number of Columns that Should be Stored to each Sector Buffer.
-	//NOTE that this is the Initial Sector Size that is Equal to All the Sector Buffers.
-	sector_size = (int)(cols / SECTORS);
-
-	/*
-	 * Calculate any Remaining Bytes in Case the Number of Columns is not an Integer Multiple of the Number of Sector Buffers.
-	 *
-	 * For Example, for an Image of Width 524 Pixels we Have 524 Pixels / 16 Sectors = 32.75 Pixels which is Not an Integer Multiple of the 16 Sector Buffers.
-	 * For each Sector Buffer we Have a Sector Size of 32 Pixels so 32 Pixels * 16 Sectors = 512 which Leads to Have 12 Remaining Pixels from the Initial 524.
+	 * The filter_mode is a Register to Select the Operation that is Applied to the Neighborhood of each Pixel.
+	 * FILTER_MODE_SOBEL (0) is the Default Sobel Edge Detection with the Fixed Coefficients and Thresholds so the Rest Filter Registers are not Used.
+	 * FILTER_MODE_LINEAR (1) Convolves the Image with the x_coefficients (e.g. Gaussian Blur, Box or Sharpen).
+	 * FILTER_MODE_GRADIENT (2) Detects Edges with the x_coefficients and y_coefficients (e.g. Scharr or Prewitt).
 	 *
-	 * As a Result each of the 16 Sector Buffers Initially Has a Sector Size of 32.
-	 * The Remaining Pixels Should be Distributed to the Sector Buffers so the First 12 Sector Buffers will Have a Sector Size with one More Pixel which Leads to 33 Pixels Sector Size.
+	 * The x_coefficients and y_coefficients are 200 Bit Registers (7 Words each) with the 5x5 Signed 8 Bit Coefficients of the Kernels (See the FILTER_TAPS).
+	 * The coefficient_shift is the Number of Bits that the Weighted Sum is Shifted Right to be Normalized.
+	 * The threshold_low and threshold_high Set the Results Below and Above them to 0 and 255 Respectively.
 	 *
-	 * |Sector0  |Sector1  |Sector2  |Sector3  |Sector4  |Sector5  |Sector6  |Sector7  |Sector8  |Sector9  |Sector10  |Sector11  |Sector12  |Sector13  |Sector14  |Sector15|
-	 * |33       |33       |33       |33       |33       |33       |33       |33       |33       |33       |33        |33        |32        |32        |32        |32      |
-	 *
-	 */
-	remaining_pixels = cols - (sector_size * SECTORS);
-
-	//Loop to Distribute the Remaining Bytes to the Sector Buffers.
-	for (int i = 0; i < SECTORS; i++)
-	{
-	#pragma HLS PIPELINE II=1
-
-		//Set the Array Field of the Corresponding Sector Buffer with the Initial Sector Size.
-		sector_iter[i] = sector_size;
-
-		//Check if we still Have Remaining Pixels
-		if (remaining_pixels > 0)
-		{
-			//Decrease the Number of Remaining Pixels.
-			remaining_pixels--;
-
-			//Increment by 1 the Sector Size of the Corresponding Sector Buffer
-			sector_iter[i] ++;
-		}
-	}
-
-	/*
-	 * The First Line/Row of an Image Processed with Sobel Edge Detection is Always Filled with Zero Pixels.
-	 * So, Send the First Row of Zero Pixels.
-	 */
-	send_1st_line:
-	for (int col=0; col<cols; col++)
-	{
-		#pragma HLS PIPELINE II=1
-
-		AXI_PIXEL output_pixel; //Declare a AXI_PIXEL that Represents the AXI Stream Output Interface.
-
-		output_pixel.strb = 0xF; //Set the Strobe of the AXI Stream Interface so that all 4 Transmitted Bytes are Valid.
-		output_pixel.user = 0x1;
-		output_pixel.tdest = 0x1;
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_en == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packket Size.
-			output_pixel.last = is_packet_complete(&bytes_count, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
-
-		//Set the Data to Transmit to Have Zero Value Since we Transmit Zero Pixels.
-		output_pixel.data = 0x0;
-
-		//Forward the Data along with the Rest Signals to the AXI Stream Output Interface.
-		STREAM_OUT[col] = output_pixel;
-	}
-
-	/*
-	 * The Sobel Edge Detection Algorithm Requires Three Rows in Order to Produce one Processed Row.
-	 * So, Pre-Fetch the First 3 Rows.
+	 * Unlike the rest Registers the Filter Registers are not Set by the Acceleration Schedulers.
+	 * They Keep their Values between the Runs of the Core and are Written by the Driver Directly before each Acceleration.
+	 * These Registers are Accessed through the AXI Slave Lite Interface (S_AXI4_LITE) of the Core.
 	 */
-	prefetch_3lines:
-	for (int row=0; row<3; row++)
-	{
-		//Receive a Row which is Distributed to the 16 Four Line Sector Buffers of Type LINE4_SECTOR_BUFFER.
-		receive_post_line(STREAM_IN,
-                          &LINE4_BUFFER_SECTOR0,
-                          &LINE4_BUFFER_SECTOR1,
-                          &LINE4_BUFFER_SECTOR2,
-                          &LINE4_BUFFER_SECTOR3,
-                          &LINE4_BUFFER_SECTOR4,
-                          &LINE4_BUFFER_SECTOR5,
-                          &LINE4_BUFFER_SECTOR6,
-                          &LINE4_BUFFER_SECTOR7,
-                          &LINE4_BUFFER_SECTOR8,
-                          &LINE4_BUFFER_SECTOR9,
-                          &LINE4_BUFFER_SECTOR10,
-                          &LINE4_BUFFER_SECTOR11,
-                          &LINE4_BUFFER_SECTOR12,
-                          &LINE4_BUFFER_SECTOR13,
-                          &LINE4_BUFFER_SECTOR14,
-                          &LINE4_BUFFER_SECTOR15,
-                          temp,
-                          sector_iter
-                          );
-
-		//Calculate the Vertical Position where the Next Received Row Should be Stored in the Four Line Sector Buffers.
-		temp = (temp+3)%4;
-	}
+	#pragma HLS INTERFACE  s_axilite  port=filter_mode       bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=x_coefficients    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=y_coefficients    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=coefficient_shift bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=threshold_low     bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=threshold_high    bundle=S_AXI4_LITE
 
 	/*
-	 * Produce a Processed Row from the 3 Pre-Fetched Rows.
-	 * Send the Processed Row and then Receive a New Row in Order to Produce again a Processed Row.
-	 *
-	 * Loop Until Receiving all the Rows of the Image.
+	 * The output_format is a Register to Select what the Core Sends for each Pixel.
+	 * OUTPUT_FORMAT_PIXEL (0) is the Default Filtered Pixel.
+	 * OUTPUT_FORMAT_GRADIENTS (1) Sends the Signed X and Y Gradients and OUTPUT_FORMAT_MAGNITUDE (2) Sends the Gradient Magnitude and its Quantized Direction
+	 * so that the Non-Maximum Suppression and the Hysteresis of a Canny Edge Detector Can Use them Directly (See the gradient_operator()).
+	 * In the Gradient Formats the Packed Output Mode is Disabled and the Thresholds are not Applied.
+	 * As the Filter Registers it is Written by the Driver Directly and it is Accessed through the AXI Slave Lite Interface (S_AXI4_LITE) of the Core.
 	 */
-	proc_module:
-	for (int row=0; row<rows-3; row++)
-	{
-    #pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR0  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR1  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR2  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR3  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR4  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR5  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR6  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR7  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR8  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR9  array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR10 array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR11 array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR12 array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR13 array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR14 array //false
-	#pragma HLS DEPENDENCE variable=LINE4_BUFFER_SECTOR15 array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR0  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR1  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR2  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR3  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR4  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR5  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR6  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR7  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR8  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR9  array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR10 array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR11 array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR12 array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR13 array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR14 array //false
-	#pragma HLS DEPENDENCE variable=LINE1_BUFFER_SECTOR15 array //false
-
-	//Process the 3 Rows that are Received in the 16 Four Line Sector Buffers and Produce one Processed Row.
-	start_sobel_operations(&LINE4_BUFFER_SECTOR0,
-                           &LINE4_BUFFER_SECTOR1,
-                           &LINE4_BUFFER_SECTOR2,
-                           &LINE4_BUFFER_SECTOR3,
-                           &LINE4_BUFFER_SECTOR4,
-                           &LINE4_BUFFER_SECTOR5,
-                           &LINE4_BUFFER_SECTOR6,
-                           &LINE4_BUFFER_SECTOR7,
-                           &LINE4_BUFFER_SECTOR8,
-                           &LINE4_BUFFER_SECTOR9,
-                           &LINE4_BUFFER_SECTOR10,
-                           &LINE4_BUFFER_SECTOR11,
-                           &LINE4_BUFFER_SECTOR12,
-                           &LINE4_BUFFER_SECTOR13,
-                           &LINE4_BUFFER_SECTOR14,
-                           &LINE4_BUFFER_SECTOR15,
-                           &LINE1_BUFFER_SECTOR0,
-                           &LINE1_BUFFER_SECTOR1,
-                           &LINE1_BUFFER_SECTOR2,
-                           &LINE1_BUFFER_SECTOR3,
-                           &LINE1_BUFFER_SECTOR4,
-                           &LINE1_BUFFER_SECTOR5,
-                           &LINE1_BUFFER_SECTOR6,
-                           &LINE1_BUFFER_SECTOR7,
-                           &LINE1_BUFFER_SECTOR8,
-                           &LINE1_BUFFER_SECTOR9,
-                           &LINE1_BUFFER_SECTOR10,
-                           &LINE1_BUFFER_SECTOR11,
-                           &LINE1_BUFFER_SECTOR12,
-                           &LINE1_BUFFER_SECTOR13,
-                           &LINE1_BUFFER_SECTOR14,
-                           &LINE1_BUFFER_SECTOR15,
-                           sector_size,
-                           first,
-                           second,
-                           last
-						   );
-
-		//Set the First Pixel of the First One Line Sector Buffer to be a Dark/Zero Pixel.
-	    //NOTE the First Pixel of the First One Line Sector Buffer is Actually the First Pixel of a Row.
-		LINE1_BUFFER_SECTOR0.insert(zero_pixel, 0, 0);
-
-		//Set the Last Pixel of the Last One Line Sector Buffer to be a Dark/Zero Pixel.
-	    //NOTE the Last Pixel of the Last One Line Sector Buffer is Actually the Last Pixel of a Row.
-		LINE1_BUFFER_SECTOR15.insert(zero_pixel, 0, sector_iter[15]-1);
-
-		//The Produced Row from the three Processed Rows is Stored in the 16 One Line Sector Buffers.
-		//Send the Produced Row over the AXI Stream Out Interface.
-		send_line(STREAM_OUT,
-                  &LINE1_BUFFER_SECTOR0,
-                  &LINE1_BUFFER_SECTOR1,
-                  &LINE1_BUFFER_SECTOR2,
-                  &LINE1_BUFFER_SECTOR3,
-                  &LINE1_BUFFER_SECTOR4,
-                  &LINE1_BUFFER_SECTOR5,
-                  &LINE1_BUFFER_SECTOR6,
-                  &LINE1_BUFFER_SECTOR7,
-                  &LINE1_BUFFER_SECTOR8,
-                  &LINE1_BUFFER_SECTOR9,
-                  &LINE1_BUFFER_SECTOR10,
-                  &LINE1_BUFFER_SECTOR11,
-                  &LINE1_BUFFER_SECTOR12,
-                  &LINE1_BUFFER_SECTOR13,
-                  &LINE1_BUFFER_SECTOR14,
-                  &LINE1_BUFFER_SECTOR15,
-                  sector_iter,
-                  packet_mode_en,
-                  packet_size,
-                  &bytes_count
-				  );
-
-		//Receive the Next Row which is Distributed to the 16 Four Line Sector Buffers.
-		receive_post_line(STREAM_IN,
-                          &LINE4_BUFFER_SECTOR0,
-                          &LINE4_BUFFER_SECTOR1,
-                          &LINE4_BUFFER_SECTOR2,
-                          &LINE4_BUFFER_SECTOR3,
-                          &LINE4_BUFFER_SECTOR4,
-                          &LINE4_BUFFER_SECTOR5,
-                          &LINE4_BUFFER_SECTOR6,
-                          &LINE4_BUFFER_SECTOR7,
-                          &LINE4_BUFFER_SECTOR8,
-                          &LINE4_BUFFER_SECTOR9,
-                          &LINE4_BUFFER_SECTOR10,
-                          &LINE4_BUFFER_SECTOR11,
-                          &LINE4_BUFFER_SECTOR12,
-                          &LINE4_BUFFER_SECTOR13,
-                          &LINE4_BUFFER_SECTOR14,
-                          &LINE4_BUFFER_SECTOR15,
-                          temp,
-                          sector_iter
-                          );
-
-		//Calculate which Should be Considered as the First Line for Producing the Next Processed Row.
-		first = (first+3)%4;
-
-		//Calculate which Should be Considered as the Second Line for Producing the Next Processed Row.
-		second = (second+3)%4;
-
-		//Calculate which Should be Considered as the Last Line for Producing the Next Processed Row.
-		last = (last+3)%4;
-
-		//Calculate where the New Received Row Should be Stored in the Four Line Sector Buffers.
-		temp = (temp+3)%4;
-	}
-
-	//The Previous for Loop Ended before Processing the Last Received Row.
-	//So, Process here the Last 3 Rows to Produce the Last Processed Row.
-	start_sobel_operations(&LINE4_BUFFER_SECTOR0,
-                           &LINE4_BUFFER_SECTOR1,
-                           &LINE4_BUFFER_SECTOR2,
-                           &LINE4_BUFFER_SECTOR3,
-                           &LINE4_BUFFER_SECTOR4,
-                           &LINE4_BUFFER_SECTOR5,
-                           &LINE4_BUFFER_SECTOR6,
-                           &LINE4_BUFFER_SECTOR7,
-                           &LINE4_BUFFER_SECTOR8,
-                           &LINE4_BUFFER_SECTOR9,
-                           &LINE4_BUFFER_SECTOR10,
-                           &LINE4_BUFFER_SECTOR11,
-                           &LINE4_BUFFER_SECTOR12,
-                           &LINE4_BUFFER_SECTOR13,
-                           &LINE4_BUFFER_SECTOR14,
-                           &LINE4_BUFFER_SECTOR15,
-                           &LINE1_BUFFER_SECTOR0,
-                           &LINE1_BUFFER_SECTOR1,
-                           &LINE1_BUFFER_SECTOR2,
-                           &LINE1_BUFFER_SECTOR3,
-                           &LINE1_BUFFER_SECTOR4,
-                           &LINE1_BUFFER_SECTOR5,
-                           &LINE1_BUFFER_SECTOR6,
-                           &LINE1_BUFFER_SECTOR7,
-                           &LINE1_BUFFER_SECTOR8,
-                           &LINE1_BUFFER_SECTOR9,
-                           &LINE1_BUFFER_SECTOR10,
-                           &LINE1_BUFFER_SECTOR11,
-                           &LINE1_BUFFER_SECTOR12,
-                           &LINE1_BUFFER_SECTOR13,
-                           &LINE1_BUFFER_SECTOR14,
-                           &LINE1_BUFFER_SECTOR15,
-                           sector_size,
-                           first,
-                           second,
-                           last);
-
-	//Set the First Pixel of the First One Line Sector Buffer to be a Dark/Zero Pixel.
-    //NOTE the First Pixel of the First One Line Sector Buffer is Actually the First Pixel of a Row.
-	LINE1_BUFFER_SECTOR0.insert(zero_pixel, 0, 0);
-
-	//Set the Last Pixel of the Last One Line Sector Buffer to be a Dark/Zero Pixel.
-    //NOTE the Last Pixel of the Last One Line Sector Buffer is Actually the Last Pixel of a Row.
-	LINE1_BUFFER_SECTOR15.insert(zero_pixel, 0, sector_iter[15]-1);
-
-	//Send the Last Produced Row over the AXI Stream Out Interface.
-	send_line(STREAM_OUT,
-              &LINE1_BUFFER_SECTOR0,
-              &LINE1_BUFFER_SECTOR1,
-              &LINE1_BUFFER_SECTOR2,
-              &LINE1_BUFFER_SECTOR3,
-              &LINE1_BUFFER_SECTOR4,
-              &LINE1_BUFFER_SECTOR5,
-              &LINE1_BUFFER_SECTOR6,
-              &LINE1_BUFFER_SECTOR7,
-              &LINE1_BUFFER_SECTOR8,
-              &LINE1_BUFFER_SECTOR9,
-              &LINE1_BUFFER_SECTOR10,
-              &LINE1_BUFFER_SECTOR11,
-              &LINE1_BUFFER_SECTOR12,
-              &LINE1_BUFFER_SECTOR13,
-              &LINE1_BUFFER_SECTOR14,
-              &LINE1_BUFFER_SECTOR15,
-              sector_iter,
-              packet_mode_en,
-              packet_size,
-              &bytes_count
-			  );
+	#pragma HLS INTERFACE  s_axilite  port=output_format     bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=return          bundle=S_AXI4_LITE
 
 	/*
-	 * The Last Line/Row of an Image Processed with Sobel Edge Detection is Always Filled with Zero Pixels.
-	 * So, Send the Last Row of Zero Pixels.
+	 * Set the STREAM_OUT and STREAM_IN Interfaces of the Core to be AXI Stream Interfaces.
+	 * The Fifo Depth is Set to 3840 which is the Maximum Image Width that the Core Can Support to Process.
 	 */
-	send_last_line:
-	for (int col=0; col<cols; col++)
-	{
-		#pragma HLS PIPELINE II=1
+	#pragma HLS INTERFACE axis depth=3840 port=STREAM_IN
+	#pragma HLS INTERFACE axis depth=3840 port=STREAM_OUT
 
-		AXI_PIXEL output_pixel; //Declare a AXI_PIXEL that Represents the AXI Stream Output Interface.
-
-		output_pixel.strb = 0xF; //Set the Strobe of the AXI Stream Interface so that all 4 Transmitted Bytes are Valid.
-		output_pixel.user = 0x1;
-		output_pixel.tdest = 0x1;
+	return sobel_filter_lanes<SOBEL_ENGINE, 1>(STREAM_IN, STREAM_OUT, rows, cols, packet_mode_en, packet_size, packed_output_en, input_format, filter_mode, x_coefficients, y_coefficients, coefficient_shift, threshold_low, threshold_high, output_format);
+}
 
-		//Since this is the Last Row Check if this is the Last Pixel to Send.
-		if (col==cols-1 )
-		{
-			//Set the TLAST Signal to 1 to Indicate that this will be the Last Transmission of the Data.
-			output_pixel.last = 0x1;
-		}
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		else if(packet_mode_en == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(&bytes_count, packet_size);
-		}
-		else
-			output_pixel.last = 0x0;
+/*
+ * sobel_filter_x2()
+ *
+ * The Sobel Filter Core with 2 Pixels (64 Bits) per Beat of the AXI Stream Interfaces.
+ * The Registers and their Functionality are the Same as in the sobel_filter().
+ */
+int sobel_filter_x2(/*01*/AXI_PIXEL_X2 STREAM_IN[MAX_WIDTH/2],
+                    /*02*/AXI_PIXEL_X2 STREAM_OUT[MAX_WIDTH/2],
+                    /*03*/int rows,
+                    /*04*/int cols,
+                    /*05*/int packet_mode_en,
+                    /*06*/int packet_size,
+                    /*07*/int packed_output_en,
+                    /*08*/int input_format,
+                    /*09*/int filter_mode,
+                    /*10*/COEFFICIENTS x_coefficients,
+                    /*11*/COEFFICIENTS y_coefficients,
+                    /*12*/int coefficient_shift,
+                    /*13*/int threshold_low,
+                    /*14*/int threshold_high,
+                    /*15*/int output_format
+                    )
+{
+	#pragma HLS RESOURCE variable=STREAM_OUT core=FIFO_LUTRAM
+	#pragma HLS RESOURCE variable=STREAM_IN  core=FIFO_LUTRAM
 
-		//Set the Data to Transmit to Have Zero Value Since we Transmit Zero Pixels.
-		output_pixel.data = 0x0;
+	#pragma HLS INTERFACE  s_axilite  port=rows             bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=cols             bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=packet_mode_en   bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=packet_size      bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=packed_output_en bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=input_format     bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=filter_mode       bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=x_coefficients    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=y_coefficients    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=coefficient_shift bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=threshold_low     bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=threshold_high    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=output_format     bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=return           bundle=S_AXI4_LITE
+
+	//The Fifo Depth is Set to 1920 Beats which Carry the 3840 Pixels of the Maximum Image Width.
+	#pragma HLS INTERFACE axis depth=1920 port=STREAM_IN
+	#pragma HLS INTERFACE axis depth=1920 port=STREAM_OUT
 
-		//Forward the Data along with the Rest Signals to the AXI Stream Output Interface.
-		STREAM_OUT[col] = output_pixel;
-	}
+	return sobel_filter_lanes<SOBEL_ENGINE, 2>(STREAM_IN, STREAM_OUT, rows, cols, packet_mode_en, packet_size, packed_output_en, input_format, filter_mode, x_coefficients, y_coefficients, coefficient_shift, threshold_low, threshold_high, output_format);
+}
 
-	bytes_count = 0; // Byte Counter
+/*
+ * sobel_filter_x4()
+ *
+ * The Sobel Filter Core with 4 Pixels (128 Bits) per Beat of the AXI Stream Interfaces.
+ * The Registers and their Functionality are the Same as in the sobel_filter().
+ */
+int sobel_filter_x4(/*01*/AXI_PIXEL_X4 STREAM_IN[MAX_WIDTH/4],
+                    /*02*/AXI_PIXEL_X4 STREAM_OUT[MAX_WIDTH/4],
+                    /*03*/int rows,
+                    /*04*/int cols,
+                    /*05*/int packet_mode_en,
+                    /*06*/int packet_size,
+                    /*07*/int packed_output_en,
+                    /*08*/int input_format,
+                    /*09*/int filter_mode,
+                    /*10*/COEFFICIENTS x_coefficients,
+                    /*11*/COEFFICIENTS y_coefficients,
+                    /*12*/int coefficient_shift,
+                    /*13*/int threshold_low,
+                    /*14*/int threshold_high,
+                    /*15*/int output_format
+                    )
+{
+	#pragma HLS RESOURCE variable=STREAM_OUT core=FIFO_LUTRAM
+	#pragma HLS RESOURCE variable=STREAM_IN  core=FIFO_LUTRAM
 
-	return 1;
+	#pragma HLS INTERFACE  s_axilite  port=rows             bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=cols             bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=packet_mode_en   bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=packet_size      bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=packed_output_en bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=input_format     bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=filter_mode       bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=x_coefficients    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=y_coefficients    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=coefficient_shift bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=threshold_low     bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=threshold_high    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=output_format     bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=return           bundle=S_AXI4_LITE
+
+	//The Fifo Depth is Set to 960 Beats which Carry the 3840 Pixels of the Maximum Image Width.
+	#pragma HLS INTERFACE axis depth=960 port=STREAM_IN
+	#pragma HLS INTERFACE axis depth=960 port=STREAM_OUT
+
+	return sobel_filter_lanes<SOBEL_ENGINE, 4>(STREAM_IN, STREAM_OUT, rows, cols, packet_mode_en, packet_size, packed_output_en, input_format, filter_mode, x_coefficients, y_coefficients, coefficient_shift, threshold_low, threshold_high, output_format);
 }
-
@@ -35,10 +35,73 @@
 #include "ap_utils.h"
 #include "ap_video.h"
 
-#define MAX_WIDTH  1920
-#define MAX_HEIGHT 1080
+/*
+ * The Maximum Image Width and the Number of Sector Buffers Can be Overridden at Synthesis (See run_hls.tcl)
+ * in order to Trade BRAM for Parallelism, e.g 8 Sectors for Small Images or 32 Sectors for Wider Images.
+ * NOTE that the MAX_WIDTH Should be an Integer Multiple of SECTORS * 4 so that the Sector Width Suits any Number of Lanes.
+ */
+#ifndef MAX_WIDTH
+#define MAX_WIDTH  3840 //UHD (3840x2160) Rows which Give Sectors of 240 Pixels that Still Fit a Single BRAM per Line with 16 Sectors.
+#endif
+#define MAX_HEIGHT 2160
 
+#ifndef SECTORS
 #define SECTORS    16
+#endif
+
+#ifndef KERNEL_SIZE
+#define KERNEL_SIZE 3 //The Width and Height of the Neighborhood that is Used to Produce each Processed Pixel.
+#endif
+
+#define INPUT_FORMAT_BGRX 0 //One Pixel per 32 Bit Beat (Blue, Green, Red and a Padding Byte).
+#define INPUT_FORMAT_BGR  1 //Packed 24 Bit Pixels (4 Pixels in 3 Beats) where each Row Starts at a New Beat.
+#define INPUT_FORMAT_LUMA 2 //Pre-Computed 8 Bit Luminance Values (4 Pixels per Beat) where each Row Starts at a New Beat.
+
+#define FILTER_MODE_SOBEL    0 //The Sobel Edge Detection with the Fixed Coefficients and Thresholds (the Filter Registers are not Used).
+#define FILTER_MODE_LINEAR   1 //Convolution with the X Coefficients (e.g. Gaussian Blur, Box or Sharpen) Shifted Right by the coefficient_shift and Saturated to 0-255.
+#define FILTER_MODE_GRADIENT 2 //Edge Detection with the X and Y Coefficients (e.g. Scharr or Prewitt) where the Shifted Gradient Magnitude is Inverted as in the Sobel Mode.
+
+/*
+ * The Output Formats of the Core.
+ * In the Gradient Formats the Core Sends the Gradients of each Pixel instead of the Filtered Pixel so that the Host or a Following Stage
+ * Can Apply Non-Maximum Suppression and Hysteresis (the Rest of a Canny Edge Detector) without Computing the Gradients Again.
+ * Each Pixel is then Sent as a 32 Bit Word where the Fourth Byte is Zero so the Packed Output Mode is not Applicable.
+ */
+#define OUTPUT_FORMAT_PIXEL     0 //The Filtered Pixel in the Blue, Green and Red Bytes (Default).
+#define OUTPUT_FORMAT_GRADIENTS 1 //The Signed X Gradient in the Bits 11-0 and the Signed Y Gradient in the Bits 23-12 (Two's Complement).
+#define OUTPUT_FORMAT_MAGNITUDE 2 //The Gradient Magnitude |X| + |Y| in the Bits 15-0 and the Quantized Direction (See the DIRECTION_*) in the Bits 17-16.
+
+#define GRADIENT_LIMIT 2047 //The Gradients are Saturated to +-GRADIENT_LIMIT to Fit in 12 Bits.
+
+/*
+ * The Coefficient Registers Hold a FILTER_TAPS x FILTER_TAPS Kernel of Signed 8 Bit Coefficients in Row Major Order (the First Coefficient in the Least Significant Byte).
+ * Only the Central KERNEL_SIZE x KERNEL_SIZE Coefficients are Used so a 3x3 Kernel is Loaded in the Center of the Registers with Zeros Around it.
+ */
+#define FILTER_TAPS 5
+
+typedef ap_uint <FILTER_TAPS * FILTER_TAPS * 8> COEFFICIENTS;
+
+/*
+ * The Filter Registers of the Core as they are Given to each Processing Unit.
+ */
+struct FILTER_CONFIG
+{
+	int mode;
+	COEFFICIENTS x_coefficients;
+	COEFFICIENTS y_coefficients;
+	int shift;
+	int threshold_low;
+	int threshold_high;
+	int output_format;
+};
+
+#define PIPELINE_STAGE_BLUR 0x1 //The sobel_pipeline() Applies a 3x3 Gaussian Blur before the Filter.
+#define PIPELINE_STAGE_NMS  0x2 //The sobel_pipeline() Thins the Edges with Non-Maximum Suppression after the Filter.
+
+#define DIRECTION_HORIZONTAL 0 //The Gradient Points Left/Right so the Edge is Vertical.
+#define DIRECTION_RISING     1 //The Gradient Points Up-Right/Down-Left.
+#define DIRECTION_VERTICAL   2 //The Gradient Points Up/Down so the Edge is Horizontal.
+#define DIRECTION_FALLING    3 //The Gradient Points Up-Left/Down-Right.
 
 #define ABSDIFF(x,y)	((x>y)? x - y : y - x)
 #define ABS(x)          ((x>0)? x : -x)
@@ -46,15 +109,118 @@
 
 typedef ap_rgb <8, 8, 8> RGB;
 typedef ap_axiu2 <32, 1, 1, 1> AXI_PIXEL;
+typedef ap_axiu2 <64, 1, 1, 1> AXI_PIXEL_X2;
+typedef ap_axiu2 <128, 1, 1, 1> AXI_PIXEL_X4;
+
+/*
+ * A Filtered Pixel Together with the Quantized Direction of its Gradient which the Non-Maximum Suppression Stage Needs.
+ */
+struct EDGE_PIXEL
+{
+	RGB pixel;
+	ap_uint<2> direction;
+};
+
+/*
+ * The Types that Depend on the Number of Pixels (Lanes) that are Transferred in each Beat of the AXI Stream Interfaces.
+ * BEAT is the AXI Stream Beat of 4 Bytes per Lane.
+ * HOLD is Wide Enough to Hold the Bytes of Two Beats which are Needed when a Pixel or a Row Crosses the Border of a Beat.
+ */
+template<int LANES>
+struct AXI_LANES
+{
+	typedef ap_axiu2 <32 * LANES, 1, 1, 1> BEAT;
+	typedef ap_uint <64 * LANES> HOLD;
+};
 
-typedef ap_linebuffer <unsigned char, 4, (MAX_WIDTH/SECTORS)+2> LINE4_SECTOR_BUFFER;
-typedef ap_linebuffer <RGB, 1, (MAX_WIDTH/SECTORS)+1> LINE1_SECTOR_BUFFER;
+/*
+ * The Line Buffer Engine Describes the Sector Buffers of the Core.
+ *
+ * Each Image Row is Split in NUM_SECTORS Sectors of up to SECTOR_WIDTH Pixels.
+ * Each Input Sector Buffer Has KERNEL + 1 Lines so that a New Row is Received while the Previous KERNEL Rows are Processed.
+ * Each Line Has HALO Extra Fields on each Side to Hold the Neighbor Pixels of the Adjacent Sectors.
+ * Each Output Sector Buffer Has a Single Line to Store the Processed Pixels of the Sector.
+ * The WINDOW is the KERNEL x KERNEL Neighborhood of a Pixel that is Given to the Operator.
+ */
+template<int NUM_SECTORS, int IMAGE_WIDTH, int KERNEL>
+struct LINE_BUFFER_ENGINE
+{
+	static const int SECTOR_COUNT = NUM_SECTORS;
+	static const int SECTOR_WIDTH = IMAGE_WIDTH / NUM_SECTORS;
+	static const int WINDOW_SIZE = KERNEL;
+	static const int LINES = KERNEL + 1;
+	static const int HALO = (KERNEL - 1) / 2;
+
+	typedef ap_linebuffer <unsigned char, KERNEL + 1, SECTOR_WIDTH + KERNEL - 1> INPUT_BUFFER;
+	typedef ap_linebuffer <RGB, 1, SECTOR_WIDTH + 1> OUTPUT_BUFFER;
+	typedef ap_window <unsigned char, KERNEL, KERNEL> WINDOW;
+};
+
+typedef LINE_BUFFER_ENGINE <SECTORS, MAX_WIDTH, KERNEL_SIZE> SOBEL_ENGINE;
 
 int sobel_filter(AXI_PIXEL STREAM_IN[MAX_WIDTH],
                  AXI_PIXEL STREAM_OUT[MAX_WIDTH],
                  int rows,
                  int cols,
                  int packet_mode_en,
-                 int packet_size);
+                 int packet_size,
+                 int packed_output_en,
+                 int input_format,
+                 int filter_mode,
+                 COEFFICIENTS x_coefficients,
+                 COEFFICIENTS y_coefficients,
+                 int coefficient_shift,
+                 int threshold_low,
+                 int threshold_high,
+                 int output_format);
+
+int sobel_filter_x2(AXI_PIXEL_X2 STREAM_IN[MAX_WIDTH/2],
+                    AXI_PIXEL_X2 STREAM_OUT[MAX_WIDTH/2],
+                    int rows,
+                    int cols,
+                    int packet_mode_en,
+                    int packet_size,
+                    int packed_output_en,
+                    int input_format,
+                    int filter_mode,
+                    COEFFICIENTS x_coefficients,
+                    COEFFICIENTS y_coefficients,
+                    int coefficient_shift,
+                    int threshold_low,
+                    int threshold_high,
+                 int output_format);
+
+int sobel_filter_x4(AXI_PIXEL_X4 STREAM_IN[MAX_WIDTH/4],
+                    AXI_PIXEL_X4 STREAM_OUT[MAX_WIDTH/4],
+                    int rows,
+                    int cols,
+                    int packet_mode_en,
+                    int packet_size,
+                    int packed_output_en,
+                    int input_format,
+                    int filter_mode,
+                    COEFFICIENTS x_coefficients,
+                    COEFFICIENTS y_coefficients,
+                    int coefficient_shift,
+                    int threshold_low,
+                    int threshold_high,
+                 int output_format);
+
+int sobel_pipeline(AXI_PIXEL STREAM_IN[MAX_WIDTH],
+                   AXI_PIXEL STREAM_OUT[MAX_WIDTH],
+                   int rows,
+                   int cols,
+                   int packet_mode_en,
+                   int packet_size,
+                   int packed_output_en,
+                   int input_format,
+                   int filter_mode,
+                   COEFFICIENTS x_coefficients,
+                   COEFFICIENTS y_coefficients,
+                   int coefficient_shift,
+                   int threshold_low,
+                   int threshold_high,
+                   int output_format,
+                   int pipeline_stages);
 
 #endif
@@ -0,0 +1,508 @@
+/*******************************************************************************
+* Filename:   sobel_golden.cpp
+* Authors:    Othon Tomoutzoglou <otto_sta@hotmail.com>
+*             Dimitrios Bakoyiannis <d.bakoyiannis@gmail.com>
+* License:
+*
+* MIT License
+*
+* Copyright (c) [2018] [Othon Tomoutzoglou, Dimitrios Bakoyiannis]
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "sobel.h"
+#include "sobel_golden.h"
+
+#ifdef SOBEL_GOLDEN_AVX2
+#include <immintrin.h>
+#endif
+
+/*
+ * golden_luma_scalar()
+ *
+ * Converts pixels 4 Byte Pixels to Luminance Values with the Same Formula as the rgb2y() of the Cores.
+ */
+static void golden_luma_scalar(const unsigned char *image, unsigned char *luma, int pixels)
+{
+	for (int j = 0; j < pixels; j++)
+	{
+		luma[j] = (unsigned char)(((66 * image[(4 * j) + 2] + 129 * image[(4 * j) + 1] + 25 * image[4 * j] + 128) >> 8) + 16);
+	}
+}
+
+/*
+ * golden_edge()
+ *
+ * Applies the sobel_operator() of the Cores to the Pixel at Column col of the Row Given by the middle Pointer.
+ * The Gradients are Summed in 16 Bit Values and only the Lower Byte of their Absolute Sum is Inverted as in the sobel_operator().
+ */
+static unsigned char golden_edge(const unsigned char *top, const unsigned char *middle, const unsigned char *bottom, int col)
+{
+	short x_weight = (top[col + 1] + (2 * middle[col + 1]) + bottom[col + 1]) - (top[col - 1] + (2 * middle[col - 1]) + bottom[col - 1]);
+	short y_weight = (top[col - 1] + (2 * top[col]) + top[col + 1]) - (bottom[col - 1] + (2 * bottom[col]) + bottom[col + 1]);
+
+	short edge_weight = (short)(((x_weight > 0) ? x_weight : -x_weight) + ((y_weight > 0) ? y_weight : -y_weight));
+
+	unsigned char edge_val = (unsigned char)(255 - (unsigned char)edge_weight);
+
+	//Edge Thresholding
+	if (edge_val > 200)
+	{
+		edge_val = 255;
+	}
+	else if (edge_val < 100)
+	{
+		edge_val = 0;
+	}
+
+	return edge_val;
+}
+
+/*
+ * golden_edges_scalar()
+ *
+ * Produces the Edge Values of the Columns from first up to (not Including) last of a Row.
+ */
+static void golden_edges_scalar(const unsigned char *top, const unsigned char *middle, const unsigned char *bottom, unsigned char *edges, int first, int last)
+{
+	for (int col = first; col < last; col++)
+	{
+		edges[col] = golden_edge(top, middle, bottom, col);
+	}
+}
+
+/*
+ * golden_process()
+ *
+ * The Common Part of the Scalar and the AVX2 Versions.
+ * The Luminance Values of the Whole Image are Computed First and then each Row apart from the First and the Last is Processed.
+ * The First and Last Row and Column are Dark/Zero Pixels as in the Cores.
+ */
+static void golden_process(const unsigned char *image, unsigned char *edges, int rows, int cols,
+                           void (*luma_row)(const unsigned char *, unsigned char *, int),
+                           void (*edges_row)(const unsigned char *, const unsigned char *, const unsigned char *, unsigned char *, int, int))
+{
+	unsigned char *luma = (unsigned char *)malloc((size_t)rows * cols);
+
+	if (luma == NULL)
+	{
+		memset(edges, 0, (size_t)rows * cols);
+		return;
+	}
+
+	for (int row = 0; row < rows; row++)
+	{
+		luma_row(image + ((size_t)row * cols * 4), luma + ((size_t)row * cols), cols);
+	}
+
+	memset(edges, 0, (size_t)cols);
+	memset(edges + ((size_t)(rows - 1) * cols), 0, (size_t)cols);
+
+	for (int row = 1; row < rows - 1; row++)
+	{
+		unsigned char *edge_row = edges + ((size_t)row * cols);
+
+		edges_row(luma + ((size_t)(row - 1) * cols), luma + ((size_t)row * cols), luma + ((size_t)(row + 1) * cols), edge_row, 1, cols - 1);
+
+		edge_row[0] = 0;
+		edge_row[cols - 1] = 0;
+	}
+
+	free(luma);
+}
+
+/*
+ * sobel_golden_scalar()
+ *
+ * Scalar Version of the Golden Model.
+ */
+void sobel_golden_scalar(const unsigned char *image, unsigned char *edges, int rows, int cols)
+{
+	golden_process(image, edges, rows, cols, golden_luma_scalar, golden_edges_scalar);
+}
+
+#ifdef SOBEL_GOLDEN_AVX2
+
+/*
+ * golden_luma_avx2()
+ *
+ * AVX2 Version of the Luminance Conversion which Converts 8 Pixels in each Loop.
+ * Each Pixel is Widened to 16 Bit Values and a Multiply-Add with the Weights (25, 129, 66, 0) Followed by a Horizontal Add
+ * Gives the Weighted Sum of each Pixel in a 32 Bit Lane.
+ */
+__attribute__((target("avx2")))
+static void golden_luma_avx2(const unsigned char *image, unsigned char *luma, int pixels)
+{
+	const __m256i weights = _mm256_setr_epi16(25, 129, 66, 0, 25, 129, 66, 0, 25, 129, 66, 0, 25, 129, 66, 0);
+	const __m256i rounding = _mm256_set1_epi32(128);
+	const __m256i offset = _mm256_set1_epi32(16);
+	const __m256i zero = _mm256_setzero_si256();
+
+	int j = 0;
+
+	for (; j + 8 <= pixels; j += 8)
+	{
+		__m256i bgrx_pixels = _mm256_loadu_si256((const __m256i *)(image + (j * 4)));
+
+		__m256i sums = _mm256_hadd_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi8(bgrx_pixels, zero), weights),
+		                                 _mm256_madd_epi16(_mm256_unpackhi_epi8(bgrx_pixels, zero), weights));
+
+		sums = _mm256_add_epi32(_mm256_srli_epi32(_mm256_add_epi32(sums, rounding), 8), offset);
+
+		__m128i words = _mm_packs_epi32(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+
+		_mm_storel_epi64((__m128i *)(luma + j), _mm_packus_epi16(words, words));
+	}
+
+	golden_luma_scalar(image + (j * 4), luma + j, pixels - j);
+}
+
+/*
+ * golden_edges_avx2()
+ *
+ * AVX2 Version of the Edge Values which Produces 16 Edge Values in each Loop.
+ * The Luminance Values are Widened to 16 Bits so the Gradients and their Absolute Sum Wrap as the 16 Bit Values of the sobel_operator().
+ * The Loop Stops while the Right Neighbor of the 16th Pixel is still in the Row.
+ */
+__attribute__((target("avx2")))
+static void golden_edges_avx2(const unsigned char *top, const unsigned char *middle, const unsigned char *bottom, unsigned char *edges, int first, int last)
+{
+	const __m256i low_byte = _mm256_set1_epi16(0xFF);
+	const __m256i high_threshold = _mm256_set1_epi16(200);
+	const __m256i low_threshold = _mm256_set1_epi16(100);
+
+	int col = first;
+
+	for (; col + 16 <= last; col += 16)
+	{
+		__m256i top_left = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(top + col - 1)));
+		__m256i top_center = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(top + col)));
+		__m256i top_right = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(top + col + 1)));
+		__m256i middle_left = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(middle + col - 1)));
+		__m256i middle_right = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(middle + col + 1)));
+		__m256i bottom_left = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(bottom + col - 1)));
+		__m256i bottom_center = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(bottom + col)));
+		__m256i bottom_right = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(bottom + col + 1)));
+
+		__m256i x_weight = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(top_right, bottom_right), _mm256_slli_epi16(middle_right, 1)),
+		                                    _mm256_add_epi16(_mm256_add_epi16(top_left, bottom_left), _mm256_slli_epi16(middle_left, 1)));
+
+		__m256i y_weight = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(top_left, top_right), _mm256_slli_epi16(top_center, 1)),
+		                                    _mm256_add_epi16(_mm256_add_epi16(bottom_left, bottom_right), _mm256_slli_epi16(bottom_center, 1)));
+
+		__m256i edge_weight = _mm256_add_epi16(_mm256_abs_epi16(x_weight), _mm256_abs_epi16(y_weight));
+
+		__m256i edge_val = _mm256_sub_epi16(low_byte, _mm256_and_si256(edge_weight, low_byte));
+
+		//Edge Thresholding
+		edge_val = _mm256_or_si256(edge_val, _mm256_and_si256(_mm256_cmpgt_epi16(edge_val, high_threshold), low_byte));
+		edge_val = _mm256_andnot_si256(_mm256_cmpgt_epi16(low_threshold, edge_val), edge_val);
+
+		//The Byte Packing Works on each 128 Bit Lane so the 64 Bit Quarters are Reordered to Bring the 16 Bytes Together.
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(edge_val, edge_val), 0xD8);
+
+		_mm_storeu_si128((__m128i *)(edges + col), _mm256_castsi256_si128(packed));
+	}
+
+	golden_edges_scalar(top, middle, bottom, edges, col, last);
+}
+
+/*
+ * sobel_golden_avx2()
+ *
+ * AVX2 Version of the Golden Model.
+ */
+void sobel_golden_avx2(const unsigned char *image, unsigned char *edges, int rows, int cols)
+{
+	golden_process(image, edges, rows, cols, golden_luma_avx2, golden_edges_avx2);
+}
+
+#endif
+
+/*
+ * sobel_golden_avx2_supported()
+ *
+ * Returns 1 if the CPU Supports the AVX2 Version of the Golden Model.
+ */
+int sobel_golden_avx2_supported()
+{
+	#ifdef SOBEL_GOLDEN_AVX2
+	return __builtin_cpu_supports("avx2") ? 1 : 0;
+	#else
+	return 0;
+	#endif
+}
+
+/*
+ * sobel_golden()
+ *
+ * Processes the Image with the Fastest Version of the Golden Model that the CPU Supports.
+ */
+void sobel_golden(const unsigned char *image, unsigned char *edges, int rows, int cols)
+{
+	#ifdef SOBEL_GOLDEN_AVX2
+	if (sobel_golden_avx2_supported())
+	{
+		sobel_golden_avx2(image, edges, rows, cols);
+		return;
+	}
+	#endif
+
+	sobel_golden_scalar(image, edges, rows, cols);
+}
+
+/*
+ * sobel_golden_luma()
+ *
+ * Converts pixels 4 Byte Pixels to the Luminance Values that the Cores Compute for the INPUT_FORMAT_BGRX and INPUT_FORMAT_BGR
+ * and that the Host Stages for the INPUT_FORMAT_LUMA.
+ */
+void sobel_golden_luma(const unsigned char *image, unsigned char *luma, int pixels)
+{
+	golden_luma_scalar(image, luma, pixels);
+}
+
+/*
+ * golden_weights()
+ *
+ * Multiplies the 3x3 Neighborhood of the Pixel at Column col of the Row Given by the middle Pointer with the X and Y Kernels.
+ */
+static void golden_weights(const unsigned char *top, const unsigned char *middle, const unsigned char *bottom, int col,
+                           const signed char *x_kernel, const signed char *y_kernel, int *x_weight, int *y_weight)
+{
+	const unsigned char *lines[3] = { top, middle, bottom };
+
+	*x_weight = 0;
+	*y_weight = 0;
+
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			*x_weight += lines[i][col - 1 + j] * x_kernel[(i * 3) + j];
+			*y_weight += lines[i][col - 1 + j] * y_kernel[(i * 3) + j];
+		}
+	}
+}
+
+/*
+ * golden_direction()
+ *
+ * Quantizes the Direction of the X and Y Gradients to one of the DIRECTION_* Values as the gradient_direction() of the Cores.
+ */
+static unsigned int golden_direction(int x_weight, int y_weight)
+{
+	int x_abs = (x_weight < 0) ? -x_weight : x_weight;
+	int y_abs = (y_weight < 0) ? -y_weight : y_weight;
+
+	if ((y_abs * 5) <= (x_abs * 2))
+	{
+		return DIRECTION_HORIZONTAL;
+	}
+	else if ((x_abs * 5) <= (y_abs * 2))
+	{
+		return DIRECTION_VERTICAL;
+	}
+	else if ((x_weight > 0) == (y_weight > 0))
+	{
+		return DIRECTION_RISING;
+	}
+
+	return DIRECTION_FALLING;
+}
+
+/*
+ * golden_word()
+ *
+ * Returns the Word of the Pixel at Column col of the Row Given by the middle Pointer as the sobel_operator(), convolution_operator() or gradient_operator() of the Cores Give it.
+ */
+static unsigned int golden_word(const unsigned char *top, const unsigned char *middle, const unsigned char *bottom, int col, const struct GOLDEN_FILTER *filter)
+{
+	const signed char sobel_x[9] = { -1, 0, 1, -2, 0, 2, -1, 0, 1 };
+	const signed char sobel_y[9] = { 1, 2, 1, 0, 0, 0, -1, -2, -1 };
+
+	int x_weight;
+	int y_weight;
+	int value;
+
+	if (filter->output_format == OUTPUT_FORMAT_PIXEL && filter->mode != FILTER_MODE_LINEAR && filter->mode != FILTER_MODE_GRADIENT)
+	{
+		return (unsigned int)golden_edge(top, middle, bottom, col) * 0x010101;
+	}
+
+	/*
+	 * The Gradient Formats Use the Sobel Kernels without a Shift unless the Filter Mode is the FILTER_MODE_GRADIENT.
+	 */
+	if (filter->output_format != OUTPUT_FORMAT_PIXEL)
+	{
+		if (filter->mode == FILTER_MODE_GRADIENT)
+		{
+			golden_weights(top, middle, bottom, col, filter->x_coefficients, filter->y_coefficients, &x_weight, &y_weight);
+
+			x_weight = x_weight >> filter->shift;
+			y_weight = y_weight >> filter->shift;
+		}
+		else
+		{
+			golden_weights(top, middle, bottom, col, sobel_x, sobel_y, &x_weight, &y_weight);
+		}
+
+		x_weight = (x_weight > GRADIENT_LIMIT) ? GRADIENT_LIMIT : ((x_weight < -GRADIENT_LIMIT) ? -GRADIENT_LIMIT : x_weight);
+		y_weight = (y_weight > GRADIENT_LIMIT) ? GRADIENT_LIMIT : ((y_weight < -GRADIENT_LIMIT) ? -GRADIENT_LIMIT : y_weight);
+
+		if (filter->output_format == OUTPUT_FORMAT_GRADIENTS)
+		{
+			return ((unsigned int)x_weight & 0xFFF) | (((unsigned int)y_weight & 0xFFF) << 12);
+		}
+
+		int x_abs = (x_weight < 0) ? -x_weight : x_weight;
+		int y_abs = (y_weight < 0) ? -y_weight : y_weight;
+
+		return (unsigned int)(x_abs + y_abs) | (golden_direction(x_weight, y_weight) << 16);
+	}
+
+	golden_weights(top, middle, bottom, col, filter->x_coefficients, filter->y_coefficients, &x_weight, &y_weight);
+
+	if (filter->mode == FILTER_MODE_GRADIENT)
+	{
+		int weight = (((x_weight < 0) ? -x_weight : x_weight) + ((y_weight < 0) ? -y_weight : y_weight)) >> filter->shift;
+
+		value = 255 - ((weight > 255) ? 255 : weight);
+	}
+	else
+	{
+		int weight = x_weight >> filter->shift;
+
+		value = (weight < 0) ? 0 : ((weight > 255) ? 255 : weight);
+	}
+
+	//Thresholding
+	if (value > filter->threshold_high)
+	{
+		value = 255;
+	}
+	else if (value < filter->threshold_low)
+	{
+		value = 0;
+	}
+
+	return (unsigned int)value * 0x010101;
+}
+
+/*
+ * sobel_golden_filter()
+ *
+ * Processes the rows x cols Luminance Values with the Filter Registers of the filter and Stores the Word of each Pixel to the words.
+ * The First and Last Row and Column are Zero Words as in the Cores.
+ */
+void sobel_golden_filter(const unsigned char *luma, unsigned int *words, int rows, int cols, const struct GOLDEN_FILTER *filter)
+{
+	memset(words, 0, (size_t)rows * cols * sizeof(unsigned int));
+
+	for (int row = 1; row < rows - 1; row++)
+	{
+		for (int col = 1; col < cols - 1; col++)
+		{
+			words[((size_t)row * cols) + col] = golden_word(luma + ((size_t)(row - 1) * cols), luma + ((size_t)row * cols), luma + ((size_t)(row + 1) * cols), col, filter);
+		}
+	}
+}
+
+/*
+ * sobel_golden_pipeline()
+ *
+ * Processes the rows x cols Luminance Values as the sobel_pipeline() with the Stages of the pipeline_stages (See the PIPELINE_STAGE_*).
+ *
+ * The Gaussian Blur Rounds (1 2 1 / 2 4 2 / 1 2 1 + 8) / 16 and Leaves the First and Last Row and Column Unchanged.
+ * The Filter is the sobel_golden_filter() of the (Blurred) Luminance Values.
+ * The Non-Maximum Suppression Applies only to the OUTPUT_FORMAT_PIXEL and Replaces with a White Word each Interior Pixel
+ * whose Neighbor along the Direction of its Sobel Gradient (of the Blurred Luminance Values) is Darker.
+ */
+void sobel_golden_pipeline(const unsigned char *luma, unsigned int *words, int rows, int cols, const struct GOLDEN_FILTER *filter, int pipeline_stages)
+{
+	const signed char sobel_x[9] = { -1, 0, 1, -2, 0, 2, -1, 0, 1 };
+	const signed char sobel_y[9] = { 1, 2, 1, 0, 0, 0, -1, -2, -1 };
+	const signed char gaussian[9] = { 1, 2, 1, 2, 4, 2, 1, 2, 1 };
+
+	const size_t pixels = (size_t)rows * cols;
+
+	unsigned char *blurred = (unsigned char *)malloc(pixels);
+	unsigned int *edges = (unsigned int *)malloc(pixels * sizeof(unsigned int));
+
+	memcpy(blurred, luma, pixels);
+
+	if (pipeline_stages & PIPELINE_STAGE_BLUR)
+	{
+		for (int row = 1; row < rows - 1; row++)
+		{
+			for (int col = 1; col < cols - 1; col++)
+			{
+				int sum;
+				int unused;
+
+				golden_weights(luma + ((size_t)(row - 1) * cols), luma + ((size_t)row * cols), luma + ((size_t)(row + 1) * cols), col, gaussian, gaussian, &sum, &unused);
+
+				blurred[((size_t)row * cols) + col] = (unsigned char)((sum + 8) >> 4);
+			}
+		}
+	}
+
+	sobel_golden_filter(blurred, words, rows, cols, filter);
+
+	if ((pipeline_stages & PIPELINE_STAGE_NMS) && filter->output_format == OUTPUT_FORMAT_PIXEL)
+	{
+		memcpy(edges, words, pixels * sizeof(unsigned int));
+
+		for (int row = 1; row < rows - 1; row++)
+		{
+			for (int col = 1; col < cols - 1; col++)
+			{
+				const size_t center = ((size_t)row * cols) + col;
+
+				size_t first;
+				size_t second;
+				int x_weight;
+				int y_weight;
+
+				golden_weights(blurred + ((size_t)(row - 1) * cols), blurred + center - col, blurred + ((size_t)(row + 1) * cols), col, sobel_x, sobel_y, &x_weight, &y_weight);
+
+				switch (golden_direction(x_weight, y_weight))
+				{
+					case DIRECTION_HORIZONTAL: first = center - 1; second = center + 1; break;
+					case DIRECTION_VERTICAL:   first = center - cols; second = center + cols; break;
+					case DIRECTION_RISING:     first = center - cols + 1; second = center + cols - 1; break;
+					default:                   first = center - cols - 1; second = center + cols + 1; break;
+				}
+
+				//The Red Byte of each Word is Compared as in the Cores.
+				if (((edges[first] >> 16) & 0xFF) < ((edges[center] >> 16) & 0xFF) || ((edges[second] >> 16) & 0xFF) < ((edges[center] >> 16) & 0xFF))
+				{
+					words[center] = 0xFFFFFF;
+				}
+			}
+		}
+	}
+
+	free(edges);
+	free(blurred);
+}
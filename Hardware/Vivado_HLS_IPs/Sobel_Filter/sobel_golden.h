@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Filename:   sobel_golden.h
+* Authors:    Othon Tomoutzoglou <otto_sta@hotmail.com>
+*             Dimitrios Bakoyiannis <d.bakoyiannis@gmail.com>
+* License:
+*
+* MIT License
+*
+* Copyright (c) [2018] [Othon Tomoutzoglou, Dimitrios Bakoyiannis]
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#ifndef _SOBEL_GOLDEN_H_
+#define _SOBEL_GOLDEN_H_
+
+/*
+ * The Golden Model of the Sobel Filter Cores for the C Simulation Testbench (See sobel_tb.cpp).
+ *
+ * The sobel_golden() Processes an Image in the Default Configuration of the Cores (INPUT_FORMAT_BGRX, FILTER_MODE_SOBEL and OUTPUT_FORMAT_PIXEL)
+ * with the Same Integer Arithmetic so that its Result is Bit Exact with the Result of the Cores.
+ * The image Holds rows x cols Pixels of 4 Bytes (Blue, Green, Red and a Padding Byte) and the edges Gets one Edge Value per Pixel
+ * which the Cores Repeat to the Blue, Green and Red Bytes of each Output Pixel.
+ *
+ * The sobel_golden_filter() is a Scalar Model of the Rest Filter Modes and Output Formats which Works on the Luminance Values of the sobel_golden_luma().
+ * It Returns the 32 Bit Word that the Cores Send for each Pixel when the Output is not Packed.
+ * The sobel_golden_pipeline() Adds the Optional Stages of the sobel_pipeline() (Gaussian Blur and Non-Maximum Suppression) around it.
+ *
+ * The sobel_golden() Selects the Fastest Version that the CPU Supports at Runtime.
+ * The Golden Model is not Synthesized so it is Added to the Project only as a Testbench File (See run_hls.tcl).
+ */
+
+/*
+ * The AVX2 Version Requires the Function Target Attributes of GCC 4.9 or Later.
+ * The Older GCC that Comes with Vivado HLS for the C Simulation Builds only the Scalar Version.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+#define SOBEL_GOLDEN_AVX2
+#endif
+
+void sobel_golden_scalar(const unsigned char *image, unsigned char *edges, int rows, int cols);
+
+#ifdef SOBEL_GOLDEN_AVX2
+void sobel_golden_avx2(const unsigned char *image, unsigned char *edges, int rows, int cols);
+#endif
+
+int sobel_golden_avx2_supported();
+
+void sobel_golden(const unsigned char *image, unsigned char *edges, int rows, int cols);
+
+/*
+ * The Filter Registers of the Cores for the sobel_golden_filter().
+ * The Kernels are 3x3 in Row Major Order as they are Loaded in the Center of the Coefficient Registers of the Cores.
+ * The mode and output_format Take the FILTER_MODE_* and OUTPUT_FORMAT_* Values of sobel.h.
+ */
+struct GOLDEN_FILTER
+{
+	int mode;
+	signed char x_coefficients[9];
+	signed char y_coefficients[9];
+	int shift;
+	int threshold_low;
+	int threshold_high;
+	int output_format;
+};
+
+void sobel_golden_luma(const unsigned char *image, unsigned char *luma, int pixels);
+
+void sobel_golden_filter(const unsigned char *luma, unsigned int *words, int rows, int cols, const struct GOLDEN_FILTER *filter);
+
+void sobel_golden_pipeline(const unsigned char *luma, unsigned int *words, int rows, int cols, const struct GOLDEN_FILTER *filter, int pipeline_stages);
+
+#endif
@@ -54,1432 +54,627 @@ unsigned char rgb2y(RGB pix)
 /*
  * start_sobel_operations()
  *
- * Produces a Single Processed Row by Applying Sobel Edge Detection to 3 Rows.
- * It Reads the 3 Rows from the 16 Four Line Sector Buffers and Stores the Produced Processed Row in the 16 One Line Sector Buffers.
- */
-void start_sobel_operations(LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_0,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_1,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_2,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_3,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_4,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_5,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_6,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_7,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_8,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_9,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_10,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_11,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_12,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_13,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_14,
-                            LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_15,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_0,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_1,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_2,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_3,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_4,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_5,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_6,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_7,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_8,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_9,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_10,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_11,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_12,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_13,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_14,
-                            LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_15,
-                            int sector_size,
-                            int first,
-                            int second,
-                            int last)
-{
-	#pragma HLS PIPELINE II=1
-
-	/*
-	 * Loop for as many Times as the Number of Columns in each Sector Buffer in Order to Apply Sobel Edge Detection to all the Pixels.
-	 */
-	loop_sobel_operations:
-	for (int col = 0; col <= sector_size; col++)
-	{
-
-		RGB edge0, edge1, edge2, edge3, edge4, edge5, edge6, edge7,
-			   edge8, edge9, edge10, edge11, edge12, edge13, edge14, edge15;
-
-		/*
-		 * Create 16 Instances of the sobel_operator Function Template.
-		 * Each Instance Applies Sobel Edge Detection to the Current Pixel of each Four Line Sector Buffer.
-		 * All Instances are Executed Concurrently Since there is no Dependency between the 16 Four Line Sector Buffers.
-		 */
-		edge0 = sobel_operator<0>(LINE_BUFFER_SECTOR_0, col, first, second, last);
-		edge1 = sobel_operator<1>(LINE_BUFFER_SECTOR_1, col, first, second, last);
-		edge2 = sobel_operator<2>(LINE_BUFFER_SECTOR_2, col, first, second, last);
-		edge3 = sobel_operator<3>(LINE_BUFFER_SECTOR_3, col, first, second, last);
-		edge4 = sobel_operator<4>(LINE_BUFFER_SECTOR_4, col, first, second, last);
-		edge5 = sobel_operator<5>(LINE_BUFFER_SECTOR_5, col, first, second, last);
-		edge6 = sobel_operator<6>(LINE_BUFFER_SECTOR_6, col, first, second, last);
-		edge7 = sobel_operator<7>(LINE_BUFFER_SECTOR_7, col, first, second, last);
-		edge8 = sobel_operator<8>(LINE_BUFFER_SECTOR_8, col, first, second, last);
-		edge9 = sobel_operator<9>(LINE_BUFFER_SECTOR_9, col, first, second, last);
-		edge10 = sobel_operator<10>(LINE_BUFFER_SECTOR_10, col, first, second, last);
-		edge11 = sobel_operator<11>(LINE_BUFFER_SECTOR_11, col, first, second, last);
-		edge12 = sobel_operator<12>(LINE_BUFFER_SECTOR_12, col, first, second, last);
-		edge13 = sobel_operator<13>(LINE_BUFFER_SECTOR_13, col, first, second, last);
-		edge14 = sobel_operator<14>(LINE_BUFFER_SECTOR_14, col, first, second, last);
-		edge15 = sobel_operator<15>(LINE_BUFFER_SECTOR_15, col, first, second, last);
-
-		/*
-		 * Insert the Processed Pixels by the Sobel Operator to the Correct Position in the One Line Sector Buffers.
-		 */
-		OUTPUT_BUFFER_SECTOR_0->insert(edge0, 0, col);
-		OUTPUT_BUFFER_SECTOR_1->insert(edge1, 0, col);
-		OUTPUT_BUFFER_SECTOR_2->insert(edge2, 0, col);
-		OUTPUT_BUFFER_SECTOR_3->insert(edge3, 0, col);
-		OUTPUT_BUFFER_SECTOR_4->insert(edge4, 0, col);
-		OUTPUT_BUFFER_SECTOR_5->insert(edge5, 0, col);
-		OUTPUT_BUFFER_SECTOR_6->insert(edge6, 0, col);
-		OUTPUT_BUFFER_SECTOR_7->insert(edge7, 0, col);
-		OUTPUT_BUFFER_SECTOR_8->insert(edge8, 0, col);
-		OUTPUT_BUFFER_SECTOR_9->insert(edge9, 0, col);
-		OUTPUT_BUFFER_SECTOR_10->insert(edge10, 0, col);
-		OUTPUT_BUFFER_SECTOR_11->insert(edge11, 0, col);
-		OUTPUT_BUFFER_SECTOR_12->insert(edge12, 0, col);
-		OUTPUT_BUFFER_SECTOR_13->insert(edge13, 0, col);
-		OUTPUT_BUFFER_SECTOR_14->insert(edge14, 0, col);
-		OUTPUT_BUFFER_SECTOR_15->insert(edge15, 0, col);
-	}
-}
-
-/*
- * receive_post_line()
- *
- * Receives an Image Row through the AXI Stream In Interface.
- * The receive_post_line() Takes Over to Equally Split and Distribute the Row (while being Received) to the 16 Four Line Sector Buffers.
- */
-void receive_post_line(AXI_PIXEL *STREAM_IN,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_0,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_1,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_2,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_3,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_4,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_5,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_6,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_7,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_8,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_9,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_10,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_11,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_12,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_13,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_14,
-                       LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_15,
-                       int row,
-                       int *sector_iter_array)
-{
-
-		/* Receive the Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_0.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_0 Starting from the Second Field.
-		 */
-		loop_in_sector_0:
-		for (int col = 0; col < sector_iter_array[0]; col++)
-		{
-		#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the First Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_0.
-			LINE_BUFFER_SECTOR_0->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_0 to the First Field of the LINE_BUFFER_SECTOR_1.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_0 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_1 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_1->insert(LINE_BUFFER_SECTOR_0->getval(row, sector_iter_array[0]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_1.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_0 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_1 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_0.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_1 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_2.
-		 */
-		loop_in_sector_1:
-		for (int col = 0; col < sector_iter_array[1]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_1.
-			LINE_BUFFER_SECTOR_1->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_1 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_0.
-		//The First Pixel of the LINE_BUFFER_SECTOR_1 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_0 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_0->insert(LINE_BUFFER_SECTOR_1->getval(row, 1), row, sector_iter_array[0] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_1 to the First Field of the LINE_BUFFER_SECTOR_2.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_1 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_2 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_2->insert(LINE_BUFFER_SECTOR_1->getval(row, sector_iter_array[1]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_2.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_2 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_2 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_1.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_2 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_3.
-		 */
-		loop_in_sector_2:
-		for (int col = 0; col < sector_iter_array[2]; col++)
-		{
-		#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_2.
-			LINE_BUFFER_SECTOR_2->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_2 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_1.
-		//The First Pixel of the LINE_BUFFER_SECTOR_2 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_1 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_1->insert(LINE_BUFFER_SECTOR_2->getval(row, 1), row, sector_iter_array[1] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_2 to the First Field of the LINE_BUFFER_SECTOR_3.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_2 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_3 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_3->insert(LINE_BUFFER_SECTOR_2->getval(row, sector_iter_array[2]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_3.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_3 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_3 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_2.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_3 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_4.
-		 */
-		loop_in_sector_3:
-		for (int col = 0; col < sector_iter_array[3]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_3.
-			LINE_BUFFER_SECTOR_3->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_3 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_2.
-		//The First Pixel of the LINE_BUFFER_SECTOR_3 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_2 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_2->insert(LINE_BUFFER_SECTOR_3->getval(row, 1), row, sector_iter_array[2] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_3 to the First Field of the LINE_BUFFER_SECTOR_4.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_3 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_4 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_4->insert(LINE_BUFFER_SECTOR_3->getval(row, sector_iter_array[3]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_4.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_4 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_4 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_3.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_4 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_5.
-		 */
-		loop_in_sector_4:
-		for (int col = 0; col < sector_iter_array[4]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_4.
-			LINE_BUFFER_SECTOR_4->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_4 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_3.
-		//The First Pixel of the LINE_BUFFER_SECTOR_4 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_3 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_3->insert(LINE_BUFFER_SECTOR_4->getval(row, 1), row, sector_iter_array[3] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_4 to the First Field of the LINE_BUFFER_SECTOR_5.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_4 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_5 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_5->insert(LINE_BUFFER_SECTOR_4->getval(row, sector_iter_array[4]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_5.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_5 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_5 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_4.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_5 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_6.
-		 */
-		loop_in_sector_5:
-		for (int col = 0; col < sector_iter_array[5]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_5.
-			LINE_BUFFER_SECTOR_5->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_5 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_4.
-		//The First Pixel of the LINE_BUFFER_SECTOR_5 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_4 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_4->insert(LINE_BUFFER_SECTOR_5->getval(row, 1), row, sector_iter_array[4] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_5 to the First Field of the LINE_BUFFER_SECTOR_6.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_5 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_6 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_6->insert(LINE_BUFFER_SECTOR_5->getval(row, sector_iter_array[5]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_6.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_6 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_6 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_5.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_6 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_7.
-		 */
-		loop_in_sector_6:
-		for (int col = 0; col < sector_iter_array[6]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_6.
-			LINE_BUFFER_SECTOR_6->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_6 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_5.
-		//The First Pixel of the LINE_BUFFER_SECTOR_6 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_5 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_5->insert(LINE_BUFFER_SECTOR_6->getval(row, 1), row, sector_iter_array[5] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_6 to the First Field of the LINE_BUFFER_SECTOR_7.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_6 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_7 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_7->insert(LINE_BUFFER_SECTOR_6->getval(row, sector_iter_array[6]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_7.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_7 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_7 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_6.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_7 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_8.
-		 */
-		loop_in_sector_7:
-		for (int col = 0; col < sector_iter_array[7]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_7.
-			LINE_BUFFER_SECTOR_7->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_7 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_6.
-		//The First Pixel of the LINE_BUFFER_SECTOR_7 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_6 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_6->insert(LINE_BUFFER_SECTOR_7->getval(row, 1), row, sector_iter_array[6] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_7 to the First Field of the LINE_BUFFER_SECTOR_8.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_7 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_8 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_8->insert(LINE_BUFFER_SECTOR_7->getval(row, sector_iter_array[7]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_8.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_8 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_8 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_7.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_8 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_9.
-		 */
-		loop_in_sector_8:
-		for (int col = 0; col < sector_iter_array[8]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_8.
-			LINE_BUFFER_SECTOR_8->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_8 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_7.
-		//The First Pixel of the LINE_BUFFER_SECTOR_8 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_7 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_7->insert(LINE_BUFFER_SECTOR_8->getval(row, 1), row, sector_iter_array[7] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_8 to the First Field of the LINE_BUFFER_SECTOR_9.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_8 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_9 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_9->insert(LINE_BUFFER_SECTOR_8->getval(row, sector_iter_array[8]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_9.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_9 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_9 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_8.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_9 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_10.
-		 */
-		loop_in_sector_9:
-		for (int col = 0; col < sector_iter_array[9]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_9.
-			LINE_BUFFER_SECTOR_9->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_9 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_8.
-		//The First Pixel of the LINE_BUFFER_SECTOR_9 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_8 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_8->insert(LINE_BUFFER_SECTOR_9->getval(row, 1), row, sector_iter_array[8] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_9 to the First Field of the LINE_BUFFER_SECTOR_10.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_9 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_10 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_10->insert(LINE_BUFFER_SECTOR_9->getval(row, sector_iter_array[9]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_10.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_10 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_10 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_9.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_10 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_11.
-		 */
-		loop_in_sector_10:
-		for (int col = 0; col < sector_iter_array[10]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_10.
-			LINE_BUFFER_SECTOR_10->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_10 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_9.
-		//The First Pixel of the LINE_BUFFER_SECTOR_10 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_9 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_9->insert(LINE_BUFFER_SECTOR_10->getval(row, 1), row, sector_iter_array[9] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_10 to the First Field of the LINE_BUFFER_SECTOR_11.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_10 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_11 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_11->insert(LINE_BUFFER_SECTOR_10->getval(row, sector_iter_array[10]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_11.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_11 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_11 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_10.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_11 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_12.
-		 */
-		loop_in_sector_11:
-		for (int col = 0; col < sector_iter_array[11]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_11.
-			LINE_BUFFER_SECTOR_11->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_11 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_10.
-		//The First Pixel of the LINE_BUFFER_SECTOR_11 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_10 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_10->insert(LINE_BUFFER_SECTOR_11->getval(row, 1), row, sector_iter_array[10] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_11 to the First Field of the LINE_BUFFER_SECTOR_12.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_11 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_12 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_12->insert(LINE_BUFFER_SECTOR_11->getval(row, sector_iter_array[11]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_12.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_12 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_12 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_11.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_12 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_13.
-		 */
-		loop_in_sector_12:
-		for (int col = 0; col < sector_iter_array[12]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_12.
-			LINE_BUFFER_SECTOR_12->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_12 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_11.
-		//The First Pixel of the LINE_BUFFER_SECTOR_12 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_11 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_11->insert(LINE_BUFFER_SECTOR_12->getval(row, 1), row, sector_iter_array[11] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_12 to the First Field of the LINE_BUFFER_SECTOR_13.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_12 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_13 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_13->insert(LINE_BUFFER_SECTOR_12->getval(row, sector_iter_array[12]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_13.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_13 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_13 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_12.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_13 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_14.
-		 */
-		loop_in_sector_13:
-		for (int col = 0; col < sector_iter_array[13]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_13.
-			LINE_BUFFER_SECTOR_13->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_13 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_12.
-		//The First Pixel of the LINE_BUFFER_SECTOR_13 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_12 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_12->insert(LINE_BUFFER_SECTOR_13->getval(row, 1), row, sector_iter_array[12] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_13 to the First Field of the LINE_BUFFER_SECTOR_14.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_13 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_14 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_14->insert(LINE_BUFFER_SECTOR_13->getval(row, sector_iter_array[13]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_14.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_14 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_14 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_13.
-		 * The Field Right After the Last Pixel of LINE_BUFFER_SECTOR_14 is Used to Insert the First Pixel of the LINE_BUFFER_SECTOR_15.
-		 */
-		loop_in_sector_14:
-		for (int col = 0; col < sector_iter_array[14]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_14.
-			LINE_BUFFER_SECTOR_14->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_14 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_13.
-		//The First Pixel of the LINE_BUFFER_SECTOR_14 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_13 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_13->insert(LINE_BUFFER_SECTOR_14->getval(row, 1), row, sector_iter_array[13] + 1);
-
-		//Insert the Y Value of the Last Pixel of the LINE_BUFFER_SECTOR_14 to the First Field of the LINE_BUFFER_SECTOR_15.
-		//The Last Pixel of the LINE_BUFFER_SECTOR_14 is the Left Neighbor of the First Pixel of the LINE_BUFFER_SECTOR_15 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_15->insert(LINE_BUFFER_SECTOR_14->getval(row, sector_iter_array[14]), row, 0);
-
-
-		/* Receive the Next Amount of Pixels of the Current Row that Should be Stored in the LINE_BUFFER_SECTOR_15.
-		 *
-		 * NOTE that this Loop Fills the Fields of the LINE_BUFFER_SECTOR_15 Starting from the Second Field.
-		 * The First Field of the LINE_BUFFER_SECTOR_15 is Used to Insert the Last Pixel of the LINE_BUFFER_SECTOR_14.
-		 */
-		loop_in_sector_15:
-		for (int col = 0; col < sector_iter_array[15]; col++)
-		{
-			#pragma HLS PIPELINE II=1
-
-			unsigned char tempx;
-			AXI_PIXEL input_pixel;
-			RGB new_pix;
-
-			//Receive through the AXI Stream In Interface 4 Bytes that Represent the Current Pixel.
-			input_pixel = STREAM_IN[col];
-
-			//Get the First Byte from the Received Data that Represents the Blue Value of the Pixel.
-			new_pix.B = input_pixel.data.range(7, 0);
-
-			//Get the Second Byte from the Received Data that Represents the Green Value of the Pixel.
-			new_pix.G = input_pixel.data.range(15, 8);
-
-			//Get the Third Byte from the Received Data that Represents the Red Value of the Pixel.
-			new_pix.R = input_pixel.data.range(23, 16);
-
-			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
-			tempx = rgb2y(new_pix);
-
-			//Insert the Y Value of the Received Pixel to the Current Field of the LINE_BUFFER_SECTOR_15.
-			LINE_BUFFER_SECTOR_15->insert(tempx, row, col+1);
-		}
-
-		//Insert the Y Value of the First Pixel of the LINE_BUFFER_SECTOR_15 to the Field Right After the Last Pixel of the LINE_BUFFER_SECTOR_14.
-		//The First Pixel of the LINE_BUFFER_SECTOR_15 is the Right Neighbor of the Last Pixel of the LINE_BUFFER_SECTOR_14 which is Required to Apply Sobel Edge Detection.
-		LINE_BUFFER_SECTOR_14->insert(LINE_BUFFER_SECTOR_15->getval(row, 1), row, sector_iter_array[14] + 1);
-
-	}
-
-/*
- * send_line()
+ * Produces a Single Processed Row by Applying Sobel Edge Detection to the Last KERNEL Received Rows.
+ * It Reads the Rows from the Input Sector Buffers and Stores the Produced Processed Row in the Output Sector Buffers.
+ * The line_index Holds the Line of the Input Sector Buffers where each Row of the Neighborhood is Stored (Oldest Row First).
+ * Each Iteration Processes LANES Columns of each Sector so a Row Takes sector_cols / LANES Iterations.
  *
- * Send a Processed Image Row through the AXI Stream Out Interface.
- * The Processed Image is Distributed in the 16 One Line Sector Buffers so the send_line() will Send the Pixels of each Sector Buffer Sequencially.
+ * If the Filter Mode is other than FILTER_MODE_SOBEL the Window is Given to the convolution_operator() instead of the sobel_operator().
+ * In the Gradient Output Formats the Window is Given to the gradient_operator() whatever the Filter Mode.
  */
-void send_line(AXI_PIXEL *STREAM_OUT,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_0,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_1,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_2,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_3,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_4,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_5,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_6,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_7,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_8,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_9,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_10,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_11,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_12,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_13,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_14,
-               LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_15,
-               int *sector_iter_array,
-               int packet_mode_enable,
-               int packet_size,
-               int *remain_bytes)
-{
-
-	int index = 0;
-	AXI_PIXEL output_pixel;
-
-	output_pixel.strb = 0xF; //Set the Strobe of the AXI Stream Interface so that all 4 Transmitted Bytes are Valid.
-	output_pixel.user = 0x1;
-	output_pixel.tdest = 0x1;
-
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_0 (One Line Sector Buffer).
-	 */
-	loop_out_sector_0:
-	for (int col = 0; col < sector_iter_array[0]; col++)
-	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_0.
-		convert = OUTPUT_BUFFER_SECTOR_0->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
-
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
-
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
-
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
-
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
-	}
-
-
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_1 (One Line Sector Buffer).
-	 */
-	loop_out_sector_1:
-	for (int col = 0; col < sector_iter_array[1]; col++)
-	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_1.
-		convert = OUTPUT_BUFFER_SECTOR_1->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
-
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
-
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
-
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
-
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
-	}
-
+template<class ENGINE, int LANES>
+void start_sobel_operations(typename ENGINE::INPUT_BUFFER LINE_BUFFER_SECTOR[ENGINE::SECTOR_COUNT],
+                            typename ENGINE::OUTPUT_BUFFER OUTPUT_BUFFER_SECTOR[ENGINE::SECTOR_COUNT],
+                            int sector_cols,
+                            int line_index[ENGINE::WINDOW_SIZE],
+                            FILTER_CONFIG filter)
+{
+	#pragma HLS PIPELINE II=1
 
 	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_2 (One Line Sector Buffer).
+	 * Loop for as many Times as Required to Cover the Columns of the Widest Sector Buffer in Order to Apply Sobel Edge Detection to all the Pixels.
 	 */
-	loop_out_sector_2:
-	for (int col = 0; col < sector_iter_array[2]; col++)
+	loop_sobel_operations:
+	for (int col = 0; col < sector_cols; col += LANES)
 	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_2.
-		convert = OUTPUT_BUFFER_SECTOR_2->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
+		/*
+		 * Create a Group of LANES Processing Units for each Sector Buffer.
+		 * Each Unit Gets the Neighborhood of its Pixel in a Window and Applies Sobel Edge Detection to it.
+		 * All Units are Executed Concurrently Since there is no Dependency between the Sector Buffers.
+		 */
+		loop_sobel_sectors:
+		for (int sector = 0; sector < ENGINE::SECTOR_COUNT; sector++)
+		{
+		#pragma HLS UNROLL
+			for (int lane = 0; lane < LANES; lane++)
+			{
+			#pragma HLS UNROLL
+				typename ENGINE::WINDOW window;
+				RGB edge;
+
+				//Copy the Neighborhood of the Current Pixel from the Input Sector Buffer to the Window.
+				for (int i = 0; i < ENGINE::WINDOW_SIZE; i++)
+				{
+				#pragma HLS UNROLL
+					for (int j = 0; j < ENGINE::WINDOW_SIZE; j++)
+					{
+					#pragma HLS UNROLL
+						window.insert(LINE_BUFFER_SECTOR[sector].getval(line_index[i], col + lane + j), i, j);
+					}
+				}
+
+				if (filter.output_format != OUTPUT_FORMAT_PIXEL)
+				{
+					edge = gradient_operator<ENGINE::WINDOW_SIZE>(&window, filter);
+				}
+				else if (filter.mode == FILTER_MODE_SOBEL)
+				{
+					edge = sobel_operator<ENGINE::WINDOW_SIZE>(&window);
+				}
+				else
+				{
+					edge = convolution_operator<ENGINE::WINDOW_SIZE>(&window, filter);
+				}
+
+				//Insert the Processed Pixel to the Correct Position in the Output Sector Buffer.
+				OUTPUT_BUFFER_SECTOR[sector].insert(edge, 0, col + lane);
+			}
 		}
+	}
+}
 
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
-
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
+/*
+ * receive_pixels()
+ *
+ * Receives the Next count (up to LANES) Pixels of the Current Row through the AXI Stream In Interface and Returns their Luminance Values.
+ *
+ * Each Beat of the AXI Stream In Interface Carries 4 * LANES Bytes.
+ * The Received Bytes are Held in the held_bytes and a New Beat is Received only when the Held Bytes are not Enough for the Requested Pixels.
+ * The held_bytes Keep their Content between the Rows so a Row May Start in the Middle of a Beat.
+ *
+ * In the INPUT_FORMAT_BGRX Format each Pixel Occupies 4 Bytes (Blue, Green, Red and a Padding Byte) and is Converted with the rgb2y().
+ * In the INPUT_FORMAT_BGR Format the Pixels are Packed in 3 Bytes so a Pixel May Start in one Beat and End in the Next.
+ * In the INPUT_FORMAT_LUMA Format the Host Has Already Converted the Pixels so each Byte is a Luminance Value that is Used as it is.
+ */
+template<int LANES>
+void receive_pixels(typename AXI_LANES<LANES>::BEAT *STREAM_IN,
+                    int *index,
+                    typename AXI_LANES<LANES>::HOLD *held_bytes,
+                    int *held_count,
+                    int input_format,
+                    int count,
+                    unsigned char luma[LANES])
+{
+	#pragma HLS INLINE
 
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+	typename AXI_LANES<LANES>::BEAT input_pixel;
+	int pixel_bytes; //The Number of Bytes that each Pixel Occupies in the Received Data.
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
+	if (input_format == INPUT_FORMAT_LUMA)
+	{
+		pixel_bytes = 1;
 	}
-
-
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_3 (One Line Sector Buffer).
-	 */
-	loop_out_sector_3:
-	for (int col = 0; col < sector_iter_array[3]; col++)
+	else if (input_format == INPUT_FORMAT_BGR)
 	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_3.
-		convert = OUTPUT_BUFFER_SECTOR_3->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
-
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
-
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
-
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
-
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
+		pixel_bytes = 3;
 	}
-
-
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_4 (One Line Sector Buffer).
-	 */
-	loop_out_sector_4:
-	for (int col = 0; col < sector_iter_array[4]; col++)
+	else
 	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_4.
-		convert = OUTPUT_BUFFER_SECTOR_4->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
-
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
+		pixel_bytes = 4;
+	}
 
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
+	//The Last Group of a Sector May Have Fewer than LANES Pixels.
+	if (count > LANES)
+	{
+		count = LANES;
+	}
 
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+	//Receive a New Beat and Append its Bytes after the Held Bytes if the Requested Pixels are not Held.
+	if (*held_count < pixel_bytes * count)
+	{
+		input_pixel = STREAM_IN[(*index)++];
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
+		*held_bytes = *held_bytes | ((typename AXI_LANES<LANES>::HOLD)input_pixel.data << (8 * (*held_count)));
+		*held_count = *held_count + (4 * LANES);
 	}
 
-
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_5 (One Line Sector Buffer).
-	 */
-	loop_out_sector_5:
-	for (int col = 0; col < sector_iter_array[5]; col++)
+	for (int lane = 0; lane < LANES; lane++)
 	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
+	#pragma HLS UNROLL
+		RGB new_pix;
+		ap_uint<32> pixel_data;
 
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_5.
-		convert = OUTPUT_BUFFER_SECTOR_5->getval(0, col);
+		//The First Pixel is in the Least Significant Bytes of the Held Bytes.
+		pixel_data = (*held_bytes >> (8 * pixel_bytes * lane)).range(31, 0);
 
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
+		if (input_format == INPUT_FORMAT_LUMA)
 		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
+			luma[lane] = pixel_data.range(7, 0);
 		}
 		else
 		{
-			output_pixel.last = 0x0;
-		}
+			//Get the Blue, Green and Red Values of the Pixel from the First, Second and Third Byte of the Pixel Data.
+			new_pix.B = pixel_data.range(7, 0);
+			new_pix.G = pixel_data.range(15, 8);
+			new_pix.R = pixel_data.range(23, 16);
 
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
-
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
-
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
-
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
+			//Convert the Received Pixel from RGB to Y that Represents its Luminance Value.
+			luma[lane] = rgb2y(new_pix);
+		}
 	}
 
+	//Remove the Bytes of the Returned Pixels from the Held Bytes.
+	*held_bytes = *held_bytes >> (8 * pixel_bytes * count);
+	*held_count = *held_count - (pixel_bytes * count);
+}
 
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_6 (One Line Sector Buffer).
-	 */
-	loop_out_sector_6:
-	for (int col = 0; col < sector_iter_array[6]; col++)
-	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_6.
-		convert = OUTPUT_BUFFER_SECTOR_6->getval(0, col);
+/*
+ * store_pixels()
+ *
+ * Inserts the Luminance Values of a Group of up to LANES Received Pixels to an Input Sector Buffer.
+ * The Fields are Filled Starting after the First halo Fields since they Hold the Left Neighbors of the Sector.
+ */
+template<int LANES, typename BUFFER>
+void store_pixels(BUFFER *buffer,
+                  unsigned char luma[LANES],
+                  int row,
+                  int col,
+                  int count,
+                  int halo)
+{
+	#pragma HLS INLINE
 
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
+	for (int lane = 0; lane < LANES; lane++)
+	{
+	#pragma HLS UNROLL
+		if (lane < count)
 		{
-			output_pixel.last = 0x0;
+			buffer->insert(luma[lane], row, col + lane + halo);
 		}
+	}
+}
 
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
+/*
+ * receive_post_line()
+ *
+ * Receives an Image Row through the AXI Stream In Interface.
+ * The receive_post_line() Takes Over to Equally Split and Distribute the Row (while being Received) to the Input Sector Buffers.
+ * The Pixels are Received in Groups of LANES and the Format of the Received Bytes is Given by the input_format (See the receive_pixels()).
+ * In the INPUT_FORMAT_BGR and INPUT_FORMAT_LUMA Formats each Row is Padded to a Multiple of 4 Bytes so the input_padding Bytes are Dropped at the End of the Row.
+ *
+ * The Pixels of each Sector are Stored after its First HALO Fields.
+ * The First HALO Fields of a Sector are Used to Insert the Last Pixels of the Previous Sector (Left Neighbors)
+ * and the Fields Right After the Last Pixel of a Sector are Used to Insert the First Pixels of the Next Sector (Right Neighbors).
+ * The Neighbors are Required to Apply Sobel Edge Detection to the Pixels at the Borders of each Sector.
+ */
+template<class ENGINE, int LANES>
+void receive_post_line(typename AXI_LANES<LANES>::BEAT *STREAM_IN,
+                       typename ENGINE::INPUT_BUFFER LINE_BUFFER_SECTOR[ENGINE::SECTOR_COUNT],
+                       int row,
+                       int *sector_iter_array,
+                       int input_format,
+                       int input_padding,
+                       int *index,
+                       typename AXI_LANES<LANES>::HOLD *held_bytes,
+                       int *held_count)
+{
 
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
+		/*
+		 * The Sectors are Received Sequencially so the Loop is Unrolled to Create one Receive Loop per Sector Buffer.
+		 */
+		loop_in_sectors:
+		for (int sector = 0; sector < ENGINE::SECTOR_COUNT; sector++)
+		{
+		#pragma HLS UNROLL
 
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+			/* Receive the Amount of Pixels of the Current Row that Should be Stored in the Current Sector Buffer.
+			 */
+			loop_in_sector:
+			for (int col = 0; col < sector_iter_array[sector]; col += LANES)
+			{
+			#pragma HLS PIPELINE II=1
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
-	}
+				unsigned char tempx[LANES];
 
+				//Receive the Next Group of Pixels through the AXI Stream In Interface and Get their Luminance Values According to the Input Format.
+				receive_pixels<LANES>(STREAM_IN, index, held_bytes, held_count, input_format, sector_iter_array[sector] - col, tempx);
 
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_7 (One Line Sector Buffer).
-	 */
-	loop_out_sector_7:
-	for (int col = 0; col < sector_iter_array[7]; col++)
-	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
+				//Insert the Y Values of the Received Pixels to the Current Fields of the Sector Buffer.
+				store_pixels<LANES>(&LINE_BUFFER_SECTOR[sector], tempx, row, col, sector_iter_array[sector] - col, ENGINE::HALO);
+			}
 
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_7.
-		convert = OUTPUT_BUFFER_SECTOR_7->getval(0, col);
+			for (int halo = 0; halo < ENGINE::HALO; halo++)
+			{
+			#pragma HLS UNROLL
+				//Insert the Y Values of the First Pixels of the Current Sector to the Fields Right After the Last Pixel of the Previous Sector.
+				if (sector > 0)
+				{
+					LINE_BUFFER_SECTOR[sector - 1].insert(LINE_BUFFER_SECTOR[sector].getval(row, ENGINE::HALO + halo), row, sector_iter_array[sector - 1] + ENGINE::HALO + halo);
+				}
 
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
+				//Insert the Y Values of the Last Pixels of the Current Sector to the First Fields of the Next Sector.
+				if (sector < ENGINE::SECTOR_COUNT - 1)
+				{
+					LINE_BUFFER_SECTOR[sector + 1].insert(LINE_BUFFER_SECTOR[sector].getval(row, sector_iter_array[sector] + halo), row, halo);
+				}
+			}
 		}
 
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
-
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
-
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+		//Drop the Padding Bytes of the Row so that the Next Row Starts with the Next Held Byte.
+		//NOTE that the Padding Bytes are Always Held at this Point Since the Padded Row Ends at a 4 Byte Boundary of the Received Beats.
+		*held_bytes = *held_bytes >> (8 * input_padding);
+		*held_count = *held_count - input_padding;
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
 	}
-	
 
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_8 (One Line Sector Buffer).
-	 */
-	loop_out_sector_8:
-	for (int col = 0; col < sector_iter_array[8]; col++)
-	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_8.
-		convert = OUTPUT_BUFFER_SECTOR_8->getval(0, col);
+/*
+ * send_full_beat()
+ *
+ * Sends a Beat of 4 * LANES Bytes through the AXI Stream Out Interface if more than a Whole Beat is Collected in the out_bytes.
+ * A Whole Beat is Kept Back until the Next Byte Arrives so that the Last Beat of the Image is Always Sent by the flush_output() with TLAST=1.
+ */
+template<int LANES>
+void send_full_beat(typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+                    int *index,
+                    typename AXI_LANES<LANES>::HOLD *out_bytes,
+                    int *out_count,
+                    int packet_mode_enable,
+                    int packet_size,
+                    int *remain_bytes)
+{
+	#pragma HLS INLINE
 
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
+	typename AXI_LANES<LANES>::BEAT output_pixel;
 
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
+	if (*out_count <= (4 * LANES))
+	{
+		return;
+	}
 
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
+	output_pixel.strb = -1; //Set the Strobe of the AXI Stream Interface so that all the Transmitted Bytes are Valid.
+	output_pixel.user = 0x1;
+	output_pixel.tdest = 0x1;
 
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+	//The First Collected Byte is Placed in the Least Significant Byte of the Beat.
+	output_pixel.data = out_bytes->range((32 * LANES) - 1, 0);
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
+	//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
+	if (packet_mode_enable == 1)
+	{
+		//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
+		output_pixel.last = is_packet_complete(remain_bytes, packet_size, 4 * LANES);
 	}
-
-
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_9 (One Line Sector Buffer).
-	 */
-	loop_out_sector_9:
-	for (int col = 0; col < sector_iter_array[9]; col++)
+	else
 	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_9.
-		convert = OUTPUT_BUFFER_SECTOR_9->getval(0, col);
+		output_pixel.last = 0x0;
+	}
 
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
+	//Send the Beat through the AXI Stream Out Interface.
+	STREAM_OUT[(*index)++] = output_pixel;
 
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
+	*out_bytes = *out_bytes >> (32 * LANES);
+	*out_count = *out_count - (4 * LANES);
+}
 
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
+/*
+ * send_pixels()
+ *
+ * Send a Group of up to LANES Processed Pixels through the AXI Stream Out Interface.
+ *
+ * The Bytes of the Pixels are Appended to the out_bytes and are Sent in Beats of 4 * LANES Bytes (See the send_full_beat()).
+ * The out_bytes Keep their Content between the Rows so a Row May Start in the Middle of a Beat.
+ *
+ * When the Packed Output Mode is Disabled each Edge Value is Sent as a 32 Bit Pixel with the Same Value in the Blue, Green and Red Bytes.
+ * When the Packed Output Mode is Enabled only the Edge Value (8 Bits) of each Pixel is Sent.
+ */
+template<int LANES>
+void send_pixels(typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+                 int *index,
+                 typename AXI_LANES<LANES>::HOLD *out_bytes,
+                 int *out_count,
+                 RGB pixel[LANES],
+                 int count,
+                 int packed_output_enable,
+                 int packet_mode_enable,
+                 int packet_size,
+                 int *remain_bytes)
+{
+	#pragma HLS INLINE
 
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+	typename AXI_LANES<LANES>::HOLD pixel_bytes = 0; //The Bytes of the Group of Pixels in the Order they are Sent.
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
+	//The Last Group of a Sector May Have Fewer than LANES Pixels.
+	if (count > LANES)
+	{
+		count = LANES;
 	}
 
-
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_10 (One Line Sector Buffer).
-	 */
-	loop_out_sector_10:
-	for (int col = 0; col < sector_iter_array[10]; col++)
+	for (int lane = 0; lane < LANES; lane++)
 	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_10.
-		convert = OUTPUT_BUFFER_SECTOR_10->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
+	#pragma HLS UNROLL
+		if (lane < count)
+		{
+			if (packed_output_enable == 1)
+			{
+				pixel_bytes.range((8 * lane) + 7, 8 * lane) = pixel[lane].R;
+			}
+			else
+			{
+				//Set the First, Second and Third Byte of the Pixel with the Blue, Green and Red Values of the Pixel.
+				pixel_bytes.range((32 * lane) + 7, 32 * lane)       = pixel[lane].B;
+				pixel_bytes.range((32 * lane) + 15, (32 * lane) + 8)  = pixel[lane].G;
+				pixel_bytes.range((32 * lane) + 23, (32 * lane) + 16) = pixel[lane].R;
+			}
 		}
-
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
-
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
-
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
-
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
 	}
 
+	*out_bytes = *out_bytes | (pixel_bytes << (8 * (*out_count)));
 
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_11 (One Line Sector Buffer).
-	 */
-	loop_out_sector_11:
-	for (int col = 0; col < sector_iter_array[11]; col++)
+	if (packed_output_enable == 1)
 	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
+		*out_count = *out_count + count;
+	}
+	else
+	{
+		*out_count = *out_count + (4 * count);
+	}
 
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_11.
-		convert = OUTPUT_BUFFER_SECTOR_11->getval(0, col);
+	send_full_beat<LANES>(STREAM_OUT, index, out_bytes, out_count, packet_mode_enable, packet_size, remain_bytes);
+}
 
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
+/*
+ * pad_output_row()
+ *
+ * Used at the End of a Row in Packed Output Mode to Append the output_padding Zero Bytes that Pad the Row to a Multiple of 4 Bytes.
+ * This Way each Row Occupies (cols + 3) / 4 * 4 Bytes in the Destination Memory.
+ */
+template<int LANES>
+void pad_output_row(typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+                    int *index,
+                    typename AXI_LANES<LANES>::HOLD *out_bytes,
+                    int *out_count,
+                    int output_padding,
+                    int packet_mode_enable,
+                    int packet_size,
+                    int *remain_bytes)
+{
+	#pragma HLS INLINE
 
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
+	//The Bytes after the out_count are Always Zero so only the Count is Increased.
+	*out_count = *out_count + output_padding;
 
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
+	send_full_beat<LANES>(STREAM_OUT, index, out_bytes, out_count, packet_mode_enable, packet_size, remain_bytes);
+}
 
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+/*
+ * flush_output()
+ *
+ * Sends the Last Beat of the Image with TLAST=1.
+ * If the Image Bytes are not an Integer Multiple of the Beat Size only the Strobe Bits of the Valid Bytes are Set.
+ */
+template<int LANES>
+void flush_output(typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+                  int *index,
+                  typename AXI_LANES<LANES>::HOLD *out_bytes,
+                  int *out_count)
+{
+	#pragma HLS INLINE
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
-	}
+	typename AXI_LANES<LANES>::BEAT output_pixel;
 
+	output_pixel.strb = 0;
 
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_12 (One Line Sector Buffer).
-	 */
-	loop_out_sector_12:
-	for (int col = 0; col < sector_iter_array[12]; col++)
+	for (int byte = 0; byte < (4 * LANES); byte++)
 	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_12.
-		convert = OUTPUT_BUFFER_SECTOR_12->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
+	#pragma HLS UNROLL
+		if (byte < *out_count)
 		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
+			output_pixel.strb[byte] = 1;
 		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
-
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
-
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
-
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
-
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
 	}
 
+	output_pixel.user = 0x1;
+	output_pixel.tdest = 0x1;
+	output_pixel.data = out_bytes->range((32 * LANES) - 1, 0);
 
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_13 (One Line Sector Buffer).
-	 */
-	loop_out_sector_13:
-	for (int col = 0; col < sector_iter_array[13]; col++)
-	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_13.
-		convert = OUTPUT_BUFFER_SECTOR_13->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
+	//Set the TLAST Signal to 1 to Indicate that this will be the Last Transmission of the Data.
+	output_pixel.last = 0x1;
 
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
+	STREAM_OUT[(*index)++] = output_pixel;
 
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
+	*out_bytes = 0;
+	*out_count = 0;
+}
 
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+/*
+ * send_zero_line()
+ *
+ * Sends a Row of Zero Pixels.
+ * The First and Last Line/Row of an Image Processed with Sobel Edge Detection are Always Filled with Zero Pixels.
+ */
+template<int LANES>
+void send_zero_line(typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+                    int *index,
+                    typename AXI_LANES<LANES>::HOLD *out_bytes,
+                    int *out_count,
+                    int cols,
+                    int output_padding,
+                    int packed_output_enable,
+                    int packet_mode_enable,
+                    int packet_size,
+                    int *remain_bytes)
+{
+	RGB zero_pixels[LANES];
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
+	for (int lane = 0; lane < LANES; lane++)
+	{
+	#pragma HLS UNROLL
+		zero_pixels[lane].R = zero_pixels[lane].G = zero_pixels[lane].B = 0;
 	}
 
-
-	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_14 (One Line Sector Buffer).
-	 */
-	loop_out_sector_14:
-	for (int col = 0; col < sector_iter_array[14]; col++)
+	loop_zero_line:
+	for (int col = 0; col < cols; col += LANES)
 	{
 	#pragma HLS PIPELINE II=1
-		RGB convert;
-
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_14.
-		convert = OUTPUT_BUFFER_SECTOR_14->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
-		{
-			output_pixel.last = 0x0;
-		}
 
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
+		send_pixels<LANES>(STREAM_OUT, index, out_bytes, out_count, zero_pixels, cols - col, packed_output_enable, packet_mode_enable, packet_size, remain_bytes);
+	}
 
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
+	pad_output_row<LANES>(STREAM_OUT, index, out_bytes, out_count, output_padding, packet_mode_enable, packet_size, remain_bytes);
+}
 
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+/*
+ * load_pixels()
+ *
+ * Reads a Group of LANES Processed Pixels from an Output Sector Buffer.
+ */
+template<int LANES, typename BUFFER>
+void load_pixels(BUFFER *buffer,
+                 RGB pixel[LANES],
+                 int col)
+{
+	#pragma HLS INLINE
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
+	for (int lane = 0; lane < LANES; lane++)
+	{
+	#pragma HLS UNROLL
+		pixel[lane] = buffer->getval(0, col + lane);
 	}
+}
 
+/*
+ * send_line()
+ *
+ * Send a Processed Image Row through the AXI Stream Out Interface.
+ * The Processed Image is Distributed in the Output Sector Buffers so the send_line() will Send the Pixels of each Sector Buffer Sequencially.
+ * The Pixels are Sent in Groups of LANES so each Iteration Fills a Whole Beat of the AXI Stream Out Interface.
+ * If the packed_output_enable is Set the Row is Sent as 8 Bit Edge Values instead of 32 Bit Pixels.
+ */
+template<class ENGINE, int LANES>
+void send_line(typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+               typename ENGINE::OUTPUT_BUFFER OUTPUT_BUFFER_SECTOR[ENGINE::SECTOR_COUNT],
+               int *sector_iter_array,
+               int packet_mode_enable,
+               int packet_size,
+               int *remain_bytes,
+               int packed_output_enable,
+               int output_padding,
+               int *index,
+               typename AXI_LANES<LANES>::HOLD *out_bytes,
+               int *out_count)
+{
 
 	/*
-	 * Send ALL the Pixels of the Processed Row that are Stored in the OUTPUT_BUFFER_SECTOR_15 (One Line Sector Buffer).
+	 * The Sectors are Sent Sequencially so the Loop is Unrolled to Create one Send Loop per Sector Buffer.
 	 */
-	loop_out_sector_15:
-	for (int col = 0; col < sector_iter_array[15]; col++)
+	loop_out_sectors:
+	for (int sector = 0; sector < ENGINE::SECTOR_COUNT; sector++)
 	{
-	#pragma HLS PIPELINE II=1
-		RGB convert;
+	#pragma HLS UNROLL
 
-		//Get the Processed Pixel from the Current Field of the OUTPUT_BUFFER_SECTOR_15.
-		convert = OUTPUT_BUFFER_SECTOR_15->getval(0, col);
-
-		//If the Packet Mode is Enabled then we Have to Set the TLAST to 1 if a Full Packet of Size packet_size is Transmitted.
-		if (packet_mode_enable == 1)
-		{
-			//The TLAST(last) Gets the Return Value of the is_packet_complete() which Returns 1 if the Number of Transmitted Bytes is Equal to the Packet Size.
-			output_pixel.last = is_packet_complete(remain_bytes, packet_size);
-		}
-		else
+		/*
+		 * Send ALL the Pixels of the Processed Row that are Stored in the Current Output Sector Buffer.
+		 */
+		loop_out_sector:
+		for (int col = 0; col < sector_iter_array[sector]; col += LANES)
 		{
-			output_pixel.last = 0x0;
-		}
-
-		//Set the First Byte of the Output Data with the Blue Value of the Pixel.
-		output_pixel.data.range(7, 0)   = convert.B;
-
-		//Set the Second Byte of the Output Data with the Green Value of the Pixel.
-		output_pixel.data.range(15, 8)  = convert.G;
+		#pragma HLS PIPELINE II=1
+			RGB convert[LANES];
 
-		//Set the Third Byte of the Output Data with the Red Value of the Pixel.
-		output_pixel.data.range(23, 16) = convert.R;
+			//Get the Processed Pixels from the Current Fields of the Output Sector Buffer.
+			load_pixels<LANES>(&OUTPUT_BUFFER_SECTOR[sector], convert, col);
 
-		//Send the Current Processed Pixel through the AXI Stream Out Interface.
-		STREAM_OUT[index++] = output_pixel;
+			//Send the Current Processed Pixels through the AXI Stream Out Interface.
+			send_pixels<LANES>(STREAM_OUT, index, out_bytes, out_count, convert, sector_iter_array[sector] - col, packed_output_enable, packet_mode_enable, packet_size, remain_bytes);
+		}
 	}
 
+	//In Packed Output Mode Pad the Row to a Multiple of 4 Bytes (See the pad_output_row()).
+	pad_output_row<LANES>(STREAM_OUT, index, out_bytes, out_count, output_padding, packet_mode_enable, packet_size, remain_bytes);
+
 }
+
+/*
+ * Explicit Instantiations of the Templates that are Called by the sobel_filter_lanes() for each Supported Number of Lanes.
+ */
+#define INSTANTIATE_SOBEL_LANES(ENGINE, LANES) \
+	template void start_sobel_operations<ENGINE, LANES>( \
+		ENGINE::INPUT_BUFFER LINE_BUFFER_SECTOR[ENGINE::SECTOR_COUNT], \
+		ENGINE::OUTPUT_BUFFER OUTPUT_BUFFER_SECTOR[ENGINE::SECTOR_COUNT], \
+		int sector_cols, \
+		int line_index[ENGINE::WINDOW_SIZE], \
+		FILTER_CONFIG filter); \
+	template void receive_post_line<ENGINE, LANES>( \
+		AXI_LANES<LANES>::BEAT *STREAM_IN, \
+		ENGINE::INPUT_BUFFER LINE_BUFFER_SECTOR[ENGINE::SECTOR_COUNT], \
+		int row, \
+		int *sector_iter_array, \
+		int input_format, \
+		int input_padding, \
+		int *index, \
+		AXI_LANES<LANES>::HOLD *held_bytes, \
+		int *held_count); \
+	template void send_line<ENGINE, LANES>( \
+		AXI_LANES<LANES>::BEAT *STREAM_OUT, \
+		ENGINE::OUTPUT_BUFFER OUTPUT_BUFFER_SECTOR[ENGINE::SECTOR_COUNT], \
+		int *sector_iter_array, \
+		int packet_mode_enable, \
+		int packet_size, \
+		int *remain_bytes, \
+		int packed_output_enable, \
+		int output_padding, \
+		int *index, \
+		AXI_LANES<LANES>::HOLD *out_bytes, \
+		int *out_count); \
+	template void send_zero_line<LANES>( \
+		AXI_LANES<LANES>::BEAT *STREAM_OUT, \
+		int *index, \
+		AXI_LANES<LANES>::HOLD *out_bytes, \
+		int *out_count, \
+		int cols, \
+		int output_padding, \
+		int packed_output_enable, \
+		int packet_mode_enable, \
+		int packet_size, \
+		int *remain_bytes); \
+	template void flush_output<LANES>( \
+		AXI_LANES<LANES>::BEAT *STREAM_OUT, \
+		int *index, \
+		AXI_LANES<LANES>::HOLD *out_bytes, \
+		int *out_count);
+
+INSTANTIATE_SOBEL_LANES(SOBEL_ENGINE, 1)
+INSTANTIATE_SOBEL_LANES(SOBEL_ENGINE, 2)
+INSTANTIATE_SOBEL_LANES(SOBEL_ENGINE, 4)
+
+/*
+ * The Single Lane Stream Operations that are, also, Called by the Stages of the sobel_pipeline().
+ */
+template void receive_pixels<1>(
+	AXI_LANES<1>::BEAT *STREAM_IN,
+	int *index,
+	AXI_LANES<1>::HOLD *held_bytes,
+	int *held_count,
+	int input_format,
+	int count,
+	unsigned char luma[1]);
+template void send_pixels<1>(
+	AXI_LANES<1>::BEAT *STREAM_OUT,
+	int *index,
+	AXI_LANES<1>::HOLD *out_bytes,
+	int *out_count,
+	RGB pixel[1],
+	int count,
+	int packed_output_enable,
+	int packet_mode_enable,
+	int packet_size,
+	int *remain_bytes);
+template void pad_output_row<1>(
+	AXI_LANES<1>::BEAT *STREAM_OUT,
+	int *index,
+	AXI_LANES<1>::HOLD *out_bytes,
+	int *out_count,
+	int output_padding,
+	int packet_mode_enable,
+	int packet_size,
+	int *remain_bytes);
@@ -35,18 +35,17 @@ unsigned char rgb2y(RGB pix);
 /*
  * Template of the sobel_operator()
  *
- * The sobel_operator() Makes Sobel Computation Using a 3x3 Neighborhood
+ * The sobel_operator() Makes Sobel Computation Using the 3x3 Neighborhood at the Center of a KERNEL x KERNEL Window.
+ * The Operator is Inlined so that each Sector and Lane Gets its own Processing Unit when the Caller Loops are Unrolled.
  */
-template<int dummy_index>
-RGB sobel_operator(LINE4_SECTOR_BUFFER *window,
-		           unsigned int x_index,
-		           unsigned int y_first,
-		           unsigned int y_second,
-		           unsigned int y_last)
+template<int KERNEL>
+RGB sobel_operator(ap_window<unsigned char, KERNEL, KERNEL> *window)
 {
-	#pragma HLS INLINE off
+	#pragma HLS INLINE
 	#pragma HLS EXPRESSION_BALANCE off
 
+	const int center = (KERNEL - 1) / 2;
+
 	short x_weight = 0;
 	short y_weight = 0;
 
@@ -69,50 +68,24 @@ RGB sobel_operator(LINE4_SECTOR_BUFFER *window,
                               {-1,-2,-1}};
 	#pragma HLS ARRAY_PARTITION variable=y_op complete dim=1
 
+	//Compute Approximation of the Gradients in the X-Y Direction for each Row of x_op and y_op.
 	sobel_mul:
-	{
-	#pragma HLS PIPELINE II=1
-
-	//Compute Approximation of the Gradients in the X-Y Direction for the First Row of x_op and y_op.
-	for(char j = 0; j < 3; j++)
+	for(char i = 0; i < 3; i++)
 	{
 	#pragma HLS UNROLL
-	#pragma HLS PIPELINE II=1
-
-		// X Direction Gradient
-		x_weight_array[j] = (window->getval(y_first,x_index + j) * x_op[0][j]);
-		// Y Direction Gradient
-		y_weight_array[j] = (window->getval(y_first,x_index + j) * y_op[0][j]);
-	}
-
-	//Compute Approximation of the Gradients in the X-Y Direction for the Second Row of x_op and y_op.
-	for(char j = 0; j < 3; j++)
-	{
-	#pragma HLS UNROLL
-	#pragma HLS PIPELINE II=1
-
-		// X Direction Gradient
-		x_weight_array[3+j] = (window->getval(y_second,x_index + j) * x_op[1][j]);
-		// Y Direction Gradient
-		y_weight_array[3+j] = (window->getval(y_second,x_index + j) * y_op[1][j]);
-	}
-
-	//Compute Approximation of the Gradients in the X-Y Direction for the Third Row of x_op and y_op.
-	for(char j = 0; j < 3; j++){
-	#pragma HLS UNROLL
-	#pragma HLS PIPELINE II=1
-
-		// X Direction Gradient
-		x_weight_array[6+j] = (window->getval(y_last,x_index + j) * x_op[2][j]);
-		// Y Direction Gradient
-		y_weight_array[6+j] = (window->getval(y_last,x_index + j) * y_op[2][j]);
-	}
+		for(char j = 0; j < 3; j++)
+		{
+		#pragma HLS UNROLL
 
+			// X Direction Gradient
+			x_weight_array[(3*i)+j] = (window->getval(center - 1 + i, center - 1 + j) * x_op[i][j]);
+			// Y Direction Gradient
+			y_weight_array[(3*i)+j] = (window->getval(center - 1 + i, center - 1 + j) * y_op[i][j]);
+		}
 	}
 
 	for(char j = 0; j < 9; j++) {
 	#pragma HLS UNROLL
-	#pragma HLS PIPELINE II=1
 
 		// X Direction Gradient
 		x_weight += x_weight_array[j];
@@ -139,86 +112,285 @@ RGB sobel_operator(LINE4_SECTOR_BUFFER *window,
   return pixel;
 }
 
+/*
+ * Template of the convolution_operator()
+ *
+ * The convolution_operator() Applies the Kernel of the Filter Registers (See the FILTER_CONFIG) to a KERNEL x KERNEL Window.
+ * The Central min(KERNEL, FILTER_TAPS) x min(KERNEL, FILTER_TAPS) Coefficients are Multiplied with the Pixels at the Same Positions around the Center of the Window.
+ *
+ * In the FILTER_MODE_LINEAR the X Weight is Shifted Right by the Filter Shift and Saturated to 0-255 (e.g. Gaussian Blur, Box or Sharpen).
+ * In the FILTER_MODE_GRADIENT the Sum of the Absolute X and Y Weights is Shifted Right, Saturated and Inverted
+ * so that Edges are Dark as in the sobel_operator() (e.g. Scharr or Prewitt).
+ * The Result is then Thresholded with the Filter Thresholds (a threshold_low of 0 and a threshold_high of 255 Disable the Thresholding).
+ */
+template<int KERNEL>
+RGB convolution_operator(ap_window<unsigned char, KERNEL, KERNEL> *window,
+                         FILTER_CONFIG filter)
+{
+	#pragma HLS INLINE
+
+	const int center = (KERNEL - 1) / 2;
+	const int reach = (center < (FILTER_TAPS - 1) / 2) ? center : (FILTER_TAPS - 1) / 2;
+
+	int x_weight = 0;
+	int y_weight = 0;
+	int weight;
+	int value;
+
+	RGB pixel;
+
+	//Multiply each Pixel of the Window with the Coefficients at the Same Position of the X and Y Kernels.
+	convolution_mul:
+	for(int i = -reach; i <= reach; i++)
+	{
+	#pragma HLS UNROLL
+		for(int j = -reach; j <= reach; j++)
+		{
+		#pragma HLS UNROLL
+			const int tap = ((((FILTER_TAPS - 1) / 2) + i) * FILTER_TAPS) + ((FILTER_TAPS - 1) / 2) + j;
+
+			ap_int<8> x_coefficient = filter.x_coefficients.range((8 * tap) + 7, 8 * tap);
+			ap_int<8> y_coefficient = filter.y_coefficients.range((8 * tap) + 7, 8 * tap);
+
+			x_weight += window->getval(center + i, center + j) * x_coefficient;
+			y_weight += window->getval(center + i, center + j) * y_coefficient;
+		}
+	}
+
+	if(filter.mode == FILTER_MODE_GRADIENT)
+	{
+		weight = (ABS(x_weight) + ABS(y_weight)) >> filter.shift;
+		value = 255 - ((weight > 255) ? 255 : weight);
+	}
+	else
+	{
+		//The Shift is Arithmetic so Negative Weights (e.g. of a Sharpen Kernel) Saturate to 0.
+		weight = x_weight >> filter.shift;
+		value = (weight < 0) ? 0 : ((weight > 255) ? 255 : weight);
+	}
+
+	//Thresholding
+	if(value > filter.threshold_high)
+	{
+		value = 255;
+	}
+	else if(value < filter.threshold_low)
+	{
+		value = 0;
+	}
+
+	pixel.R = pixel.G = pixel.B = value;
+
+	return pixel;
+}
+
+/*
+ * gradient_direction()
+ *
+ * Quantizes the Direction of a Gradient to one of the 4 DIRECTION_* Values.
+ * The X Gradient Increases towards the Last Column and the Y Gradient towards the First (Oldest) Row of the Window as in the sobel_operator().
+ * A Gradient within about 22 Degrees of an Axis is Considered Parallel to that Axis (tan(22) is about 2 / 5).
+ */
+inline ap_uint<2> gradient_direction(int x_weight, int y_weight)
+{
+	#pragma HLS INLINE
+
+	int x_abs = ABS(x_weight);
+	int y_abs = ABS(y_weight);
+
+	if ((y_abs * 5) <= (x_abs * 2))
+	{
+		return DIRECTION_HORIZONTAL;
+	}
+	else if ((x_abs * 5) <= (y_abs * 2))
+	{
+		return DIRECTION_VERTICAL;
+	}
+	else if ((x_weight > 0) == (y_weight > 0))
+	{
+		return DIRECTION_RISING;
+	}
+
+	return DIRECTION_FALLING;
+}
+
+/*
+ * Template of the gradient_operator()
+ *
+ * The gradient_operator() Computes the X and Y Gradients of the Center of a KERNEL x KERNEL Window and Returns them
+ * in the Blue (Bits 7-0), Green (Bits 15-8) and Red (Bits 23-16) Bytes of the Pixel according to the Output Format (See the OUTPUT_FORMAT_*).
+ *
+ * In the FILTER_MODE_GRADIENT the Kernels of the Filter Registers are Used and the Gradients are Shifted Right by the Filter Shift (e.g. Scharr or Prewitt).
+ * In the Rest Modes the Sobel Kernels of the sobel_operator() are Used since the Linear Kernels Have no Gradients.
+ * The Gradients are not Thresholded but they are Saturated to +-GRADIENT_LIMIT.
+ */
+template<int KERNEL>
+RGB gradient_operator(ap_window<unsigned char, KERNEL, KERNEL> *window,
+                      FILTER_CONFIG filter)
+{
+	#pragma HLS INLINE
+
+	const int center = (KERNEL - 1) / 2;
+	const int reach = (center < (FILTER_TAPS - 1) / 2) ? center : (FILTER_TAPS - 1) / 2;
+
+	const char x_op[3][3] = { {-1, 0, 1},
+                              {-2, 0, 2},
+                              {-1, 0, 1}};
+
+	const char y_op[3][3] = { { 1, 2, 1},
+                              { 0, 0, 0},
+                              {-1,-2,-1}};
+
+	int x_weight = 0;
+	int y_weight = 0;
+	int magnitude;
+	unsigned int word;
+
+	RGB pixel;
+
+	gradient_mul:
+	for(int i = -reach; i <= reach; i++)
+	{
+	#pragma HLS UNROLL
+		for(int j = -reach; j <= reach; j++)
+		{
+		#pragma HLS UNROLL
+			const int tap = ((((FILTER_TAPS - 1) / 2) + i) * FILTER_TAPS) + ((FILTER_TAPS - 1) / 2) + j;
+			const bool sobel_tap = (i >= -1) && (i <= 1) && (j >= -1) && (j <= 1);
+
+			ap_int<8> x_coefficient;
+			ap_int<8> y_coefficient;
+
+			if(filter.mode == FILTER_MODE_GRADIENT)
+			{
+				x_coefficient = filter.x_coefficients.range((8 * tap) + 7, 8 * tap);
+				y_coefficient = filter.y_coefficients.range((8 * tap) + 7, 8 * tap);
+			}
+			else
+			{
+				x_coefficient = sobel_tap ? x_op[i + 1][j + 1] : 0;
+				y_coefficient = sobel_tap ? y_op[i + 1][j + 1] : 0;
+			}
+
+			x_weight += window->getval(center + i, center + j) * x_coefficient;
+			y_weight += window->getval(center + i, center + j) * y_coefficient;
+		}
+	}
+
+	//The Shift is Arithmetic so the Sign of the Gradients is Kept.
+	if(filter.mode == FILTER_MODE_GRADIENT)
+	{
+		x_weight = x_weight >> filter.shift;
+		y_weight = y_weight >> filter.shift;
+	}
+
+	x_weight = (x_weight > GRADIENT_LIMIT) ? GRADIENT_LIMIT : ((x_weight < -GRADIENT_LIMIT) ? -GRADIENT_LIMIT : x_weight);
+	y_weight = (y_weight > GRADIENT_LIMIT) ? GRADIENT_LIMIT : ((y_weight < -GRADIENT_LIMIT) ? -GRADIENT_LIMIT : y_weight);
+
+	if(filter.output_format == OUTPUT_FORMAT_GRADIENTS)
+	{
+		word = ((unsigned int)x_weight & 0xFFF) | (((unsigned int)y_weight & 0xFFF) << 12);
+	}
+	else
+	{
+		magnitude = ABS(x_weight) + ABS(y_weight);
+
+		word = (unsigned int)magnitude | ((unsigned int)gradient_direction(x_weight, y_weight) << 16);
+	}
+
+	pixel.B = word & 0xFF;
+	pixel.G = (word >> 8) & 0xFF;
+	pixel.R = (word >> 16) & 0xFF;
+
+	return pixel;
+}
+
+template<class ENGINE, int LANES>
 void start_sobel_operations(
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_0,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_1,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_2,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_3,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_4,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_5,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_6,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_7,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_8,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_9,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_10,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_11,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_12,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_13,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_14,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_15,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_0,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_1,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_2,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_3,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_4,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_5,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_6,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_7,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_8,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_9,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_10,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_11,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_12,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_13,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_14,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_15,
-		int sector_size,
-		int first,
-		int second,
-		int last);
+		typename ENGINE::INPUT_BUFFER LINE_BUFFER_SECTOR[ENGINE::SECTOR_COUNT],
+		typename ENGINE::OUTPUT_BUFFER OUTPUT_BUFFER_SECTOR[ENGINE::SECTOR_COUNT],
+		int sector_cols,
+		int line_index[ENGINE::WINDOW_SIZE],
+		FILTER_CONFIG filter);
 
+template<class ENGINE, int LANES>
 void send_line(
-		AXI_PIXEL *STREAM_OUT,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_0,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_1,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_2,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_3,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_4,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_5,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_6,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_7,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_8,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_9,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_10,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_11,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_12,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_13,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_14,
-		LINE1_SECTOR_BUFFER *OUTPUT_BUFFER_SECTOR_15,
+		typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+		typename ENGINE::OUTPUT_BUFFER OUTPUT_BUFFER_SECTOR[ENGINE::SECTOR_COUNT],
 		int *sector_iter_array,
 		int packet_mode_enable,
 		int packet_size,
+		int *remain_bytes,
+		int packed_output_enable,
+		int output_padding,
+		int *index,
+		typename AXI_LANES<LANES>::HOLD *out_bytes,
+		int *out_count);
+
+template<int LANES>
+void send_zero_line(
+		typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+		int *index,
+		typename AXI_LANES<LANES>::HOLD *out_bytes,
+		int *out_count,
+		int cols,
+		int output_padding,
+		int packed_output_enable,
+		int packet_mode_enable,
+		int packet_size,
+		int *remain_bytes);
+
+template<int LANES>
+void flush_output(
+		typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+		int *index,
+		typename AXI_LANES<LANES>::HOLD *out_bytes,
+		int *out_count);
+
+template<int LANES>
+void receive_pixels(
+		typename AXI_LANES<LANES>::BEAT *STREAM_IN,
+		int *index,
+		typename AXI_LANES<LANES>::HOLD *held_bytes,
+		int *held_count,
+		int input_format,
+		int count,
+		unsigned char luma[LANES]);
+
+template<int LANES>
+void send_pixels(
+		typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+		int *index,
+		typename AXI_LANES<LANES>::HOLD *out_bytes,
+		int *out_count,
+		RGB pixel[LANES],
+		int count,
+		int packed_output_enable,
+		int packet_mode_enable,
+		int packet_size,
 		int *remain_bytes);
 
+template<int LANES>
+void pad_output_row(
+		typename AXI_LANES<LANES>::BEAT *STREAM_OUT,
+		int *index,
+		typename AXI_LANES<LANES>::HOLD *out_bytes,
+		int *out_count,
+		int output_padding,
+		int packet_mode_enable,
+		int packet_size,
+		int *remain_bytes);
+
+template<class ENGINE, int LANES>
 void receive_post_line(
-		AXI_PIXEL *STREAM_IN,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_0,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_1,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_2,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_3,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_4,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_5,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_6,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_7,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_8,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_9,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_10,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_11,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_12,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_13,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_14,
-		LINE4_SECTOR_BUFFER *LINE_BUFFER_SECTOR_15,
+		typename AXI_LANES<LANES>::BEAT *STREAM_IN,
+		typename ENGINE::INPUT_BUFFER LINE_BUFFER_SECTOR[ENGINE::SECTOR_COUNT],
 		int row,
-		int *sector_iter_array);
+		int *sector_iter_array,
+		int input_format,
+		int input_padding,
+		int *index,
+		typename AXI_LANES<LANES>::HOLD *held_bytes,
+		int *held_count);
 
 #endif
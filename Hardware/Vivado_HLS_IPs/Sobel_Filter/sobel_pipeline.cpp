@@ -0,0 +1,459 @@
+/*******************************************************************************
+* Filename:   sobel_pipeline.cpp
+* Authors:    Othon Tomoutzoglou <otto_sta@hotmail.com>
+*             Dimitrios Bakoyiannis <d.bakoyiannis@gmail.com>
+* License:
+*
+* MIT License
+*
+* Copyright (c) [2018] [Othon Tomoutzoglou, Dimitrios Bakoyiannis]
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#include "hls_stream.h"
+#include "sobel.h"
+#include "sobel_operations.h"
+#include "packet_mode_operations.h"
+
+#define PIPELINE_FIFO_DEPTH 16 //The Depth of the Stream FIFOs between the Stages of the sobel_pipeline().
+
+/*
+ * blur_stage_operator
+ *
+ * Applies a 3x3 Gaussian Blur (1 2 1 / 2 4 2 / 1 2 1 Divided by 16) to the Center Pixel of a Window.
+ * The Border Pixels of the Image and all the Pixels when the Stage is Disabled Pass Unchanged.
+ */
+struct blur_stage_operator
+{
+	int enable;
+
+	unsigned char apply(unsigned char window[3][3], bool border) const
+	{
+		#pragma HLS INLINE
+
+		const unsigned char gaussian[3][3] = { {1, 2, 1},
+		                                       {2, 4, 2},
+		                                       {1, 2, 1}};
+
+		int sum = 8; //Rounds the Division to the Nearest Value.
+
+		if (enable == 0 || border)
+		{
+			return window[1][1];
+		}
+
+		for (int i = 0; i < 3; i++)
+		{
+		#pragma HLS UNROLL
+			for (int j = 0; j < 3; j++)
+			{
+			#pragma HLS UNROLL
+				sum += window[i][j] * gaussian[i][j];
+			}
+		}
+
+		return (unsigned char)(sum >> 4);
+	}
+};
+
+/*
+ * edge_stage_operator
+ *
+ * Applies the Filter of the Filter Registers to the Center Pixel of a Window the Same Way as the sobel_filter() (See the start_sobel_operations()).
+ * The Border Pixels of the Image are Dark/Zero Pixels as in the sobel_filter().
+ *
+ * The Direction of the Gradient is Found from the Sobel Gradients and is Quantized to 4 Directions for the Non-Maximum Suppression (See the gradient_direction()).
+ */
+struct edge_stage_operator
+{
+	FILTER_CONFIG filter;
+
+	EDGE_PIXEL apply(unsigned char window[3][3], bool border) const
+	{
+		#pragma HLS INLINE
+
+		ap_window<unsigned char, 3, 3> operator_window;
+		EDGE_PIXEL edge;
+		RGB pixel;
+
+		int x_weight;
+		int y_weight;
+
+		for (int i = 0; i < 3; i++)
+		{
+		#pragma HLS UNROLL
+			for (int j = 0; j < 3; j++)
+			{
+			#pragma HLS UNROLL
+				operator_window.insert(window[i][j], i, j);
+			}
+		}
+
+		if (filter.output_format != OUTPUT_FORMAT_PIXEL)
+		{
+			pixel = gradient_operator<3>(&operator_window, filter);
+		}
+		else if (filter.mode == FILTER_MODE_SOBEL)
+		{
+			pixel = sobel_operator<3>(&operator_window);
+		}
+		else
+		{
+			pixel = convolution_operator<3>(&operator_window, filter);
+		}
+
+		if (border)
+		{
+			pixel.R = pixel.G = pixel.B = 0;
+		}
+
+		edge.pixel = pixel;
+
+		//The Sobel Gradients where the X Gradient Increases towards the Last Column and the Y Gradient towards the First Row of the Window.
+		x_weight = (window[0][2] + (2 * window[1][2]) + window[2][2]) - (window[0][0] + (2 * window[1][0]) + window[2][0]);
+		y_weight = (window[0][0] + (2 * window[0][1]) + window[0][2]) - (window[2][0] + (2 * window[2][1]) + window[2][2]);
+
+		edge.direction = gradient_direction(x_weight, y_weight);
+
+		return edge;
+	}
+};
+
+/*
+ * nms_stage_operator
+ *
+ * Thins the Edges with Non-Maximum Suppression.
+ * The Edges are Dark (Low Values) so a Pixel is Kept only if Neither of its two Neighbors along the Direction of its Gradient is Darker.
+ * Otherwise it is Replaced with a White Pixel (No Edge).
+ * The Border Pixels of the Image and all the Pixels when the Stage is Disabled Pass Unchanged.
+ */
+struct nms_stage_operator
+{
+	int enable;
+
+	RGB apply(EDGE_PIXEL window[3][3], bool border) const
+	{
+		#pragma HLS INLINE
+
+		const RGB white_pixel = {255, 255, 255};
+
+		unsigned char first;
+		unsigned char second;
+		unsigned char center = window[1][1].pixel.R;
+
+		if (enable == 0 || border)
+		{
+			return window[1][1].pixel;
+		}
+
+		switch (window[1][1].direction)
+		{
+			case DIRECTION_HORIZONTAL: first = window[1][0].pixel.R; second = window[1][2].pixel.R; break;
+			case DIRECTION_VERTICAL:   first = window[0][1].pixel.R; second = window[2][1].pixel.R; break;
+			case DIRECTION_RISING:     first = window[0][2].pixel.R; second = window[2][0].pixel.R; break;
+			default:                   first = window[0][0].pixel.R; second = window[2][2].pixel.R; break;
+		}
+
+		if (first < center || second < center)
+		{
+			return white_pixel;
+		}
+
+		return window[1][1].pixel;
+	}
+};
+
+/*
+ * stencil_stage()
+ *
+ * The Common Functionality of the 3x3 Stages of the sobel_pipeline().
+ * Reads the rows x cols Pixels of the Image from the in_stream and Writes rows x cols Processed Pixels to the out_stream.
+ *
+ * Two Line Buffers Keep the Previous Two Rows and a 3x3 Window Slides over the Image one Column per Iteration.
+ * The Output Pixel of each Iteration is the Center of the Window which is one Row and one Column Behind the Received Pixel,
+ * this is why the Loops Run for one Extra Row and one Extra Column.
+ * The Pixels of the First and Last Row and Column are Given to the Operator as Border Pixels.
+ */
+template<typename IN_PIXEL, typename OUT_PIXEL, class OPERATOR>
+void stencil_stage(hls::stream<IN_PIXEL> &in_stream,
+                   hls::stream<OUT_PIXEL> &out_stream,
+                   int rows,
+                   int cols,
+                   OPERATOR stage_operator)
+{
+	IN_PIXEL line_buffer[2][MAX_WIDTH];
+	#pragma HLS ARRAY_PARTITION variable=line_buffer complete dim=1
+	#pragma HLS RESOURCE variable=line_buffer core=RAM_2P_BRAM
+
+	IN_PIXEL window[3][3];
+	#pragma HLS ARRAY_PARTITION variable=window complete dim=0
+
+	loop_stencil_rows:
+	for (int row = 0; row <= rows; row++)
+	{
+		loop_stencil_cols:
+		for (int col = 0; col <= cols; col++)
+		{
+		#pragma HLS PIPELINE II=1
+		#pragma HLS DEPENDENCE variable=line_buffer inter false
+
+			IN_PIXEL new_pixel = IN_PIXEL();
+
+			//Slide the Window one Column to the Left.
+			for (int i = 0; i < 3; i++)
+			{
+			#pragma HLS UNROLL
+				window[i][0] = window[i][1];
+				window[i][1] = window[i][2];
+			}
+
+			//Insert the Current Column of the Previous Two Rows and the Received Pixel in the Last Column of the Window.
+			if (col < cols)
+			{
+				if (row < rows)
+				{
+					new_pixel = in_stream.read();
+				}
+
+				window[0][2] = line_buffer[0][col];
+				window[1][2] = line_buffer[1][col];
+				window[2][2] = new_pixel;
+
+				line_buffer[0][col] = line_buffer[1][col];
+				line_buffer[1][col] = new_pixel;
+			}
+
+			//Write the Output Pixel at Row row - 1 and Column col - 1 which is the Center of the Window.
+			if (row > 0 && col > 0)
+			{
+				bool border = (row == 1) || (row == rows) || (col == 1) || (col == cols);
+
+				out_stream.write(stage_operator.apply(window, border));
+			}
+		}
+	}
+}
+
+/*
+ * receive_stage()
+ *
+ * Receives the Image through the AXI Stream In Interface and Writes the Luminance Value of each Pixel to the luma_stream.
+ * The Format of the Received Bytes is Given by the input_format (See the receive_pixels()) and the Padding Bytes of each Row are Dropped.
+ */
+void receive_stage(AXI_PIXEL *STREAM_IN,
+                   hls::stream<unsigned char> &luma_stream,
+                   int rows,
+                   int cols,
+                   int input_format)
+{
+	int in_index = 0;
+	AXI_LANES<1>::HOLD held_bytes = 0;
+	int held_count = 0;
+	int input_padding;
+
+	//In the INPUT_FORMAT_BGR and INPUT_FORMAT_LUMA Formats each Received Row is Padded to a Multiple of 4 Bytes.
+	if (input_format == INPUT_FORMAT_LUMA)
+	{
+		input_padding = (4 - (cols % 4)) % 4;
+	}
+	else if (input_format == INPUT_FORMAT_BGR)
+	{
+		input_padding = (4 - ((cols * 3) % 4)) % 4;
+	}
+	else
+	{
+		input_padding = 0;
+	}
+
+	loop_receive_rows:
+	for (int row = 0; row < rows; row++)
+	{
+		loop_receive_cols:
+		for (int col = 0; col < cols; col++)
+		{
+		#pragma HLS PIPELINE II=1
+			unsigned char luma[1];
+
+			receive_pixels<1>(STREAM_IN, &in_index, &held_bytes, &held_count, input_format, 1, luma);
+
+			luma_stream.write(luma[0]);
+		}
+
+		held_bytes = held_bytes >> (8 * input_padding);
+		held_count = held_count - input_padding;
+	}
+}
+
+/*
+ * send_stage()
+ *
+ * Reads the Processed Pixels from the out_stream and Sends them through the AXI Stream Out Interface as the sobel_filter() (See the send_line()).
+ */
+void send_stage(hls::stream<RGB> &out_stream,
+                AXI_PIXEL *STREAM_OUT,
+                int rows,
+                int cols,
+                int packed_output_en,
+                int packet_mode_en,
+                int packet_size)
+{
+	int out_index = 0;
+	AXI_LANES<1>::HOLD out_bytes = 0;
+	int out_count = 0;
+	int bytes_count = 0;
+	int output_padding;
+
+	//In Packed Output Mode each Sent Row is Padded to a Multiple of 4 Bytes.
+	output_padding = (packed_output_en == 1) ? (4 - (cols % 4)) % 4 : 0;
+
+	loop_send_rows:
+	for (int row = 0; row < rows; row++)
+	{
+		loop_send_cols:
+		for (int col = 0; col < cols; col++)
+		{
+		#pragma HLS PIPELINE II=1
+			RGB pixel[1];
+
+			pixel[0] = out_stream.read();
+
+			send_pixels<1>(STREAM_OUT, &out_index, &out_bytes, &out_count, pixel, 1, packed_output_en, packet_mode_en, packet_size, &bytes_count);
+		}
+
+		pad_output_row<1>(STREAM_OUT, &out_index, &out_bytes, &out_count, output_padding, packet_mode_en, packet_size, &bytes_count);
+	}
+
+	//Send the Last Beat of the Image with TLAST=1.
+	flush_output<1>(STREAM_OUT, &out_index, &out_bytes, &out_count);
+}
+
+/*
+ * sobel_pipeline()
+ *
+ * A Sobel Filter Core that Applies up to Three 3x3 Stages to the Image in a Single Pass over the AXI Stream Interfaces:
+ *
+ * a --> Gaussian Blur (Enabled with the PIPELINE_STAGE_BLUR Bit of the pipeline_stages).
+ * b --> The Filter of the Filter Registers (Sobel Edge Detection by Default) Including its Thresholds.
+ * c --> Non-Maximum Suppression (Enabled with the PIPELINE_STAGE_NMS Bit of the pipeline_stages).
+ *
+ * The Stages Run Concurrently (#pragma HLS DATAFLOW) and Pass the Pixels through Stream FIFOs
+ * so the Image Crosses the PCIe Bus only Once whatever Stages are Enabled.
+ * The Disabled Stages Pass the Pixels Unchanged so when the pipeline_stages is 0 the Core Produces the Same Image as the sobel_filter().
+ *
+ * The Registers 03 to 15 are the Same as in the sobel_filter() so the Core Can Replace it in the Block Design.
+ * The pipeline_stages (16) is Set per Job by the Driver Together with the Filter Registers.
+ *
+ * In the Gradient Output Formats the Filter Stage Sends the Gradients of the (Optionally Blurred) Image
+ * and the Non-Maximum Suppression is Left to the Host since it Needs the Gradient Magnitudes instead of the Filtered Pixels.
+ *
+ * Unlike the sobel_filter() the Stages Process one Pixel per Cycle in Full Rows instead of Sectors.
+ * This Matches the Rate of the Single Lane AXI Stream Interfaces and the Neighborhood is Always 3x3.
+ */
+int sobel_pipeline(/*01*/AXI_PIXEL STREAM_IN[MAX_WIDTH],
+                   /*02*/AXI_PIXEL STREAM_OUT[MAX_WIDTH],
+                   /*03*/int rows,
+                   /*04*/int cols,
+                   /*05*/int packet_mode_en,
+                   /*06*/int packet_size,
+                   /*07*/int packed_output_en,
+                   /*08*/int input_format,
+                   /*09*/int filter_mode,
+                   /*10*/COEFFICIENTS x_coefficients,
+                   /*11*/COEFFICIENTS y_coefficients,
+                   /*12*/int coefficient_shift,
+                   /*13*/int threshold_low,
+                   /*14*/int threshold_high,
+                   /*15*/int output_format,
+                   /*16*/int pipeline_stages
+                   )
+{
+	#pragma HLS RESOURCE variable=STREAM_OUT core=FIFO_LUTRAM
+	#pragma HLS RESOURCE variable=STREAM_IN  core=FIFO_LUTRAM
+
+	#pragma HLS INTERFACE  s_axilite  port=rows              bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=cols              bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=packet_mode_en    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=packet_size       bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=packed_output_en  bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=input_format      bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=filter_mode       bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=x_coefficients    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=y_coefficients    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=coefficient_shift bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=threshold_low     bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=threshold_high    bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=output_format     bundle=S_AXI4_LITE
+
+	/*
+	 * The pipeline_stages is a Register to Store the Bits of the Optional Stages (PIPELINE_STAGE_BLUR and PIPELINE_STAGE_NMS) that are Enabled.
+	 * This Register is Accessed through the AXI Slave Lite Interface (S_AXI4_LITE) of the Core.
+	 */
+	#pragma HLS INTERFACE  s_axilite  port=pipeline_stages   bundle=S_AXI4_LITE
+	#pragma HLS INTERFACE  s_axilite  port=return            bundle=S_AXI4_LITE
+
+	#pragma HLS INTERFACE axis depth=3840 port=STREAM_IN
+	#pragma HLS INTERFACE axis depth=3840 port=STREAM_OUT
+
+	hls::stream<unsigned char> luma_stream;
+	hls::stream<unsigned char> blur_stream;
+	hls::stream<EDGE_PIXEL> edge_stream;
+	hls::stream<RGB> out_stream;
+	#pragma HLS STREAM variable=luma_stream depth=PIPELINE_FIFO_DEPTH
+	#pragma HLS STREAM variable=blur_stream depth=PIPELINE_FIFO_DEPTH
+	#pragma HLS STREAM variable=edge_stream depth=PIPELINE_FIFO_DEPTH
+	#pragma HLS STREAM variable=out_stream  depth=PIPELINE_FIFO_DEPTH
+
+	blur_stage_operator blur;
+	edge_stage_operator edge;
+	nms_stage_operator nms;
+
+	blur.enable = (pipeline_stages & PIPELINE_STAGE_BLUR) ? 1 : 0;
+	edge.filter.output_format = ((output_format == OUTPUT_FORMAT_GRADIENTS) || (output_format == OUTPUT_FORMAT_MAGNITUDE)) ? output_format : OUTPUT_FORMAT_PIXEL;
+
+	nms.enable = ((pipeline_stages & PIPELINE_STAGE_NMS) && (edge.filter.output_format == OUTPUT_FORMAT_PIXEL)) ? 1 : 0;
+
+	//The Gradients Need the Whole 32 Bit Word of each Pixel so they Cannot be Packed.
+	if (edge.filter.output_format != OUTPUT_FORMAT_PIXEL)
+	{
+		packed_output_en = 0;
+	}
+
+	//Unknown Filter Modes Fall Back to the Sobel Edge Detection (See the sobel_filter_lanes()).
+	edge.filter.mode = ((filter_mode == FILTER_MODE_LINEAR) || (filter_mode == FILTER_MODE_GRADIENT)) ? filter_mode : FILTER_MODE_SOBEL;
+	edge.filter.x_coefficients = x_coefficients;
+	edge.filter.y_coefficients = y_coefficients;
+	edge.filter.shift = coefficient_shift & 0x1F;
+	edge.filter.threshold_low = threshold_low;
+	edge.filter.threshold_high = threshold_high;
+
+	#pragma HLS DATAFLOW
+
+	receive_stage(STREAM_IN, luma_stream, rows, cols, input_format);
+
+	stencil_stage<unsigned char, unsigned char, blur_stage_operator>(luma_stream, blur_stream, rows, cols, blur);
+
+	stencil_stage<unsigned char, EDGE_PIXEL, edge_stage_operator>(blur_stream, edge_stream, rows, cols, edge);
+
+	stencil_stage<EDGE_PIXEL, RGB, nms_stage_operator>(edge_stream, out_stream, rows, cols, nms);
+
+	send_stage(out_stream, STREAM_OUT, rows, cols, packed_output_en, packet_mode_en, packet_size);
+
+	return 1;
+}
@@ -0,0 +1,606 @@
+/*******************************************************************************
+* Filename:   sobel_tb.cpp
+* Authors:    Othon Tomoutzoglou <otto_sta@hotmail.com>
+*             Dimitrios Bakoyiannis <d.bakoyiannis@gmail.com>
+* License:
+*
+* MIT License
+*
+* Copyright (c) [2018] [Othon Tomoutzoglou, Dimitrios Bakoyiannis]
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*
+ * The C Simulation Testbench of the sobel_filter(), sobel_filter_x2(), sobel_filter_x4() and sobel_pipeline() Cores.
+ *
+ * Each Bitmap Image (24 or 32 Bits per Pixel) Given as an Argument (or the Images of the Results Directory of the Application by Default)
+ * is Sent to the Cores in each Configuration of the tb_cases Table and the Received Image is Compared Bit Exactly with the Golden Model
+ * (See sobel_golden.h) Including the Strobe and TLAST Signals of each Beat.
+ * The Table Covers every Core, the Packed Output Mode, the Packed Input Formats,
+ * the Filter Modes, the Gradient Output Formats and the Stages of the sobel_pipeline() so that a Change to any of them is Checked against the Default Configuration.
+ * The Scalar and AVX2 Versions of the Golden Model are also Compared with each other and Timed to Give a CPU Baseline for each Image.
+ *
+ * It Runs in the C Simulation of Vivado HLS (See run_hls.tcl) or Standalone with the Vivado HLS Include Directory, e.g:
+ *
+ * g++ -O2 -I<Vivado_HLS>/include -I. sobel_tb.cpp sobel_golden.cpp sobel.cpp sobel_operations.cpp packet_mode_operations.cpp sobel_pipeline.cpp -o sobel_tb
+ *
+ * The Sector Buffers are Local Arrays of the Core so the Stack Limit May Need to be Raised (e.g. ulimit -s unlimited).
+ * The Testbench Returns 0 if all the Images Match.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <vector>
+
+#include "sobel.h"
+#include "sobel_golden.h"
+
+#define GOLDEN_ITERATIONS 10 //The Number of Times each Version of the Golden Model Processes an Image to Measure its Time.
+
+#define TB_CORE_X1       0 //sobel_filter()
+#define TB_CORE_X2       1 //sobel_filter_x2()
+#define TB_CORE_X4       2 //sobel_filter_x4()
+#define TB_CORE_PIPELINE 3 //sobel_pipeline()
+
+/*
+ * The Filter Registers that the Test Cases Load to the Cores.
+ */
+static const struct GOLDEN_FILTER tb_sobel = { FILTER_MODE_SOBEL, { 0 }, { 0 }, 0, 0, 255, OUTPUT_FORMAT_PIXEL };
+static const struct GOLDEN_FILTER tb_gaussian = { FILTER_MODE_LINEAR, { 1, 2, 1, 2, 4, 2, 1, 2, 1 }, { 0 }, 4, 0, 255, OUTPUT_FORMAT_PIXEL };
+static const struct GOLDEN_FILTER tb_sharpen = { FILTER_MODE_LINEAR, { 0, -1, 0, -1, 5, -1, 0, -1, 0 }, { 0 }, 0, 0, 255, OUTPUT_FORMAT_PIXEL };
+static const struct GOLDEN_FILTER tb_scharr = { FILTER_MODE_GRADIENT, { -3, 0, 3, -10, 0, 10, -3, 0, 3 }, { -3, -10, -3, 0, 0, 0, 3, 10, 3 }, 2, 60, 220, OUTPUT_FORMAT_PIXEL };
+static const struct GOLDEN_FILTER tb_sobel_gradients = { FILTER_MODE_SOBEL, { 0 }, { 0 }, 0, 0, 255, OUTPUT_FORMAT_GRADIENTS };
+static const struct GOLDEN_FILTER tb_scharr_magnitude = { FILTER_MODE_GRADIENT, { -3, 0, 3, -10, 0, 10, -3, 0, 3 }, { -3, -10, -3, 0, 0, 0, 3, 10, 3 }, 2, 0, 255, OUTPUT_FORMAT_MAGNITUDE };
+
+/*
+ * A Test Case is the Core (See the TB_CORE_*), the Input Format, the Packed Output Mode and the Filter Registers that an Image is Processed with.
+ * The pipeline_stages are Loaded only to the sobel_pipeline().
+ * The Packed Input Formats are Always Used with the Packed Output Mode as the Driver Does.
+ */
+struct TB_CASE
+{
+	const char *name;
+	int core;
+	int input_format;
+	int packed_output;
+	const struct GOLDEN_FILTER *filter;
+	int pipeline_stages;
+};
+
+static const struct TB_CASE tb_cases[] = { { "Default",                  TB_CORE_X1,        INPUT_FORMAT_BGRX, 0, &tb_sobel,             0 },
+                                           { "Packed Output",            TB_CORE_X1,        INPUT_FORMAT_BGRX, 1, &tb_sobel,             0 },
+                                           { "BGR Input",                TB_CORE_X1,        INPUT_FORMAT_BGR,  1, &tb_sobel,             0 },
+                                           { "Luma Input",               TB_CORE_X1,        INPUT_FORMAT_LUMA, 1, &tb_sobel,             0 },
+                                           { "x2",                       TB_CORE_X2,        INPUT_FORMAT_BGRX, 0, &tb_sobel,             0 },
+                                           { "x2 Packed Output",         TB_CORE_X2,        INPUT_FORMAT_BGRX, 1, &tb_sobel,             0 },
+                                           { "x2 BGR Input",             TB_CORE_X2,        INPUT_FORMAT_BGR,  1, &tb_sobel,             0 },
+                                           { "x4",                       TB_CORE_X4,        INPUT_FORMAT_BGRX, 0, &tb_sobel,             0 },
+                                           { "x4 BGR Input",             TB_CORE_X4,        INPUT_FORMAT_BGR,  1, &tb_sobel,             0 },
+                                           { "x4 Luma Input",            TB_CORE_X4,        INPUT_FORMAT_LUMA, 1, &tb_sobel,             0 },
+                                           { "Gaussian Blur",            TB_CORE_X1,        INPUT_FORMAT_BGRX, 1, &tb_gaussian,          0 },
+                                           { "x2 Sharpen",               TB_CORE_X2,        INPUT_FORMAT_BGRX, 0, &tb_sharpen,           0 },
+                                           { "x4 Scharr Luma Input",     TB_CORE_X4,        INPUT_FORMAT_LUMA, 1, &tb_scharr,            0 },
+                                           { "Sobel Gradients",          TB_CORE_X1,        INPUT_FORMAT_BGRX, 0, &tb_sobel_gradients,   0 },
+                                           { "x4 Scharr Magnitude",      TB_CORE_X4,        INPUT_FORMAT_BGRX, 0, &tb_scharr_magnitude,  0 },
+                                           { "Pipeline",                 TB_CORE_PIPELINE,  INPUT_FORMAT_BGRX, 0, &tb_sobel,             0 },
+                                           { "Pipeline Luma Input",      TB_CORE_PIPELINE,  INPUT_FORMAT_LUMA, 1, &tb_scharr,            0 },
+                                           { "Pipeline Sobel Gradients", TB_CORE_PIPELINE,  INPUT_FORMAT_BGRX, 0, &tb_sobel_gradients,   0 },
+                                           { "Pipeline Blur",            TB_CORE_PIPELINE,  INPUT_FORMAT_BGRX, 0, &tb_sobel,             PIPELINE_STAGE_BLUR },
+                                           { "Pipeline NMS",             TB_CORE_PIPELINE,  INPUT_FORMAT_BGRX, 1, &tb_sobel,             PIPELINE_STAGE_NMS },
+                                           { "Pipeline Blur and NMS",    TB_CORE_PIPELINE,  INPUT_FORMAT_BGR,  1, &tb_sobel,             PIPELINE_STAGE_BLUR | PIPELINE_STAGE_NMS },
+                                           { "Pipeline Scharr NMS",      TB_CORE_PIPELINE,  INPUT_FORMAT_LUMA, 1, &tb_scharr,            PIPELINE_STAGE_NMS },
+                                           { "Pipeline Blur Magnitude",  TB_CORE_PIPELINE,  INPUT_FORMAT_BGRX, 0, &tb_scharr_magnitude,  PIPELINE_STAGE_BLUR | PIPELINE_STAGE_NMS } };
+
+/*
+ * tb_time_us()
+ *
+ * Returns the Current Time in Microseconds.
+ */
+static double tb_time_us()
+{
+	struct timeval now;
+
+	gettimeofday(&now, NULL);
+
+	return ((double)now.tv_sec * 1000000.0) + (double)now.tv_usec;
+}
+
+/*
+ * tb_read_u32() and tb_read_u16()
+ *
+ * Read the Little Endian Fields of the Bitmap Headers.
+ */
+static unsigned int tb_read_u32(const unsigned char *bytes)
+{
+	return (unsigned int)bytes[0] | ((unsigned int)bytes[1] << 8) | ((unsigned int)bytes[2] << 16) | ((unsigned int)bytes[3] << 24);
+}
+
+static unsigned int tb_read_u16(const unsigned char *bytes)
+{
+	return (unsigned int)bytes[0] | ((unsigned int)bytes[1] << 8);
+}
+
+/*
+ * tb_load_bmp()
+ *
+ * Loads an Uncompressed Bitmap Image with 24 or 32 Bits per Pixel and Returns its Pixels in the 4 Bytes per Pixel Format
+ * (Blue, Green, Red and a Zero Padding Byte) that the Application Stages for the Acceleration Groups.
+ * The Rows are Kept in the Order they are Stored in the File as the Application Does.
+ * Returns NULL if the File Cannot be Read or its Format is not Supported.
+ */
+static unsigned char *tb_load_bmp(const char *path, int *rows, int *cols)
+{
+	unsigned char headers[54];
+	unsigned char *image;
+	unsigned char *file_row;
+
+	unsigned int offset;
+	unsigned int bytes_per_pixel;
+	size_t row_stride;
+
+	FILE *bmp_file = fopen(path, "rb");
+
+	if (bmp_file == NULL)
+	{
+		return NULL;
+	}
+
+	if (fread(headers, 1, sizeof(headers), bmp_file) != sizeof(headers) || headers[0] != 'B' || headers[1] != 'M')
+	{
+		fclose(bmp_file);
+		return NULL;
+	}
+
+	offset = tb_read_u32(headers + 10);
+	*cols = (int)tb_read_u32(headers + 18);
+	*rows = (int)tb_read_u32(headers + 22);
+	bytes_per_pixel = tb_read_u16(headers + 28) / 8;
+
+	if ((bytes_per_pixel != 3 && bytes_per_pixel != 4) || tb_read_u32(headers + 30) != 0 || *rows <= 0 || *cols <= 0)
+	{
+		fclose(bmp_file);
+		return NULL;
+	}
+
+	row_stride = (((size_t)*cols * bytes_per_pixel) + 3) / 4 * 4;
+
+	image = (unsigned char *)malloc((size_t)*rows * *cols * 4);
+	file_row = (unsigned char *)malloc(row_stride);
+
+	if (image == NULL || file_row == NULL || fseek(bmp_file, offset, SEEK_SET) != 0)
+	{
+		free(image);
+		free(file_row);
+		fclose(bmp_file);
+		return NULL;
+	}
+
+	for (int row = 0; row < *rows; row++)
+	{
+		if (fread(file_row, 1, row_stride, bmp_file) != row_stride)
+		{
+			free(image);
+			free(file_row);
+			fclose(bmp_file);
+			return NULL;
+		}
+
+		for (int col = 0; col < *cols; col++)
+		{
+			unsigned char *pixel = image + ((((size_t)row * *cols) + col) * 4);
+
+			pixel[0] = file_row[(col * bytes_per_pixel)];
+			pixel[1] = file_row[(col * bytes_per_pixel) + 1];
+			pixel[2] = file_row[(col * bytes_per_pixel) + 2];
+			pixel[3] = 0;
+		}
+	}
+
+	free(file_row);
+	fclose(bmp_file);
+
+	return image;
+}
+
+/*
+ * tb_coefficients()
+ *
+ * Loads a 3x3 Kernel in the Center of a Coefficient Register of the Cores with Zeros Around it.
+ */
+static COEFFICIENTS tb_coefficients(const signed char *kernel)
+{
+	COEFFICIENTS coefficients = 0;
+
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			const int tap = ((i + 1) * FILTER_TAPS) + j + 1;
+
+			coefficients.range((8 * tap) + 7, 8 * tap) = (unsigned char)kernel[(i * 3) + j];
+		}
+	}
+
+	return coefficients;
+}
+
+/*
+ * tb_call_core()
+ *
+ * Calls a Core with the Registers of a Test Case.
+ * The Overload of the sobel_pipeline() Loads, also, the pipeline_stages Register.
+ */
+template<typename BEAT>
+static void tb_call_core(int (*core)(BEAT *, BEAT *, int, int, int, int, int, int, int, COEFFICIENTS, COEFFICIENTS, int, int, int, int),
+                         BEAT *stream_in,
+                         BEAT *stream_out,
+                         int rows,
+                         int cols,
+                         const struct TB_CASE *test)
+{
+	core(stream_in,
+	     stream_out,
+	     rows,
+	     cols,
+	     0,                   //packet_mode_en
+	     0,                   //packet_size
+	     test->packed_output,
+	     test->input_format,
+	     test->filter->mode,
+	     tb_coefficients(test->filter->x_coefficients),
+	     tb_coefficients(test->filter->y_coefficients),
+	     test->filter->shift,
+	     test->filter->threshold_low,
+	     test->filter->threshold_high,
+	     test->filter->output_format);
+}
+
+static void tb_call_core(int (*core)(AXI_PIXEL *, AXI_PIXEL *, int, int, int, int, int, int, int, COEFFICIENTS, COEFFICIENTS, int, int, int, int, int),
+                         AXI_PIXEL *stream_in,
+                         AXI_PIXEL *stream_out,
+                         int rows,
+                         int cols,
+                         const struct TB_CASE *test)
+{
+	core(stream_in,
+	     stream_out,
+	     rows,
+	     cols,
+	     0,                   //packet_mode_en
+	     0,                   //packet_size
+	     test->packed_output,
+	     test->input_format,
+	     test->filter->mode,
+	     tb_coefficients(test->filter->x_coefficients),
+	     tb_coefficients(test->filter->y_coefficients),
+	     test->filter->shift,
+	     test->filter->threshold_low,
+	     test->filter->threshold_high,
+	     test->filter->output_format,
+	     test->pipeline_stages);
+}
+
+/*
+ * tb_check_case()
+ *
+ * Sends an Image to the Core of a Test Case and Compares the Received Beats with the Words of the Golden Model.
+ *
+ * The Input Bytes are Staged in the Input Format of the Test Case (each Row of the Packed Formats Starts at a New 32 Bit Word)
+ * and they are Sent in Beats of 4 Bytes per Lane of the Core (lanes).
+ * The Expected Output is the Word of each Pixel or, in the Packed Output Mode, its Low Byte with each Row Padded by Zeros to a Multiple of 4 Bytes.
+ * Every Beat apart from the Last Has all its Bytes Valid and only the Last Beat of the Image Has TLAST=1.
+ *
+ * Returns the Number of Mismatches (0 if the Image Matches).
+ */
+template<typename BEAT, typename CORE>
+static int tb_check_case(const char *path,
+                         const struct TB_CASE *test,
+                         CORE core,
+                         int lanes,
+                         const unsigned char *image,
+                         const unsigned char *luma,
+                         const unsigned int *words,
+                         int rows,
+                         int cols)
+{
+	const int beat_bytes = 4 * lanes;
+	const int packed = (test->packed_output == 1) && (test->filter->output_format == OUTPUT_FORMAT_PIXEL);
+
+	std::vector<unsigned char> input;
+	std::vector<unsigned char> expected;
+
+	int errors = 0;
+
+	for (int row = 0; row < rows; row++)
+	{
+		size_t input_start = input.size();
+		size_t expected_start = expected.size();
+
+		for (int col = 0; col < cols; col++)
+		{
+			const size_t pixel = ((size_t)row * cols) + col;
+
+			if (test->input_format == INPUT_FORMAT_LUMA)
+			{
+				input.push_back(luma[pixel]);
+			}
+			else
+			{
+				input.push_back(image[(pixel * 4)]);
+				input.push_back(image[(pixel * 4) + 1]);
+				input.push_back(image[(pixel * 4) + 2]);
+
+				if (test->input_format == INPUT_FORMAT_BGRX)
+				{
+					input.push_back(0);
+				}
+			}
+
+			for (int byte = 0; byte < (packed ? 1 : 4); byte++)
+			{
+				expected.push_back((unsigned char)(words[pixel] >> (8 * byte)));
+			}
+		}
+
+		while (((input.size() - input_start) % 4) != 0)
+		{
+			input.push_back(0);
+		}
+
+		while (((expected.size() - expected_start) % 4) != 0)
+		{
+			expected.push_back(0);
+		}
+	}
+
+	const int input_beats = (int)((input.size() + beat_bytes - 1) / beat_bytes);
+	const int output_beats = (int)((expected.size() + beat_bytes - 1) / beat_bytes);
+
+	BEAT *stream_in = new BEAT[input_beats];
+	BEAT *stream_out = new BEAT[output_beats + 1];
+
+	for (int i = 0; i < input_beats; i++)
+	{
+		stream_in[i].data = 0;
+
+		for (int byte = 0; byte < beat_bytes; byte++)
+		{
+			const size_t offset = ((size_t)i * beat_bytes) + byte;
+
+			if (offset < input.size())
+			{
+				stream_in[i].data.range((8 * byte) + 7, 8 * byte) = input[offset];
+			}
+		}
+
+		stream_in[i].strb = -1;
+		stream_in[i].user = 0;
+		stream_in[i].last = (i == input_beats - 1) ? 1 : 0;
+		stream_in[i].tdest = 0;
+	}
+
+	for (int i = 0; i <= output_beats; i++)
+	{
+		stream_out[i].data = 0;
+		stream_out[i].strb = 0;
+		stream_out[i].last = 0;
+	}
+
+	tb_call_core(core, stream_in, stream_out, rows, cols, test);
+
+	for (int i = 0; i <= output_beats; i++)
+	{
+		const size_t first = (size_t)i * beat_bytes;
+		const int valid = (i == output_beats) ? 0 : (int)(((expected.size() - first) < (size_t)beat_bytes) ? (expected.size() - first) : beat_bytes);
+
+		int mismatch = (stream_out[i].strb.to_uint() != ((1u << valid) - 1)) || (stream_out[i].last.to_uint() != (unsigned int)(i == output_beats - 1));
+
+		for (int byte = 0; byte < valid && mismatch == 0; byte++)
+		{
+			mismatch = ((unsigned int)stream_out[i].data.range((8 * byte) + 7, 8 * byte) != expected[first + byte]);
+		}
+
+		if (mismatch)
+		{
+			if (errors < 8)
+			{
+				printf("[%s] %s: Mismatch at Beat %d of %d (Strobe 0x%X, TLAST %u)\n", path, test->name, i, output_beats, stream_out[i].strb.to_uint(), stream_out[i].last.to_uint());
+			}
+
+			errors++;
+		}
+	}
+
+	delete[] stream_in;
+	delete[] stream_out;
+
+	return errors;
+}
+
+/*
+ * tb_check_image()
+ *
+ * Runs all the Test Cases of the tb_cases Table on an Image and Times the Golden Model.
+ * Returns the Number of Mismatches (0 if the Image Matches in all the Test Cases).
+ */
+static int tb_check_image(const char *path)
+{
+	unsigned char *image;
+	unsigned char *luma;
+	unsigned char *golden_edges;
+	unsigned char *avx2_edges;
+	unsigned int *words;
+
+	int rows;
+	int cols;
+	int pixels;
+	int errors = 0;
+	int case_errors;
+
+	double start;
+	double scalar_us;
+	double avx2_us = 0;
+
+	image = tb_load_bmp(path, &rows, &cols);
+
+	if (image == NULL)
+	{
+		printf("[%s] Failed to Load the Image\n", path);
+		return 1;
+	}
+
+	if (cols < SECTORS * 4 || cols > MAX_WIDTH || rows < KERNEL_SIZE || rows > MAX_HEIGHT)
+	{
+		printf("[%s] The %dx%d Image is not Supported by the Cores\n", path, cols, rows);
+		free(image);
+		return 1;
+	}
+
+	pixels = rows * cols;
+
+	luma = (unsigned char *)malloc(pixels);
+	golden_edges = (unsigned char *)malloc(pixels);
+	avx2_edges = (unsigned char *)malloc(pixels);
+	words = (unsigned int *)malloc((size_t)pixels * sizeof(unsigned int));
+
+	sobel_golden_luma(image, luma, pixels);
+
+	for (int i = 0; i < (int)(sizeof(tb_cases) / sizeof(tb_cases[0])); i++)
+	{
+		const struct TB_CASE *test = &tb_cases[i];
+
+		sobel_golden_pipeline(luma, words, rows, cols, test->filter, test->pipeline_stages);
+
+		switch (test->core)
+		{
+			case TB_CORE_X2: case_errors = tb_check_case<AXI_PIXEL_X2>(path, test, sobel_filter_x2, 2, image, luma, words, rows, cols); break;
+			case TB_CORE_X4: case_errors = tb_check_case<AXI_PIXEL_X4>(path, test, sobel_filter_x4, 4, image, luma, words, rows, cols); break;
+			case TB_CORE_PIPELINE: case_errors = tb_check_case<AXI_PIXEL>(path, test, sobel_pipeline, 1, image, luma, words, rows, cols); break;
+			default: case_errors = tb_check_case<AXI_PIXEL>(path, test, sobel_filter, 1, image, luma, words, rows, cols); break;
+		}
+
+		if (case_errors != 0)
+		{
+			printf("[%s] %s: FAIL (%d Mismatches)\n", path, test->name, case_errors);
+		}
+
+		errors += case_errors;
+	}
+
+	/*
+	 * Time the Scalar Version of the Golden Model whose Result is the Reference.
+	 * It Must Match the FILTER_MODE_SOBEL Words that the Default Test Case Compared with the Core.
+	 */
+	start = tb_time_us();
+
+	for (int iteration = 0; iteration < GOLDEN_ITERATIONS; iteration++)
+	{
+		sobel_golden_scalar(image, golden_edges, rows, cols);
+	}
+
+	scalar_us = (tb_time_us() - start) / GOLDEN_ITERATIONS;
+
+	sobel_golden_filter(luma, words, rows, cols, &tb_sobel);
+
+	for (int i = 0; i < pixels; i++)
+	{
+		if (words[i] != (unsigned int)golden_edges[i] * 0x010101)
+		{
+			printf("[%s] The Scalar Golden Model does not Match the Default Filter Words\n", path);
+			errors++;
+			break;
+		}
+	}
+
+	#ifdef SOBEL_GOLDEN_AVX2
+	if (sobel_golden_avx2_supported())
+	{
+		start = tb_time_us();
+
+		for (int iteration = 0; iteration < GOLDEN_ITERATIONS; iteration++)
+		{
+			sobel_golden_avx2(image, avx2_edges, rows, cols);
+		}
+
+		avx2_us = (tb_time_us() - start) / GOLDEN_ITERATIONS;
+
+		if (memcmp(avx2_edges, golden_edges, pixels) != 0)
+		{
+			printf("[%s] The AVX2 Golden Model does not Match the Scalar Golden Model\n", path);
+			errors++;
+		}
+	}
+	#endif
+
+	printf("[%s] %dx%d %s (%d Test Cases) | CPU Golden Model: Scalar %.3f ms (%.1f MPixels/s)",
+	       path, cols, rows, (errors == 0) ? "PASS" : "FAIL", (int)(sizeof(tb_cases) / sizeof(tb_cases[0])), scalar_us / 1000.0, pixels / scalar_us);
+
+	if (avx2_us > 0)
+	{
+		printf(", AVX2 %.3f ms (%.1f MPixels/s)", avx2_us / 1000.0, pixels / avx2_us);
+	}
+
+	printf("\n");
+
+	free(words);
+	free(avx2_edges);
+	free(golden_edges);
+	free(luma);
+	free(image);
+
+	return errors;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *default_images[] = { "../../../Software/Linux_App_Driver/Results/qvga.bmp",
+	                                 "../../../Software/Linux_App_Driver/Results/vga.bmp",
+	                                 "../../../Software/Linux_App_Driver/Results/hd.bmp" };
+
+	int errors = 0;
+
+	if (argc > 1)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			errors += tb_check_image(argv[i]);
+		}
+	}
+	else
+	{
+		for (int i = 0; i < (int)(sizeof(default_images) / sizeof(default_images[0])); i++)
+		{
+			errors += tb_check_image(default_images[i]);
+		}
+	}
+
+	if (errors != 0)
+	{
+		printf("FAIL: %d Mismatches\n", errors);
+		return 1;
+	}
+
+	printf("PASS\n");
+
+	return 0;
+}
@@ -44,6 +44,15 @@
 #include <pthread.h>
 #include <sys/syscall.h>
 #include <sys/file.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 
 /*
@@ -193,6 +202,169 @@ pthread_barrier_t threads_barrier;
  */
 int renamer_value = 0;
 
+/*
+ * completion_spin_iterations is the Number of Times that a Thread Checks the accel_completed Flag in Polling Mode before it Sleeps in poll() on the Driver File.
+ * Short Accelerations are Caught while Spinning with Minimum Latency while Longer Accelerations do not Keep a CPU Core Busy for their Whole Duration.
+ * Setting this Variable to a Negative Value Makes the Threads Spin until the Acceleration Completes.
+ */
+int completion_spin_iterations = 4096;
+
+/*
+ * load_mode Indicates how the Image Data Reach the Pre Process Kernel Memory of each Thread before each Acceleration Request.
+ * The Value of this Variable is Given as an Optional Argument when this Application is Called.
+ * There are 3 Different Values that this Variable Can be Given:
+ * 
+ * 0 (LOAD_MODE_COPY) --> Load the Image Once to the common_load Memory and Copy it to the Pre Process Kernel Memory in EACH Iteration (Default)
+ * 1 (LOAD_MODE_DIRECT) --> Memory Map the Image File and Expand the Image Data Directly to the Pre Process Kernel Memory in EACH Iteration
+ * 2 (LOAD_MODE_PRE_STAGED) --> As in LOAD_MODE_DIRECT but the Image is Staged Again only if the Pre Process Kernel Memory no Longer Holds the Unchanged Image
+ */
+int load_mode = LOAD_MODE_COPY;
+
+/*
+ * ring_depth Indicates the Maximum Number of Images that each Thread Keeps Queued in its Submission Ring.
+ * The Value of this Variable is Given as an Optional Argument when this Application is Called.
+ * 
+ * 0 --> Do Not Use the Submission Ring. Each Iteration Requests Acceleration with the COMMAND_REQUEST_ACCELERATOR_ACCESS IOCtl Call and Waits for its Completion (Default)
+ * N --> Stage up to N Images (Limited by RING_ENTRIES and by how many Images Fit in the Pre Process Kernel Memory), Queue them in the Submission Ring and Reap their Completions in Batches
+ */
+int ring_depth = 0;
+
+/*
+ * allocation_policy Indicates the Policy that the Driver Applies when the Threads Request Acceleration Groups with the COMMAND_REQUEST_ACCELERATOR_ACCESS IOCtl Call.
+ * The Value of this Variable is Given as an Optional Argument when this Application is Called.
+ * 
+ * 0 (ALLOCATION_POLICY_DEFAULT) --> Use the Policy that is Set in the allocation_policy Parameter of the Driver Module (Default)
+ * 1 (ALLOCATION_POLICY_GREEDY) --> Split the Image to all the Available Acceleration Groups
+ * 2 (ALLOCATION_POLICY_BEST_AVAILABLE) --> Process the Image by the Most Efficient Available Acceleration Group
+ * 3 (ALLOCATION_POLICY_SIZE_AWARE) --> Split Large Images as in Greedy and Process Small Images as in Best Available
+ * 4 (ALLOCATION_POLICY_FAIR_SHARE) --> Split the Image to an Equal Share of the Acceleration Groups for each Thread
+ */
+int allocation_policy = ALLOCATION_POLICY_DEFAULT;
+
+/*
+ * packed_output Indicates whether the Sobel Filters of the Acceleration Groups Return each Processed Pixel as a Single 8 Bit Grayscale Value.
+ * The Value of this Variable is Given as an Optional Argument when this Application is Called.
+ * 
+ * 0 --> The Sobel Filters Return 4 Bytes per Pixel as the Input Image (Default)
+ * 1 --> The Sobel Filters Pack 4 Grayscale Pixels in each 32 Bit Word which Reduces the Output Traffic to the Quarter.
+ *       Each Processed Row Starts at a 4 Byte Aligned Offset and the save_bmp() Expands the Pixels Back to 24 Bits per Pixel
+ */
+int packed_output = 0;
+
+/*
+ * input_format Indicates the Format in which the Image is Staged to the Pre Process Kernel Memory for the Sobel Filters.
+ * The Value of this Variable is Given as an Optional Argument when this Application is Called.
+ * 
+ * 0 (INPUT_FORMAT_BGRX) --> 4 Bytes per Pixel where the Fourth Byte is Padding (Default)
+ * 1 (INPUT_FORMAT_BGR) --> 3 Bytes per Pixel as in the Bitmap File so the Rows of a 24 Bit Image are Staged without any Conversion
+ * 2 (INPUT_FORMAT_LUMA) --> 1 Byte per Pixel with the Luminance Value that the Sobel Filter would Otherwise Compute on Arrival
+ * 
+ * In the Last Two Formats each Row is Padded to a Multiple of 4 Bytes and the Packed Output Mode is Always Enabled
+ * since the Processed Image Replaces the Smaller Initial Image in the Same Memory.
+ */
+int input_format = INPUT_FORMAT_BGRX;
+
+/*
+ * filter_preset Indicates the Operation that the Sobel Filters of the Acceleration Groups Apply to the Image (See the set_filter()).
+ * The Value of this Variable is Given as an Optional Argument when this Application is Called.
+ * 
+ * 0 (FILTER_PRESET_SOBEL) --> The Sobel Edge Detection (Default)
+ * 1 (FILTER_PRESET_GAUSSIAN) --> 3x3 Gaussian Blur
+ * 2 (FILTER_PRESET_SHARPEN) --> 3x3 Sharpen
+ * 3 (FILTER_PRESET_SCHARR) --> Scharr Edge Detection
+ * 4 (FILTER_PRESET_PREWITT) --> Prewitt Edge Detection
+ * 5 (FILTER_PRESET_BOX) --> 3x3 Box Blur
+ */
+int filter_preset = FILTER_PRESET_SOBEL;
+
+/*
+ * pipeline_stages Holds the Optional Stages that a sobel_pipeline Core Applies Together with the Filter in a Single Pass over the Image.
+ * The Value of this Variable is Given as an Optional Argument when this Application is Called and is a Combination of the Bits Below.
+ * 
+ * 0 --> No Optional Stages (Default)
+ * 1 (PIPELINE_STAGE_BLUR) --> 3x3 Gaussian Blur before the Filter
+ * 2 (PIPELINE_STAGE_NMS) --> Non-Maximum Suppression after the Filter
+ * 
+ * The Stages are Ignored by the Acceleration Groups that Use the sobel_filter Core.
+ */
+int pipeline_stages = 0;
+
+/*
+ * output_format Indicates whether the Sobel Filters of the Acceleration Groups Return the Filtered Pixels or the Gradients of each Pixel.
+ * The Value of this Variable is Given as an Optional Argument when this Application is Called.
+ * 
+ * 0 (OUTPUT_FORMAT_PIXEL) --> The Filtered Pixels (Default)
+ * 1 (OUTPUT_FORMAT_GRADIENTS) --> The Signed X and Y Gradients of each Pixel
+ * 2 (OUTPUT_FORMAT_MAGNITUDE) --> The Gradient Magnitude and the Quantized Gradient Direction of each Pixel
+ * 
+ * In the Gradient Formats the Image is Staged in the INPUT_FORMAT_BGRX without Packed Output
+ * and the save_bmp() Completes a Canny Edge Detector on the Gradients before Saving the Image (See the gradients_to_edges()).
+ */
+int output_format = OUTPUT_FORMAT_PIXEL;
+
+/*
+ * offload_mode Indicates whether each Iteration is Processed by the Acceleration Groups of the FPGA or by the CPU Engine of the Application (See the cpu_sobel_filter()).
+ * The Value of this Variable is Given as an Optional Argument when this Application is Called.
+ * 
+ * 0 (OFFLOAD_MODE_FPGA) --> Always Request Acceleration Groups (Default)
+ * 1 (OFFLOAD_MODE_AUTO) --> Select the Engine of each Iteration from the Image Size, the Queue Depth of the Acceleration Groups and the Measured Latencies (See the offload_decision())
+ * 2 (OFFLOAD_MODE_CPU) --> Always Use the CPU Engine
+ * 
+ * The CPU Engine Supports only the FILTER_PRESET_SOBEL with the OUTPUT_FORMAT_PIXEL and no Pipeline Stages.
+ * The Iterations of any Other Configuration as well as the Tiled Images and the Submission Ring are Always Processed by the FPGA.
+ */
+int offload_mode = OFFLOAD_MODE_FPGA;
+
+/*
+ * cpu_workers is the Number of Threads that the CPU Engine Uses for each Image.
+ * It is Set in the main() so that the Threads of all the Application Threads Together do not Exceed the Online CPUs.
+ * The cpu_sobel_filter() Uses at most CPU_MAX_WORKERS Threads.
+ */
+int cpu_workers = 1;
+
+/*
+ * The offload_* Variables Keep the Measurements of the offload_decision() and they are Shared among the Threads of the Application.
+ * 
+ * offload_latency --> The Average Latency of each Engine (Indexed by OFFLOAD_ENGINE_*) in Nanoseconds per 1024 Pixels
+ * offload_samples --> The Number of Latency Samples of each Engine
+ * offload_last_job --> The Decision Number when each Engine was Last Selected
+ * offload_jobs --> The Number of Decisions Made so Far
+ * 
+ * The offload_lock Mutex Protects all of them.
+ */
+pthread_mutex_t offload_lock = PTHREAD_MUTEX_INITIALIZER;
+uint64_t offload_latency[2] = { 0, 0 };
+int offload_samples[2] = { 0, 0 };
+unsigned int offload_last_job[2] = { 0, 0 };
+unsigned int offload_jobs = 0;
+
+/*
+ * mapped_bmp_file (Pointer) Points to the Whole Image File when it is Memory Mapped for the LOAD_MODE_DIRECT and LOAD_MODE_PRE_STAGED Modes.
+ * The mapped_bmp_file_size is the Size in Bytes of the Mapping.
+ * The mapped_bmp_data (Pointer) Points to the Beginning of the Bitmap Data inside the Mapping and mapped_bmp_row_stride is the Size in Bytes of each Image Row in the File.
+ * The Mapping is Shared among the Threads of the Application and it is only Read.
+ */
+uint8_t *mapped_bmp_file = NULL;
+size_t mapped_bmp_file_size = 0;
+uint8_t *mapped_bmp_data = NULL;
+size_t mapped_bmp_row_stride = 0;
+
+/*
+ * save_buffer (Pointer) Points to a Memory where save_bmp() Assembles the Whole Bitmap File (Headers and 24 Bit Bitmap Data)
+ * so that the File is Written to the Storage Device with a Single write() Call.
+ * It is Thread Local since Multiple Threads May Save Images Simultaneously and it is Reused among the Iterations of each Thread.
+ * The save_buffer_size Indicates the Size in Bytes of the Current Allocation and it is Increased only if a Larger Image is Saved.
+ */
+__thread uint8_t *save_buffer = NULL;
+__thread size_t save_buffer_size = 0;
+
+/*
+ * cpu_buffer (Pointer) Points to a Thread Local Memory where the cpu_sobel_filter() Keeps the Luminance Values of the Image and the Edge Row of each Worker.
+ * The cpu_buffer_size Indicates the Size in Bytes of the Current Allocation and it is Increased only if a Larger Image is Processed.
+ */
+__thread uint8_t *cpu_buffer = NULL;
+__thread size_t cpu_buffer_size = 0;
+
 
 /*
  * ---------------------
@@ -211,9 +383,35 @@ void signal_handler_sg(int, siginfo_t *, void *);
  
 int setup_signal_handling();
 void clear_screen();
+void print_usage(const char *);
 
 int load_bmp(uint8_t *);
-int save_bmp(uint8_t *, char *);
+int save_bmp(uint8_t *, char *, const int *, int);
+
+void expand_bgr_to_bgrx(const uint8_t *, uint8_t *, int);
+void pack_bgrx_to_bgr(const uint8_t *, uint8_t *, int);
+void unpack_gray_to_bgr(const uint8_t *, uint8_t *, int);
+int gradients_to_edges(const uint8_t *, uint8_t *, size_t);
+void convert_to_luma(const uint8_t *, uint8_t *, int, int);
+size_t input_row_bytes();
+size_t output_row_bytes();
+void expand_bmp_rows(const uint8_t *, size_t, uint8_t *);
+
+int map_bmp();
+void unmap_bmp();
+void stage_image(uint8_t *);
+void set_filter(struct filter_config *, int);
+
+int cpu_sobel_supported();
+int cpu_sobel_filter(uint8_t *);
+int offload_decision(int, int *);
+void offload_record(int, int, uint64_t, int);
+uint64_t monotonic_time_ns();
+
+int wait_for_acceleration(int, struct shared_repository_process *);
+int ring_acceleration(int, struct shared_repository_process *, uint8_t *, pid_t);
+int ring_wait_for_completion(int, struct pollfd *, uint64_t);
+int tiled_acceleration(int, struct shared_repository_process *, uint8_t *, pid_t);
 
 uint64_t convert_cycles_2_ns(uint64_t);
 int file_size(FILE *);
@@ -545,442 +743,2424 @@ void clear_screen()
 
 
 /* OK
- * load_bmp()
+ * print_usage()
  * 
- * Used to Load the Image from the Storage Device to a Given Memory
- * According to the u8_pre_process_kernel_address Pointer.
- * According to the Current Implementation the u8_pre_process_kernel_address Points Directly to an Allocated Memory in Kernel Space
+ * Prints the Arguments of the Application when they are Missing or Invalid.
  */
-int load_bmp(uint8_t *u8_pre_process_kernel_address) 
+void print_usage(const char *application)
 {
-	size_t total_read_bytes;
-	
-	FILE *bmp_file;
+	printf("Usage: %s path_file thread_iterations threads_number save_flag test_iterations [load_mode] [ring_depth] [allocation_policy] [packed_output] [input_format] [filter] [pipeline] [output] [offload]\n", application);
+	printf("load_mode: 0 Copy the Loaded Image (Default), 1 Stage the Image Directly from the Mapped File, 2 As 1 but Stage the Image only when it Changed\n");
+}
 
-	int status;
-	int repeat;
-	size_t pad;
-	uint8_t current_byte;
+
+/* OK
+ * expand_bgr_to_bgrx_scalar()
+ * 
+ * Scalar Version of the Pixel Expansion which Copies the 3 Bytes (Blue, Green, Red) of each Pixel
+ * and Appends a Zero Padding Byte so that each Pixel Occupies 4 Bytes in the Destination Memory.
+ * It is Used when the CPU Lacks SIMD Support and for the Remaining Pixels at the End of each Row of the SIMD Versions.
+ */
+static void expand_bgr_to_bgrx_scalar(const uint8_t *source, uint8_t *destination, int pixels)
+{
+	int j;
 	
-	int count = 0;
-	int i,j;
-		
-	#ifdef DEBUG_MESSAGES_UI	
-	printf("The Path is: %s\n", load_path_name);
+	for(j = 0; j < pixels; j++)
+	{
+		destination[0] = source[0];
+		destination[1] = source[1];
+		destination[2] = source[2];
+		destination[3] = 0x0;
 		
-	printf("Loading the Image File\n");
-    #endif
-    
-    /*
-     * Open the Image File According to the File Name Given by the the User
-     */
-    bmp_file = fopen(load_path_name, "r");
+		source += 3;
+		destination += 4;
+	}
+}
 
-    if(bmp_file != NULL)
-    {
-		#ifdef DEBUG_MESSAGES_UI
-    	printf("Image File Opened\n");
-    	#endif
-    }
-    else
-    {
-        if(bmp_file == NULL)
-        {
-        	printf("Image Failed to Open [NULL Pointer]\n");
-        }
+#if defined(__x86_64__) || defined(__i386__)
+
+/* OK
+ * expand_bgr_to_bgrx_ssse3()
+ * 
+ * SSSE3 Version of the Pixel Expansion.
+ * Each 16 Byte Load Contains 4 Complete Pixels (12 Bytes) which are Spread with a Single Byte Shuffle to 16 Bytes.
+ * The Shuffle Mask Indices with the Most Significant Bit Set (0x80) Produce the Zero Padding Byte of each Pixel.
+ * The Loop Stops while there are still at least 2 Pixels Left so that the 16 Byte Load Never Reads Past the End of the Row.
+ */
+__attribute__((target("ssse3")))
+static void expand_bgr_to_bgrx_ssse3(const uint8_t *source, uint8_t *destination, int pixels)
+{
+	const __m128i shuffle_mask = _mm_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128);
 	
-   	usleep(2000000);
+	int j = 0;
+	
+	for(; j + 6 <= pixels; j += 4)
+	{
+		__m128i bgr_pixels = _mm_loadu_si128((const __m128i *)(source + (j * 3)));
+		
+		_mm_storeu_si128((__m128i *)(destination + (j * 4)), _mm_shuffle_epi8(bgr_pixels, shuffle_mask));
+	}
+	
+	expand_bgr_to_bgrx_scalar(source + (j * 3), destination + (j * 4), pixels - j);
+}
 
-   	return(FAILURE);
-    }
-    
-    
-    #ifdef DEBUG_MESSAGES_UI
-    printf("Checking the Magic Number to Validate that this is a Bitmap File\n");
-    #endif
+/* OK
+ * expand_bgr_to_bgrx_avx2()
+ * 
+ * AVX2 Version of the Pixel Expansion.
+ * The Same Shuffle as in the SSSE3 Version is Applied on Two 128 Bit Lanes so that 8 Pixels are Expanded in each Loop.
+ * The Upper Lane is Loaded from the 12th Byte since the Byte Shuffle of AVX2 Cannot Cross the Lanes.
+ */
+__attribute__((target("avx2")))
+static void expand_bgr_to_bgrx_avx2(const uint8_t *source, uint8_t *destination, int pixels)
+{
+	const __m256i shuffle_mask = _mm256_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128,
+	                                              0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128);
+	
+	int j = 0;
+	
+	for(; j + 10 <= pixels; j += 8)
+	{
+		__m256i bgr_pixels = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(source + (j * 3)))),
+		                                             _mm_loadu_si128((const __m128i *)(source + (j * 3) + 12)), 1);
+		
+		_mm256_storeu_si256((__m256i *)(destination + (j * 4)), _mm256_shuffle_epi8(bgr_pixels, shuffle_mask));
+	}
+	
+	expand_bgr_to_bgrx_scalar(source + (j * 3), destination + (j * 4), pixels - j);
+}
 
-	/*
-	 * Read the Magic Number from the Header of the Bitmap File.
-	 */
-    fread(&magic_number, sizeof(bmpfile_magic_t), 1, bmp_file);
+#endif
 
-	/*
-	 * Check the Magic Number to Validate that this is a Bitmap File.
-	 * The Magic Number for .bmp Files is: 0x4D42.
-	 */
-	if (*((uint16_t *)magic_number.magic) == 0x4D42)
+/* OK
+ * expand_bgr_to_bgrx()
+ * 
+ * Used to Expand a Row of 24 Bit Pixels (Blue, Green, Red) as Stored in the Bitmap File to the 32 Bit per Pixel Format
+ * that the Acceleration System Requires (See the Comments for the total_reserved_size Global Variable).
+ * The Fastest Version that the CPU Supports is Selected at Runtime so that the Application does not Require any Special Compiler Flags.
+ */
+void expand_bgr_to_bgrx(const uint8_t *source, uint8_t *destination, int pixels)
+{
+	#if defined(__x86_64__) || defined(__i386__)
+	if(__builtin_cpu_supports("avx2"))
 	{
-		#ifdef DEBUG_MESSAGES_UI
-		printf("Bitmap File Valid [MAGIC NUMBER 0x%X]\n", *((uint16_t *)magic_number.magic));
-		#endif
+		expand_bgr_to_bgrx_avx2(source, destination, pixels);
+		return;
 	}
-	else
+	
+	if(__builtin_cpu_supports("ssse3"))
 	{
-		#ifdef DEBUG_MESSAGES_UI
-		printf("No Bitmap File Was Found/Aborting\n");
-		#endif
-		fclose(bmp_file);
-		return FAILURE;
+		expand_bgr_to_bgrx_ssse3(source, destination, pixels);
+		return;
 	}
-    
-    
+	#endif
+	
+	expand_bgr_to_bgrx_scalar(source, destination, pixels);
+}
 
-    #ifdef DEBUG_MESSAGES_UI
-    printf("Reading the Bitmap File Header\n");
-    #endif
 
-    /*
-     * Read the Bitmap File Header
-     */
-    fread(&bitmap_file_header, sizeof(bmpfile_header_t), 1, bmp_file);
+/* OK
+ * pack_bgrx_to_bgr_scalar()
+ * 
+ * Scalar Version of the Pixel Packing which is the Reverse of the expand_bgr_to_bgrx_scalar().
+ * It Copies the 3 Bytes (Blue, Green, Red) of each 4 Byte Pixel and Drops the Padding Byte.
+ */
+static void pack_bgrx_to_bgr_scalar(const uint8_t *source, uint8_t *destination, int pixels)
+{
+	int j;
+	
+	for(j = 0; j < pixels; j++)
+	{
+		destination[0] = source[0];
+		destination[1] = source[1];
+		destination[2] = source[2];
+		
+		source += 4;
+		destination += 3;
+	}
+}
 
+#if defined(__x86_64__) || defined(__i386__)
 
-    #ifdef DEBUG_MESSAGES_UI
-    printf("Reading the Bitmap Info Header\n");
-    #endif
+/* OK
+ * pack_bgrx_to_bgr_ssse3()
+ * 
+ * SSSE3 Version of the Pixel Packing.
+ * A Byte Shuffle Gathers the 12 Valid Bytes of 4 Pixels at the Lower Part of the Register.
+ * The Whole 16 Bytes are Stored but the Destination Pointer Advances only by 12 Bytes so the 4 Invalid Bytes are Overwritten by the Next Store.
+ * As a Result the Destination Memory Requires 4 Bytes of Slack after the Last Pixel.
+ */
+__attribute__((target("ssse3")))
+static void pack_bgrx_to_bgr_ssse3(const uint8_t *source, uint8_t *destination, int pixels)
+{
+	const __m128i shuffle_mask = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -128, -128, -128, -128);
+	
+	int j = 0;
+	
+	for(; j + 4 <= pixels; j += 4)
+	{
+		__m128i bgrx_pixels = _mm_loadu_si128((const __m128i *)(source + (j * 4)));
+		
+		_mm_storeu_si128((__m128i *)(destination + (j * 3)), _mm_shuffle_epi8(bgrx_pixels, shuffle_mask));
+	}
+	
+	pack_bgrx_to_bgr_scalar(source + (j * 4), destination + (j * 3), pixels - j);
+}
 
-    /*
-     * Read the Bitmap Info Header
-     */
-    fread(&bitmap_info_header, sizeof(bitmap_info_header_t), 1, bmp_file);
+/* OK
+ * pack_bgrx_to_bgr_avx2()
+ * 
+ * AVX2 Version of the Pixel Packing.
+ * After the Byte Shuffle each 128 Bit Lane Holds 12 Valid Bytes so a Cross Lane Permutation of the 32 Bit Words 
+ * Brings the 24 Valid Bytes of the 8 Pixels Together.
+ * The Destination Memory Requires 8 Bytes of Slack after the Last Pixel.
+ */
+__attribute__((target("avx2")))
+static void pack_bgrx_to_bgr_avx2(const uint8_t *source, uint8_t *destination, int pixels)
+{
+	const __m256i shuffle_mask = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -128, -128, -128, -128,
+	                                              0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -128, -128, -128, -128);
+	const __m256i permute_mask = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+	
+	int j = 0;
+	
+	for(; j + 8 <= pixels; j += 8)
+	{
+		__m256i bgrx_pixels = _mm256_loadu_si256((const __m256i *)(source + (j * 4)));
+		
+		_mm256_storeu_si256((__m256i *)(destination + (j * 3)), _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(bgrx_pixels, shuffle_mask), permute_mask));
+	}
+	
+	pack_bgrx_to_bgr_scalar(source + (j * 4), destination + (j * 3), pixels - j);
+}
 
+#endif
 
-	 #ifdef DEBUG_MESSAGES_UI
-	 printf("Checking Compression\n");
-	 #endif
-	 
-	/*
-	 * Check the Info Header Structure to See if Compression is Supported
-	 */	 
-	if (bitmap_info_header.compress_type == 0)
+/* OK
+ * pack_bgrx_to_bgr()
+ * 
+ * Used to Pack a Row of 32 Bit Pixels of the Acceleration System Format Back to the 24 Bit per Pixel Format of the Bitmap File.
+ * The SIMD Versions Write up to 8 Bytes after the Last Packed Pixel so the Caller Should Provide a Destination Memory with Adequate Slack.
+ */
+void pack_bgrx_to_bgr(const uint8_t *source, uint8_t *destination, int pixels)
+{
+	#if defined(__x86_64__) || defined(__i386__)
+	if(__builtin_cpu_supports("avx2"))
 	{
-		#ifdef DEBUG_MESSAGES_UI
-		printf("Compression is Supported\n");
-		#endif
+		pack_bgrx_to_bgr_avx2(source, destination, pixels);
+		return;
 	}
-	else
+	
+	if(__builtin_cpu_supports("ssse3"))
 	{
-		#ifdef DEBUG_MESSAGES_UI
-		printf("Warning, Compression is not Supported\n");
-		#endif
-	}	  
+		pack_bgrx_to_bgr_ssse3(source, destination, pixels);
+		return;
+	}
+	#endif
 	
-	/*
-	 * Print Information About the Image
-	 */
-	 #ifdef DEBUG_MESSAGES_UI
-	printf("\n* Image Width:       %d Pixels\n", bitmap_info_header.width);
-	printf("* Image Height:      %d Pixels\n", bitmap_info_header.height);
-	printf("* Image Size:        %d Bytes\n", bitmap_info_header.bmp_bytesz);
-	printf("* Image Header Size: %d Bytes\n", bitmap_info_header.header_sz);
-	printf("* Bits Per Pixel:    %d \n\n", bitmap_info_header.bitspp);	
-	#endif 
-	 
+	pack_bgrx_to_bgr_scalar(source, destination, pixels);
+}
+
+
+/* OK
+ * unpack_gray_to_bgr()
+ * 
+ * Used to Expand a Row of the Packed Output Mode where each Pixel is a Single 8 Bit Grayscale Value to the 24 Bit per Pixel Format of the Bitmap File.
+ * The Grayscale Value is Repeated to the Blue, Green and Red Bytes as the Sobel Filter Does in its Default Output Mode.
+ */
+void unpack_gray_to_bgr(const uint8_t *source, uint8_t *destination, int pixels)
+{
+	int j;
 	
-	/*
-	 * Read the Info Header to Make Sure that the Image Resolution is up to 1920x1080 which is the Maximum Supported
-	 */
-	if((bitmap_info_header.width > 1920) || (bitmap_info_header.height >1080)) 
+	for(j = 0; j < pixels; j++)
 	{
-		printf("The Image Cannot be Processed due to Sobel Accelerator's Restricted Resolution at Maximum of 3840x2160/Aborting\n");
-		fclose(bmp_file);
+		destination[0] = source[j];
+		destination[1] = source[j];
+		destination[2] = source[j];
 		
-		usleep(5000000);
-		
-		return FAILURE;
+		destination += 3;
 	}
-	  
+}
+
+
+/* OK
+ * gradients_to_edges()
+ * 
+ * Used to Complete a Canny Edge Detector on the Gradients that the Sobel Filters Return in the Gradient Output Formats (See the output_format).
+ * The Gradients of each Pixel are in the 32 Bit Word of the Pixel in the Memory Given by the source Pointer.
+ * The Edges are Written as 24 Bit Pixels of row_stride Bytes per Row to the Bitmap Data Given by the bitmap_data Pointer
+ * where Edges are Dark as in the Default Output of the Sobel Filters.
+ * 
+ * a --> The Magnitude and the Direction of each Gradient are Decoded (Calculated from the X and Y Gradients in the OUTPUT_FORMAT_GRADIENTS).
+ * b --> Non-Maximum Suppression Keeps only the Pixels whose Magnitude is a Local Maximum along the Direction.
+ * c --> Hysteresis Keeps the Pixels Above the CANNY_THRESHOLD_HIGH and the Pixels Above the CANNY_THRESHOLD_LOW that are Connected to them.
+ * 
+ * The Direction is Quantized as in the Sobel Filters where the Y Gradient Increases towards the Previous Row of the Memory.
+ */
+int gradients_to_edges(const uint8_t *source, uint8_t *bitmap_data, size_t row_stride)
+{
+	int width = bitmap_info_header.width;
+	int height = bitmap_info_header.height;
+	size_t pixels = (size_t)width * height;
+	
+	uint16_t *magnitude;
+	uint8_t *direction;
+	uint8_t *edge;
+	uint32_t *stack;
+	size_t stack_size;
+	
+	uint32_t word;
+	int x_gradient;
+	int y_gradient;
+	int x_abs;
+	int y_abs;
+	int first;
+	int second;
+	int row;
+	int col;
+	size_t i;
+	
+	magnitude = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+	direction = (uint8_t *)malloc(pixels);
+	edge = (uint8_t *)calloc(pixels, 1);
+	stack = (uint32_t *)malloc(pixels * sizeof(uint32_t));
+	
+	if(magnitude == NULL || direction == NULL || edge == NULL || stack == NULL)
+	{
+		free(magnitude);
+		free(direction);
+		free(edge);
+		free(stack);
+		
+		return FAILURE;
+	}
+	
+	/*
+	 * Decode the Magnitude and the Direction of the Gradient of each Pixel.
+	 */
+	for(i = 0; i < pixels; i++)
+	{
+		word = (uint32_t)source[(i * 4)] | ((uint32_t)source[(i * 4) + 1] << 8) | ((uint32_t)source[(i * 4) + 2] << 16);
+		
+		if(output_format == OUTPUT_FORMAT_MAGNITUDE)
+		{
+			magnitude[i] = (uint16_t)(word & 0xFFFF);
+			direction[i] = (uint8_t)((word >> 16) & 0x3);
+			
+			continue;
+		}
+		
+		//Sign Extend the 12 Bit Gradients.
+		x_gradient = (int)((word & 0xFFF) ^ 0x800) - 0x800;
+		y_gradient = (int)(((word >> 12) & 0xFFF) ^ 0x800) - 0x800;
+		
+		x_abs = abs(x_gradient);
+		y_abs = abs(y_gradient);
+		
+		magnitude[i] = (uint16_t)(x_abs + y_abs);
+		
+		if((y_abs * 5) <= (x_abs * 2))
+		{
+			direction[i] = DIRECTION_HORIZONTAL;
+		}
+		else if((x_abs * 5) <= (y_abs * 2))
+		{
+			direction[i] = DIRECTION_VERTICAL;
+		}
+		else if((x_gradient > 0) == (y_gradient > 0))
+		{
+			direction[i] = DIRECTION_RISING;
+		}
+		else
+		{
+			direction[i] = DIRECTION_FALLING;
+		}
+	}
+	
+	/*
+	 * Apply the Non-Maximum Suppression and Mark the Strong (2) and Weak (1) Edges.
+	 * The Strong Edges are Pushed to the Stack to Start the Hysteresis from them.
+	 * The Pixels of the First and Last Row and Column are Never Edges as in the Sobel Filters.
+	 */
+	stack_size = 0;
+	
+	for(row = 1; row < height - 1; row++)
+	{
+		for(col = 1; col < width - 1; col++)
+		{
+			i = ((size_t)row * width) + col;
+			
+			if(magnitude[i] < CANNY_THRESHOLD_LOW)
+			{
+				continue;
+			}
+			
+			switch(direction[i])
+			{
+				case DIRECTION_HORIZONTAL: first = magnitude[i - 1]; second = magnitude[i + 1]; break;
+				case DIRECTION_VERTICAL: first = magnitude[i - width]; second = magnitude[i + width]; break;
+				case DIRECTION_RISING: first = magnitude[i - width + 1]; second = magnitude[i + width - 1]; break;
+				default: first = magnitude[i - width - 1]; second = magnitude[i + width + 1]; break;
+			}
+			
+			//A Tie is Kept only on the Second Side so that an Edge between two Equal Magnitudes is one Pixel Wide.
+			if(first > magnitude[i] || second >= magnitude[i])
+			{
+				continue;
+			}
+			
+			if(magnitude[i] >= CANNY_THRESHOLD_HIGH)
+			{
+				edge[i] = 2;
+				stack[stack_size++] = (uint32_t)i;
+			}
+			else
+			{
+				edge[i] = 1;
+			}
+		}
+	}
+	
+	/*
+	 * Promote the Weak Edges that are 8-Connected to a Strong Edge.
+	 * Each Pixel is Pushed at most once since it is Promoted before it is Pushed.
+	 */
+	while(stack_size > 0)
+	{
+		i = stack[--stack_size];
+		
+		for(row = -1; row <= 1; row++)
+		{
+			for(col = -1; col <= 1; col++)
+			{
+				size_t neighbor = i + ((long)row * width) + col;
+				
+				if(edge[neighbor] == 1)
+				{
+					edge[neighbor] = 2;
+					stack[stack_size++] = (uint32_t)neighbor;
+				}
+			}
+		}
+	}
+	
+	/*
+	 * Write the Edges as Dark Pixels and the Rest Pixels as White Pixels.
+	 */
+	for(row = 0; row < height; row++)
+	{
+		for(col = 0; col < width; col++)
+		{
+			uint8_t value = (edge[((size_t)row * width) + col] == 2) ? 0 : 255;
+			
+			bitmap_data[(row * row_stride) + (col * 3)] = value;
+			bitmap_data[(row * row_stride) + (col * 3) + 1] = value;
+			bitmap_data[(row * row_stride) + (col * 3) + 2] = value;
+		}
+		
+		memset(bitmap_data + (row * row_stride) + ((size_t)width * 3), 0, row_stride - ((size_t)width * 3));
+	}
+	
+	free(magnitude);
+	free(direction);
+	free(edge);
+	free(stack);
+	
+	return SUCCESS;
+}
+
+
+/* OK
+ * convert_to_luma_scalar()
+ * 
+ * Scalar Version of the Luminance Conversion.
+ * It Applies the Same Formula as the rgb2y() of the Sobel Filter to Pixels of bytes_per_pixel (3 or 4) Bytes.
+ */
+static void convert_to_luma_scalar(const uint8_t *source, uint8_t *destination, int pixels, int bytes_per_pixel)
+{
+	int j;
+	
+	for(j = 0; j < pixels; j++)
+	{
+		destination[j] = (uint8_t)(((66 * source[2] + 129 * source[1] + 25 * source[0] + 128) >> 8) + 16);
+		
+		source += bytes_per_pixel;
+	}
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/* OK
+ * convert_to_luma_ssse3()
+ * 
+ * SSSE3 Version of the Luminance Conversion.
+ * The 4 Pixels of each Loop are First Brought to the 4 Bytes per Pixel Layout (a Byte Shuffle is Required only for 24 Bit Pixels).
+ * Each Pixel is then Widened to 16 Bit Values and a Multiply-Add with the Weights (25, 129, 66, 0) Followed by a Horizontal Add
+ * Gives the Weighted Sum of each Pixel in a 32 Bit Lane.
+ * For 24 Bit Pixels the Loop Stops while there are still at least 2 Pixels Left so that the 16 Byte Load Never Reads Past the End of the Row.
+ */
+__attribute__((target("ssse3")))
+static void convert_to_luma_ssse3(const uint8_t *source, uint8_t *destination, int pixels, int bytes_per_pixel)
+{
+	const __m128i shuffle_mask = _mm_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128);
+	const __m128i weights = _mm_setr_epi16(25, 129, 66, 0, 25, 129, 66, 0);
+	const __m128i rounding = _mm_set1_epi32(128);
+	const __m128i offset = _mm_set1_epi32(16);
+	const __m128i zero = _mm_setzero_si128();
+	
+	int slack = (bytes_per_pixel == 3) ? 2 : 0;
+	int j = 0;
+	
+	for(; j + 4 + slack <= pixels; j += 4)
+	{
+		__m128i bgrx_pixels = _mm_loadu_si128((const __m128i *)(source + (j * bytes_per_pixel)));
+		
+		if(bytes_per_pixel == 3)
+		{
+			bgrx_pixels = _mm_shuffle_epi8(bgrx_pixels, shuffle_mask);
+		}
+		
+		__m128i sums = _mm_hadd_epi32(_mm_madd_epi16(_mm_unpacklo_epi8(bgrx_pixels, zero), weights),
+		                              _mm_madd_epi16(_mm_unpackhi_epi8(bgrx_pixels, zero), weights));
+		
+		sums = _mm_add_epi32(_mm_srli_epi32(_mm_add_epi32(sums, rounding), 8), offset);
+		
+		*(int *)(destination + j) = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(sums, zero), zero));
+	}
+	
+	convert_to_luma_scalar(source + (j * bytes_per_pixel), destination + j, pixels - j, bytes_per_pixel);
+}
+
+/* OK
+ * convert_to_luma_avx2()
+ * 
+ * AVX2 Version of the Luminance Conversion.
+ * The Same Steps as in the SSSE3 Version are Applied on Two 128 Bit Lanes so that 8 Pixels are Converted in each Loop.
+ * After the Horizontal Add the Lower Lane Holds the Sums of the First 4 Pixels and the Upper Lane the Sums of the Last 4 Pixels
+ * so the Two Lanes are Packed Together to the 8 Luminance Values.
+ */
+__attribute__((target("avx2")))
+static void convert_to_luma_avx2(const uint8_t *source, uint8_t *destination, int pixels, int bytes_per_pixel)
+{
+	const __m256i shuffle_mask = _mm256_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128,
+	                                              0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128);
+	const __m256i weights = _mm256_setr_epi16(25, 129, 66, 0, 25, 129, 66, 0, 25, 129, 66, 0, 25, 129, 66, 0);
+	const __m256i rounding = _mm256_set1_epi32(128);
+	const __m256i offset = _mm256_set1_epi32(16);
+	const __m256i zero = _mm256_setzero_si256();
+	
+	int slack = (bytes_per_pixel == 3) ? 2 : 0;
+	int j = 0;
+	
+	for(; j + 8 + slack <= pixels; j += 8)
+	{
+		__m256i bgrx_pixels;
+		
+		if(bytes_per_pixel == 3)
+		{
+			bgrx_pixels = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(source + (j * 3)))),
+			                                      _mm_loadu_si128((const __m128i *)(source + (j * 3) + 12)), 1);
+			
+			bgrx_pixels = _mm256_shuffle_epi8(bgrx_pixels, shuffle_mask);
+		}
+		else
+		{
+			bgrx_pixels = _mm256_loadu_si256((const __m256i *)(source + (j * 4)));
+		}
+		
+		__m256i sums = _mm256_hadd_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi8(bgrx_pixels, zero), weights),
+		                                 _mm256_madd_epi16(_mm256_unpackhi_epi8(bgrx_pixels, zero), weights));
+		
+		sums = _mm256_add_epi32(_mm256_srli_epi32(_mm256_add_epi32(sums, rounding), 8), offset);
+		
+		__m128i words = _mm_packs_epi32(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+		
+		_mm_storel_epi64((__m128i *)(destination + j), _mm_packus_epi16(words, words));
+	}
+	
+	convert_to_luma_scalar(source + (j * bytes_per_pixel), destination + j, pixels - j, bytes_per_pixel);
+}
+
+#endif
+
+/* OK
+ * convert_to_luma()
+ * 
+ * Used to Convert a Row of the Bitmap File with 3 or 4 Bytes per Pixel (bytes_per_pixel) to 8 Bit Luminance Values for the INPUT_FORMAT_LUMA.
+ * The Conversion Moves the rgb2y() of the Sobel Filter to the Host so that the Acceleration Groups Read a Quarter of the Image Data.
+ */
+void convert_to_luma(const uint8_t *source, uint8_t *destination, int pixels, int bytes_per_pixel)
+{
+	#if defined(__x86_64__) || defined(__i386__)
+	if(__builtin_cpu_supports("avx2"))
+	{
+		convert_to_luma_avx2(source, destination, pixels, bytes_per_pixel);
+		return;
+	}
+	
+	if(__builtin_cpu_supports("ssse3"))
+	{
+		convert_to_luma_ssse3(source, destination, pixels, bytes_per_pixel);
+		return;
+	}
+	#endif
+	
+	convert_to_luma_scalar(source, destination, pixels, bytes_per_pixel);
+}
+
+
+/* OK
+ * input_row_bytes()
+ * 
+ * Returns the Size in Bytes that each Image Row Occupies in the Pre Process Kernel Memory According to the input_format.
+ * The Driver Calculates the Same Size to Locate the Image Segment of each Acceleration Group.
+ */
+size_t input_row_bytes()
+{
+	if(input_format == INPUT_FORMAT_BGR)
+	{
+		return (((size_t)bitmap_info_header.width * 3 + 3) / 4) * 4;
+	}
+	
+	if(input_format == INPUT_FORMAT_LUMA)
+	{
+		return (((size_t)bitmap_info_header.width + 3) / 4) * 4;
+	}
+	
+	return (size_t)bitmap_info_header.width * 4;
+}
+
+
+/* OK
+ * output_row_bytes()
+ * 
+ * Returns the Size in Bytes of each Processed Image Row.
+ * In the Packed Output Mode each Processed Row Occupies a Single Byte per Pixel Rounded up to 4 Bytes.
+ */
+size_t output_row_bytes()
+{
+	if(packed_output == 1)
+	{
+		return (((size_t)bitmap_info_header.width + 3) / 4) * 4;
+	}
+	
+	return (size_t)bitmap_info_header.width * 4;
+}
+
+
+/* OK
+ * expand_bmp_rows()
+ * 
+ * Used to Convert the Whole Bitmap Data as Stored in the File (Given by the file_pixels Pointer) to the Format of the Acceleration System Given by the input_format.
+ * The row_stride is the Size in Bytes of each Image Row in the File Including the Padding Bytes at the End of the Row which are Skipped.
+ * 
+ * In the INPUT_FORMAT_BGRX Images with 32 Bits per Pixel are Already in the Required Format so their Rows are Copied as they are.
+ * In the INPUT_FORMAT_BGR the Rows of Images with 24 Bits per Pixel are Already in the Required Format (Including the Padding) so the Whole Bitmap Data is Copied at Once.
+ * In the INPUT_FORMAT_LUMA each Row is Converted to Luminance Values.
+ */
+void expand_bmp_rows(const uint8_t *file_pixels, size_t row_stride, uint8_t *destination)
+{
+	int i;
+	size_t destination_stride = input_row_bytes();
+	size_t row_bytes;
+	
+	if(input_format == INPUT_FORMAT_BGR && bitmap_info_header.bitspp != 32)
+	{
+		memcpy(destination, file_pixels, destination_stride * bitmap_info_header.height);
+		
+		return;
+	}
+	
+	/*
+	 * Loop for the Number of Image Rows.
+	 */
+	for(i=0; i<bitmap_info_header.height; i++)
+	{
+		if(input_format == INPUT_FORMAT_LUMA)
+		{
+			convert_to_luma(file_pixels + (i * row_stride), destination + (i * destination_stride), bitmap_info_header.width, bitmap_info_header.bitspp / 8);
+			
+			row_bytes = bitmap_info_header.width;
+		}
+		else if(input_format == INPUT_FORMAT_BGR)
+		{
+			pack_bgrx_to_bgr(file_pixels + (i * row_stride), destination + (i * destination_stride), bitmap_info_header.width);
+			
+			row_bytes = (size_t)bitmap_info_header.width * 3;
+		}
+		else if(bitmap_info_header.bitspp == 32)
+		{
+			memcpy(destination + (i * destination_stride), file_pixels + (i * row_stride), bitmap_info_header.width * 4);
+			
+			row_bytes = destination_stride;
+		}
+		else
+		{
+			expand_bgr_to_bgrx(file_pixels + (i * row_stride), destination + (i * destination_stride), bitmap_info_header.width);
+			
+			row_bytes = destination_stride;
+		}
+		
+		/*
+		 * Clear the Padding Bytes at the End of the Row (If Any) of the Packed Input Formats.
+		 */
+		memset(destination + (i * destination_stride) + row_bytes, 0, destination_stride - row_bytes);
+	}
+}
+
+
+/* OK
+ * load_bmp()
+ * 
+ * Used to Load the Image from the Storage Device to a Given Memory
+ * According to the u8_pre_process_kernel_address Pointer.
+ * According to the Current Implementation the u8_pre_process_kernel_address Points Directly to an Allocated Memory in Kernel Space
+ */
+int load_bmp(uint8_t *u8_pre_process_kernel_address) 
+{
+	size_t total_read_bytes;
+	
+	FILE *bmp_file;
+
+	size_t pad;
+	size_t row_stride;
+	uint8_t *file_pixels;
+		
+	#ifdef DEBUG_MESSAGES_UI	
+	printf("The Path is: %s\n", load_path_name);
+		
+	printf("Loading the Image File\n");
+    #endif
+    
+    /*
+     * Open the Image File According to the File Name Given by the the User
+     */
+    bmp_file = fopen(load_path_name, "r");
+
+    if(bmp_file != NULL)
+    {
+		#ifdef DEBUG_MESSAGES_UI
+    	printf("Image File Opened\n");
+    	#endif
+    }
+    else
+    {
+        if(bmp_file == NULL)
+        {
+        	printf("Image Failed to Open [NULL Pointer]\n");
+        }
+	
+   	usleep(2000000);
+
+   	return(FAILURE);
+    }
+    
+    
+    #ifdef DEBUG_MESSAGES_UI
+    printf("Checking the Magic Number to Validate that this is a Bitmap File\n");
+    #endif
+
+	/*
+	 * Read the Magic Number from the Header of the Bitmap File.
+	 */
+    fread(&magic_number, sizeof(bmpfile_magic_t), 1, bmp_file);
+
+	/*
+	 * Check the Magic Number to Validate that this is a Bitmap File.
+	 * The Magic Number for .bmp Files is: 0x4D42.
+	 */
+	if (*((uint16_t *)magic_number.magic) == 0x4D42)
+	{
+		#ifdef DEBUG_MESSAGES_UI
+		printf("Bitmap File Valid [MAGIC NUMBER 0x%X]\n", *((uint16_t *)magic_number.magic));
+		#endif
+	}
+	else
+	{
+		#ifdef DEBUG_MESSAGES_UI
+		printf("No Bitmap File Was Found/Aborting\n");
+		#endif
+		fclose(bmp_file);
+		return FAILURE;
+	}
+    
+    
+
+    #ifdef DEBUG_MESSAGES_UI
+    printf("Reading the Bitmap File Header\n");
+    #endif
+
+    /*
+     * Read the Bitmap File Header
+     */
+    fread(&bitmap_file_header, sizeof(bmpfile_header_t), 1, bmp_file);
+
+
+    #ifdef DEBUG_MESSAGES_UI
+    printf("Reading the Bitmap Info Header\n");
+    #endif
+
+    /*
+     * Read the Bitmap Info Header
+     */
+    fread(&bitmap_info_header, sizeof(bitmap_info_header_t), 1, bmp_file);
+
+
+	 #ifdef DEBUG_MESSAGES_UI
+	 printf("Checking Compression\n");
+	 #endif
+	 
+	/*
+	 * Check the Info Header Structure to See if Compression is Supported
+	 */	 
+	if (bitmap_info_header.compress_type == 0)
+	{
+		#ifdef DEBUG_MESSAGES_UI
+		printf("Compression is Supported\n");
+		#endif
+	}
+	else
+	{
+		#ifdef DEBUG_MESSAGES_UI
+		printf("Warning, Compression is not Supported\n");
+		#endif
+	}	  
+	
+	/*
+	 * Print Information About the Image
+	 */
+	 #ifdef DEBUG_MESSAGES_UI
+	printf("\n* Image Width:       %d Pixels\n", bitmap_info_header.width);
+	printf("* Image Height:      %d Pixels\n", bitmap_info_header.height);
+	printf("* Image Size:        %d Bytes\n", bitmap_info_header.bmp_bytesz);
+	printf("* Image Header Size: %d Bytes\n", bitmap_info_header.header_sz);
+	printf("* Bits Per Pixel:    %d \n\n", bitmap_info_header.bitspp);	
+	#endif 
+	 
+	
+	/*
+	 * Read the Info Header to Make Sure that the Image Resolution is up to 3840x2160 which is the Maximum Supported
+	 */
+	if((bitmap_info_header.width > 3840) || (bitmap_info_header.height > 2160)) 
+	{
+		printf("The Image Cannot be Processed due to Sobel Accelerator's Restricted Resolution at Maximum of 3840x2160/Aborting\n");
+		fclose(bmp_file);
+		
+		usleep(5000000);
+		
+		return FAILURE;
+	}
+	  
+	/*
+	 * Move the File Pointer at the Beginning of the Bitmap File
+	 */
+	fseek(bmp_file, bitmap_file_header.bmp_offset, SEEK_SET);
+
+	#ifdef DEBUG_MESSAGES_UI
+	printf("Moved File Pointer at the Beginning of Bitmap Data\n");  	  
+	#endif
+    
+    
+    /*
+     * Get the Total Size Required for the Image Data.
+     * See Details at the Global Variables Section at the Comments for the total_reserved_size Variable.s
+     */
+    total_reserved_size =  (bitmap_info_header.width * bitmap_info_header.height) * 4;
+   
+    #ifdef DEBUG_MESSAGES_UI
+    printf("The Total Reserved Size Should Be: %d\n", total_reserved_size); 
+    #endif
+
+	/*
+	 * Calculate the Possible Padding that Might be Found at the end of an Image Row.
+	 */
+	pad = (4 - (((bitmap_info_header.bitspp / 8)*bitmap_info_header.width) % 4)) % 4;     
+    
+    #ifdef DEBUG_MESSAGES_UI
+    printf("The Padding is: %d\n", pad);	
+    #endif
+
+	/*
+	 * Get the Size of each Image Row as Stored in the File (3 Bytes per Pixel Plus the Padding Bytes).
+	 */
+	row_stride = ((bitmap_info_header.bitspp / 8) * bitmap_info_header.width) + pad;
+	
+	/*
+	 * Allocate a Temporary Memory to Read the Whole Bitmap Data with a Single fread() Call.
+	 * Reading the Image Byte by Byte Requires Millions of Library Calls for an HD Image which Dominates the Loading Time.
+	 */
+	file_pixels = (uint8_t *)malloc(row_stride * bitmap_info_header.height);
+	
+	if(file_pixels == NULL)
+	{
+		printf("Failed to Allocate Memory for the Bitmap Data\n");
+		fclose(bmp_file);
+		
+		return FAILURE;
+	}
+	
+	total_read_bytes = fread(file_pixels, sizeof(uint8_t), row_stride * bitmap_info_header.height, bmp_file);
+	
+	if(total_read_bytes != row_stride * bitmap_info_header.height)
+	{
+		printf("Failed to Read the Bitmap Data [Read %zu of %zu Bytes]\n", total_read_bytes, row_stride * bitmap_info_header.height);
+		free(file_pixels);
+		fclose(bmp_file);
+		
+		return FAILURE;
+	}
+
+	/*
+	 * Expand each Row from 3 to 4 Bytes per Pixel while the Padding Bytes at the End of each Row of the File are Skipped.
+	 */
+	expand_bmp_rows(file_pixels, row_stride, u8_pre_process_kernel_address);
+	
+	free(file_pixels);
+	
+	#ifdef DEBUG_MESSAGES_UI
+    printf("The Image Data is Loaded\n");	
+	#endif
+	
+    /*
+     * Close the Bitmap File.
+     */
+    fclose(bmp_file);
+	
+	return SUCCESS;
+}
+
+
+/* OK
+ * map_bmp()
+ * 
+ * Used Instead of the load_bmp() for the LOAD_MODE_DIRECT and LOAD_MODE_PRE_STAGED Modes.
+ * It Memory Maps the Whole Image File (load_path_name) so that the Threads Can Expand the Image Data with the stage_image() Function
+ * Directly from the Page Cache to their Pre Process Kernel Memory without the Intermediate common_load Memory.
+ * The Headers of the File Must be Already Read to the Global Header Structures.
+ */
+int map_bmp()
+{
+	int bmp_file;
+	
+	struct stat bmp_file_status;
+	
+	size_t pad;
+	
+	/*
+	 * Read the Info Header to Make Sure that the Image Resolution is up to 3840x2160 which is the Maximum Supported
+	 */
+	if((bitmap_info_header.width > 3840) || (bitmap_info_header.height > 2160)) 
+	{
+		printf("The Image Cannot be Processed due to Sobel Accelerator's Restricted Resolution at Maximum of 3840x2160/Aborting\n");
+		
+		return FAILURE;
+	}
+	
+	bmp_file = open(load_path_name, O_RDONLY);
+	
+	if(bmp_file < 0)
+	{
+		printf("Image Failed to Open\n");
+		
+		return FAILURE;
+	}
+	
+	if(fstat(bmp_file, &bmp_file_status) != 0)
+	{
+		printf("Image File Status Failed to be Read\n");
+		close(bmp_file);
+		
+		return FAILURE;
+	}
+	
+	/*
+	 * Calculate the Possible Padding that Might be Found at the end of an Image Row and the Size of each Image Row in the File.
+	 */
+	pad = (4 - (((bitmap_info_header.bitspp / 8) * bitmap_info_header.width) % 4)) % 4;
+	
+	mapped_bmp_row_stride = ((bitmap_info_header.bitspp / 8) * bitmap_info_header.width) + pad;
+	
+	/*
+	 * Make Sure that the File Actually Contains the Whole Bitmap Data that the Headers Describe.
+	 */
+	if((size_t)bmp_file_status.st_size < bitmap_file_header.bmp_offset + (mapped_bmp_row_stride * bitmap_info_header.height))
+	{
+		printf("The Image File is Shorter than its Headers Indicate/Aborting\n");
+		close(bmp_file);
+		
+		return FAILURE;
+	}
+	
+	/*
+	 * Map the Image File with Read Only Access.
+	 * The MAP_POPULATE Flag Reads the File Pages in Advance so that the Threads do not Suffer Page Faults during the First Iteration.
+	 */
+	mapped_bmp_file = (uint8_t *)mmap(0, bmp_file_status.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, bmp_file, 0);
+	
+	/*
+	 * The File Descriptor is not Required after the File is Mapped.
+	 */
+	close(bmp_file);
+	
+	if(mapped_bmp_file == MAP_FAILED)
+	{
+		printf("Image Failed to be Memory Mapped\n");
+		mapped_bmp_file = NULL;
+		
+		return FAILURE;
+	}
+	
+	mapped_bmp_file_size = bmp_file_status.st_size;
+	mapped_bmp_data = mapped_bmp_file + bitmap_file_header.bmp_offset;
+	
+    /*
+     * Get the Total Size Required for the Image Data.
+     * See Details at the Global Variables Section at the Comments for the total_reserved_size Variable.
+     */
+    total_reserved_size =  (bitmap_info_header.width * bitmap_info_header.height) * 4;
+	
+	return SUCCESS;
+}
+
+
+/* OK
+ * unmap_bmp()
+ * 
+ * Used to Release the Memory Mapped Image File that was Mapped by the map_bmp() Function.
+ */
+void unmap_bmp()
+{
+	if(mapped_bmp_file != NULL)
+	{
+		munmap(mapped_bmp_file, mapped_bmp_file_size);
+	}
+	
+	mapped_bmp_file = NULL;
+	mapped_bmp_file_size = 0;
+	mapped_bmp_data = NULL;
+	mapped_bmp_row_stride = 0;
+}
+
+
+/* OK
+ * stage_image()
+ * 
+ * Used by each Thread to Place the Image Data to its Pre Process Kernel Memory (u8_pre_process_kernel_address) According to the load_mode.
+ * In the LOAD_MODE_COPY Mode the Image is Copied from the common_load Memory where it was Loaded by the load_bmp().
+ * In the Rest Modes the Image is Expanded Directly from the Memory Mapped Image File.
+ */
+void stage_image(uint8_t *u8_pre_process_kernel_address)
+{
+	if(load_mode == LOAD_MODE_COPY)
+	{
+		memcpy((void *)u8_pre_process_kernel_address, (void *)common_load, input_row_bytes() * bitmap_info_header.height);
+	}
+	else
+	{
+		expand_bmp_rows(mapped_bmp_data, mapped_bmp_row_stride, u8_pre_process_kernel_address);
+	}
+}
+
+
+/* OK
+ * set_filter()
+ * 
+ * Used to Fill the Filter Configuration (filter) of the Shared Repository with the Coefficients, Shift and Thresholds of a Filter Preset.
+ * The Driver Loads them to the Sobel Filter of each Acceleration Group that Processes the Image of the Thread.
+ * 
+ * The 3x3 Kernels are Placed in the Center of the 5x5 Coefficients (See the FILTER_TAPS) and the Shift Normalizes the Weighted Sum.
+ * The Edge Detection Presets Keep the Thresholds of the Sobel Edge Detection (100 and 200) while the Rest Presets Disable the Thresholding.
+ */
+void set_filter(struct filter_config *filter, int preset)
+{
+	const int8_t gaussian[9] = { 1, 2, 1,
+	                             2, 4, 2,
+	                             1, 2, 1 };
+	
+	const int8_t sharpen[9] = {  0, -1,  0,
+	                            -1,  5, -1,
+	                             0, -1,  0 };
+	
+	const int8_t scharr_x[9] = {  -3, 0,  3,
+	                             -10, 0, 10,
+	                              -3, 0,  3 };
+	
+	const int8_t scharr_y[9] = {  3,  10,  3,
+	                              0,   0,  0,
+	                             -3, -10, -3 };
+	
+	const int8_t prewitt_x[9] = { -1, 0, 1,
+	                              -1, 0, 1,
+	                              -1, 0, 1 };
+	
+	const int8_t prewitt_y[9] = {  1,  1,  1,
+	                               0,  0,  0,
+	                              -1, -1, -1 };
+	
+	/*
+	 * The Box Blur Divides by 9 which is Approximated as 7 / 64.
+	 */
+	const int8_t box[9] = { 7, 7, 7,
+	                        7, 7, 7,
+	                        7, 7, 7 };
+	
+	const int8_t *x_kernel = NULL;
+	const int8_t *y_kernel = NULL;
+	
+	int i;
+	int j;
+	
+	memset(filter, 0, sizeof(struct filter_config));
+	
+	filter->threshold_low = 0;
+	filter->threshold_high = 255;
+	
+	switch(preset)
+	{
+		case FILTER_PRESET_GAUSSIAN: filter->mode = FILTER_MODE_LINEAR; x_kernel = gaussian; filter->shift = 4; break;
+		case FILTER_PRESET_SHARPEN: filter->mode = FILTER_MODE_LINEAR; x_kernel = sharpen; break;
+		case FILTER_PRESET_SCHARR: filter->mode = FILTER_MODE_GRADIENT; x_kernel = scharr_x; y_kernel = scharr_y; filter->shift = 2; break;
+		case FILTER_PRESET_PREWITT: filter->mode = FILTER_MODE_GRADIENT; x_kernel = prewitt_x; y_kernel = prewitt_y; break;
+		case FILTER_PRESET_BOX: filter->mode = FILTER_MODE_LINEAR; x_kernel = box; filter->shift = 6; break;
+		default: filter->mode = FILTER_MODE_SOBEL; return;
+	}
+	
+	if(filter->mode == FILTER_MODE_GRADIENT)
+	{
+		filter->threshold_low = 100;
+		filter->threshold_high = 200;
+	}
+	
+	for(i = 0; i < 3; i++)
+	{
+		for(j = 0; j < 3; j++)
+		{
+			filter->x_coefficients[((i + 1) * FILTER_TAPS) + j + 1] = x_kernel[(i * 3) + j];
+			
+			if(y_kernel != NULL)
+			{
+				filter->y_coefficients[((i + 1) * FILTER_TAPS) + j + 1] = y_kernel[(i * 3) + j];
+			}
+		}
+	}
+}
+
+
+/*
+ * The Part of an Image that each Worker Thread of the cpu_sobel_filter() Processes.
+ *
+ * image --> The Pre Process Kernel Memory where the Image is Staged and where the Processed Image is Written in Place
+ * luma --> The Luminance Values of the Whole Image
+ * edges --> The Edge Row of the Worker
+ * first_row and last_row --> The Rows of the Worker (last_row is not Included)
+ */
+struct cpu_sobel_worker
+{
+	uint8_t *image;
+	uint8_t *luma;
+	uint8_t *edges;
+	int first_row;
+	int last_row;
+};
+
+
+/* OK
+ * cpu_sobel_edges_scalar()
+ *
+ * Scalar Version of the Edge Values of the CPU Engine.
+ * It Applies the sobel_operator() of the Sobel Filter to the Columns from first up to (not Including) last of the Row Given by the middle Pointer.
+ * The Gradients are Summed in 16 Bit Values and only the Lower Byte of their Absolute Sum is Inverted so that the Result is Bit Exact with the Sobel Filter.
+ */
+static void cpu_sobel_edges_scalar(const uint8_t *top, const uint8_t *middle, const uint8_t *bottom, uint8_t *edges, int first, int last)
+{
+	int col;
+
+	for(col = first; col < last; col++)
+	{
+		int16_t x_weight = (top[col + 1] + (2 * middle[col + 1]) + bottom[col + 1]) - (top[col - 1] + (2 * middle[col - 1]) + bottom[col - 1]);
+		int16_t y_weight = (top[col - 1] + (2 * top[col]) + top[col + 1]) - (bottom[col - 1] + (2 * bottom[col]) + bottom[col + 1]);
+
+		int16_t edge_weight = (int16_t)(((x_weight > 0) ? x_weight : -x_weight) + ((y_weight > 0) ? y_weight : -y_weight));
+
+		uint8_t edge_val = (uint8_t)(255 - (uint8_t)edge_weight);
+
+		//Edge Thresholding
+		if(edge_val > 200)
+		{
+			edge_val = 255;
+		}
+		else if(edge_val < 100)
+		{
+			edge_val = 0;
+		}
+
+		edges[col] = edge_val;
+	}
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/* OK
+ * cpu_sobel_edges_ssse3()
+ *
+ * SSSE3 Version of the Edge Values which Produces 8 Edge Values in each Loop.
+ * The Luminance Values are Widened to 16 Bit Lanes so that the Gradients and their Absolute Sum Wrap as in the Sobel Filter.
+ * The Thresholds are Applied with Signed Compares which is Safe since the Inverted Lower Byte is Always in the 0 to 255 Range.
+ */
+__attribute__((target("ssse3")))
+static void cpu_sobel_edges_ssse3(const uint8_t *top, const uint8_t *middle, const uint8_t *bottom, uint8_t *edges, int first, int last)
+{
+	const __m128i low_byte = _mm_set1_epi16(0xFF);
+	const __m128i high_threshold = _mm_set1_epi16(200);
+	const __m128i low_threshold = _mm_set1_epi16(100);
+	const __m128i zero = _mm_setzero_si128();
+
+	int col = first;
+
+	for(; col + 8 <= last; col += 8)
+	{
+		__m128i top_left = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(top + col - 1)), zero);
+		__m128i top_center = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(top + col)), zero);
+		__m128i top_right = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(top + col + 1)), zero);
+		__m128i middle_left = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(middle + col - 1)), zero);
+		__m128i middle_right = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(middle + col + 1)), zero);
+		__m128i bottom_left = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(bottom + col - 1)), zero);
+		__m128i bottom_center = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(bottom + col)), zero);
+		__m128i bottom_right = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(bottom + col + 1)), zero);
+
+		__m128i x_weight = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(top_right, bottom_right), _mm_slli_epi16(middle_right, 1)),
+		                                 _mm_add_epi16(_mm_add_epi16(top_left, bottom_left), _mm_slli_epi16(middle_left, 1)));
+
+		__m128i y_weight = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(top_left, top_right), _mm_slli_epi16(top_center, 1)),
+		                                 _mm_add_epi16(_mm_add_epi16(bottom_left, bottom_right), _mm_slli_epi16(bottom_center, 1)));
+
+		__m128i edge_weight = _mm_add_epi16(_mm_abs_epi16(x_weight), _mm_abs_epi16(y_weight));
+
+		__m128i edge_val = _mm_sub_epi16(low_byte, _mm_and_si128(edge_weight, low_byte));
+
+		//Edge Thresholding
+		edge_val = _mm_or_si128(edge_val, _mm_and_si128(_mm_cmpgt_epi16(edge_val, high_threshold), low_byte));
+		edge_val = _mm_andnot_si128(_mm_cmpgt_epi16(low_threshold, edge_val), edge_val);
+
+		_mm_storel_epi64((__m128i *)(edges + col), _mm_packus_epi16(edge_val, edge_val));
+	}
+
+	cpu_sobel_edges_scalar(top, middle, bottom, edges, col, last);
+}
+
+/* OK
+ * cpu_sobel_edges_avx2()
+ *
+ * AVX2 Version of the Edge Values which Produces 16 Edge Values in each Loop with the Same Steps as the SSSE3 Version.
+ * The Byte Packing of AVX2 Works on each 128 Bit Lane so the 64 Bit Quarters are Reordered to Bring the 16 Edge Values Together.
+ */
+__attribute__((target("avx2")))
+static void cpu_sobel_edges_avx2(const uint8_t *top, const uint8_t *middle, const uint8_t *bottom, uint8_t *edges, int first, int last)
+{
+	const __m256i low_byte = _mm256_set1_epi16(0xFF);
+	const __m256i high_threshold = _mm256_set1_epi16(200);
+	const __m256i low_threshold = _mm256_set1_epi16(100);
+
+	int col = first;
+
+	for(; col + 16 <= last; col += 16)
+	{
+		__m256i top_left = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(top + col - 1)));
+		__m256i top_center = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(top + col)));
+		__m256i top_right = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(top + col + 1)));
+		__m256i middle_left = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(middle + col - 1)));
+		__m256i middle_right = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(middle + col + 1)));
+		__m256i bottom_left = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(bottom + col - 1)));
+		__m256i bottom_center = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(bottom + col)));
+		__m256i bottom_right = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(bottom + col + 1)));
+
+		__m256i x_weight = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(top_right, bottom_right), _mm256_slli_epi16(middle_right, 1)),
+		                                    _mm256_add_epi16(_mm256_add_epi16(top_left, bottom_left), _mm256_slli_epi16(middle_left, 1)));
+
+		__m256i y_weight = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(top_left, top_right), _mm256_slli_epi16(top_center, 1)),
+		                                    _mm256_add_epi16(_mm256_add_epi16(bottom_left, bottom_right), _mm256_slli_epi16(bottom_center, 1)));
+
+		__m256i edge_weight = _mm256_add_epi16(_mm256_abs_epi16(x_weight), _mm256_abs_epi16(y_weight));
+
+		__m256i edge_val = _mm256_sub_epi16(low_byte, _mm256_and_si256(edge_weight, low_byte));
+
+		//Edge Thresholding
+		edge_val = _mm256_or_si256(edge_val, _mm256_and_si256(_mm256_cmpgt_epi16(edge_val, high_threshold), low_byte));
+		edge_val = _mm256_andnot_si256(_mm256_cmpgt_epi16(low_threshold, edge_val), edge_val);
+
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(edge_val, edge_val), 0xD8);
+
+		_mm_storeu_si128((__m128i *)(edges + col), _mm256_castsi256_si128(packed));
+	}
+
+	cpu_sobel_edges_scalar(top, middle, bottom, edges, col, last);
+}
+
+#endif
+
+/* OK
+ * cpu_sobel_edges()
+ *
+ * Used to Produce the Edge Values of a Row of the CPU Engine from the Luminance Values of the Row (middle) and its two Neighbor Rows (top and bottom).
+ * The Fastest Version that the CPU Supports is Selected at Runtime.
+ */
+static void cpu_sobel_edges(const uint8_t *top, const uint8_t *middle, const uint8_t *bottom, uint8_t *edges, int first, int last)
+{
+	#if defined(__x86_64__) || defined(__i386__)
+	if(__builtin_cpu_supports("avx2"))
+	{
+		cpu_sobel_edges_avx2(top, middle, bottom, edges, first, last);
+		return;
+	}
+
+	if(__builtin_cpu_supports("ssse3"))
+	{
+		cpu_sobel_edges_ssse3(top, middle, bottom, edges, first, last);
+		return;
+	}
+	#endif
+
+	cpu_sobel_edges_scalar(top, middle, bottom, edges, first, last);
+}
+
+/* OK
+ * cpu_sobel_luma_worker()
+ *
+ * The First Step of each Worker of the CPU Engine which Converts the Rows of the Worker to Luminance Values as the Sobel Filter Does on Arrival.
+ * The Rows of the INPUT_FORMAT_LUMA are Already Luminance Values so they are only Copied.
+ */
+static void *cpu_sobel_luma_worker(void *arg)
+{
+	struct cpu_sobel_worker *worker = (struct cpu_sobel_worker *)arg;
+
+	size_t row_bytes = input_row_bytes();
+	int cols = bitmap_info_header.width;
+	int i;
+
+	for(i = worker->first_row; i < worker->last_row; i++)
+	{
+		if(input_format == INPUT_FORMAT_LUMA)
+		{
+			memcpy(worker->luma + ((size_t)i * cols), worker->image + (i * row_bytes), cols);
+		}
+		else
+		{
+			convert_to_luma(worker->image + (i * row_bytes), worker->luma + ((size_t)i * cols), cols, (input_format == INPUT_FORMAT_BGR) ? 3 : 4);
+		}
+	}
+
+	return NULL;
+}
+
+/* OK
+ * cpu_sobel_edge_worker()
+ *
+ * The Second Step of each Worker of the CPU Engine which Writes the Processed Rows of the Worker to the Image Memory in the Format that the Sobel Filter Returns them.
+ * It Starts only after all the Workers Completed the First Step since the Processed Rows Replace the Initial Image in the Same Memory.
+ *
+ * The First and Last Row and Column are Dark/Zero Pixels as in the Sobel Filter.
+ * In the Packed Output Mode each Row is Written at a 4 Byte Aligned Offset with one Byte per Pixel
+ * else each Pixel is Written as 4 Bytes where the Edge Value is Repeated in the Blue, Green and Red Bytes.
+ */
+static void *cpu_sobel_edge_worker(void *arg)
+{
+	struct cpu_sobel_worker *worker = (struct cpu_sobel_worker *)arg;
+
+	int rows = bitmap_info_header.height;
+	int cols = bitmap_info_header.width;
+	size_t packed_row_stride = ((size_t)(cols + 3) / 4) * 4;
+
+	uint8_t *edges;
+	uint32_t *pixels;
+	int i;
+	int j;
+
+	for(i = worker->first_row; i < worker->last_row; i++)
+	{
+		edges = (packed_output == 1) ? worker->image + (i * packed_row_stride) : worker->edges;
+
+		if(i == 0 || i == rows - 1)
+		{
+			memset(edges, 0, cols);
+		}
+		else
+		{
+			cpu_sobel_edges(worker->luma + ((size_t)(i - 1) * cols), worker->luma + ((size_t)i * cols), worker->luma + ((size_t)(i + 1) * cols), edges, 1, cols - 1);
+
+			edges[0] = 0;
+			edges[cols - 1] = 0;
+		}
+
+		if(packed_output == 1)
+		{
+			memset(edges + cols, 0, packed_row_stride - cols);
+		}
+		else
+		{
+			pixels = (uint32_t *)(worker->image + ((size_t)i * cols * 4));
+
+			for(j = 0; j < cols; j++)
+			{
+				pixels[j] = edges[j] * 0x010101;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/* OK
+ * cpu_run_workers()
+ *
+ * Used to Run a Step (routine) of the CPU Engine for all the Workers.
+ * The First Worker Runs in the Calling Thread and a New Thread is Created for each of the Rest.
+ * If a Thread Cannot be Created its Worker Runs in the Calling Thread so that the Step is Always Completed.
+ * The Caller Gives at most CPU_MAX_WORKERS Workers.
+ */
+static void cpu_run_workers(void *(*routine)(void *), struct cpu_sobel_worker *worker, int workers)
+{
+	pthread_t thread_id[CPU_MAX_WORKERS];
+	int created[CPU_MAX_WORKERS];
+	int repeat;
+
+	for(repeat = 1; repeat < workers; repeat++)
+	{
+		created[repeat] = (pthread_create(&thread_id[repeat], NULL, routine, &worker[repeat]) == 0) ? 1 : 0;
+	}
+
+	routine(&worker[0]);
+
+	for(repeat = 1; repeat < workers; repeat++)
+	{
+		if(created[repeat] == 1)
+		{
+			pthread_join(thread_id[repeat], NULL);
+		}
+		else
+		{
+			routine(&worker[repeat]);
+		}
+	}
+}
+
+
+/* OK
+ * cpu_sobel_supported()
+ *
+ * Returns 1 if the CPU Engine Can Process the Image in the Configuration Requested by the Application.
+ * The CPU Engine Implements only the Sobel Edge Detection with the Filtered Pixels as Output.
+ */
+int cpu_sobel_supported()
+{
+	if(filter_preset == FILTER_PRESET_SOBEL && output_format == OUTPUT_FORMAT_PIXEL && pipeline_stages == 0)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+/* OK
+ * cpu_sobel_filter()
+ *
+ * The CPU Engine which Processes the Image that is Staged in the Pre Process Kernel Memory (image) instead of the Acceleration Groups.
+ * The Processed Image is Written in Place in the Same Format that a Single Acceleration Group Returns so that it is Saved by the save_bmp() as Usual.
+ * The Result is Bit Exact with the sobel_filter Core (See the sobel_golden.cpp of the Sobel Filter IP).
+ *
+ * The Rows are Divided among cpu_workers Threads and each of them Converts its Rows to Luminance Values and then, once all the Rows are Converted,
+ * Produces its Processed Rows with the SIMD Versions of the cpu_sobel_edges().
+ */
+int cpu_sobel_filter(uint8_t *image)
+{
+	int rows = bitmap_info_header.height;
+	int cols = bitmap_info_header.width;
+	int workers = (cpu_workers < rows) ? cpu_workers : rows;
+
+	struct cpu_sobel_worker worker[CPU_MAX_WORKERS];
+
+	size_t required_buffer_size;
+	int repeat;
+
+	if(workers < 1)
+	{
+		workers = 1;
+	}
+
+	if(workers > CPU_MAX_WORKERS)
+	{
+		workers = CPU_MAX_WORKERS;
+	}
+
+	/*
+	 * Reuse the Thread Local cpu_buffer and Reallocate it only if the Current Image Requires a Larger Memory.
+	 */
+	required_buffer_size = ((size_t)rows * cols) + ((size_t)workers * cols);
+
+	if(cpu_buffer_size < required_buffer_size)
+	{
+		free(cpu_buffer);
+
+		cpu_buffer = (uint8_t *)malloc(required_buffer_size);
+
+		if(cpu_buffer == NULL)
+		{
+			printf("[CPU ENGINE] Failed to Allocate Memory for the Luminance Values\n");
+			cpu_buffer_size = 0;
+
+			return FAILURE;
+		}
+
+		cpu_buffer_size = required_buffer_size;
+	}
+
+	for(repeat = 0; repeat < workers; repeat++)
+	{
+		worker[repeat].image = image;
+		worker[repeat].luma = cpu_buffer;
+		worker[repeat].edges = cpu_buffer + ((size_t)rows * cols) + ((size_t)repeat * cols);
+		worker[repeat].first_row = (int)(((int64_t)rows * repeat) / workers);
+		worker[repeat].last_row = (int)(((int64_t)rows * (repeat + 1)) / workers);
+	}
+
+	cpu_run_workers(cpu_sobel_luma_worker, worker, workers);
+	cpu_run_workers(cpu_sobel_edge_worker, worker, workers);
+
+	return SUCCESS;
+}
+
+
+/* OK
+ * offload_decision()
+ *
+ * Used to Select whether the Current Iteration is Processed by the FPGA (OFFLOAD_ENGINE_FPGA) or by the CPU Engine (OFFLOAD_ENGINE_CPU) According to the offload_mode.
+ * The queue_depth is Set with the Number of Requests that would be Served by the Acceleration Groups before the Current one.
+ *
+ * In the OFFLOAD_MODE_AUTO the Queue Depth is Found from the Busy Flags and the waiting_requests Counter of the FPGA BRAM.
+ * The Latency of the FPGA is Estimated as its Average Latency Increased by the Time that the Acceleration Groups Need to Serve the Queued Requests
+ * while the Latency of the CPU Engine is its Average Latency. Both are Scaled to the pixels of the Image and the Engine with the Lower Estimation is Selected.
+ *
+ * Until both Engines Have a Latency Sample the Images up to OFFLOAD_SMALL_IMAGE_PIXELS and the Images that would be Queued Start on the CPU Engine.
+ * The Engine that was not Selected for OFFLOAD_PROBE_INTERVAL Decisions is Used Once to Refresh its Average Latency unless its Estimation is more than Twice the Selected.
+ */
+int offload_decision(int pixels, int *queue_depth)
+{
+	struct status_flags *flags = &shared_kernel_address->shared_status_flags;
+
+	uint64_t estimate[2];
+	int busy_groups;
+	int engine;
+	int other;
+
+	*queue_depth = 0;
+
+	if(offload_mode == OFFLOAD_MODE_FPGA || cpu_sobel_supported() == 0)
+	{
+		return OFFLOAD_ENGINE_FPGA;
+	}
+
+	if(offload_mode == OFFLOAD_MODE_CPU)
+	{
+		return OFFLOAD_ENGINE_CPU;
+	}
+
+	/*
+	 * Read the Busy Flags of the Acceleration Groups and the Number of Threads that Sleep Waiting for them.
+	 * A Request is Queued only when all the Acceleration Groups are Busy or other Requests are Already Waiting.
+	 */
+	busy_groups = (flags->agd0_busy != 0) + (flags->agd1_busy != 0) + (flags->agi0_busy != 0) + (flags->agi1_busy != 0) +
+	              (flags->agi2_busy != 0) + (flags->agi3_busy != 0) + (flags->agsg_busy != 0);
+
+	if(busy_groups == ACCELERATION_GROUPS || flags->waiting_requests > 0)
+	{
+		*queue_depth = flags->waiting_requests + 1;
+	}
+
+	pthread_mutex_lock(&offload_lock);
+
+	offload_jobs++;
+
+	if(offload_samples[OFFLOAD_ENGINE_FPGA] == 0 && offload_samples[OFFLOAD_ENGINE_CPU] == 0)
+	{
+		engine = (pixels <= OFFLOAD_SMALL_IMAGE_PIXELS || *queue_depth > 0) ? OFFLOAD_ENGINE_CPU : OFFLOAD_ENGINE_FPGA;
+	}
+	else if(offload_samples[OFFLOAD_ENGINE_FPGA] == 0)
+	{
+		engine = OFFLOAD_ENGINE_FPGA;
+	}
+	else if(offload_samples[OFFLOAD_ENGINE_CPU] == 0)
+	{
+		engine = OFFLOAD_ENGINE_CPU;
+	}
+	else
+	{
+		estimate[OFFLOAD_ENGINE_FPGA] = (offload_latency[OFFLOAD_ENGINE_FPGA] * pixels) / 1024;
+		estimate[OFFLOAD_ENGINE_FPGA] += (estimate[OFFLOAD_ENGINE_FPGA] * *queue_depth) / ACCELERATION_GROUPS;
+
+		estimate[OFFLOAD_ENGINE_CPU] = (offload_latency[OFFLOAD_ENGINE_CPU] * pixels) / 1024;
+
+		engine = (estimate[OFFLOAD_ENGINE_CPU] < estimate[OFFLOAD_ENGINE_FPGA]) ? OFFLOAD_ENGINE_CPU : OFFLOAD_ENGINE_FPGA;
+		other = (engine == OFFLOAD_ENGINE_CPU) ? OFFLOAD_ENGINE_FPGA : OFFLOAD_ENGINE_CPU;
+
+		if(offload_jobs - offload_last_job[other] >= OFFLOAD_PROBE_INTERVAL && estimate[other] <= 2 * estimate[engine])
+		{
+			engine = other;
+		}
+	}
+
+	offload_last_job[engine] = offload_jobs;
+
+	pthread_mutex_unlock(&offload_lock);
+
+	return engine;
+}
+
+/* OK
+ * offload_record()
+ *
+ * Used to Add the Latency (latency_ns) that an Engine Needed to Process an Image of pixels Pixels to the Average Latency of the Engine.
+ * The Latency of the FPGA Includes the Time that the Request Waited for Acceleration Groups so the Samples of Queued Requests (queue_depth)
+ * are Kept only while there is no other Sample since the offload_decision() Adds the Queueing Time Separately.
+ */
+void offload_record(int engine, int pixels, uint64_t latency_ns, int queue_depth)
+{
+	uint64_t sample = (latency_ns * 1024) / ((pixels > 0) ? pixels : 1);
+
+	pthread_mutex_lock(&offload_lock);
+
+	if(offload_samples[engine] == 0)
+	{
+		offload_latency[engine] = sample;
+		offload_samples[engine] = 1;
+	}
+	else if(engine == OFFLOAD_ENGINE_CPU || queue_depth == 0)
+	{
+		offload_latency[engine] = offload_latency[engine] - (offload_latency[engine] >> OFFLOAD_EWMA_SHIFT) + (sample >> OFFLOAD_EWMA_SHIFT);
+		offload_samples[engine]++;
+	}
+
+	pthread_mutex_unlock(&offload_lock);
+}
+
+/* OK
+ * monotonic_time_ns()
+ *
+ * Returns the Time of the Monotonic Clock of the Host in Nanoseconds which is Used to Measure the Latencies of the Engines.
+ */
+uint64_t monotonic_time_ns()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+
+/* OK
+ * wait_for_acceleration()
+ * 
+ * Used to Wait until all the Acceleration Groups that were Occupied for the Current Thread Have Completed.
+ * This is the Case when the accel_completed Flag (Set by the Driver's Interrupt Handlers) Becomes Equal to the accel_occupied Flag.
+ * 
+ * The Thread Initially Spins for completion_spin_iterations Times Reading the Flags with a CPU Pause Hint between the Reads.
+ * If the Acceleration Has not Completed yet the Thread Sleeps in poll() on the Driver File (device_file) and is Woken Up by the Driver
+ * each Time an Acceleration Group Completes.
+ * 
+ * Returns FAILURE if poll() Fails for any Reason other than a Signal (EINTR) so that the Caller Can Fall Back to the CPU Engine, else SUCCESS.
+ */
+int wait_for_acceleration(int device_file, struct shared_repository_process *shared_repo_kernel_address)
+{
 	/*
-	 * Move the File Pointer at the Beginning of the Bitmap File
+	 * The Flags are Changed by the Driver so they Must be Read from the Memory in each Check.
 	 */
-	fseek(bmp_file, bitmap_file_header.bmp_offset, SEEK_SET);
+	volatile int *accel_completed = &shared_repo_kernel_address->accel_completed;
+	volatile int *accel_occupied = &shared_repo_kernel_address->accel_occupied;
+	
+	struct pollfd device_poll;
+	
+	int spin;
+	
+	for(spin = 0; (completion_spin_iterations < 0) || (spin < completion_spin_iterations); spin++)
+	{
+		if(*accel_completed == *accel_occupied)
+		{
+			return SUCCESS;
+		}
+		
+		#if defined(__x86_64__) || defined(__i386__)
+		_mm_pause();
+		#endif
+	}
+	
+	device_poll.fd = device_file;
+	device_poll.events = POLLIN;
+	
+	/*
+	 * The Driver Reports the Driver File as Readable when the accel_completed Flag is Equal to the accel_occupied Flag.
+	 * The Flags are Checked Again after each Return of poll() Since poll() May, also, Return due to a Signal.
+	 */
+	while(*accel_completed != *accel_occupied)
+	{
+		if(poll(&device_poll, 1, -1) < 0 && errno != EINTR)
+		{
+			#ifdef DEBUG_MESSAGES_UI
+			printf("Waiting for the Acceleration with poll() Failed\n");
+			#endif
+			
+			return FAILURE;
+		}
+	}
+	
+	return SUCCESS;
+}
 
-	#ifdef DEBUG_MESSAGES_UI
-	printf("Moved File Pointer at the Beginning of Bitmap Data\n");  	  
-	#endif
-    
-    
-    /*
-     * Get the Total Size Required for the Image Data.
-     * See Details at the Global Variables Section at the Comments for the total_reserved_size Variable.s
-     */
-    total_reserved_size =  (bitmap_info_header.width * bitmap_info_header.height) * 4;
-   
-    #ifdef DEBUG_MESSAGES_UI
-    printf("The Total Reserved Size Should Be: %d\n", total_reserved_size); 
-    #endif
 
+/* OK
+ * ring_wait_for_completion()
+ * 
+ * Used by the ring_acceleration() and the tiled_acceleration() when there are no Posted Completions in the Completion Ring.
+ * The Thread Sleeps in poll() until the Driver Posts a Completion.
+ * The Driver May not Dispatch the Queued Jobs if the Acceleration Groups were Released while Another Thread was Inside an IOCtl Call
+ * so on Timeout the Thread Requests the Dispatch Again.
+ * 
+ * Returns FAILURE if poll() Fails or no Completion was Posted for RING_COMPLETION_TIMEOUT_MS since the last_completion_ns (e.g. due to a Hung Acceleration Group)
+ * so that the Caller Stops Waiting for the Ring Jobs, else SUCCESS.
+ */
+int ring_wait_for_completion(int device_file, struct pollfd *device_poll, uint64_t last_completion_ns)
+{
+	int ready;
+	
+	if(monotonic_time_ns() - last_completion_ns > (uint64_t)RING_COMPLETION_TIMEOUT_MS * 1000000ULL)
+	{
+		return FAILURE;
+	}
+	
+	ready = poll(device_poll, 1, RING_POLL_TIMEOUT_MS);
+	
+	if(ready == 0)
+	{
+		ioctl(device_file, COMMAND_RING_SUBMIT, (unsigned long)0);
+	}
+	else if(ready < 0 && errno != EINTR)
+	{
+		return FAILURE;
+	}
+	
+	return SUCCESS;
+}
+
+/* OK
+ * ring_acceleration()
+ * 
+ * Used Instead of the Acceleration Loop of the acceleration_thread() when the ring_depth is Set.
+ * 
+ * The Pre Process Kernel Memory is Divided in Frames of total_reserved_size Bytes.
+ * Each Iteration Stages the Image in a Free Frame and Queues a Job for that Frame in the Submission Ring of the Metrics Kernel Memory.
+ * The Driver Dispatches the Queued Jobs to the AGD0, AGD1, AGI0, AGI1, AGI2 and AGI3 as they Become Available and Posts their Completions in the Completion Ring.
+ * The Thread Reaps all the Posted Completions at Once, Saves the Processed Images (According to the save_request) and Reuses their Frames for the Next Iterations.
+ * 
+ * The job_id of each Job is (Iteration * RING_ENTRIES + Frame) so that the Frame and the Iteration are Known when Reaping its Completion.
+ */
+int ring_acceleration(int device_file, struct shared_repository_process *shared_repo_kernel_address, uint8_t *u8_pre_process_kernel_address, pid_t tid)
+{
+	struct submission_ring *ring = &shared_repo_kernel_address->ring;
+	struct ring_submission *submission;
+	struct ring_completion *completion;
+	
+	struct pollfd device_poll;
+	
+	char save_path_name[100];
+	
 	/*
-	 * Calculate the Possible Padding that Might be Found at the end of an Image Row.
+	 * Stack with the Frames of the Pre Process Kernel Memory that are not Used by a Queued Job.
 	 */
-	pad = (4 - (((bitmap_info_header.bitspp / 8)*bitmap_info_header.width) % 4)) % 4;     
-    
-    #ifdef DEBUG_MESSAGES_UI
-    printf("The Padding is: %d\n", pad);	
-    #endif
+	int free_frames[RING_ENTRIES];
+	int free_frames_count = 0;
+	
+	int frames;
+	int frame;
+	int iteration;
+	int submitted = 0;
+	int reaped = 0;
+	int queued;
+	int status = SUCCESS;
+	
+	uint32_t submission_tail;
+	uint32_t completion_head;
+	uint32_t completion_tail;
+	
+	/*
+	 * The Time when the Last Completion was Reaped (or the Ring was Set up) which Bounds the Wait for the Next Completion.
+	 */
+	uint64_t last_completion_ns;
+	
+	frames = MMAP_ALLOCATION_SIZE / total_reserved_size;
+	
+	if(frames > ring_depth)
+	{
+		frames = ring_depth;
+	}
+	
+	if(frames > RING_ENTRIES)
+	{
+		frames = RING_ENTRIES;
+	}
+	
+	if(frames == 0)
+	{
+		printf("The Image Does not Fit in the Pre Process Kernel Memory [PID: %d]\n", tid);
+		return FAILURE;
+	}
+	
+	for(frame = frames - 1; frame >= 0; frame--)
+	{
+		free_frames[free_frames_count++] = frame;
+	}
+	
+	/*
+	 * IOCtl Request to Clear and Enable the Submission Ring of the Current Thread.
+	 */
+	ioctl(device_file, COMMAND_RING_SETUP, (unsigned long)0);
+	
+	device_poll.fd = device_file;
+	device_poll.events = POLLIN;
+	
+	last_completion_ns = monotonic_time_ns();
+	
+	while(reaped < global_iterations)
+	{
+		queued = 0;
+		
+		/*
+		 * Queue a Job for each Free Frame.
+		 * The Submission Entry is Written before the submission_tail is Advanced so that the Driver never Reads an Incomplete Entry.
+		 */
+		while((submitted < global_iterations) && (free_frames_count > 0))
+		{
+			frame = free_frames[--free_frames_count];
+			
+			stage_image(u8_pre_process_kernel_address + (size_t)frame * total_reserved_size);
+			
+			submission_tail = ring->submission_tail;
+			
+			submission = &ring->submissions[submission_tail & RING_ENTRIES_MASK];
+			
+			submission->job_id = (uint32_t)(submitted * RING_ENTRIES + frame);
+			submission->rows = bitmap_info_header.height;
+			submission->columns = bitmap_info_header.width;
+			submission->buffer_offset = (uint32_t)(frame * total_reserved_size);
+			
+			__atomic_store_n(&ring->submission_tail, submission_tail + 1, __ATOMIC_RELEASE);
+			
+			submitted++;
+			queued++;
+		}
+		
+		/*
+		 * IOCtl Request to Dispatch the new Jobs.
+		 * The Call Returns without Waiting for the Jobs to Complete.
+		 */
+		if(queued > 0)
+		{
+			ioctl(device_file, COMMAND_RING_SUBMIT, (unsigned long)0);
+		}
+		
+		completion_head = ring->completion_head;
+		completion_tail = __atomic_load_n(&ring->completion_tail, __ATOMIC_ACQUIRE);
+		
+		/*
+		 * If there are no Completions Wait until the Driver Posts One.
+		 */
+		if(completion_head == completion_tail)
+		{
+			if(ring_wait_for_completion(device_file, &device_poll, last_completion_ns) != SUCCESS)
+			{
+				printf("No Ring Job Completed in %d ms / %d of %d Jobs Reaped [PID: %d]\n", RING_COMPLETION_TIMEOUT_MS, reaped, global_iterations, tid);
+				
+				return FAILURE;
+			}
+			
+			continue;
+		}
+		
+		/*
+		 * Reap all the Posted Completions.
+		 */
+		while(completion_head != completion_tail)
+		{
+			completion = &ring->completions[completion_head & RING_ENTRIES_MASK];
+			
+			frame = completion->job_id % RING_ENTRIES;
+			iteration = completion->job_id / RING_ENTRIES;
+			
+			if(completion->status != RING_STATUS_SUCCESS)
+			{
+				printf("Ring Job %d Failed with Status %d [PID: %d]\n", iteration, completion->status, tid);
+				status = FAILURE;
+			}
+			else if((save_request == 1) || ((save_request == 2) && (iteration == (global_iterations - 1))))
+			{
+				/*
+				 * Call the set_save_accelerator() Function to Create the Path and Name for the Image File
+				 * and Save the Processed Image from the Frame of the Job.
+				 */
+				set_save_accelerator(save_path_name, completion->accel_group, tid, iteration);
+				
+				if(save_bmp(u8_pre_process_kernel_address + (size_t)frame * total_reserved_size, save_path_name, NULL, 0) != SUCCESS)
+				{
+					status = FAILURE;
+				}
+			}
+			
+			free_frames[free_frames_count++] = frame;
+			
+			completion_head++;
+			reaped++;
+		}
+		
+		__atomic_store_n(&ring->completion_head, completion_head, __ATOMIC_RELEASE);
+		
+		last_completion_ns = monotonic_time_ns();
+		
+		printf("Completed Jobs: %d [PID: %d]\n", reaped, tid);
+	}
+	
+	return status;
+}
 
+/* OK
+ * tiled_acceleration()
+ * 
+ * Used Instead of the Acceleration Loop of the acceleration_thread() when the Image does not Fit in the Pre Process Kernel Memory (e.g. 3840x2160 Images).
+ * 
+ * The AGD0, AGD1, AGI0, AGI1, AGI2 and AGI3 Reach the Pre Process Kernel Memory through AXI BAR Windows of MMAP_ALLOCATION_SIZE Bytes
+ * so the Image is Split in Row Bands that are Processed as Separate Jobs of the Submission Ring.
+ * The Pre Process Kernel Memory is Divided in TILE_SLOTS Slots and each Slot Holds the Staged Rows of a Single Row Band.
+ * 
+ * Each Row Band is Staged Together with TILE_HALO_ROWS Rows Above and Below it (Unless it is at the Top or Bottom of the Image).
+ * The Sobel Core Zeroes the First and the Last Row of each Job which are Exactly the Halo Rows so the Interior Rows of all the Row Bands
+ * are the Same as if the Whole Image was Processed at Once.
+ * 
+ * The Image is Staged Once in a Full Frame Memory and the Interior Rows of each Completed Row Band are Gathered in an Output Frame Memory
+ * in the Layout that the save_bmp() Expects for a Single Segment.
+ * 
+ * The job_id of each Job is (Row Band * RING_ENTRIES + Slot) so that the Row Band and the Slot are Known when Reaping its Completion.
+ */
+int tiled_acceleration(int device_file, struct shared_repository_process *shared_repo_kernel_address, uint8_t *u8_pre_process_kernel_address, pid_t tid)
+{
+	struct submission_ring *ring = &shared_repo_kernel_address->ring;
+	struct ring_submission *submission;
+	struct ring_completion *completion;
+	
+	struct pollfd device_poll;
+	
+	char save_path_name[100];
+	
 	/*
-	 * Loop for the Number of Image Rows
+	 * Stack with the Slots of the Pre Process Kernel Memory that are not Used by a Queued Job.
 	 */
-    for(i=0; i<bitmap_info_header.height; i++)
-    {
+	int free_slots[TILE_SLOTS];
+	int free_slots_count;
+	
+	uint8_t *input_frame = NULL;
+	uint8_t *output_frame = NULL;
+	
+	size_t in_row_bytes = input_row_bytes();
+	size_t out_row_bytes = output_row_bytes();
+	size_t slot_bytes;
+	
+	int rows = bitmap_info_header.height;
+	int slots = TILE_SLOTS;
+	int slot_rows;
+	int band_rows;
+	int bands;
+	int band;
+	int slot;
+	int first_row;
+	int last_row;
+	int staged_first_row;
+	int staged_last_row;
+	int iteration;
+	int submitted;
+	int reaped;
+	int queued;
+	int used_accelerator;
+	int status = SUCCESS;
+	
+	uint32_t submission_tail;
+	uint32_t completion_head;
+	uint32_t completion_tail;
+	
+	/*
+	 * The Time when the Last Completion was Reaped (or the Ring was Set up) which Bounds the Wait for the Next Completion.
+	 */
+	uint64_t last_completion_ns;
+	
+	/*
+	 * The Driver Checks the Size of each Job as if it Had 4 Bytes per Pixel so the Rows of a Slot are Calculated the Same Way.
+	 * Fewer Slots are Used if a Slot Cannot Hold at least Two Interior Rows with their Halo Rows
+	 * so that every Row Band (Except the Last which is Extended Upwards) Gives the Sobel Core at least 3 Rows.
+	 */
+	do
+	{
+		slot_bytes = MMAP_ALLOCATION_SIZE / slots;
+		slot_rows = slot_bytes / ((size_t)bitmap_info_header.width * 4);
+		
+		if(slot_rows > (2 * TILE_HALO_ROWS) + 1)
+		{
+			break;
+		}
+		
+		slots = slots / 2;
+	}
+	while(slots > 0);
+	
+	if(slots == 0)
+	{
+		printf("The Image Rows do not Fit in the Pre Process Kernel Memory [PID: %d]\n", tid);
+		return FAILURE;
+	}
+	
+	band_rows = slot_rows - (2 * TILE_HALO_ROWS);
+	bands = (rows + band_rows - 1) / band_rows;
+	
+	input_frame = (uint8_t *)malloc(in_row_bytes * rows);
+	output_frame = (uint8_t *)malloc(out_row_bytes * rows);
+	
+	if(input_frame == NULL || output_frame == NULL)
+	{
+		printf("Could not Allocate the Tiled Image Frames [PID: %d]\n", tid);
+		
+		free(input_frame);
+		free(output_frame);
+		
+		return FAILURE;
+	}
+	
+	#ifdef DEBUG_MESSAGES_UI
+	printf("Tiled Acceleration in %d Row Bands of %d Rows with %d Slots [PID: %d]\n", bands, band_rows, slots, tid);
+	#endif
+	
+	/*
+	 * IOCtl Request to Clear and Enable the Submission Ring of the Current Thread.
+	 */
+	ioctl(device_file, COMMAND_RING_SETUP, (unsigned long)0);
+	
+	device_poll.fd = device_file;
+	device_poll.events = POLLIN;
+	
+	last_completion_ns = monotonic_time_ns();
+	
+	for(iteration = 0; iteration < global_iterations; iteration++)
+	{
 		/*
-		 * Loop for the Number of Image Columns (The Pixels of each Row)
+		 * Stage the Whole Image According to the load_mode.
+		 * In the LOAD_MODE_PRE_STAGED Mode the Full Frame Memory Keeps the Unchanged Image so it is Staged only Once.
 		 */
-		for(j=0; j<(bitmap_info_header.width); j++)
-		{	
+		if((load_mode != LOAD_MODE_PRE_STAGED) || (iteration == 0))
+		{
+			stage_image(input_frame);
+		}
+		
+		free_slots_count = 0;
+		
+		for(slot = slots - 1; slot >= 0; slot--)
+		{
+			free_slots[free_slots_count++] = slot;
+		}
+		
+		submitted = 0;
+		reaped = 0;
+		used_accelerator = 0;
+		
+		while(reaped < bands)
+		{
+			queued = 0;
+			
+			/*
+			 * Queue the Next Row Band in each Free Slot.
+			 * The Submission Entry is Written before the submission_tail is Advanced so that the Driver never Reads an Incomplete Entry.
+			 */
+			while((submitted < bands) && (free_slots_count > 0))
+			{
+				slot = free_slots[--free_slots_count];
+				
+				first_row = submitted * band_rows;
+				last_row = first_row + band_rows;
+				
+				if(last_row > rows)
+				{
+					last_row = rows;
+				}
+				
+				staged_first_row = (first_row > TILE_HALO_ROWS) ? first_row - TILE_HALO_ROWS : 0;
+				staged_last_row = (last_row + TILE_HALO_ROWS < rows) ? last_row + TILE_HALO_ROWS : rows;
+				
+				/*
+				 * The Sobel Core Needs at least (2 * TILE_HALO_ROWS + 1) Rows per Job so a Short Last Row Band is Staged with more Rows Above it.
+				 */
+				if(staged_last_row - staged_first_row < (2 * TILE_HALO_ROWS) + 1)
+				{
+					staged_first_row = staged_last_row - ((2 * TILE_HALO_ROWS) + 1);
+				}
+				
+				memcpy((void *)(u8_pre_process_kernel_address + (size_t)slot * slot_bytes), (void *)(input_frame + (size_t)staged_first_row * in_row_bytes), (size_t)(staged_last_row - staged_first_row) * in_row_bytes);
+				
+				submission_tail = ring->submission_tail;
+				
+				submission = &ring->submissions[submission_tail & RING_ENTRIES_MASK];
+				
+				submission->job_id = (uint32_t)(submitted * RING_ENTRIES + slot);
+				submission->rows = staged_last_row - staged_first_row;
+				submission->columns = bitmap_info_header.width;
+				submission->buffer_offset = (uint32_t)((size_t)slot * slot_bytes);
+				
+				__atomic_store_n(&ring->submission_tail, submission_tail + 1, __ATOMIC_RELEASE);
+				
+				submitted++;
+				queued++;
+			}
+			
 			/*
-			 * Read and Store the First Byte of the Current Pixel
+			 * IOCtl Request to Dispatch the new Jobs.
 			 */
-			fread(&current_byte, sizeof(uint8_t), 1, bmp_file);
-			u8_pre_process_kernel_address[count++] = current_byte;
+			if(queued > 0)
+			{
+				ioctl(device_file, COMMAND_RING_SUBMIT, (unsigned long)0);
+			}
+			
+			completion_head = ring->completion_head;
+			completion_tail = __atomic_load_n(&ring->completion_tail, __ATOMIC_ACQUIRE);
 			
 			/*
-			 * Read and Store the Second Byte of the Current Pixel
-			 */			
-			fread(&current_byte, sizeof(uint8_t), 1, bmp_file);
-			u8_pre_process_kernel_address[count++] = current_byte;
-		
+			 * If there are no Completions Wait until the Driver Posts One.
+			 * If the Wait Fails the Row Bands that were not Reaped are Abandoned and so is the Rest of the Iterations.
+			 */
+			if(completion_head == completion_tail)
+			{
+				if(ring_wait_for_completion(device_file, &device_poll, last_completion_ns) != SUCCESS)
+				{
+					printf("No Row Band Completed in %d ms / %d of %d Row Bands Reaped [PID: %d]\n", RING_COMPLETION_TIMEOUT_MS, reaped, bands, tid);
+					
+					status = FAILURE;
+					
+					break;
+				}
+				
+				continue;
+			}
+			
 			/*
-			 * Read and Store the Third Byte of the Current Pixel
-			 */			
-			fread(&current_byte, sizeof(uint8_t), 1, bmp_file);
-			u8_pre_process_kernel_address[count++] = current_byte;
+			 * Reap all the Posted Completions and Gather the Interior Rows of their Row Bands in the Output Frame Memory.
+			 */
+			while(completion_head != completion_tail)
+			{
+				completion = &ring->completions[completion_head & RING_ENTRIES_MASK];
+				
+				slot = completion->job_id % RING_ENTRIES;
+				band = completion->job_id / RING_ENTRIES;
+				
+				if(completion->status != RING_STATUS_SUCCESS)
+				{
+					printf("Row Band %d of Iteration %d Failed with Status %d [PID: %d]\n", band, iteration, completion->status, tid);
+					status = FAILURE;
+				}
+				else
+				{
+					first_row = band * band_rows;
+					last_row = first_row + band_rows;
+					
+					if(last_row > rows)
+					{
+						last_row = rows;
+					}
+					
+					staged_first_row = (first_row > TILE_HALO_ROWS) ? first_row - TILE_HALO_ROWS : 0;
+					
+					if(rows - staged_first_row < (2 * TILE_HALO_ROWS) + 1)
+					{
+						staged_first_row = rows - ((2 * TILE_HALO_ROWS) + 1);
+					}
+					
+					memcpy((void *)(output_frame + (size_t)first_row * out_row_bytes), (void *)(u8_pre_process_kernel_address + (size_t)slot * slot_bytes + (size_t)(first_row - staged_first_row) * out_row_bytes), (size_t)(last_row - first_row) * out_row_bytes);
+					
+					used_accelerator = used_accelerator | completion->accel_group;
+				}
+				
+				free_slots[free_slots_count++] = slot;
+				
+				completion_head++;
+				reaped++;
+			}
+			
+			__atomic_store_n(&ring->completion_head, completion_head, __ATOMIC_RELEASE);
 			
+			last_completion_ns = monotonic_time_ns();
+		}
+		
+		if(reaped < bands)
+		{
+			break;
+		}
+		
+		if((save_request == 1) || ((save_request == 2) && (iteration == (global_iterations - 1))))
+		{
 			/*
-			 * Store a Padding Byte in Order to Have 4 Bytes Alignment per Pixel.
-			 */				
-			u8_pre_process_kernel_address[count++] = 0x0;
+			 * The Name of the Saved Image Carries all the Acceleration Groups that Processed any of its Row Bands.
+			 */
+			set_save_accelerator(save_path_name, used_accelerator, tid, iteration);
+			
+			if(save_bmp(output_frame, save_path_name, NULL, 0) != SUCCESS)
+			{
+				status = FAILURE;
+			}
 		}
 		
-		/*
-		 * Move the Position Indicator of the File According to the pad Variable so that we Get to the Beginning of the Next Image Row.
-		 * The fseek() Herein is Required because there might be a Chance that in each Row there is a Number of Padding Bytes after the End of the Valid Image Data of each Row.
-		 * As a Result Using fseek() is the Way to Move to the Valid Image Data of the Next Row.
-		 */
-		fseek(bmp_file, pad, SEEK_CUR);
+		printf("Completed Tiled Images: %d [PID: %d]\n", iteration + 1, tid);
 	}
 	
-	#ifdef DEBUG_MESSAGES_UI
-    printf("The Image Data is Loaded\n");	
-	#endif
-	
-    /*
-     * Close the Bitmap File.
-     */
-    fclose(bmp_file);
+	free(input_frame);
+	free(output_frame);
 	
-	return SUCCESS;
+	return status;
 }
 
-
 /* OK
  * save_bmp()
  * 
  * Used to Save the Processed Image from a Memory Given by the u8_post_process_kernel_address Pointer
  * to the Storage Device at the Directory and Filename Given by the save_path_name Pointer.
  * According to the Current Implementation the u8_post_process_kernel_address Points Directly to an Allocated Memory in Kernel Space
+ * 
+ * In Packed Output Mode each Segment of the Image Keeps its Processed Rows at the Beginning of its own Part of the Memory
+ * which Starts where the Initial Rows of the Segment were Staged (See the input_row_bytes()).
+ * The segment_rows Array Gives the Rows of each of the segments in the Order they are Located in the Memory.
+ * If segments is 0 the Whole Image is Considered a Single Segment.
  */
-int save_bmp(uint8_t *u8_post_process_kernel_address, char *save_path_name) 
+int save_bmp(uint8_t *u8_post_process_kernel_address, char *save_path_name, const int *segment_rows, int segments) 
 {
+	ssize_t written_bytes;
 	size_t total_written_bytes;
 	
-	FILE *bmp_file;
+	int bmp_file;
 	
 	bmpfile_magic_t save_magic_number;
 	bmpfile_header_t save_bitmap_file_header;
 
-	size_t i;
-	size_t j;
-	size_t k;
+	int i;
+	int segment;
+	int segment_start_row;
+	int segment_end_row;
 	size_t pad;	
+	size_t row_stride;
+	size_t packed_row_stride;
+	uint8_t *segment_base;
+	size_t headers_size;
+	size_t total_file_size;
+	size_t required_buffer_size;
 	
-	uint8_t current_byte;
+	uint8_t *bitmap_data;
 	
 	#ifdef DEBUG_MESSAGES_UI
 	printf("Saving the Image File\n");
 	#endif
-    
-    /*
-     * Open the Image File According to the File Name Given by the the User
-     */
-    bmp_file = fopen(save_path_name, "wb");
-
-    if(bmp_file != NULL)
-    {
-		#ifdef DEBUG_MESSAGES_UI
-    	printf("New Image File Opened\n");
-    	#endif
-    }
-    else
-    {
-        if(bmp_file == NULL)
-        {
-        	printf("New Image File Failed to Open [NULL Pointer]\n");
-        }
 	
-   	usleep(2000000);
-
-   	return(FAILURE);
-    }
+	/*
+	 * Calculate the Offset where the Clear Image Data (After the File Header) Starts.
+	 */
+	const uint32_t offset = sizeof(bmpfile_magic_t) + sizeof(bmpfile_header_t) + bitmap_info_header.header_sz;	
 	
-
-	#ifdef DEBUG_MESSAGES_UI
-	printf("[SAVE PROCESS] Writing the Magic Number at the New Image File\n");
-	#endif
-
 	/*
-	 * Set the Magic Number Structure with the .bmp Image Magic Number.
+	 * Calculate the Possible Padding that Might be Found at the end of an Image Row.
+	 */	
+	pad = (4 - (((bitmap_info_header.bitspp / 8) * bitmap_info_header.width) % 4)) % 4;
+	
+	/*
+	 * Get the Size of each Image Row as Stored in the File (3 Bytes per Pixel Plus the Padding Bytes) and the Size of the Whole File.
 	 */
-	save_magic_number.magic[0] = 0x42;
-	save_magic_number.magic[1] = 0x4d;
-
+	row_stride = ((bitmap_info_header.bitspp / 8) * bitmap_info_header.width) + pad;
+	
+	total_file_size = offset + (row_stride * bitmap_info_header.height);
+	
 	/*
-	 * Write the Magic Number Inside the File
-	 */		
-	if (fwrite(&save_magic_number, sizeof(bmpfile_magic_t), 1, bmp_file) != 1)
-	{
-		printf("[SAVE PROCESS] Failed to Write the Magic Number\n");
-		fclose(bmp_file);
-		return FAILURE;
-	}
-	else
+	 * The Extra 32 Bytes Cover the Slack that the SIMD Versions of the pack_bgrx_to_bgr() Require after the Last Pixel.
+	 */
+	required_buffer_size = total_file_size + 32;
+	
+	/*
+	 * Reuse the Thread Local save_buffer and Reallocate it only if the Current Image Requires a Larger Memory.
+	 */
+	if(save_buffer_size < required_buffer_size)
 	{
-		#ifdef DEBUG_MESSAGES_UI
-		printf("[SAVE PROCESS] The Magic Number is Written\n");		
-		#endif
+		free(save_buffer);
+		
+		save_buffer = (uint8_t *)malloc(required_buffer_size);
+		
+		if(save_buffer == NULL)
+		{
+			printf("[SAVE PROCESS] Failed to Allocate Memory for the New Image File\n");
+			save_buffer_size = 0;
+			
+			return FAILURE;
+		}
+		
+		save_buffer_size = required_buffer_size;
 	}
-	
+
 	/*
-	 * Calculate the Offset where the Clear Image Data (After the File Header) Starts.
+	 * Set the Magic Number Structure with the .bmp Image Magic Number.
 	 */
-	const uint32_t offset = sizeof(bmpfile_magic_t) + sizeof(bmpfile_header_t) + bitmap_info_header.header_sz;	
+	save_magic_number.magic[0] = 0x42;
+	save_magic_number.magic[1] = 0x4d;
 	
 	/*
 	 * Set the File Header with the File Size, Creator 1, Creator 2 and the Offset of the Bitmap Data.
 	 */
-	save_bitmap_file_header.filesz = offset + bitmap_info_header.bmp_bytesz;
+	save_bitmap_file_header.filesz = total_file_size;
 	save_bitmap_file_header.creator1 = 0;
 	save_bitmap_file_header.creator2 = 0;
 	save_bitmap_file_header.bmp_offset = offset;
 	
 	#ifdef DEBUG_MESSAGES_UI
-	printf("[SAVE PROCESS] Writing the File Header of the Image File\n");
+	printf("[SAVE PROCESS] Writing the Magic Number, the File Header and the Info Header of the Image File\n");
 	#endif
-
-	/*
-	 * Write the File Header inside the File.
-	 */
-	if (fwrite(&save_bitmap_file_header, sizeof(bmpfile_header_t), 1, bmp_file) != 1) 
-	{
-		printf("[SAVE PROCESS] Failed to Write the File Header\n");		
-		fclose(bmp_file);
-		return FAILURE;
-	}
-	else
-	{
-		#ifdef DEBUG_MESSAGES_UI
-		printf("[SAVE PROCESS] The File Header is Written\n");		
-		#endif
-	}	
 	
-	#ifdef DEBUG_MESSAGES_UI
-	printf("[SAVE PROCESS] Writing the Info Header of the Image File\n");
-	#endif
-
 	/*
-	 * Write the Info Header inside the File.
+	 * Place the Magic Number, the File Header and the Info Header at the Beginning of the save_buffer.
+	 * If the Info Header of the Loaded Image was Larger than the bitmap_info_header_t Structure then the Remaining Bytes up to the Offset are Cleared.
 	 */
-	if (fwrite(&bitmap_info_header, sizeof(bitmap_info_header_t), 1, bmp_file) != 1) 
-	{
-		printf("[SAVE PROCESS] Failed to Write the Info Header\n");		
-		fclose(bmp_file);
-		return FAILURE;
-	}
-	else
-	{
-		#ifdef DEBUG_MESSAGES_UI
-		printf("[SAVE PROCESS] The Info Header is Written\n");		
-		#endif
-	}		
-		
+	headers_size = 0;
 	
-	#ifdef DEBUG_MESSAGES_UI
-	printf("[SAVE PROCESS] Moving the File Pointer at the Beginning of the Bitmap Data\n");	
-	#endif
+	memcpy(save_buffer + headers_size, &save_magic_number, sizeof(bmpfile_magic_t));
+	headers_size += sizeof(bmpfile_magic_t);
 	
-	/*
-	 * Move the File Pointer at the Beginning of the Bitmap Data;
-	 */	 
-	if (fseek(bmp_file, offset, SEEK_SET))
+	memcpy(save_buffer + headers_size, &save_bitmap_file_header, sizeof(bmpfile_header_t));
+	headers_size += sizeof(bmpfile_header_t);
+	
+	memcpy(save_buffer + headers_size, &bitmap_info_header, sizeof(bitmap_info_header_t));
+	headers_size += sizeof(bitmap_info_header_t);
+	
+	if(headers_size < offset)
 	{
-		printf("[SAVE PROCESS] Failed to Move the File Pointer at the Beginning of the Bitmap Data\n");
-		fclose(bmp_file);
-		return FAILURE;
+		memset(save_buffer + headers_size, 0, offset - headers_size);
 	}
-	
-	/*
-	 * Calculate the Possible Padding that Might be Found at the end of an Image Row.
-	 */	
-	pad = (4 - (((bitmap_info_header.bitspp / 8) * bitmap_info_header.width) % 4)) % 4;
 
 	#ifdef DEBUG_MESSAGES_UI
 	printf("Writing the Bitmap Data\n");
 	#endif
 	
+	bitmap_data = save_buffer + offset;
+	
 	/*
-	 * Loop for the Number of Image Rows
+	 * Loop for the Number of Image Rows.
+	 * Each Row is Packed from 4 to 3 Bytes per Pixel and then the Padding Bytes (If Any) are Added to the End of the Row.
+	 * The Padding Bytes are Cleared after the Packing since the SIMD Versions of pack_bgrx_to_bgr() May Write Past the Last Pixel.
+	 * 
+	 * In the Gradient Output Formats the Image is Replaced by the Edges that the gradients_to_edges() Finds.
 	 */	
-	for(i=0; i < bitmap_info_header.height; i++) 
+	if(output_format != OUTPUT_FORMAT_PIXEL)
+	{
+		if(gradients_to_edges(u8_post_process_kernel_address, bitmap_data, row_stride) != SUCCESS)
+		{
+			printf("[SAVE PROCESS] Failed to Allocate Memory for the Edge Detection\n");
+			
+			return FAILURE;
+		}
+	}
+	else if(packed_output == 0)
+	{
+		for(i=0; i < bitmap_info_header.height; i++) 
+		{
+			pack_bgrx_to_bgr(u8_post_process_kernel_address + (i * bitmap_info_header.width * 4), bitmap_data + (i * row_stride), bitmap_info_header.width);
+			
+			memset(bitmap_data + (i * row_stride) + (row_stride - pad), 0, pad);
+		}
+	}
+	else
 	{
 		/*
-		 * Loop for the Number of Image Columns (The Pixels of each Row)
+		 * In Packed Output Mode each Row Occupies the Width Rounded Up to a Multiple of 4 Bytes.
+		 * The Rows of each Segment are Contiguous Starting from the Offset where the 4 Byte per Pixel Rows of the Segment were Placed before the Processing.
 		 */
-		for(j=0; j < bitmap_info_header.width; j++) 
+		packed_row_stride = ((bitmap_info_header.width + 3) / 4) * 4;
+		
+		if(segments <= 0)
 		{
-			/*
-			 * Loop 3 Times for each Pixel (3 Bytes Per Pixel / bitspp = 24)
-			 */
-			for(k=0; k<(bitmap_info_header.bitspp / 8); k++)
+			segment_rows = NULL;
+			segments = 1;
+		}
+		
+		segment_start_row = 0;
+		
+		for(segment = 0; segment < segments; segment++)
+		{
+			if(segment_rows == NULL || segment == segments - 1)
 			{
-				/*
-				 * Get the Current Byte (1 of 3) of the Current Pixel which is Stored in the (j * 4) + k + (bitmap_info_header.width * i * 4) Offset 
-				 * of the Kernel Memory (u8_post_process_kernel_address).
-				 */
-				current_byte = (uint8_t) u8_post_process_kernel_address[(j * 4) + k + (bitmap_info_header.width * i * 4)];
-
-				/*
-				 * Write the Current Byte Inside the Bitmap Data Offset of the File.
-				 */
-				if (fwrite(&current_byte, sizeof(uint8_t), 1, bmp_file) != 1)
-				{
-					printf("Failed to Write the Bitmap Data\n");
-					fclose(bmp_file);
-					return true;
-				}
+				segment_end_row = bitmap_info_header.height;
+			}
+			else
+			{
+				segment_end_row = segment_start_row + segment_rows[segment];
+			}
+			
+			segment_base = u8_post_process_kernel_address + ((size_t)segment_start_row * input_row_bytes());
+			
+			for(i = segment_start_row; i < segment_end_row; i++)
+			{
+				unpack_gray_to_bgr(segment_base + ((size_t)(i - segment_start_row) * packed_row_stride), bitmap_data + (i * row_stride), bitmap_info_header.width);
+				
+				memset(bitmap_data + (i * row_stride) + (row_stride - pad), 0, pad);
 			}
+			
+			segment_start_row = segment_end_row;
 		}
+	}
+	
+    /*
+     * Open the Image File According to the File Name Given by the the User
+     */
+    bmp_file = open(save_path_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
 
-		/*
-		 * If Any Padding is Necessary then Add it to the End of the Row.
-		 */
-		current_byte = 0;
+    if(bmp_file >= 0)
+    {
+		#ifdef DEBUG_MESSAGES_UI
+    	printf("New Image File Opened\n");
+    	#endif
+    }
+    else
+    {
+       	printf("New Image File Failed to Open\n");
+	
+		usleep(2000000);
+
+		return(FAILURE);
+    }
+    
+	/*
+	 * Write the Whole File with a Single write() Call.
+	 * The Loop is Required only in the Rare Case where write() Returns without Writing All the Requested Bytes.
+	 */
+	total_written_bytes = 0;
+	
+	while(total_written_bytes < total_file_size)
+	{
+		written_bytes = write(bmp_file, save_buffer + total_written_bytes, total_file_size - total_written_bytes);
 		
-		/*
-		 * Loop for the Number of Padding Bytes and
-		 */
-		for(j=0; j < pad; j++)
-			if (fwrite(&current_byte, sizeof(uint8_t), 1, bmp_file) != 1) 
-			{
-				fclose(bmp_file);
-				return true;
-			}
+		if(written_bytes <= 0)
+		{
+			printf("[SAVE PROCESS] Failed to Write the New Image File\n");
+			close(bmp_file);
+			
+			return FAILURE;
+		}
+		
+		total_written_bytes += written_bytes;
 	}
 
 	/*
 	 * Close the Save Bitmap File.
 	 */
-	fclose(bmp_file);
+	close(bmp_file);
 	
 	#ifdef DEBUG_MESSAGES_UI
 	printf("Image is Saved\n");	
@@ -1268,6 +3448,14 @@ int print_save_metrics(struct shared_repository_process *shared_repo_kernel_addr
 		 */		
 		fprintf(metrics_summary_file,"		<Image_Segments>%d</Image_Segments>\n", segments);
 		
+		/*
+		 * Write the Engine Element Node if the Image was Processed by the CPU Engine instead of the Acceleration Groups (See the offload_mode).
+		 */
+		if(used_accelerator == ACCELERATOR_NO_OCCUPIED)
+		{
+			fprintf(metrics_summary_file,"		<Engine>CPU</Engine>\n");
+		}
+		
 		/*
 		 * Write the Preparation_Time_Start Element Node Along with its Value (nanoseconds).
 		 * The Node Value was Calculated by Converting the Cycles Value Found in the preparation_time_start Field of the shared_repo_kernel_address->process_metrics Structure of the Shared Kernel Memory
@@ -2047,6 +4235,8 @@ int print_save_metrics(struct shared_repository_process *shared_repo_kernel_addr
  *  -> i2 Followed by Value Zero or One Depending on whether the Accelereration Group Indirect 2 Was Used or Not for Accelerating the Current Image
  *  -> i3 Followed by Value Zero or One Depending on whether the Accelereration Group Indirect 3 Was Used or Not for Accelerating the Current Image
  *  -> sg Followed by Value Zero or One Depending on whether the Accelereration Group Scatter/Gather Was Used or Not for Accelerating the Current Image
+ * 
+ * The Images that were Processed by the CPU Engine are Named with the cpu Suffix instead of the Acceleration Groups.
  */
 int set_save_accelerator(char *save_path_name, int used_accelerator, int tid, int iteration)
 {
@@ -2057,9 +4247,19 @@ int set_save_accelerator(char *save_path_name, int used_accelerator, int tid, in
 	 * Shift Right the used_accelerator Variable to Get the 7 LSB Bits 
 	 * that Represent the Status (Used or Not) of each Acceleration Group Respectively
 	 */
-	for(repeat = 0; repeat < 7; repeat++)
+	for(repeat = 0; repeat < 7; repeat++)
+	{
+		accel_occupied[repeat] = (used_accelerator >> repeat) & 1;
+	}
+	
+	/*
+	 * If no Acceleration Group was Used then the Image was Processed by the CPU Engine (See the offload_mode).
+	 */
+	if(used_accelerator == ACCELERATOR_NO_OCCUPIED)
 	{
-		accel_occupied[repeat] = (used_accelerator >> repeat) & 1;
+		sprintf(save_path_name, "Results/pid_%d_iter_%d_cpu.bmp", tid, iteration);
+		
+		return SUCCESS;
 	}
 	
 	/*
@@ -2584,8 +4784,6 @@ int acceleration_thread()
 	
 	int status = 0;
 	
-	int page_size;
-	
 	/*
 	 * This Structure Pointer is Used to Store the Pre Process, Post Process and Metrics Kernel Memory Pointers as well as the File Descriptors 
 	 * which are used by the pre_process_mmap(), post_process_mmap() and shared_repo_mmap() Functions for Mapping the Kernel's Allocated Memories for the Current Thread.
@@ -2612,6 +4810,26 @@ int acceleration_thread()
 	 */
 	struct sg_list_addresses *sg_list_src_dst_addresses = NULL;
 	
+	/*
+	 * Used in the LOAD_MODE_PRE_STAGED Mode to Indicate that the Pre Process Kernel Memory (pre_process_staged) 
+	 * and the Pre Process Userspace Memory of the Acceleration Group SG (sg_source_staged) Hold the Unchanged Image Data.
+	 */
+	int pre_process_staged = 0;
+	int sg_source_staged = 0;
+	
+	/*
+	 * Set when the Image does not Fit in the Pre Process Kernel Memory and is Processed in Row Bands by the tiled_acceleration().
+	 */
+	int tiled_image = 0;
+	
+	/*
+	 * The Engine (OFFLOAD_ENGINE_*) that Processes the Current Iteration, the Number of Requests that were Queued for the Acceleration Groups
+	 * when it was Selected and the Time when the Engine Started.
+	 */
+	int engine;
+	int queue_depth;
+	uint64_t engine_time_start;
+	
 	
 	char* device_file_name = device_driver_name;
 	
@@ -2669,6 +4887,19 @@ int acceleration_thread()
     shared_repo_kernel_address->shared_image_info.columns = bitmap_info_header.width;
     shared_repo_kernel_address->shared_image_info.size = total_reserved_size;
 	
+	/*
+	 * Request the Packed Output Mode (If Enabled) from the Acceleration Groups that will Process the Image.
+	 */
+	shared_repo_kernel_address->packed_output = packed_output;
+	shared_repo_kernel_address->input_format = input_format;
+	
+	/*
+	 * Request the Filter that the Sobel Filters of the Acceleration Groups will Apply.
+	 */
+	set_filter(&shared_repo_kernel_address->filter, filter_preset);
+	shared_repo_kernel_address->filter.output_format = output_format;
+	shared_repo_kernel_address->filter.stages = pipeline_stages;
+	
 
 	/*
 	 * Store the Time Spot where the Required Preparation before Acceleration Started
@@ -2714,11 +4945,37 @@ int acceleration_thread()
 	 */	
 	shared_repo_kernel_address->process_metrics.preparation_time_end = time_stamp;
 
+	/*
+	 * If the Image does not Fit in the Pre Process Kernel Memory then all the Iterations are Processed in Row Bands by the tiled_acceleration().
+	 * Else if the ring_depth is Set then all the Iterations are Queued in the Submission Ring by the ring_acceleration().
+	 * In both Cases the Loop Below is Skipped.
+	 */
+	tiled_image = (input_row_bytes() * bitmap_info_header.height > MMAP_ALLOCATION_SIZE) ? 1 : 0;
+	
+	if(tiled_image == 1)
+	{
+		status = tiled_acceleration(device_file, shared_repo_kernel_address, u8_pre_process_kernel_address, tid);
+		
+		if(status != SUCCESS)
+		{
+			printf("Multi-Application Access Test Failed / Tiled Acceleration Error\n");
+		}
+	}
+	else if(ring_depth > 0)
+	{
+		status = ring_acceleration(device_file, shared_repo_kernel_address, u8_pre_process_kernel_address, tid);
+		
+		if(status != SUCCESS)
+		{
+			printf("Multi-Application Access Test Failed / Ring Acceleration Error\n");
+		}
+	}
+
 	/*
 	 * This Loop Contains the Main Steps of the Acceleration Procedure from Requesting Acceleration to Completing the Acceleration.
 	 * Each New Iteration of the for Loop is A New Acceleration Request.
 	 */	
-	for(global_repeat = 0; global_repeat < global_iterations; global_repeat++)
+	for(global_repeat = 0; (ring_depth == 0) && (tiled_image == 0) && (global_repeat < global_iterations); global_repeat++)
 	{
 	
 		/*
@@ -2735,10 +4992,17 @@ int acceleration_thread()
 		shared_repo_kernel_address->process_metrics.load_time_start = time_stamp;
 		
 		/*
-		 * Copy the Image Data from the Common Memory where they were Initially Loaded  to the Pre Process Kernel Memory (u8_pre_process_kernel_address).
+		 * Place the Image Data to the Pre Process Kernel Memory (u8_pre_process_kernel_address) According to the load_mode.
 		 * An Old but Slower Approach was to Load the Image Data to the Pre Process Kernel Memory instead of Using the Copy Method.
+		 * 
+		 * In the LOAD_MODE_PRE_STAGED Mode the Image is not Staged Again if the Pre Process Kernel Memory Still Holds the Unchanged Image from a Previous Iteration.
 		 */
-		memcpy((void *)u8_pre_process_kernel_address, (void *)common_load, shared_repo_kernel_address->shared_image_info.size);
+		if((load_mode != LOAD_MODE_PRE_STAGED) || (pre_process_staged == 0))
+		{
+			stage_image(u8_pre_process_kernel_address);
+			
+			pre_process_staged = 1;
+		}
 
 		
 		/*
@@ -2746,31 +5010,63 @@ int acceleration_thread()
 		 */			
 		time_stamp = uint_64_pcie_bar_kernel_address[BAR0_OFFSET_TIMER / 8];
 		shared_repo_kernel_address->process_metrics.load_time_end = time_stamp;
-	
-
-        #ifdef DEBUG_MESSAGES_UI
-		printf("Sending Access Request to the Driver\n");
-		#endif
-
-		/*
-		 * Read and Store the Time Spot Right Before the Thread is Possibly Set to Sleep State (If no Acceleration Groups were Found Available).
-		 * This is where the Sleep State Possibly Started.
-		 */							
-		time_stamp = uint_64_pcie_bar_kernel_address[BAR0_OFFSET_TIMER / 8];
-		shared_repo_kernel_address->process_metrics.sleep_time_start = time_stamp;	
-
+		
 		/*
-		 * IOCtl Request Access to Hardware Accelerator From Driver.
-		 * This System Call Makes the Driver to Execute a Specific Code Routine that will Try to Occupy Acceleration Group(s)
-		 */ 		 
-		status = ioctl(device_file, COMMAND_REQUEST_ACCELERATOR_ACCESS, (unsigned long)0);
+		 * Select whether the Current Iteration is Processed by the Acceleration Groups or by the CPU Engine (See the offload_mode).
+		 * The Latency of the Selected Engine is Measured from this Point up to the Completion of the Processing.
+		 */
+		engine = offload_decision(bitmap_info_header.width * bitmap_info_header.height, &queue_depth);
 		
-		if(status == FAILURE)
+		engine_time_start = monotonic_time_ns();
+		
+		if(engine == OFFLOAD_ENGINE_CPU)
 		{
-			printf("IOCtl Failed\n");
-			usleep(1500000);
+			/*
+			 * The CPU Engine does not Occupy any Acceleration Group so the Sleep Time is Empty and the Processed Image is a Single Segment.
+			 */
+			time_stamp = uint_64_pcie_bar_kernel_address[BAR0_OFFSET_TIMER / 8];
+			shared_repo_kernel_address->process_metrics.sleep_time_start = time_stamp;
+			shared_repo_kernel_address->process_metrics.sleep_time_end = time_stamp;
 			
-			return FAILURE;
+			shared_repo_kernel_address->accel_occupied = ACCELERATOR_NO_OCCUPIED;
+			shared_repo_kernel_address->image_segments = 0;
+			
+			status = cpu_sobel_filter(u8_pre_process_kernel_address);
+			
+			if(status != SUCCESS)
+			{
+				printf("Multi-Application Access Test Failed / CPU Engine Error\n");
+				usleep(1500000);
+				
+				return FAILURE;
+			}
+		}
+		else
+		{
+			#ifdef DEBUG_MESSAGES_UI
+			printf("Sending Access Request to the Driver\n");
+			#endif
+
+			/*
+			 * Read and Store the Time Spot Right Before the Thread is Possibly Set to Sleep State (If no Acceleration Groups were Found Available).
+			 * This is where the Sleep State Possibly Started.
+			 */							
+			time_stamp = uint_64_pcie_bar_kernel_address[BAR0_OFFSET_TIMER / 8];
+			shared_repo_kernel_address->process_metrics.sleep_time_start = time_stamp;	
+
+			/*
+			 * IOCtl Request Access to Hardware Accelerator From Driver.
+			 * This System Call Makes the Driver to Execute a Specific Code Routine that will Try to Occupy Acceleration Group(s)
+			 */ 		 
+			status = ioctl(device_file, COMMAND_REQUEST_ACCELERATOR_ACCESS, (unsigned long)allocation_policy);
+			
+			if(status == FAILURE)
+			{
+				printf("IOCtl Failed\n");
+				usleep(1500000);
+				
+				return FAILURE;
+			}
 		}
 
 		/*
@@ -2785,11 +5081,6 @@ int acceleration_thread()
 			
 			if(u8_sg_pre_process_kernel_address == NULL && u8_sg_post_process_kernel_address == NULL)
 			{
-				/*
-				 * Get the Page Size which is Set by the Linux System.
-				 */
-				page_size = getpagesize();	
-				
 				/*
 				 * Allocate a "sg_list_addresses" Structure.
 				 * This Structure Holds the Pointers for the Pre Process (Source) and the Post Process (Destination) Userspace Memories.
@@ -2797,9 +5088,9 @@ int acceleration_thread()
 				sg_list_src_dst_addresses = (struct sg_list_addresses *)malloc(sizeof(struct sg_list_addresses));	
 				
 				/*
-				 * Allocate 4M of Memory Aligned in Pages of PAGE_SIZE (4K) for the Pre Process Userspace Memory
+				 * Allocate the POSIX_ALLOCATED_SIZE of Memory Aligned to a Huge Page for the Pre Process Userspace Memory
 				 */ 
-				status = posix_memalign((void **)&sg_list_src_dst_addresses->sg_list_source_address, page_size, POSIX_ALLOCATED_SIZE);
+				status = posix_memalign((void **)&sg_list_src_dst_addresses->sg_list_source_address, POSIX_ALLOCATED_ALIGNMENT, POSIX_ALLOCATED_SIZE);
 				
 				/*
 				 * Set the u8_sg_pre_process_kernel_address Pointer to Point at the Pre Process Userspace Memory as the sg_list_src_dst_addresses->sg_list_source_address Pointer.
@@ -2815,15 +5106,30 @@ int acceleration_thread()
 					printf("Failed to Allocate Memory for Source Buffer [ERROR %d]", status);
 				}
 				
+				/*
+				 * Only the Bytes of the Staged Image and of the Processed Image are Accessed by the AGSG.
+				 * They are the Sizes that are Locked and Pinned by the Driver so that Small Images do not Lock the Whole POSIX_ALLOCATED_SIZE of each Thread.
+				 */
+				sg_list_src_dst_addresses->source_size = input_row_bytes() * bitmap_info_header.height;
+				sg_list_src_dst_addresses->destination_size = output_row_bytes() * bitmap_info_header.height;
+				
+				/*
+				 * Ask for Transparent Huge Pages before the Memory is Touched so that the Driver Finds Long Runs of Contiguous Pages when it Registers the Memory.
+				 * It is only a Hint and the Memory Works the Same with Regular Pages.
+				 */
+				#ifdef MADV_HUGEPAGE
+				madvise(sg_list_src_dst_addresses->sg_list_source_address, POSIX_ALLOCATED_SIZE, MADV_HUGEPAGE);
+				#endif
+				
 				/*
 				 * Pin the Allocated Memory to Avoid Swapping.
 				 */
-				mlock(sg_list_src_dst_addresses->sg_list_source_address, POSIX_ALLOCATED_SIZE);
+				mlock(sg_list_src_dst_addresses->sg_list_source_address, sg_list_src_dst_addresses->source_size);
 				
 				/*
-				 * Allocate 4M of Memory Aligned in Pages of PAGE_SIZE (4K) for the Post Process Userspace Memory
+				 * Allocate the POSIX_ALLOCATED_SIZE of Memory Aligned to a Huge Page for the Post Process Userspace Memory
 				 */ 				
-				status = posix_memalign((void **)&sg_list_src_dst_addresses->sg_list_destination_address, page_size, POSIX_ALLOCATED_SIZE);
+				status = posix_memalign((void **)&sg_list_src_dst_addresses->sg_list_destination_address, POSIX_ALLOCATED_ALIGNMENT, POSIX_ALLOCATED_SIZE);
 				
 				/*
 				 * Set the u8_sg_post_process_kernel_address Pointer to Point at the Post Process Userspace Memory as the sg_list_src_dst_addresses->sg_list_destination_address Pointer.
@@ -2840,10 +5146,27 @@ int acceleration_thread()
 					printf("Failed to Allocate Memory for Destination Buffer [ERROR %d]", status);
 				}	
 
+				#ifdef MADV_HUGEPAGE
+				madvise(sg_list_src_dst_addresses->sg_list_destination_address, POSIX_ALLOCATED_SIZE, MADV_HUGEPAGE);
+				#endif
+
 				/*
 				 * Pin the Allocated Memory to Avoid Swapping.
 				 */
-				mlock(sg_list_src_dst_addresses->sg_list_destination_address, POSIX_ALLOCATED_SIZE);	
+				mlock(sg_list_src_dst_addresses->sg_list_destination_address, sg_list_src_dst_addresses->destination_size);	
+				
+				/*
+				 * IOCtl Request to Register the Pre Process and Post Process Userspace Memories.
+				 * The Driver Keeps them Pinned and DMA Mapped until they are Unregistered so the Following AGSG Jobs of the Thread
+				 * do not Need the COMMAND_SET_PAGES and COMMAND_UNMAP_PAGES IOCtl Calls.
+				 * If the Registration Fails the handle is 0 and each Job Falls Back to those IOCtl Calls.
+				 */
+				sg_list_src_dst_addresses->handle = 0;
+				
+				if(ioctl(device_file, COMMAND_REGISTER_PAGES, (unsigned long)sg_list_src_dst_addresses) != 0)
+				{
+					sg_list_src_dst_addresses->handle = 0;
+				}
 			}
 			
 			/*
@@ -2851,7 +5174,12 @@ int acceleration_thread()
 			 * Since there was no Available Acceleration Group (Except for the AGSG) that Uses the Kernel Memory the Data Must be Copied to the
 			 * Pre Process Userspace Memory so that they Can be Processed by the Acceleration Group SG (AGSG).
 			 */
-			memcpy(u8_sg_pre_process_kernel_address, u8_pre_process_kernel_address, total_reserved_size);
+			if((load_mode != LOAD_MODE_PRE_STAGED) || (sg_source_staged == 0))
+			{
+				memcpy(u8_sg_pre_process_kernel_address, u8_pre_process_kernel_address, sg_list_src_dst_addresses->source_size);
+				
+				sg_source_staged = 1;
+			}
 			
 			
 			sg_list_src_dst_addresses->current_pid = tid;
@@ -2866,13 +5194,22 @@ int acceleration_thread()
 			 * IOCtl Request to Create the Scatter/Gather List.
 			 * This System Call Provides the Driver with the Pre Process and Post Process Memory Pointers so that the Driver Can Create 
 			 * two Scatter/Gather Lists for the Source and Destination of the Image Data.
+			 * 
+			 * It is not Required when the Memories are Registered so the Set Pages Overhead is Zero in such Case.
 			 */ 
-			ioctl(device_file, COMMAND_SET_PAGES, (unsigned long)sg_list_src_dst_addresses);
+			if(sg_list_src_dst_addresses->handle == 0)
+			{
+				ioctl(device_file, COMMAND_SET_PAGES, (unsigned long)sg_list_src_dst_addresses);
+			}
 
 			/*
 			 * Read and Store the Time Spot where Setting the Scatter/Gather Lists Ended.
 			 */				
-			time_stamp = uint_64_pcie_bar_kernel_address[BAR0_OFFSET_TIMER / 8];
+			if(sg_list_src_dst_addresses->handle == 0)
+			{
+				time_stamp = uint_64_pcie_bar_kernel_address[BAR0_OFFSET_TIMER / 8];
+			}
+			
 			shared_repo_kernel_address->process_metrics.set_pages_overhead_time_end = time_stamp;						
 
 			/*
@@ -2886,8 +5223,9 @@ int acceleration_thread()
 			 * IOCtl Request Access to Hardware Accelerator From Driver.
 			 * This System Call Makes the Driver to Execute a Specific Code Routine that will Try to Occupy Acceleration Group(s).
 			 * This Time Since there were no other Acceleration Groups Available (Except for the AGSG) the Application Requests to Occupy the Acceleration Group SG.
+			 * The handle of the Registered Memories (or 0 for the Scatter/Gather Lists of the COMMAND_SET_PAGES) is Carried Along.
 			 */ 			
-			ioctl(device_file, COMMAND_REQUEST_ACCELERATOR_SG_ACCESS, (unsigned long)0);
+			ioctl(device_file, COMMAND_REQUEST_ACCELERATOR_SG_ACCESS, (unsigned long)sg_list_src_dst_addresses->handle);
 			
 		}
 		
@@ -2895,15 +5233,59 @@ int acceleration_thread()
 		 * The shared_repo_kernel_address->accel_occupied is a Flag whose 7 LSBs Indicate which Acceleration Groups where Occupied for the Current Thread Depending on the Acceleration Policy.
 		 * The shared_repo_kernel_address->accel_completed is a Flag whose 7 LSBs Indicate which Acceleration Groups Have Completed their Procedure.
 		 * When the Driver Occupies a Number of Acceleration Groups for the Thread we Expect that the Total Acceleration is Completed when all the Occupied Acceleration Groups Have Completed.
-		 * As a Result the while Loop is Active until all the Acceleration Groups that where Occupied are Completed.
+		 * As a Result the wait_for_acceleration() Returns only when all the Acceleration Groups that where Occupied are Completed.
 		 */
 		 
-		while(shared_repo_kernel_address->accel_completed != shared_repo_kernel_address->accel_occupied)
+		if(engine == OFFLOAD_ENGINE_FPGA)
 		{
-
-		}					
+			/*
+			 * If the Completion Cannot be Awaited then the Iteration is Processed Again by the CPU Engine (if it Supports the Current Configuration).
+			 * The Image is Staged Again Since the Acceleration Groups May Have Already Written Part of the Processed Image.
+			 */
+			if(wait_for_acceleration(device_file, shared_repo_kernel_address) != SUCCESS)
+			{
+				printf("Waiting for the Acceleration Failed / Falling Back to the CPU Engine [PID: %d]\n", tid);
+				
+				status = FAILURE;
+				
+				if(cpu_sobel_supported() == 1)
+				{
+					stage_image(u8_pre_process_kernel_address);
+					
+					shared_repo_kernel_address->accel_occupied = ACCELERATOR_NO_OCCUPIED;
+					shared_repo_kernel_address->image_segments = 0;
+					
+					engine = OFFLOAD_ENGINE_CPU;
+					
+					status = cpu_sobel_filter(u8_pre_process_kernel_address);
+				}
+				
+				if(status != SUCCESS)
+				{
+					printf("Multi-Application Access Test Failed / Acceleration Wait Error\n");
+					usleep(1500000);
+					
+					return FAILURE;
+				}
+			}
+			
+			printf("Occupied: %d Completed: %d [PID: %d]\n", shared_repo_kernel_address->accel_occupied, shared_repo_kernel_address->accel_completed, tid);
+		}
+		else
+		{
+			printf("Processed by the CPU Engine [PID: %d]\n", tid);
+		}
 		
-		printf("Occupied: %d Completed: %d [PID: %d]\n", shared_repo_kernel_address->accel_occupied, shared_repo_kernel_address->accel_completed, tid);
+		offload_record(engine, bitmap_info_header.width * bitmap_info_header.height, monotonic_time_ns() - engine_time_start, queue_depth);
+		
+		/*
+		 * Every Acceleration Group Except for the AGSG (as well as the CPU Engine) Writes the Processed Image Back to the Pre Process Kernel Memory (See the Comments for the u8_post_process_kernel_address).
+		 * In such Case the Image Must be Staged Again in the Next Iteration.
+		 */
+		if(shared_repo_kernel_address->accel_occupied != ACCELERATOR_SG_OCCUPIED)
+		{
+			pre_process_staged = 0;
+		}
 		
 
 		#ifdef DEBUG_MESSAGES_UI	
@@ -2935,14 +5317,19 @@ int acceleration_thread()
 			 * The Scatter/Gather Mapped Pages Must be Released before the Application Tries to Read and Store
 			 * the Processed Image Data from the Pre Process Userspace Memory.
 			 * 
-			 * The Unmap Procedure is Only Required if the Acceleration Group SG was Occupied.
+			 * The Unmap Procedure is Only Required if the Acceleration Group SG was Occupied without Registered Memories
+			 * (the Driver Synchronizes the Registered Destination Memory for the CPU when the AGSG Completes).
 			 */ 
-			ioctl(device_file, COMMAND_UNMAP_PAGES, (unsigned long)0);
+			if(sg_list_src_dst_addresses->handle == 0)
+			{
+				ioctl(device_file, COMMAND_UNMAP_PAGES, (unsigned long)0);
 
-			/*
-			 * Read and Store the Time Spot where Unmapping the Pages Ended.
-			 */				
-			time_stamp = uint_64_pcie_bar_kernel_address[BAR0_OFFSET_TIMER / 8];
+				/*
+				 * Read and Store the Time Spot where Unmapping the Pages Ended.
+				 */				
+				time_stamp = uint_64_pcie_bar_kernel_address[BAR0_OFFSET_TIMER / 8];
+			}
+			
 			shared_repo_kernel_address->process_metrics.unmap_pages_overhead_time_end = time_stamp;	
 			
 			/*
@@ -2959,7 +5346,7 @@ int acceleration_thread()
 				/*
 				 * Call the save_bmp() Function to Save the Image from the Post Process Usespace Memory (u8_sg_post_process_kernel_address) to the Storage Device (save_path_name).
 				 */					
-				status = save_bmp(u8_sg_post_process_kernel_address, save_path_name);				
+				status = save_bmp(u8_sg_post_process_kernel_address, save_path_name, NULL, 0);				
 	
 				/*
 				 * Read and Store the Time Spot where Saving the Processed Image Ended.
@@ -2986,7 +5373,7 @@ int acceleration_thread()
 					/*
 					 * Call the save_bmp() Function to Save the Image from the Post Process Usespace Memory (u8_sg_post_process_kernel_address) to the Storage Device (save_path_name).
 					 */					
-					status = save_bmp(u8_sg_post_process_kernel_address, save_path_name);
+					status = save_bmp(u8_sg_post_process_kernel_address, save_path_name, NULL, 0);
 					
 					/*
 					 * Read and Store the Time Spot where Saving the Processed Image Ended.
@@ -3010,7 +5397,7 @@ int acceleration_thread()
 				 * Call the save_bmp() Function to Save the Image from the Pre Process Kernel Memory (u8_post_process_kernel_address Points to u8_pre_process_kernel_address)
 				 * to the Storage Device (save_path_name).
 				 */									
-				status = save_bmp(u8_post_process_kernel_address, save_path_name);	
+				status = save_bmp(u8_post_process_kernel_address, save_path_name, shared_repo_kernel_address->segment_rows, shared_repo_kernel_address->image_segments);	
 				
 				/*
 				 * Read and Store the Time Spot where Saving the Processed Image Ended.
@@ -3035,7 +5422,7 @@ int acceleration_thread()
 					 * Call the save_bmp() Function to Save the Image from the Pre Process Kernel Memory (u8_post_process_kernel_address Points to u8_pre_process_kernel_address)
 					 * to the Storage Device (save_path_name).
 					 */										
-					status = save_bmp(u8_post_process_kernel_address, save_path_name);
+					status = save_bmp(u8_post_process_kernel_address, save_path_name, shared_repo_kernel_address->segment_rows, shared_repo_kernel_address->image_segments);
 					
 					/*
 					 * Read and Store the Time Spot where Saving the Processed Image Ended.
@@ -3101,6 +5488,14 @@ int acceleration_thread()
 	{	
 		printf("Freed SG Lists [PID: %d]\n", tid);
 		
+		/*
+		 * IOCtl Request to Unregister the Memories before they are Freed.
+		 */
+		if(sg_list_src_dst_addresses->handle != 0)
+		{
+			ioctl(device_file, COMMAND_UNREGISTER_PAGES, (unsigned long)sg_list_src_dst_addresses->handle);
+		}
+		
 		/*
 		 * If the Pre Process (Source) Userspace Memory (sg_list_src_dst_addresses->sg_list_source_address) was Used (not Null) then Release it.
 		 */
@@ -3169,6 +5564,22 @@ int acceleration_thread()
 	 * Free the Memory Allocation of the mm_per_thread_info Pointer.
 	 */
 	free(mm_per_thread_info);
+	
+	/*
+	 * Free the Thread Local Memory that save_bmp() Used to Assemble the Saved Image Files.
+	 */
+	free(save_buffer);
+	
+	save_buffer = NULL;
+	save_buffer_size = 0;
+	
+	/*
+	 * Free the Thread Local Memory that the cpu_sobel_filter() Used for the Luminance Values.
+	 */
+	free(cpu_buffer);
+	
+	cpu_buffer = NULL;
+	cpu_buffer_size = 0;
 		
 	
 	completed = 0;
@@ -3224,6 +5635,15 @@ int main(int argc, char *argv[])
 	 * Used to Store the Number of Threads that the Application is Going to Start.
 	 */		
 	int threads_number = 0;
+	
+	char *argument_end;
+	
+	if(argc < 6)
+	{
+		print_usage(argv[0]);
+		
+		return FAILURE;
+	}
 
 	/*
 	 * Get the First Argument of the Application Call.
@@ -3258,6 +5678,148 @@ int main(int argc, char *argv[])
 	 */		
 	test_iterations = atoi(argv[5]);
 	
+	/*
+	 * Get the Optional Sixth Argument of the Application Call.
+	 * The Sixth Argument Represents the Load Mode which Refers to How the Image Reaches the Pre Process Kernel Memory of each Thread.
+	 * See the Comments of the load_mode at the Global Variables Section for more Details.
+	 */
+	if(argc > 6)
+	{
+		load_mode = (int)strtol(argv[6], &argument_end, 10);
+		
+		if(argument_end == argv[6] || *argument_end != '\0' || load_mode < LOAD_MODE_COPY || load_mode > LOAD_MODE_PRE_STAGED)
+		{
+			printf("Invalid load_mode: %s\n", argv[6]);
+			print_usage(argv[0]);
+			
+			return FAILURE;
+		}
+	}
+	
+	/*
+	 * Get the Optional Seventh Argument of the Application Call.
+	 * The Seventh Argument Represents the Depth of the Submission Ring of each Thread.
+	 * See the Comments of the ring_depth at the Global Variables Section for more Details.
+	 */
+	if(argc > 7)
+	{
+		ring_depth = atoi(argv[7]);
+	}
+	
+	/*
+	 * Get the Optional Eighth Argument of the Application Call.
+	 * The Eighth Argument Represents the Allocation Policy that the Driver Applies to the Requests of the Threads.
+	 * See the Comments of the allocation_policy at the Global Variables Section for more Details.
+	 */
+	if(argc > 8)
+	{
+		allocation_policy = atoi(argv[8]);
+	}
+	
+	/*
+	 * Get the Optional Ninth Argument of the Application Call.
+	 * The Ninth Argument Enables the Packed 8 Bit Grayscale Output Mode of the Sobel Filters.
+	 * See the Comments of the packed_output at the Global Variables Section for more Details.
+	 */
+	if(argc > 9)
+	{
+		packed_output = (atoi(argv[9]) == 1) ? 1 : 0;
+	}
+	
+	/*
+	 * Get the Optional Tenth Argument of the Application Call.
+	 * The Tenth Argument Represents the Format in which the Image is Staged for the Sobel Filters.
+	 * See the Comments of the input_format at the Global Variables Section for more Details.
+	 */
+	if(argc > 10)
+	{
+		input_format = atoi(argv[10]);
+		
+		if(input_format != INPUT_FORMAT_BGR && input_format != INPUT_FORMAT_LUMA)
+		{
+			input_format = INPUT_FORMAT_BGRX;
+		}
+		
+		if(input_format != INPUT_FORMAT_BGRX)
+		{
+			packed_output = 1;
+		}
+	}
+	
+	/*
+	 * Get the Optional Eleventh Argument of the Application Call.
+	 * The Eleventh Argument Represents the Filter Preset that the Sobel Filters Apply to the Image.
+	 * See the Comments of the filter_preset at the Global Variables Section for more Details.
+	 */
+	if(argc > 11)
+	{
+		filter_preset = atoi(argv[11]);
+		
+		if(filter_preset < FILTER_PRESET_SOBEL || filter_preset > FILTER_PRESET_BOX)
+		{
+			filter_preset = FILTER_PRESET_SOBEL;
+		}
+	}
+	
+	/*
+	 * Get the Optional Twelfth Argument of the Application Call.
+	 * The Twelfth Argument Represents the Optional Stages of the sobel_pipeline Cores.
+	 * See the Comments of the pipeline_stages at the Global Variables Section for more Details.
+	 */
+	if(argc > 12)
+	{
+		pipeline_stages = atoi(argv[12]) & PIPELINE_STAGES_MASK;
+	}
+	
+	/*
+	 * Get the Optional Thirteenth Argument of the Application Call.
+	 * The Thirteenth Argument Represents the Output Format of the Sobel Filters.
+	 * See the Comments of the output_format at the Global Variables Section for more Details.
+	 */
+	if(argc > 13)
+	{
+		output_format = atoi(argv[13]);
+		
+		if(output_format != OUTPUT_FORMAT_GRADIENTS && output_format != OUTPUT_FORMAT_MAGNITUDE)
+		{
+			output_format = OUTPUT_FORMAT_PIXEL;
+		}
+		
+		/*
+		 * The Gradients are 32 Bit Words that Replace the Initial Image in the Same Memory so the Image Should not be Staged in a Smaller Format.
+		 */
+		if(output_format != OUTPUT_FORMAT_PIXEL)
+		{
+			input_format = INPUT_FORMAT_BGRX;
+			packed_output = 0;
+		}
+	}
+	
+	/*
+	 * Get the Optional Fourteenth Argument of the Application Call.
+	 * The Fourteenth Argument Represents the Offload Mode which Selects the Engine (FPGA or CPU) of each Iteration.
+	 * See the Comments of the offload_mode at the Global Variables Section for more Details.
+	 */
+	if(argc > 14)
+	{
+		offload_mode = atoi(argv[14]);
+		
+		if(offload_mode != OFFLOAD_MODE_AUTO && offload_mode != OFFLOAD_MODE_CPU)
+		{
+			offload_mode = OFFLOAD_MODE_FPGA;
+		}
+	}
+	
+	/*
+	 * Share the Online CPUs among the Threads of the Application so that the CPU Engines of all the Threads Together do not Oversubscribe the CPUs.
+	 */
+	cpu_workers = (threads_number > 0) ? (int)(sysconf(_SC_NPROCESSORS_ONLN) / threads_number) : 1;
+	
+	if(cpu_workers < 1)
+	{
+		cpu_workers = 1;
+	}
+	
 	clear_screen();
 	
 	/*
@@ -3415,17 +5977,34 @@ int main(int argc, char *argv[])
 		 */		
 		fclose(bmp_file);
 		
-		/*
-		 * Allocate a Common Memory Area Equal to the Size of the Clear Image Data (No Headers) Along with the Required Padding.
-		 * common_load is the Pointer where All Threads will Copy the Image from.
-		 */
-		common_load = (uint8_t *)malloc(bitmap_info_header.width * bitmap_info_header.height * 4);
+		if(load_mode == LOAD_MODE_COPY)
+		{
+			/*
+			 * Allocate a Common Memory Area Equal to the Size of the Clear Image Data (No Headers) Along with the Required Padding.
+			 * common_load is the Pointer where All Threads will Copy the Image from.
+			 */
+			common_load = (uint8_t *)malloc(bitmap_info_header.width * bitmap_info_header.height * 4);
 
+			
+			/*
+			 * Call the load_bmp() Function to Load the Image to a Common Memory		 
+			 */			
+			status = load_bmp(common_load);
+		}
+		else
+		{
+			/*
+			 * Call the map_bmp() Function to Memory Map the Image File so that each Thread Can Stage the Image Directly to its Pre Process Kernel Memory.
+			 */
+			status = map_bmp();
+		}
 		
-		/*
-		 * Call the load_bmp() Function to Load the Image to a Common Memory		 
-		 */			
-		status = load_bmp(common_load);
+		if(status == FAILURE)
+		{
+			printf("Loading the Image File [FAILURE]\n");
+			
+			return FAILURE;
+		}
 
 
 		/*
@@ -3537,9 +6116,13 @@ int main(int argc, char *argv[])
 		munmap(shared_kernel_address, 128 * KBYTE);
 
 		/*
-		 * Free the Allocated Common Memory
+		 * Free the Allocated Common Memory or Unmap the Image File Depending on the load_mode.
 		 */
 		free(common_load);
+		
+		common_load = NULL;
+		
+		unmap_bmp();
 
 		/*
 		 * Close the pcie_bar_0_mmap_file and pcie_bar_1_mmap_file Files that where Opened when we Previously Called pcie_bar_mmap().
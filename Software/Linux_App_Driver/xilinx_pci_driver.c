@@ -39,6 +39,8 @@
 #include <linux/interrupt.h>
 #include <linux/debugfs.h>
 #include <linux/sched.h>
+#include <linux/poll.h>
+#include <linux/math64.h>
 
 
 /**
@@ -69,7 +71,7 @@ char driver_name[]= "isca_pcie_driver";
 /*
  * The Semaphores that are Used to Explicitly Lock Part of the Code to a Thread.
  */
-struct rw_semaphore ioctl_sem;
+struct rw_semaphore allocation_sem;
 
 struct rw_semaphore case_0_sem;
 struct rw_semaphore case_1_sem;
@@ -91,6 +93,7 @@ struct rw_semaphore msi_8_sem;
 struct rw_semaphore set_pages_sem;
 struct rw_semaphore unmap_pages_sem;
 struct rw_semaphore sg_sem;
+struct rw_semaphore ring_sem;
 struct rw_semaphore write_sem;
 
 struct rw_semaphore search_element_sem;
@@ -106,6 +109,27 @@ struct rw_semaphore post_process_mmap_sem;
  */
 wait_queue_head_t ioctl_queue;
 
+/*
+ * The completion_queue is Used to Queue the Userspace Threads that Wait (through the poll() File Operation) for their Acceleration to Complete.
+ * It is Woken Up by the Threaded Interrupt Handlers after they Update the accel_completed Mask of the Thread that Occupied the Acceleration Group.
+ */
+wait_queue_head_t completion_queue;
+
+/*
+ * The Acceleration Groups AGD0, AGD1, AGI0, AGI1, AGI2 and AGI3 can, also, Process Jobs that the Userspace Threads Queue in their Submission Rings.
+ * The Arrays Below are Indexed in the Same Order as the segment_rows Array of the xilinx_pci_driver_unlocked_ioctl() and they are Protected by the ring_sem Semaphore.
+ * 
+ * --> ring_group_active Indicates that the Acceleration Group is Currently Processing a Ring Job.
+ * --> ring_group_owner Points to the Node of the Thread that Queued the Ring Job or is NULL if the Acceleration Group is Quarantined (See accel_ring_shutdown()).
+ * --> ring_group_job_id Keeps the job_id of the Ring Job so that it Can be Returned in the Completion Ring.
+ * 
+ * The ring_last_pid is the PID of the Thread whose Ring Job was Dispatched Last so that the Rings of the Threads are Served in Round Robin.
+ */
+int ring_group_active[RING_ACCELERATION_GROUPS];
+struct pid_reserved_memories *ring_group_owner[RING_ACCELERATION_GROUPS];
+u32 ring_group_job_id[RING_ACCELERATION_GROUPS];
+pid_t ring_last_pid = 0;
+
 /*
  * BAR0, BAR1 and BAR2 64 Bit Hardware/Physical Addresses.
  */
@@ -167,6 +191,49 @@ int driver_major_number = 240;
  */
 short int signal_to_pid;
 
+/*
+ * Used to Enable/Disable the Collection of the Per Job Metrics of the Acceleration Groups at Runtime (Module Parameter).
+ * When Cleared the Interrupt Handlers do not Read the Metrics of the Completed Acceleration Group from the FPGA BRAM.
+ */
+int collect_metrics = 1;
+
+/*
+ * The Allocation Policy (ALLOCATION_POLICY_*) that is Used for the Requests that do not Select their own Policy (Module Parameter).
+ * Its Initial Value is Set by the GREEDY/BEST_AVAILABLE Switch of the xilinx_pci_driver.h Header File.
+ */
+#ifdef GREEDY
+int allocation_policy = ALLOCATION_POLICY_GREEDY;
+#else
+int allocation_policy = ALLOCATION_POLICY_BEST_AVAILABLE;
+#endif
+
+/*
+ * The Number of Image Pixels from which the Size Aware Policy Splits an Image to Multiple Acceleration Groups (Module Parameter).
+ */
+int size_aware_split_pixels = SIZE_AWARE_SPLIT_PIXELS;
+
+/*
+ * The Number of Threads that Currently Have the Driver File Open.
+ * Used by the Fair Share Policy and Protected by the search_element_sem Semaphore.
+ */
+int open_threads = 0;
+
+/*
+ * Used to Enable/Disable the Split of the Image Rows in Proportion to the Measured Throughput of the Acceleration Groups (Module Parameter).
+ * When Cleared the Image Rows are Split Evenly.
+ */
+int weighted_split = 1;
+
+/*
+ * The accel_group_throughput Array Keeps the Measured Throughput of each Acceleration Group (Indexed as the segment_group Array)
+ * in Bytes per 256 Cycles of the FPGA's Shared Timer.
+ * It is Updated with a Moving Average by the Interrupt Handlers and it Starts Equal for all the Acceleration Groups so that the Rows are Split Evenly until the First Measurements.
+ * 
+ * The accel_group_segment_bytes Array Keeps the Size in Bytes of the Last Segment that was Given to each Acceleration Group.
+ */
+u32 accel_group_throughput[ACCELERATION_GROUPS] = { [0 ... ACCELERATION_GROUPS - 1] = THROUGHPUT_INITIAL };
+u64 accel_group_segment_bytes[ACCELERATION_GROUPS];
+
 /*
  * Used to Indicate the Head of a Singly Linked List with Nodes of Type struct pid_reserved_memories.
  * 
@@ -193,6 +260,33 @@ static struct pid_reserved_memories *pid_list_head = NULL;
  */
 static struct pid_reserved_memories *pid_list_mover = NULL;
 
+/*
+ * The pid_hash_table is Used to Find the Node of a Thread by its PID without Searching the Whole Singly Linked List.
+ * Each Bucket Chains the Nodes whose PIDs Have the Same Lower Bits through their next_hash_pid Pointer.
+ * 
+ * The MMap File Operations are Made on the Debugfs Files rather than the Driver File so they Cannot Use the private_data of the Driver File to Get the Node.
+ * 
+ * The Singly Linked List and the pid_hash_table are Protected by the search_element_sem Semaphore.
+ */
+static struct pid_reserved_memories *pid_hash_table[PID_HASH_BUCKETS];
+
+/*
+ * The accel_group_owner Array Points to the Node of the Thread that Occupied each Acceleration Group through the COMMAND_REQUEST_ACCELERATOR_ACCESS Case.
+ * It is Indexed in the Same Order as the ACCELERATOR_*_OCCUPIED Flags (AGD0, AGD1, AGI0, AGI1, AGI2, AGI3, AGSG) and it is Protected by the allocation_sem Semaphore.
+ * 
+ * The Interrupt Handlers Use it to Get the Node of the Thread that Occupied the Acceleration Group that Completed.
+ */
+struct pid_reserved_memories *accel_group_owner[ACCELERATION_GROUPS];
+
+/*
+ * The sg_bram_registration Points to the Registered Memories (See accel_sg_register()) whose Scatter/Gather Lists are Currently Stored in the FPGA BRAM
+ * and the sg_bram_source_pages and sg_bram_destination_pages are the Number of Pages of each List that were Written.
+ * They are Protected by the sg_sem Semaphore and Let the COMMAND_REQUEST_ACCELERATOR_SG_ACCESS Case Skip Rewriting the Same Lists to the FPGA BRAM.
+ */
+struct sg_registration *sg_bram_registration;
+int sg_bram_source_pages;
+int sg_bram_destination_pages;
+
 /*
  * Used to Point to an Offset of the FPGA's BRAM where the Scatter/Gather List of the Userspace Source Memory will be Stored.
  */
@@ -232,6 +326,43 @@ void write_remote_register(u64 *, u64, u32);
 u32 read_remote_register(u64 *, u64);
 int setup_and_send_signal(u8 signal, pid_t pid);
 
+u32 *accel_ring_busy_flag(int group);
+u32 *accel_ring_occupied_pid(int group);
+int accel_ring_pending(struct pid_reserved_memories *element);
+struct pid_reserved_memories *accel_ring_next_element(void);
+void accel_ring_post_completion(struct pid_reserved_memories *element, u32 job_id, u32 accel_group, u32 status);
+int accel_ring_start_job(int group, struct pid_reserved_memories *element);
+void accel_ring_dispatch(void);
+int accel_ring_complete(int group);
+void accel_ring_kick(void);
+int accel_ring_shutdown(struct pid_reserved_memories *element);
+
+struct pid_reserved_memories *pid_list_lookup(pid_t pid);
+
+void accel_copy_metrics(struct metrics *destination, struct metrics *source);
+
+int accel_resolve_policy(unsigned long requested_policy, struct pid_reserved_memories *element);
+int accel_policy_max_groups(int policy);
+void accel_weight_segments(int rows, int segments, int *segment_group, int *segment_rows);
+void accel_calibrate_group(int group, struct metrics *source);
+u32 accel_packed_output(struct pid_reserved_memories *element);
+u32 accel_input_format(struct pid_reserved_memories *element);
+u32 accel_output_format(struct pid_reserved_memories *element);
+u32 accel_row_bytes(struct pid_reserved_memories *element, u32 columns, int destination);
+u32 accel_input_row_bytes(struct pid_reserved_memories *element);
+u32 accel_output_row_bytes(struct pid_reserved_memories *element);
+int accel_sg_pages(u64 bytes);
+int accel_sg_job_pages(struct pid_reserved_memories *element, int destination);
+void accel_set_filter(u64 sobel_filter_offset, struct pid_reserved_memories *element);
+
+int accel_sg_map_buffer(struct sg_buffer *buffer, unsigned long address, int pages);
+void accel_sg_unmap_buffer(struct sg_buffer *buffer, int dirty);
+int accel_sg_extent_count(struct sg_buffer *buffer, int pages);
+struct sg_registration *accel_sg_lookup(struct pid_reserved_memories *element, int handle);
+int accel_sg_register(struct pid_reserved_memories *element, struct sg_list_addresses *addresses);
+int accel_sg_unregister(struct pid_reserved_memories *element, int handle);
+void accel_sg_unregister_all(struct pid_reserved_memories *element);
+
 
 /**
   **********************************************************************
@@ -258,13 +389,6 @@ int xilinx_pci_driver_open(struct inode *inode, struct file *file_pointer)
 	 */
 	struct pid_reserved_memories *new_element = NULL;
 	
-	/*
-	 * Pointer of Type struct pid_reserved_memories.
-	 * Used to Access the Singly Linked List where each Node Hold Metrics Information and Pointers for each Userspace Application.
-	 */	
-	struct pid_reserved_memories *search_element = NULL;
-	
-	
 	#ifdef DEBUG_MESSAGES
 	printk(KERN_ALERT "[%s-DBG -> MAIN OPEN (PID %d)] Opening Main Driver Module\n", driver_name, current->pid);
 	#endif
@@ -338,6 +462,11 @@ int xilinx_pci_driver_open(struct inode *inode, struct file *file_pointer)
 		inter_process_shared_info_memory->shared_status_flags.agi2_busy = 0;
 		inter_process_shared_info_memory->shared_status_flags.agi3_busy = 0;
 		inter_process_shared_info_memory->shared_status_flags.agsg_busy = 0;
+		
+		/*
+		 * Clear the waiting_requests Counter of the Threads that Sleep until an Acceleration Group is Released.
+		 */
+		inter_process_shared_info_memory->shared_status_flags.waiting_requests = 0;
 
 		/*
 		 * Write a Start Value to the Data Register of the GPIO_PCIE_INTERRUPT Peripheral of the FPGA through the PCIe Bus to Start the Shared Timer (Shared APM).
@@ -370,6 +499,8 @@ int xilinx_pci_driver_open(struct inode *inode, struct file *file_pointer)
 		printk(KERN_ALERT "[%s-DBG -> MAIN OPEN (PID %d)] Failed to Create Element Structure\n", driver_name, current->pid);
 		#endif
 		
+		up_write(&main_open_sem);
+		
 		return FAILURE;
 	}
 		
@@ -377,8 +508,8 @@ int xilinx_pci_driver_open(struct inode *inode, struct file *file_pointer)
 	 * Set the new Node's Process ID Value to be the Current Thread's Process ID.
 	 * 
 	 * At this Point we Have Created a new Node that Can be Identified by the PID that Belongs to the Current Thread.
-	 * When the Current Thread Requires to Access the Structure Fields of Its Node it Should Look the Singly Linked List
-	 * to Find the Node with the Same PID Value as the PID of the Thread.
+	 * When the Current Thread Requires to Access the Structure Fields of Its Node it Gets the Node from the private_data of its Driver File
+	 * or, in the MMap File Operations, from the pid_hash_table by the PID of the Thread.
 	 */
  	new_element->pid = current->pid;
  	
@@ -389,7 +520,21 @@ int xilinx_pci_driver_open(struct inode *inode, struct file *file_pointer)
 	new_element->shared_repo_physical_address = 0;
 	new_element->pre_process_mmap_virtual_address = NULL;
 	new_element->post_process_mmap_virtual_address = NULL;
+	new_element->ring_enabled = 0;
+	new_element->ring_in_flight = 0;
+	new_element->ring_submission_head = 0;
+	new_element->ring_completion_tail = 0;
+	memset(new_element->sg_registrations, 0, sizeof(new_element->sg_registrations));
+	new_element->sg_active_registration = NULL;
+	new_element->sg_active_destination_pages = 0;
+	new_element->previous_pid = NULL;
 	new_element->next_pid = NULL;
+	new_element->next_hash_pid = NULL;
+
+	/*
+	 * Lock the search_element_sem Semaphore so that the Singly Linked List and the pid_hash_table are not Accessed while the new Node is Inserted.
+	 */
+	down_write(&search_element_sem);
 
 	/*
 	 * This if-else Condition is where the new Node is Inserted to the Singly Linked List.
@@ -424,42 +569,30 @@ int xilinx_pci_driver_open(struct inode *inode, struct file *file_pointer)
 		 * Set the next_pid Pointer (which is a Structure Field of the pid_list_mover Pointer) to Point at the new Node.
 		 * This Way the new Node is Inserted in the Tail of the Singly Linked List.
 		 */
+		new_element->previous_pid = pid_list_mover;
 		pid_list_mover->next_pid = new_element;
 		pid_list_mover = new_element;
 		 
 	 }
 	 
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */	 
-	search_element = pid_list_head;
-	 
+	 * Insert the new Node at the Head of its pid_hash_table Bucket so that the MMap File Operations Can Find it by the PID of the Current Thread.
+	 */
+	new_element->next_hash_pid = pid_hash_table[new_element->pid & PID_HASH_MASK];
+	pid_hash_table[new_element->pid & PID_HASH_MASK] = new_element;
+	
+	open_threads++;
+	
 	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 * 
-	 * The Reason for Searching the Singly Linked List at this Point is to Validate that we Have Successfully Inserted the New Node.
-	 */	 
-	while(search_element != NULL)
-	{
-		
-		/*
-		 * Check if the Current Node's PID Value is Equal to the Current Userspace Thread's PID.
-		 * If this is the Case then we Have Validated that the Node is Successfully Inserted in the Singly Linked List.
-		 */		
-		if(search_element->pid == current->pid)
-		{
-			#ifdef DEBUG_MESSAGES
-			printk(KERN_ALERT "[%s-DBG -> MAIN OPEN (PID %d)] Adding the New Element is Validated\n", driver_name, current->pid);
-			#endif
-			
-			break;
-		}
-		 
-		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */		 
-		search_element = search_element->next_pid;
-	}	
+	 * Unlock the search_element_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+	 */
+	up_write(&search_element_sem);
+	
+	/*
+	 * Store the new Node in the private_data of the Driver File.
+	 * The Rest File Operations (IOCtl, Poll, Release) of the Current Thread on the Driver File Get the Node from there without Searching the Singly Linked List.
+	 */
+	file_pointer->private_data = new_element;
 	
 	/*
 	 * Unlock the main_open_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
@@ -483,18 +616,22 @@ int xilinx_pci_driver_release(struct inode *inode, struct file *file_pointer)
 {
 	/*
 	 * Pointer of Type struct pid_reserved_memories.
-	 * Used to Access the Singly Linked List where each Node Hold Metrics Information and Pointers for each Userspace Application.
+	 * Used to Access the Node of the Current Thread which was Stored in the private_data of the Driver File when the Thread Opened the Driver File.
 	 */		
 	struct pid_reserved_memories *search_element = NULL;
 	
 	/*
-	 * Pointer of Type struct pid_reserved_memories.
-	 * Used when Removing a Node in Order to Connect the Previous and the Next Nodes of the Removed Node.
-	 */		
-	struct pid_reserved_memories *previous_element = NULL;
+	 * Pointer to the Pointer that Links to the Current Node inside its pid_hash_table Bucket.
+	 * Used when Removing the Node from the pid_hash_table.
+	 */
+	struct pid_reserved_memories **hash_link = NULL;
+	
+	int group;
 	
-	int validate = 0;
-	int check_elements = 0;
+	/*
+	 * Set to 1 if an Acceleration Group that Timed Out while Processing a Ring Job of the Current Thread was Quarantined.
+	 */
+	int ring_quarantined = 0;
 	
 	/*
 	 * Lock the main_release_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
@@ -502,181 +639,152 @@ int xilinx_pci_driver_release(struct inode *inode, struct file *file_pointer)
 	down_write(&main_release_sem);
 
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
+	 * Get the Node of the Current Thread from the private_data of the Driver File.
 	 */	 
-	search_element = pid_list_head;
+	search_element = (struct pid_reserved_memories *)file_pointer->private_data;
 	
-	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 * 
-	 * The Reason for Searching the Singly Linked List at this Point is to Find the Current Thread's Node in Order to Free the Thread's Kernel Resources and Remove the Pointer.
-	 */	 	 
-	 while(search_element != NULL)
-	 {
+	if(search_element != NULL)
+	{
 		/*
-		 * Check if the Current Node's PID Value is Equal to the Current Userspace Thread's PID.
-		 * If this is the Case we Can Proceed to Removing the Node from the Singly Linked List.
-		 * 
-		 * Else we Set the search_element Pointer to Point at the Next List Node and the previous_element Pointer to Point at the Current List Node.
-		 * As a Result when Moving Forward in the List we Always Know the Previous Node.
-		 */			
-		if(search_element->pid == current->pid)
+		 * Stop Dispatching the Ring Jobs of the Current Thread and Wait for its Ring Jobs that are Still Processed
+		 * so that no Acceleration Group Writes to the Pre-Process Data Kernel Memory after it is Freed Below.
+		 */
+		ring_quarantined = accel_ring_shutdown(search_element);
+		
+		/*
+		 * Unpin the Userspace Memories that the Thread Left Registered for the AGSG.
+		 * This is Done before the Node is Detached from the AGSG so that the irq_handler_6() Can Still Complete a Job of the Thread that is in Progress.
+		 */
+		accel_sg_unregister_all(search_element);
+		
+		/*
+		 * Detach the Current Node from any Acceleration Group that it Still Occupies so that the Interrupt Handlers do not Access the Node after it is Freed.
+		 */
+		down_write(&allocation_sem);
+		
+		for(group = 0; group < ACCELERATION_GROUPS; group++)
 		{
-			/*
-			 * If the Node that we Want to Remove is the Head of the List then we Should Set the Next Node as the Head of the List before Removing the Current Node.
-			 * 
-			 * Else we Should Set the Previous Node to Point at the Next Node of the Current Node that we are about to Remove.
-			 */
-			if(search_element == pid_list_head)
-			{
-				/*
-				 * Set the pid_list_head Pointer to Point at the Next Node (search_element->next_pid).
-				 */
-				pid_list_head = search_element->next_pid;		
-			}
-			else
+			if(accel_group_owner[group] == search_element)
 			{
-				/*
-				 * Set the Previous Node's next_pid Pointer to Point at the Current Node's next_pid Pointer which Actually Points at the Next Node of the Current Node.
-				 * As a Result we Connect the Previous and the Next Node of the Current Node.
-				 */
-				previous_element->next_pid = search_element->next_pid;
-			}
-			
-			/*
-			 * If the Current Node's pre_process_mmap_virtual_address Pointer is not NULL then it Points to a Kernel Memory Allocation.
-			 * This Kernel Memory Allocation Belongs to the Current Thread and we Should Free it with dma_free_coherent() Since it will no Longer be Required.
-			 */
-			if(search_element->pre_process_mmap_virtual_address != NULL)
-			{
-				dma_free_coherent(&dev->dev, MMAP_ALLOCATION_SIZE, search_element->pre_process_mmap_virtual_address, search_element->pre_process_mmap_physical_address);
-				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> MAIN RELEASE (PID %d)] Pre Process MMAP Memory Freed\n", driver_name, current->pid);
-				#endif
-			}
-			
-			/*
-			 * If the Current Node's post_process_mmap_virtual_address Pointer is not NULL then it Points to a Kernel Memory Allocation.
-			 * This Kernel Memory Allocation Belongs to the Current Thread and we Should Free it with dma_free_coherent() Since it will no Longer be Required.
-			 */			
-			if(search_element->post_process_mmap_virtual_address != NULL)
-			{				
-				dma_free_coherent(&dev->dev, MMAP_ALLOCATION_SIZE, search_element->post_process_mmap_virtual_address, search_element->post_process_mmap_physical_address);
-				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> MAIN RELEASE (PID %d)] Post Process MMAP Memory Freed\n", driver_name, current->pid);
-				#endif					
-			}
-			
-			/*
-			 * If the Current Node's shared_repo_virtual_address Pointer is not NULL then it Points to a Kernel Memory Allocation.
-			 * This Kernel Memory Allocation Belongs to the Current Thread and we Should Free it with dma_free_coherent() Since it will no Longer be Required.
-			 */			
-			if(search_element->shared_repo_virtual_address != NULL)
-			{				
-				dma_free_coherent(&dev->dev, MMAP_ALLOCATION_SIZE, search_element->shared_repo_virtual_address, search_element->shared_repo_physical_address);
-				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> MAIN RELEASE (PID %d)] Shared Repo MMAP Memory Freed\n", driver_name, current->pid);
-				#endif					
+				accel_group_owner[group] = NULL;
 			}
-
-			/*
-			 * Free the Memory Allocation where the Current Node was Stored which Results in Removing the Current Node.
-			 */
-			kfree(search_element);
+		}
 		
+		up_write(&allocation_sem);
 		
+		/*
+		 * Lock the search_element_sem Semaphore so that the Singly Linked List and the pid_hash_table are not Accessed while the Node is Removed.
+		 */
+		down_write(&search_element_sem);
+
+		/*
+		 * If the Node that we Want to Remove is the Head of the List then we Should Set the Next Node as the Head of the List before Removing the Current Node.
+		 * 
+		 * Else we Should Set the Previous Node to Point at the Next Node of the Current Node that we are about to Remove.
+		 */
+		if(search_element->previous_pid == NULL)
+		{
 			/*
-			 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-			 */		
-			search_element = pid_list_head;
-			
-	 	 	/*
-			 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-			 * 
-			 * The Reason for Searching the Singly Linked List at this Point is to Validate that we Have Successfully Removed the New Node.
-			 */	
-			while(search_element != NULL)
-			{
-				
-				/*
-				 * Check if the Current Node's PID Value is Equal to the Current Userspace Thread's PID.
-				 * If this is the Case then the Node is Still Present so Increment the Value of the validate Variable to Indicate the Presence of the Node.
-				 */					
-				if(search_element->pid == current->pid)
-				{
-					validate++;
-				}
-				 
-				/*
-				 * Set the search_element Pointer to Point at the Next List Node.
-				 */						 
-				search_element = search_element->next_pid;
-			}
-			
-			/*
-			 * If the Value of the validate Variable is Zero then the Node was not Found in the List.
+			 * Set the pid_list_head Pointer to Point at the Next Node (search_element->next_pid).
 			 */
-			if(validate == 0)
-			{
-				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> MAIN RELEASE (PID %d)] Deleting Current Element is Validated\n", driver_name, current->pid);
-				#endif
-
-			}			
-			
+			pid_list_head = search_element->next_pid;		
 		}
 		else
 		{
 			/*
-			 * Set the previous_element Pointer to Point at the Current Node.
+			 * Set the Previous Node's next_pid Pointer to Point at the Current Node's next_pid Pointer which Actually Points at the Next Node of the Current Node.
+			 * As a Result we Connect the Previous and the Next Node of the Current Node.
 			 */
-			previous_element = search_element;
+			search_element->previous_pid->next_pid = search_element->next_pid;
+		}
+		
+		/*
+		 * If the Node that we Want to Remove is the Tail of the List then the pid_list_mover Pointer Should Point at the Previous Node
+		 * so that the Next Node is Inserted after a Node that is Still in the List.
+		 * 
+		 * Else the Next Node Should Point Back at the Previous Node of the Current Node.
+		 */
+		if(search_element->next_pid == NULL)
+		{
+			pid_list_mover = search_element->previous_pid;
+		}
+		else
+		{
+			search_element->next_pid->previous_pid = search_element->previous_pid;
+		}
+		
+		/*
+		 * Remove the Current Node from its pid_hash_table Bucket.
+		 */
+		hash_link = &pid_hash_table[search_element->pid & PID_HASH_MASK];
+		
+		while(*hash_link != NULL)
+		{
+			if(*hash_link == search_element)
+			{
+				*hash_link = search_element->next_hash_pid;
+				
+				break;
+			}
 			
-			/*
-			 * Set the search_element Pointer to Point at the Next List Node.
-			 */				
-			search_element = search_element->next_pid;
+			hash_link = &(*hash_link)->next_hash_pid;
 		}
-		 		
-	}	
-	
-
-	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */		 	
-	search_element = pid_list_head;
-	 	
-	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 * 
-	 * The Reason for Searching the Singly Linked List at this Point is to Check if there are any Left Nodes in the Singly Linked List.
-	 * If the List is Empty then we Should Clean the pid_list_head Pointer.
-	 */	 	 
-	while(search_element != NULL)
-	{
+		
+		open_threads--;
+		
 		/*
-		 * If the search_element Pointer is not NULL then we Have Nodes in the List so Increment the check_elements Variable.
+		 * Unlock the search_element_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
 		 */
-		if(search_element != NULL)
+		up_write(&search_element_sem);
+		
+		/*
+		 * If the Current Node's pre_process_mmap_virtual_address Pointer is not NULL then it Points to a Kernel Memory Allocation.
+		 * This Kernel Memory Allocation Belongs to the Current Thread and we Should Free it with dma_free_coherent() Since it will no Longer be Required.
+		 * 
+		 * It is Leaked on Purpose if a Quarantined Acceleration Group May Still Read or Write it.
+		 */
+		if(search_element->pre_process_mmap_virtual_address != NULL && ring_quarantined == 0)
 		{
-			check_elements++;
+			dma_free_coherent(&dev->dev, MMAP_ALLOCATION_SIZE, search_element->pre_process_mmap_virtual_address, search_element->pre_process_mmap_physical_address);
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> MAIN RELEASE (PID %d)] Pre Process MMAP Memory Freed\n", driver_name, current->pid);
+			#endif
 		}
-		 
+		
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */			 
-		search_element = search_element->next_pid;
-	}
-	
-	/*
-	 * If the check_elements Variable Has Zero Value then the Singly Linked List is Empty.
-	 */
-	if(check_elements == 0)
-	{
+		 * If the Current Node's post_process_mmap_virtual_address Pointer is not NULL then it Points to a Kernel Memory Allocation.
+		 * This Kernel Memory Allocation Belongs to the Current Thread and we Should Free it with dma_free_coherent() Since it will no Longer be Required.
+		 */			
+		if(search_element->post_process_mmap_virtual_address != NULL)
+		{				
+			dma_free_coherent(&dev->dev, MMAP_ALLOCATION_SIZE, search_element->post_process_mmap_virtual_address, search_element->post_process_mmap_physical_address);
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> MAIN RELEASE (PID %d)] Post Process MMAP Memory Freed\n", driver_name, current->pid);
+			#endif					
+		}
+		
+		/*
+		 * If the Current Node's shared_repo_virtual_address Pointer is not NULL then it Points to a Kernel Memory Allocation.
+		 * This Kernel Memory Allocation Belongs to the Current Thread and we Should Free it with dma_free_coherent() Since it will no Longer be Required.
+		 */			
+		if(search_element->shared_repo_virtual_address != NULL)
+		{				
+			dma_free_coherent(&dev->dev, MMAP_ALLOCATION_SIZE, search_element->shared_repo_virtual_address, search_element->shared_repo_physical_address);
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> MAIN RELEASE (PID %d)] Shared Repo MMAP Memory Freed\n", driver_name, current->pid);
+			#endif					
+		}
+
 		/*
-		 * Clear the pid_list_head Pointer.
+		 * Free the Memory Allocation where the Current Node was Stored which Results in Removing the Current Node.
 		 */
-		pid_list_head = NULL;
+		kfree(search_element);
+		
+		file_pointer->private_data = NULL;
+		
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> MAIN RELEASE (PID %d)] Current Element is Deleted\n", driver_name, current->pid);
+		#endif
 	}
 
 	/*
@@ -713,9 +821,20 @@ long xilinx_pci_driver_unlocked_ioctl(struct file *file_pointer, unsigned int co
 	
 /*
  * Pointer of Type struct sg_list_addresses.
- * Used to Point to a Userspace Memory Allocation where the Pointers to the Userspace Source and Destination Memories are Stored.
+ * Used to Point to the Kernel Copy of the Structure where the Pointers to the Userspace Source and Destination Memories are Stored.
  */	
 struct sg_list_addresses *sg_list_src_dst_addresses;	
+
+/*
+ * Used by the COMMAND_SET_PAGES and COMMAND_REGISTER_PAGES Cases to Copy the struct sg_list_addresses of the Current Thread and by the COMMAND_REQUEST_ACCELERATOR_SG_ACCESS Case
+ * to Hold the Registration that the AGSG will Use and the Number of Pages and Extents of the Image.
+ */
+struct sg_list_addresses sg_registration_request;
+struct sg_registration *sg_registration = NULL;
+int sg_source_pages;
+int sg_destination_pages;
+int sg_source_extents;
+int sg_destination_extents;
 	
 /*
  * Pointer of Type struct pid_reserved_memories.
@@ -798,6 +917,12 @@ int remaining_rows = 0;
  */
 int segment_rows[6];
 
+/*
+ * The segment_group Array Has the Index (0 for AGD0 to 5 for AGI3 and 6 for AGSG) of the Acceleration Group that will Process each Segment.
+ * It is Filled in the Same Order as the segment_rows Array.
+ */
+int segment_group[ACCELERATION_GROUPS];
+
 /*
  * The segment_count Variable is Used to Access the Fields of the segment_rows Array.
  */
@@ -809,9 +934,19 @@ int segment_count = 0;
 int segment_offset = 0;
 
 /*
- * Lock the ioctl_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+ * The policy Variable is the Allocation Policy (ALLOCATION_POLICY_*) that is Applied to the Current Request for Acceleration Groups.
+ */
+int policy = 0;
+
+/*
+ * The max_groups Variable is the Maximum Number of Acceleration Groups that the Current Request Can Occupy Depending on its Allocation Policy.
+ */
+int max_groups = 0;
+
+/*
+ * The allocation_locked Flag Indicates whether the Current Thread Still Holds the allocation_sem Semaphore in the COMMAND_REQUEST_ACCELERATOR_ACCESS Case.
  */
-down_write(&ioctl_sem);
+int allocation_locked = 0;
 
 switch(command)
 {
@@ -821,1658 +956,1123 @@ switch(command)
 	case COMMAND_REQUEST_ACCELERATOR_ACCESS:
 
 		/*
-		 * The wait_event_interruptible() Puts a Process to Sleep Until a Condition Evaluates to True.
-		 * 
-		 * In this Case the Driver Checks in the Below Condition if any of the agd0_busy, agd1_busy, agi0_busy, agi1_busy, agi2_busy, agi3_busy, agsg_busy Flags Has Zero Value 
-		 * which Means that there is at Least one Acceleration Group that is not Busy(not Occupied).
-		 * 
-		 * If the Condition Returns Non-Zero Value then the Process will be Set to Sleep and Put in a Wait Queue.
-		 * Once a Wake Up Call Takes Place in the Future the Condition will be Re-evaluated.
-		 * 
-		 * If the Condition Below Validates that there is at Least One Acceleration Group Available then the Userspace Thread Can Proceed to Request Acceleration.
+		 * The AGD0, AGD1, AGI0, AGI1, AGI2 and AGI3 Process the Image in Place inside the Pre-Process Data Kernel Memory of the Current Thread.
+		 * If the Image does not Fit in it (e.g. a 3840x2160 Image) the Request is Rejected before the Thread Waits for an Acceleration Group
+		 * so that the DMAs never Access the Host Memory beyond the Pre-Process Data Kernel Memory.
+		 * Such Images are Processed in Row Bands through the Submission Ring (See tiled_acceleration() of the ui.cpp).
 		 */
-		wait_event_interruptible(ioctl_queue, (inter_process_shared_info_memory->shared_status_flags.agd0_busy &
-											   inter_process_shared_info_memory->shared_status_flags.agd1_busy &
-											   inter_process_shared_info_memory->shared_status_flags.agi0_busy &
-											   inter_process_shared_info_memory->shared_status_flags.agi1_busy &
-											   inter_process_shared_info_memory->shared_status_flags.agi2_busy &
-											   inter_process_shared_info_memory->shared_status_flags.agi3_busy &
-											   inter_process_shared_info_memory->shared_status_flags.agsg_busy) == 0);
-			
-		#ifdef DEBUG_MESSAGES
-		printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] New Process Request for Acceleration Group\n", driver_name, current->pid);
-		#endif	
+		search_element = (struct pid_reserved_memories *)file_pointer->private_data;
 		
+		if(search_element != NULL && (u64)search_element->shared_repo_virtual_address->shared_image_info.rows * accel_input_row_bytes(search_element) > MMAP_ALLOCATION_SIZE)
+		{
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] The Image does not Fit in the Pre-Process Data Kernel Memory\n", driver_name, current->pid);
+			#endif
+			
+			return(FAILURE);
+		}
+
 		/*
-		 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-		 */	 		
-		search_element = pid_list_head;
-	
+		 * Lock the allocation_sem Semaphore so that only the Current Userspace Thread can Read and Claim the Busy Flags of the Acceleration Groups.
+		 * 
+		 * The allocation_sem Semaphore is Held Only while the Acceleration Groups are Chosen and Claimed.
+		 * The Setup of each Claimed Acceleration Group is Done Later under the case_X_sem Semaphore of the Specific Acceleration Group
+		 * so that Threads of Different Processes that Occupy Different Acceleration Groups do not Serialize Against each Other.
+		 */
+		down_write(&allocation_sem);
+		
+		allocation_locked = 1;
+
 		/*
-		 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
+		 * In this Case the Driver Checks in the Below Condition if all of the agd0_busy, agd1_busy, agi0_busy, agi1_busy, agi2_busy, agi3_busy, agsg_busy Flags Have Value 1
+		 * which Means that there is no Acceleration Group that is not Busy(not Occupied).
 		 * 
-		 * The Reason for Searching the Singly Linked List at this Point is to Find the List Node that Belongs to the Current Userspace Thread.
-		 * The Structure Fields of the Current Thread's Node will be Needed During the Acceleration Procedure.
-		 */			 
-		 while(search_element != NULL)
-		 {
-			/*
-			 * Check if the Current Node's PID Value is Equal to the Current Userspace Thread's PID.
-			 * If this is the Case then we Can Proceed to Request an Acceleration Group.
-			 */				
-			if(search_element->pid == current->pid)
+		 * If this is the Case then the allocation_sem Semaphore is Unlocked and the wait_event_interruptible() Puts the Process to Sleep Until at Least one Acceleration Group is Released.
+		 * The allocation_sem Semaphore Must not be Held while Sleeping since the Rest Threads Need it in Order to Claim or Release Acceleration Groups.
+		 * 
+		 * Once the Process Wakes Up it Locks the allocation_sem Semaphore Again and Re-evaluates the Condition since Another Thread May have Claimed the Released Acceleration Group First.
+		 * If the Sleep is Interrupted by a Signal then the IOCtl Returns -ERESTARTSYS without Having Claimed any Acceleration Group.
+		 * 
+		 * The waiting_requests Counter is Incremented and Decremented while Holding the allocation_sem Semaphore
+		 * so that the Userspace Threads Can Read how Many Requests are Queued before their own.
+		 */
+		while((inter_process_shared_info_memory->shared_status_flags.agd0_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agd1_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agi0_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agi1_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agi2_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agi3_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agsg_busy) != 0)
+		{
+			inter_process_shared_info_memory->shared_status_flags.waiting_requests++;
+			
+			up_write(&allocation_sem);
+			
+			if(wait_event_interruptible(ioctl_queue, (inter_process_shared_info_memory->shared_status_flags.agd0_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agd1_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agi0_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agi1_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agi2_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agi3_busy &
+									   inter_process_shared_info_memory->shared_status_flags.agsg_busy) == 0))
 			{
-				/*
-				 * This Macro if Condition Encloses Part of the Code that is ONLY Applicable in the Greedy Policy.
-				 * 
-				 * The Greedy Policy Tries to Occupy as many Accelerators as Possible for a Single Image Accelerarion for a Single Userspace Thread.
-				 * This Policy Initially Checks if any of the AGD0, AGD1, AGI0, AGI1, AGI2, AGI3 is Available and Locks all of those that are Found Available.
-				 * If it Fails with the Previous Step then it Checks if the AGSG is Available and Locks it.
-				 * The Reason for this Separation is that the AGSG Requires Special Handling due to Using Scatter/Gather Lists so it Can Only be Used if no Other is Available.
-				 * 
-				 * This Part of the Code is where the Driver Locks the Available Acceleration Groups so that they Can be Occupied ONLY by the Current Thread.
-				 */
-				#ifdef GREEDY	
-				/*
-				 * If this Condition Returns Zero Value then at Least one Acceleration Group from the AGD0, AGD1, AGI0, AGI1, AGI2 or AGI3 is Available for Locking.
-				 * 
-				 * Else Try to Occupy the AGSG.
-				 */			
-				if((inter_process_shared_info_memory->shared_status_flags.agd0_busy &
-				   inter_process_shared_info_memory->shared_status_flags.agd1_busy &
-				   inter_process_shared_info_memory->shared_status_flags.agi0_busy &
-				   inter_process_shared_info_memory->shared_status_flags.agi1_busy &
-				   inter_process_shared_info_memory->shared_status_flags.agi2_busy &
-				   inter_process_shared_info_memory->shared_status_flags.agi3_busy) == 0)
-				{
-					/*
-					 * Check if the agd0_busy Flag has Zero Value which Means that AGD0 is Available.
-					 */
-					if(inter_process_shared_info_memory->shared_status_flags.agd0_busy == 0)
-					{
-						/*
-						 * Set the direct_0_accel Flag as Occupied.
-						 * This Flag will be Used Later to Lock the AGD0 as Occupied.
-						 */
-						direct_0_accel = OCCUPIED;
-						
-						/*
-						 * Increment the Value of the segments Variable.
-						 */
-						segments++;
-					}
-					/*
-					 * Check if the agd1_busy Flag has Zero Value which Means that AGD1 is Available.
-					 */					
-					if(inter_process_shared_info_memory->shared_status_flags.agd1_busy == 0)
-					{
-						/*
-						 * Set the direct_1_accel Flag as Occupied.
-						 * This Flag will be Used Later to Lock the AGD1 as Occupied.
-						 */						
-						direct_1_accel = OCCUPIED;
-						
-						/*
-						 * Increment the Value of the segments Variable.
-						 */						
-						segments++;
-					}
-					/*
-					 * Check if the agi0_busy Flag has Zero Value which Means that AGI0 is Available.
-					 */						
-					if(inter_process_shared_info_memory->shared_status_flags.agi0_busy == 0)
-					{
-						/*
-						 * Set the indirect_0_accel Flag as Occupied.
-						 * This Flag will be Used Later to Lock the AGI0 as Occupied.
-						 */							
-						indirect_0_accel = OCCUPIED;
-						
-						/*
-						 * Increment the Value of the segments Variable.
-						 */						
-						segments++;
-					}
-					/*
-					 * Check if the agi1_busy Flag has Zero Value which Means that AGI1 is Available.
-					 */						
-					if(inter_process_shared_info_memory->shared_status_flags.agi1_busy == 0)
-					{
-						/*
-						 * Set the indirect_1_accel Flag as Occupied.
-						 * This Flag will be Used Later to Lock the AGI1 as Occupied.
-						 */								
-						indirect_1_accel = OCCUPIED;
-						
-						/*
-						 * Increment the Value of the segments Variable.
-						 */						
-						segments++;
-					}	
-					/*
-					 * Check if the agi2_busy Flag has Zero Value which Means that AGI2 is Available.
-					 */						
-					if(inter_process_shared_info_memory->shared_status_flags.agi2_busy == 0)
-					{
-						/*
-						 * Set the indirect_2_accel Flag as Occupied.
-						 * This Flag will be Used Later to Lock the AGI2 as Occupied.
-						 */								
-						indirect_2_accel = OCCUPIED;
-						
-						/*
-						 * Increment the Value of the segments Variable.
-						 */						
-						segments++;
-					}	
-					/*
-					 * Check if the agi3_busy Flag has Zero Value which Means that AGI3 is Available.
-					 */						
-					if(inter_process_shared_info_memory->shared_status_flags.agi3_busy == 0)
-					{
-						/*
-						 * Set the indirect_3_accel Flag as Occupied.
-						 * This Flag will be Used Later to Lock the AGI3 as Occupied.
-						 */								
-						indirect_3_accel = OCCUPIED;
-						
-						/*
-						 * Increment the Value of the segments Variable.
-						 */						
-						segments++;
-					}
-				}
-				/*
-				 * Check if the agsg_busy Flag Has Zero Value which Means that AGSG is Available.
-				 */
-				else if(inter_process_shared_info_memory->shared_status_flags.agsg_busy == 0)
-				{
-					/*
-					 * Set the sg_accel Flag as Occupied.
-					 * This Flag will be Used Later to Lock the AGSG as Occupied.
-					 */						
-					sg_accel = OCCUPIED;
-
-					/*
-					 * Increment the Value of the segments Variable.
-					 */						
-					segments++;
-				}						
-				
-				/*
-				 * The shared_repo_virtual_address Points to the Kernel Memory Allocation which is Used so that the Current Thread Can Explicitly Store
-				 * Metrics Information fot its own Acceleration Procedure.
-				 * 
-				 * Set the image_segments Structure Field of the Current Userspace Thread with the Value of the segments Variable.
-				 */
-				search_element->shared_repo_virtual_address->image_segments = segments;
-								
-				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Assigned Acceleration Group are\n", driver_name, current->pid);
-				#endif	
-				
-				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] AGD0 AGD1 AGI0 AGI1 AGI2 AGI3 AGSG\n", driver_name, current->pid);
-				#endif		
-				
-				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)]    %d    %d    %d    %d    %d    %d    %d\n", driver_name, current->pid, direct_0_accel, direct_1_accel, indirect_0_accel, indirect_1_accel, indirect_2_accel, indirect_3_accel, sg_accel);
-				#endif										
-
-				/*
-				 * Get the Number of Rows that each Acceleration Group Should Process.
-				 */
-				segment_size = search_element->shared_repo_virtual_address->shared_image_info.rows / segments;
+				down_write(&allocation_sem);
+				inter_process_shared_info_memory->shared_status_flags.waiting_requests--;
+				up_write(&allocation_sem);
 				
-				/*
-				 * Get the Remaining Rows (If any)
-				 */
-				remaining_rows = search_element->shared_repo_virtual_address->shared_image_info.rows - (segment_size * segments);
+				return(-ERESTARTSYS);
+			}
+			
+			down_write(&allocation_sem);
+			
+			inter_process_shared_info_memory->shared_status_flags.waiting_requests--;
+		}
+			
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] New Process Request for Acceleration Group\n", driver_name, current->pid);
+		#endif	
+		
+		/*
+		 * Get the Node of the Current Thread from the private_data of the Driver File where it was Stored when the Thread Opened the Driver File.
+		 */
+		search_element = (struct pid_reserved_memories *)file_pointer->private_data;
 
+		if(search_element != NULL)
+		{
+			/*
+			 * Resolve the Allocation Policy of the Current Request.
+			 * 
+			 * The userspace_value of the IOCtl Call Selects the Policy of the Request (ALLOCATION_POLICY_*).
+			 * If it is ALLOCATION_POLICY_DEFAULT then the allocation_policy Module Parameter of the Driver is Used.
+			 * 
+			 * Every Policy Occupies the Available Acceleration Groups in the Below Priority (Best Efficient to Worst Efficient) up to the max_groups Acceleration Groups:
+			 * AGD0 --> AGD1 --> AGI0 --> AGI1 --> AGI2 --> AGI3
+			 * 
+			 * --> The Greedy Policy Occupies as many of the AGD0, AGD1, AGI0, AGI1, AGI2, AGI3 as are Available so that they Process Segments of the Same Image.
+			 * --> The Best Available Policy Occupies a Single Acceleration Group.
+			 * --> The Size Aware Policy Works as Greedy for Images of at Least size_aware_split_pixels Pixels and as Best Available for Smaller Images.
+			 * --> The Fair Share Policy Occupies up to an Equal Share of the AGD0, AGD1, AGI0, AGI1, AGI2, AGI3 for each Thread that Has the Driver File Open.
+			 * 
+			 * If none of the AGD0, AGD1, AGI0, AGI1, AGI2, AGI3 is Available then the AGSG is Occupied.
+			 * The Reason for this Separation is that the AGSG Requires Special Handling due to Using Scatter/Gather Lists so it Can Only be Used if no Other is Available.
+			 * 
+			 * This Part of the Code is where the Driver Locks the Available Acceleration Groups so that they Can be Occupied ONLY by the Current Thread.
+			 */
+			policy = accel_resolve_policy(userspace_value, search_element);
+			
+			max_groups = accel_policy_max_groups(policy);
+			
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Allocation Policy %d for up to %d Acceleration Groups\n", driver_name, current->pid, policy, max_groups);
+			#endif
+			
+			/*
+			 * If this Condition Returns Zero Value then at Least one Acceleration Group from the AGD0, AGD1, AGI0, AGI1, AGI2 or AGI3 is Available for Locking.
+			 * 
+			 * Else Try to Occupy the AGSG.
+			 */			
+			if((inter_process_shared_info_memory->shared_status_flags.agd0_busy &
+			   inter_process_shared_info_memory->shared_status_flags.agd1_busy &
+			   inter_process_shared_info_memory->shared_status_flags.agi0_busy &
+			   inter_process_shared_info_memory->shared_status_flags.agi1_busy &
+			   inter_process_shared_info_memory->shared_status_flags.agi2_busy &
+			   inter_process_shared_info_memory->shared_status_flags.agi3_busy) == 0)
+			{
 				/*
-				 * Repeat for as many Times as the Number of Image Segments.
+				 * Check if the agd0_busy Flag has Zero Value which Means that AGD0 is Available.
 				 */
-				for (repeat = 0; repeat < segments; repeat++) 
+				if(inter_process_shared_info_memory->shared_status_flags.agd0_busy == 0 && segments < max_groups)
 				{
 					/*
-					 * Set the Current Array Field with the Number of Rows that the Corresponding Acceleration Group Should Process.
+					 * Set the direct_0_accel Flag as Occupied.
+					 * This Flag will be Used Later to Lock the AGD0 as Occupied.
 					 */
-					segment_rows[repeat] = segment_size;
+					direct_0_accel = OCCUPIED;
 					
 					/*
-					 * If we Found Remaining Rows then the Acceleration Group of the Current Array Field Should Process One More Row.
+					 * Increment the Value of the segments Variable.
 					 */
-					if (remaining_rows > 0) 
-					{
-						/*
-						 * Decrement the remaining_rows Value.
-						 */
-						remaining_rows--;
-						
-						/*
-						 * Increment the Number of Rows of the Current Array Field by 1.
-						 */
-						segment_rows[repeat]++;
-					}
-				}				
-				#endif
-				
-				
-				/*
-				 * This Macro if Condition Encloses Part of the Code that is ONLY Applicable in the Best Available Policy.
-				 * 
-				 * The Best Available Policy Tries to Occupy a Single Acceleration Group for a Single Image Process for a Single Userspace Thread.
-				 * 
-				 * It Checks to Occupy the First that is Found Available Starting from the Best Efficient to the Worst Efficient with the Below Priority:
-				 * AGD0 --> AGD1 --> AGI0 --> AGI1 --> AGI2 --> AGI3 --> AGSG
-				 * 
-				 * This Part of the Code is where the Driver Locks a Single Available Acceleration Group so that it Can be Occupied ONLY by the Current Thread.
-				 */				
-				#ifdef BEST_AVAILABLE
-				
-				/*
-				 * Check if the agd0_busy Flag has Zero Value which Means that AGD0 is Available.
-				 */				
-				if(inter_process_shared_info_memory->shared_status_flags.agd0_busy == 0)
-				{
-					/*
-					 * Set the direct_0_accel Flag as Occupied.
-					 * This Flag will be Used Later to Lock the AGD0 as Occupied.
-					 */					
-					direct_0_accel = OCCUPIED;
+					segment_group[segments] = 0;
+					segments++;
 				}
 				/*
-				 * Else Check if the agd1_busy Flag has Zero Value which Means that AGD1 is Available.
+				 * Check if the agd1_busy Flag has Zero Value which Means that AGD1 is Available.
 				 */					
-				else if(inter_process_shared_info_memory->shared_status_flags.agd1_busy == 0)
+				if(inter_process_shared_info_memory->shared_status_flags.agd1_busy == 0 && segments < max_groups)
 				{
 					/*
 					 * Set the direct_1_accel Flag as Occupied.
 					 * This Flag will be Used Later to Lock the AGD1 as Occupied.
 					 */						
 					direct_1_accel = OCCUPIED;
+					
+					/*
+					 * Increment the Value of the segments Variable.
+					 */						
+					segment_group[segments] = 1;
+					segments++;
 				}
 				/*
-				 * Else Check if the agi0_busy Flag has Zero Value which Means that AGI0 is Available.
-				 */					
-				else if(inter_process_shared_info_memory->shared_status_flags.agi0_busy == 0)
+				 * Check if the agi0_busy Flag has Zero Value which Means that AGI0 is Available.
+				 */						
+				if(inter_process_shared_info_memory->shared_status_flags.agi0_busy == 0 && segments < max_groups)
 				{
 					/*
 					 * Set the indirect_0_accel Flag as Occupied.
 					 * This Flag will be Used Later to Lock the AGI0 as Occupied.
-					 */						
+					 */							
 					indirect_0_accel = OCCUPIED;
+					
+					/*
+					 * Increment the Value of the segments Variable.
+					 */						
+					segment_group[segments] = 2;
+					segments++;
 				}
 				/*
-				 * Else Check if the agi1_busy Flag has Zero Value which Means that AGI1 is Available.
-				 */									
-				else if(inter_process_shared_info_memory->shared_status_flags.agi1_busy == 0)
+				 * Check if the agi1_busy Flag has Zero Value which Means that AGI1 is Available.
+				 */						
+				if(inter_process_shared_info_memory->shared_status_flags.agi1_busy == 0 && segments < max_groups)
 				{
 					/*
 					 * Set the indirect_1_accel Flag as Occupied.
 					 * This Flag will be Used Later to Lock the AGI1 as Occupied.
-					 */						
+					 */								
 					indirect_1_accel = OCCUPIED;
+					
+					/*
+					 * Increment the Value of the segments Variable.
+					 */						
+					segment_group[segments] = 3;
+					segments++;
 				}	
 				/*
-				 * Else Check if the agi2_busy Flag has Zero Value which Means that AGI2 is Available.
-				 */									
-				else if(inter_process_shared_info_memory->shared_status_flags.agi2_busy == 0)
+				 * Check if the agi2_busy Flag has Zero Value which Means that AGI2 is Available.
+				 */						
+				if(inter_process_shared_info_memory->shared_status_flags.agi2_busy == 0 && segments < max_groups)
 				{
 					/*
 					 * Set the indirect_2_accel Flag as Occupied.
 					 * This Flag will be Used Later to Lock the AGI2 as Occupied.
-					 */						
+					 */								
 					indirect_2_accel = OCCUPIED;
+					
+					/*
+					 * Increment the Value of the segments Variable.
+					 */						
+					segment_group[segments] = 4;
+					segments++;
 				}	
 				/*
-				 * Else Check if the agi3_busy Flag has Zero Value which Means that AGI3 is Available.
-				 */									
-				else if(inter_process_shared_info_memory->shared_status_flags.agi3_busy == 0)
+				 * Check if the agi3_busy Flag has Zero Value which Means that AGI3 is Available.
+				 */						
+				if(inter_process_shared_info_memory->shared_status_flags.agi3_busy == 0 && segments < max_groups)
 				{
 					/*
 					 * Set the indirect_3_accel Flag as Occupied.
 					 * This Flag will be Used Later to Lock the AGI3 as Occupied.
-					 */						
+					 */								
 					indirect_3_accel = OCCUPIED;
-				}
-				/*
-				 * Else Check if the agsg_busy Flag has Zero Value which Means that AGSG is Available.
-				 */									
-				else if(inter_process_shared_info_memory->shared_status_flags.agsg_busy == 0)
-				{
+					
 					/*
-					 * Set the sg_accel Flag as Occupied.
-					 * This Flag will be Used Later to Lock the AGSG as Occupied.
+					 * Increment the Value of the segments Variable.
 					 */						
-					sg_accel = OCCUPIED;
+					segment_group[segments] = 5;
+					segments++;
 				}
-				
+			}
+			/*
+			 * Check if the agsg_busy Flag Has Zero Value which Means that AGSG is Available.
+			 */
+			else if(inter_process_shared_info_memory->shared_status_flags.agsg_busy == 0)
+			{
 				/*
-				 * Set segments Variable with 1 Because in this Policy the Image will not be Processed in Segments.
-				 */
-				segments = 1;
-				
+				 * Set the sg_accel Flag as Occupied.
+				 * This Flag will be Used Later to Lock the AGSG as Occupied.
+				 */						
+				sg_accel = OCCUPIED;
+
+				/*
+				 * Increment the Value of the segments Variable.
+				 */						
+				segment_group[segments] = 6;
+				segments++;
+			}						
+			
+			/*
+			 * The shared_repo_virtual_address Points to the Kernel Memory Allocation which is Used so that the Current Thread Can Explicitly Store
+			 * Metrics Information fot its own Acceleration Procedure.
+			 * 
+			 * Set the image_segments Structure Field of the Current Userspace Thread with the Value of the segments Variable.
+			 */
+			search_element->shared_repo_virtual_address->image_segments = segments;
+							
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Assigned Acceleration Group are\n", driver_name, current->pid);
+			#endif	
+			
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] AGD0 AGD1 AGI0 AGI1 AGI2 AGI3 AGSG\n", driver_name, current->pid);
+			#endif		
+			
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)]    %d    %d    %d    %d    %d    %d    %d\n", driver_name, current->pid, direct_0_accel, direct_1_accel, indirect_0_accel, indirect_1_accel, indirect_2_accel, indirect_3_accel, sg_accel);
+			#endif										
+
+			/*
+			 * Get the Number of Rows that each Acceleration Group Should Process.
+			 */
+			segment_size = search_element->shared_repo_virtual_address->shared_image_info.rows / segments;
+			
+			/*
+			 * Get the Remaining Rows (If any)
+			 */
+			remaining_rows = search_element->shared_repo_virtual_address->shared_image_info.rows - (segment_size * segments);
+
+			/*
+			 * Repeat for as many Times as the Number of Image Segments.
+			 */
+			for (repeat = 0; repeat < segments; repeat++) 
+			{
 				/*
-				 * Set the segment_rows First Array Field with the Number of Image Rows.
+				 * Set the Current Array Field with the Number of Rows that the Corresponding Acceleration Group Should Process.
 				 */
-				segment_rows[0] = search_element->shared_repo_virtual_address->shared_image_info.rows;
+				segment_rows[repeat] = segment_size;
 				
-				#endif
-
 				/*
-				 * Check if the direct_0_accel Flag is Set as Occupied which Means that AGD0 is Assigned to the Current Thread.
-				 * If this is the Case then Setup and Start the AGD0.
+				 * If we Found Remaining Rows then the Acceleration Group of the Current Array Field Should Process One More Row.
 				 */
-				if(direct_0_accel == OCCUPIED)
+				if (remaining_rows > 0) 
 				{
 					/*
-					 * Lock the case_0_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-					 */
-					down_write(&case_0_sem);
-					
-					/*
-					 * Set accel_direct_0_occupied_pid Flag with the PID of the Current Thread so that we Later Know which Thread Occupied the AGD0.
-					 */
-					inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid = current->pid;
-					
-					/*
-					 * Set the agd0_busy Flag with Value 1 in order to Lock AGD0 for the Current Thread.
-					 */
-					inter_process_shared_info_memory->shared_status_flags.agd0_busy	= 1;
-					
-					/*
-					 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
-					 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
-					 */
-					search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
-					
-					/*
-					 * Add the ACCELERATOR_DIRECT_0_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
-					 * 
-					 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
-					 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
-					 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
-					 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
-					 */
-					search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_DIRECT_0_OCCUPIED;
-					
-					/*
-					 * Unlock the case_0_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-					 */						
-					up_write(&case_0_sem);
-						
-					
-
-					///////////////////////////////////////////////////////////////////////////////////////////
-					// Set Up and Start Accelerator Group Direct 0
-					///////////////////////////////////////////////////////////////////////////////////////////
-					
-					/*
-					 * Set (through the PCIe Bus) the AXI BAR0 Address Translation Register of the FPGA's PCIe Bridge
-					 * with the  Physical Address of the Pre-Process Data Kernel Memory (pre_process_mmap_physical_address).
-					 * This Way the DMA of the AGD0 that Uses AXI BAR0 for Accessing the Host Memory Can Directly Target the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_PCIE_CTL + AXI_BAR0_LOWER_ADDRESS_OFFSET, (u32)search_element->pre_process_mmap_physical_address);
-
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Direct of the AGD0 with the Host's Source Address where the Pre-Process Image Data is Located which is AXI BAR0.
-					 * By Extension AXI BAR0 Targets the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 * 
-					 * If the Image is Segmented in order to be Processed by Multiple Acceleration Groups (Greedy Policy) then the Source Address Points to an Offset of AXI BAR0
-					 * According to the segment_offset Variable where the Segment that AGD0 will Process is Located.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_HOST_SOURCE_ADDRESS_REGISTER_OFFSET, (u32)(AXI_BAR_0_OFFSET + segment_offset));
-
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Direct of the AGD0 with the Host's Destination Address where
-					 * the Post-Process Image Data Should be Located which is AXI BAR0.
-					 * By Extension AXI BAR0 Targets the Pre-Process Data Kernel Memory which is, also, Used as the Destination Memory for the Post-Processed Data.
-					 * Typically, the Driver Creates a Post-Process Data Kernel Memory but Using it Would Require the Usage of Additional AXI BAR.
-					 * In Order to Reduce the AXI BARs that are Required for Data Acceleration we Use ONLY the Pre-Process Data Kernel Memory
-					 * both to Read the Initial Image Data from and Write the Processed Image Data to.
-					 * 
-					 * 
-					 * If the Image is Segmented in order to be Processed by Multiple Acceleration Groups (Greedy Policy) then the Destination Address Points to an Offset of AXI BAR0
-					 * According to the segment_offset Variable where the Segment that AGD0 will Process is Located.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_HOST_DESTINATION_ADDRESS_REGISTER_OFFSET, (u32)(AXI_BAR_0_OFFSET + segment_offset));
-					
-					/*
-					 * Set the FPGA's Acceleration Scheduler Direct of the AGD0 (through the PCIe Bus) with the Number of Image Columns that the AGD0 will Process.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
-
-					/*
-					 * Set the FPGA's Acceleration Scheduler Direct of the AGD0 (through the PCIe Bus) with the Number of Image Rows that the AGD0 will Process.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
-
-					/*
-					 * Set the FPGA's Acceleration Scheduler Direct of the AGD0 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
-					 */				
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_CONTROL_REGISTER_OFFSET, (u32)START);
-					
-					#ifdef GREEDY
-					/*
-					 * If we are in Greedy Policy we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
-					 * Should Know which Image Segment to Process.
+					 * Decrement the remaining_rows Value.
 					 */
-					segment_offset = segment_offset + (segment_rows[segment_count] * search_element->shared_repo_virtual_address->shared_image_info.columns * 4);
+					remaining_rows--;
 					
 					/*
-					 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
-					 * in order to Get the Correct Number of Image Rows that it Should Process.
+					 * Increment the Number of Rows of the Current Array Field by 1.
 					 */
-					segment_count++;
-					#endif
-
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGD 0\n", driver_name, current->pid);
-					#endif
-					
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
-					#endif					
-										
-				
+					segment_rows[repeat]++;
 				}
+			}
+			
+			/*
+			 * The Acceleration Groups do not Have the Same Throughput (Direct DMA, CDMA through the Scheduler Buffer).
+			 * If the Image is Processed in Segments then Split the Rows in Proportion to the Measured Throughput of each Acceleration Group
+			 * so that all the Segments Complete at Roughly the Same Time.
+			 */
+			if(segments > 1 && READ_ONCE(weighted_split) == 1)
+			{
+				accel_weight_segments(search_element->shared_repo_virtual_address->shared_image_info.rows, segments, segment_group, segment_rows);
+			}
+			
+			/*
+			 * Keep the Size in Bytes of the Segment of each Acceleration Group so that the Interrupt Handler Can Calibrate the Throughput of the Acceleration Group when it Completes.
+			 * The Size is Counted with the Larger of the Input and the Output Row Bytes of the Input Format and the Packed Output Mode of the Current Thread.
+			 * 
+			 * The Rows of each Segment are, also, Shared with the Current Thread.
+			 * In Packed Output Mode each Segment Leaves its Processed Rows Packed at the Beginning of its own Part of the Pre-Process Data Kernel Memory
+			 * so the Userspace Application Needs the Segment Rows to Locate each Processed Row.
+			 */
+			for(repeat = 0; repeat < segments; repeat++)
+			{
+				WRITE_ONCE(accel_group_segment_bytes[segment_group[repeat]], (u64)segment_rows[repeat] * max(accel_input_row_bytes(search_element), accel_output_row_bytes(search_element)));
 				
-				/*
-				 * Check if the direct_1_accel Flag is Set as Occupied which Means that AGD1 is Assigned to the Current Thread.
-				 * If this is the Case then Setup and Start the AGD1.
-				 */				
-				if(direct_1_accel == OCCUPIED)
-				{	
-					/*
-					 * Lock the case_1_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-					 */					
-					down_write(&case_1_sem);
-					
-					/*
-					 * Set accel_direct_1_occupied_pid Flag with the PID of the Current Thread so that we Later Know which Thread Occupied the AGD1.
-					 */					
-					inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid = current->pid;	
-					
-					/*
-					 * Set the agd1_busy Flag with Value 1 in order to Lock AGD1 for the Current Thread.
-					 */						
-					inter_process_shared_info_memory->shared_status_flags.agd1_busy	= 1;		
-					
-					/*
-					 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
-					 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
-					 */					
-					search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
-					
-					/*
-					 * Add the ACCELERATOR_DIRECT_1_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
-					 * 
-					 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
-					 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
-					 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
-					 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
-					 */					
-					search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_DIRECT_1_OCCUPIED;
-					
-					/*
-					 * Unlock the case_1_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-					 */						
-					up_write(&case_1_sem);
-					
-					
-					
-					///////////////////////////////////////////////////////////////////////////////////////////
-					// Set Up and Start Accelerator Group Direct 1
-					///////////////////////////////////////////////////////////////////////////////////////////
-					
-					/*
-					 * Set (through the PCIe Bus) the AXI BAR1 Address Translation Register of the FPGA's PCIe Bridge
-					 * with the  Physical Address of the Pre-Process Data Kernel Memory (pre_process_mmap_physical_address).
-					 * This Way the DMA of the AGD1 that Uses AXI BAR1 for Accessing the Host Memory Can Directly Target the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */					
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_PCIE_CTL + AXI_BAR1_LOWER_ADDRESS_OFFSET, (u32)search_element->pre_process_mmap_physical_address);
-
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Direct of the AGD1 with the Host's Source Address where the Pre-Process Image Data is Located which is AXI BAR1.
-					 * By Extension AXI BAR1 Targets the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 * 
-					 * If the Image is Segmented in order to be Processed by Multiple Acceleration Groups (Greedy Policy) then the Source Address Points to an Offset of AXI BAR1
-					 * According to the segment_offset Variable where the Segment that AGD1 will Process is Located.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_HOST_SOURCE_ADDRESS_REGISTER_OFFSET, (u32)(AXI_BAR_1_OFFSET + segment_offset));
-					
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Direct of the AGD1 with the Host's Destination Address where
-					 * the Post-Process Image Data Should be Located which is AXI BAR1.
-					 * By Extension AXI BAR1 Targets the Pre-Process Data Kernel Memory which is, also, Used as the Destination Memory for the Post-Processed Data.
-					 * Typically, the Driver Creates a Post-Process Data Kernel Memory but Using it Would Require the Usage of Additional AXI BAR.
-					 * In Order to Reduce the AXI BARs that are Required for Data Acceleration we Use ONLY the Pre-Process Data Kernel Memory
-					 * both to Read the Initial Image Data from and Write the Processed Image Data to.
-					 * 
-					 * 
-					 * If the Image is Segmented in order to be Processed by Multiple Acceleration Groups (Greedy Policy) then the Destination Address Points to an Offset of AXI BAR1
-					 * According to the segment_offset Variable where the Segment that AGD1 will Process is Located.
-					 */					
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_HOST_DESTINATION_ADDRESS_REGISTER_OFFSET, (u32)(AXI_BAR_1_OFFSET + segment_offset));
+				search_element->shared_repo_virtual_address->segment_rows[repeat] = segment_rows[repeat];
+			}
+
+			/*
+			 * Claim the Chosen Acceleration Groups while Still Holding the allocation_sem Semaphore.
+			 * 
+			 * For each Acceleration Group that is Set as Occupied the accel_group_owner Array and the accel_X_occupied_pid Flag are Set with the Node and the PID of the Current Thread 
+			 * so that we Later Know which Thread Occupied the Acceleration Group and the agX_busy Flag is Set with Value 1 in order to Lock it for the Current Thread.
+			 */
+			if(direct_0_accel == OCCUPIED)
+			{
+				accel_group_owner[0] = search_element;
+				inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid = current->pid;
+				inter_process_shared_info_memory->shared_status_flags.agd0_busy = 1;
+			}
+			
+			if(direct_1_accel == OCCUPIED)
+			{
+				accel_group_owner[1] = search_element;
+				inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid = current->pid;
+				inter_process_shared_info_memory->shared_status_flags.agd1_busy = 1;
+			}
+			
+			if(indirect_0_accel == OCCUPIED)
+			{
+				accel_group_owner[2] = search_element;
+				inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid = current->pid;
+				inter_process_shared_info_memory->shared_status_flags.agi0_busy = 1;
+			}
+			
+			if(indirect_1_accel == OCCUPIED)
+			{
+				accel_group_owner[3] = search_element;
+				inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid = current->pid;
+				inter_process_shared_info_memory->shared_status_flags.agi1_busy = 1;
+			}
+			
+			if(indirect_2_accel == OCCUPIED)
+			{
+				accel_group_owner[4] = search_element;
+				inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid = current->pid;
+				inter_process_shared_info_memory->shared_status_flags.agi2_busy = 1;
+			}
+			
+			if(indirect_3_accel == OCCUPIED)
+			{
+				accel_group_owner[5] = search_element;
+				inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid = current->pid;
+				inter_process_shared_info_memory->shared_status_flags.agi3_busy = 1;
+			}
+			
+			if(sg_accel == OCCUPIED)
+			{
+				accel_group_owner[6] = search_element;
+				inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid = current->pid;
+				inter_process_shared_info_memory->shared_status_flags.agsg_busy = 1;
+			}
+			
+			/*
+			 * Unlock the allocation_sem Semaphore so that other Userspace Threads can Claim the Rest Available Acceleration Groups
+			 * while the Current Thread Sets Up the Acceleration Groups that it Has Just Claimed.
+			 */
+			up_write(&allocation_sem);
+			
+			allocation_locked = 0;
+
+			/*
+			 * Check if the direct_0_accel Flag is Set as Occupied which Means that AGD0 is Assigned to the Current Thread.
+			 * If this is the Case then Setup and Start the AGD0.
+			 */
+			if(direct_0_accel == OCCUPIED)
+			{
+				/*
+				 * Lock the case_0_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+				 */
+				down_write(&case_0_sem);
 				
-					/*
-					 * Set the FPGA's Acceleration Scheduler Direct of the AGD1 (through the PCIe Bus) with the Number of Image Columns that the AGD1 will Process.
-					 */					
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
+				/*
+				 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
+				 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
+				 */
+				search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
+				
+				/*
+				 * Add the ACCELERATOR_DIRECT_0_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
+				 * 
+				 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
+				 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
+				 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
+				 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
+				 */
+				search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_DIRECT_0_OCCUPIED;
 				
-					/*
-					 * Set the FPGA's Acceleration Scheduler Direct of the AGD1 (through the PCIe Bus) with the Number of Image Rows that the AGD1 will Process.
-					 */				
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
-
-					/*
-					 * Set the FPGA's Acceleration Scheduler Direct of the AGD1 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
-					 */	
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
-					
-					#ifdef GREEDY
-					/*
-					 * If we are in Greedy Policy we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
-					 * Should Know which Image Segment to Process.
-					 */					
-					segment_offset = segment_offset + (segment_rows[segment_count] * search_element->shared_repo_virtual_address->shared_image_info.columns * 4);
-					
-					/*
-					 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
-					 * in order to Get the Correct Number of Image Rows that it Should Process.
-					 */					
-					segment_count++;
-					#endif
-					
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGD 1\n", driver_name, current->pid);
-					#endif	
 					
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
-					#endif																
-				}		
+				
+
+				///////////////////////////////////////////////////////////////////////////////////////////
+				// Set Up and Start Accelerator Group Direct 0
+				///////////////////////////////////////////////////////////////////////////////////////////
 				
 				/*
-				 * Check if the indirect_0_accel Flag is Set as Occupied which Means that AGI0 is Assigned to the Current Thread.
-				 * If this is the Case then Setup and Start the AGI0.
-				 */					
-				if(indirect_0_accel == OCCUPIED)
-				{	
-					/*
-					 * Lock the case_2_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-					 */						
-					down_write(&case_2_sem);
-					
-					/*
-					 * Set accel_indirect_0_occupied_pid Flag with the PID of the Current Thread so that we Later Know which Thread Occupied the AGI0.
-					 */						
-					inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid = current->pid;	
-					
-					/*
-					 * Set the agi0_busy Flag with Value 1 in order to Lock AGI0 for the Current Thread.
-					 */							
-					inter_process_shared_info_memory->shared_status_flags.agi0_busy	= 1;
-					
-					/*
-					 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
-					 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
-					 */									
-					search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
-					
-					/*
-					 * Add the ACCELERATOR_INDIRECT_0_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
-					 * 
-					 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
-					 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
-					 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
-					 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
-					 */						
-					search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_INDIRECT_0_OCCUPIED;
-					
-					/*
-					 * Unlock the case_2_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-					 */						
-					up_write(&case_2_sem);
-					
-								
-					
-					///////////////////////////////////////////////////////////////////////////////////////////
-					// Set Up and Start Accelerator Group Indirect 0
-					///////////////////////////////////////////////////////////////////////////////////////////
-					 
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI0 with the Host's Source Address where the Pre-Process Image Data is Located.
-					 * The Acceleration Scheduler Indirect will Set the AXI BAR2 Address Translation Register of the FPGA's PCIe Bridge with that Source Address.
-					 * Then the CDMA Fetch will Read the Image Data from AXI BAR 2 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */					 
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_SOURCE_ADDRESS_FETCH_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
-
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI0 with the Host's Destination Address where the Post-Process Image Data Should be Stored.
-					 * 
-					 * Typically, the Driver Creates a Post-Process Data Kernel Memory to Store the Processed Data But in order to Reduce Memory Usage the Processed Data are Stored Back to
-					 * the Pre-Process Data Kernel Memory.
-					 * 
-					 * The Acceleration Scheduler Indirect will Set the AXI BAR3 Address Translation Register of the FPGA's PCIe Bridge with that Destination Address.
-					 * Then the CDMA Send will Write the Processed Image Data to AXI BAR 3 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */	
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_DESTINATION_ADDRESS_SEND_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
-					
-					/*
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI0 with the Offset of the Source Address where the Image Segment that the AGI0 will Process is Located.
-					 * 
-					 * @note This is Applicable ONLY for the Greedy Policy.
-					 * @note The Best Available Policy Assigns a whole Image in the AGI0 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_FETCH_REGISTER_OFFSET, (u32)segment_offset);
+				 * Set (through the PCIe Bus) the AXI BAR0 Address Translation Register of the FPGA's PCIe Bridge
+				 * with the  Physical Address of the Pre-Process Data Kernel Memory (pre_process_mmap_physical_address).
+				 * This Way the DMA of the AGD0 that Uses AXI BAR0 for Accessing the Host Memory Can Directly Target the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_PCIE_CTL + AXI_BAR0_LOWER_ADDRESS_OFFSET, (u32)search_element->pre_process_mmap_physical_address);
 
-					/*
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI0 with the Offset of the Destination Address
-					 * where the Image Segment that the AGI0 will Process Should be Stored.
-					 * 
-					 * @note This is Applicable ONLY for the Greedy Policy.
-					 * @note The Best Available Policy Assigns a whole Image in the AGI0 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_SEND_REGISTER_OFFSET, (u32)segment_offset);
-							
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI0 (through the PCIe Bus) with the Number of Image Columns that the AGI0 will Process.
-					 */								
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Direct of the AGD0 with the Host's Source Address where the Pre-Process Image Data is Located which is AXI BAR0.
+				 * By Extension AXI BAR0 Targets the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 * 
+				 * If the Image is Segmented in order to be Processed by Multiple Acceleration Groups (Greedy, Size Aware or Fair Share Policy) then the Source Address Points to an Offset of AXI BAR0
+				 * According to the segment_offset Variable where the Segment that AGD0 will Process is Located.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_HOST_SOURCE_ADDRESS_REGISTER_OFFSET, (u32)(AXI_BAR_0_OFFSET + segment_offset));
+
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Direct of the AGD0 with the Host's Destination Address where
+				 * the Post-Process Image Data Should be Located which is AXI BAR0.
+				 * By Extension AXI BAR0 Targets the Pre-Process Data Kernel Memory which is, also, Used as the Destination Memory for the Post-Processed Data.
+				 * Typically, the Driver Creates a Post-Process Data Kernel Memory but Using it Would Require the Usage of Additional AXI BAR.
+				 * In Order to Reduce the AXI BARs that are Required for Data Acceleration we Use ONLY the Pre-Process Data Kernel Memory
+				 * both to Read the Initial Image Data from and Write the Processed Image Data to.
+				 * 
+				 * 
+				 * If the Image is Segmented in order to be Processed by Multiple Acceleration Groups (Greedy, Size Aware or Fair Share Policy) then the Destination Address Points to an Offset of AXI BAR0
+				 * According to the segment_offset Variable where the Segment that AGD0 will Process is Located.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_HOST_DESTINATION_ADDRESS_REGISTER_OFFSET, (u32)(AXI_BAR_0_OFFSET + segment_offset));
+				
+				/*
+				 * Set the FPGA's Acceleration Scheduler Direct of the AGD0 (through the PCIe Bus) with the Number of Image Columns that the AGD0 will Process.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
 
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI0 (through the PCIe Bus) with the Number of Image Rows that the AGI0 will Process.
-					 */	
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
+				/*
+				 * Set the FPGA's Acceleration Scheduler Direct of the AGD0 (through the PCIe Bus) with the Number of Image Rows that the AGD0 will Process.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
 
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI0 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
-		
-					#ifdef GREEDY
-					/*
-					 * If we are in Greedy Policy we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
-					 * Should Know which Image Segment to Process.
-					 */						
-					segment_offset = segment_offset + (segment_rows[segment_count] * search_element->shared_repo_virtual_address->shared_image_info.columns * 4);
-					
-					/*
-					 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
-					 * in order to Get the Correct Number of Image Rows that it Should Process.
-					 */						
-					segment_count++;
-					#endif
-		
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGI 0\n", driver_name, current->pid);
-					#endif								
-						
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
-					#endif	
-				}	
+				/*
+				 * Set the FPGA's Acceleration Scheduler Direct of the AGD0 (through the PCIe Bus) with the Packed Output Mode and the Input Format that the Sobel Filter of the AGD0 will Use.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_PACKED_OUTPUT_REGISTER_OFFSET, accel_packed_output(search_element));
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_INPUT_FORMAT_REGISTER_OFFSET, accel_input_format(search_element));
 				
 				/*
-				 * Check if the indirect_1_accel Flag is Set as Occupied which Means that AGI1 is Assigned to the Current Thread.
-				 * If this is the Case then Setup and Start the AGI1.
-				 */					
-				if(indirect_1_accel == OCCUPIED)
-				{	
-					/*
-					 * Lock the case_3_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-					 */					
-					down_write(&case_3_sem);
-					
-					/*
-					 * Set accel_indirect_1_occupied_pid Flag with the PID of the Current Thread so that we Later Know which Thread Occupied the AGI1.
-					 */							
-					inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid = current->pid;			
-					
-					/*
-					 * Set the agi1_busy Flag with Value 1 in order to Lock AGI1 for the Current Thread.
-					 */						
-					inter_process_shared_info_memory->shared_status_flags.agi1_busy	= 1;
-					
-					/*
-					 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
-					 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
-					 */								
-					search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
-					
-					/*
-					 * Add the ACCELERATOR_INDIRECT_1_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
-					 * 
-					 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
-					 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
-					 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
-					 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
-					 */						
-					search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_INDIRECT_1_OCCUPIED;
-					
-					/*
-					 * Unlock the case_3_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-					 */						
-					up_write(&case_3_sem);
-					
-												
-					
-					///////////////////////////////////////////////////////////////////////////////////////////
-					// Set Up and Start Accelerator Group Indirect 1
-					///////////////////////////////////////////////////////////////////////////////////////////
-					
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI1 with the Host's Source Address where the Pre-Process Image Data is Located.
-					 * The Acceleration Scheduler Indirect will Set the AXI BAR2 Address Translation Register of the FPGA's PCIe Bridge with that Source Address.
-					 * Then the CDMA Fetch will Read the Image Data from AXI BAR 2 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_SOURCE_ADDRESS_FETCH_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
-					
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI1 with the Host's Destination Address where the Post-Process Image Data Should be Stored.
-					 * 
-					 * Typically, the Driver Creates a Post-Process Data Kernel Memory to Store the Processed Data But in order to Reduce Memory Usage the Processed Data are Stored Back to
-					 * the Pre-Process Data Kernel Memory.
-					 * 
-					 * The Acceleration Scheduler Indirect will Set the AXI BAR3 Address Translation Register of the FPGA's PCIe Bridge with that Destination Address.
-					 * Then the CDMA Send will Write the Processed Image Data to AXI BAR 3 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_DESTINATION_ADDRESS_SEND_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
-					
-					/*
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI1 with the Offset of the Source Address where the Image Segment that the AGI1 will Process is Located.
-					 * 
-					 * @note This is Applicable ONLY for the Greedy Policy.
-					 * @note The Best Available Policy Assigns a whole Image in the AGI1 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
-					 */					
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_FETCH_REGISTER_OFFSET, (u32)segment_offset);
-					
-					/*
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI1 with the Offset of the Destination Address
-					 * where the Image Segment that the AGI1 will Process Should be Stored.
-					 * 
-					 * @note This is Applicable ONLY for the Greedy Policy.
-					 * @note The Best Available Policy Assigns a whole Image in the AGI1 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
-					 */					
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_SEND_REGISTER_OFFSET, (u32)segment_offset);					
-					
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI1 (through the PCIe Bus) with the Number of Image Columns that the AGI1 will Process.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
-					
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI1 (through the PCIe Bus) with the Number of Image Rows that the AGI1 will Process.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
+				 * Set the Sobel Filter of the AGD0 (through the PCIe Bus) with the Filter that the Thread Requested.
+				 */
+				accel_set_filter(BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_SOBEL_FILTER, search_element);
 
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI1 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
+				/*
+				 * Set the FPGA's Acceleration Scheduler Direct of the AGD0 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
+				 */				
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_CONTROL_REGISTER_OFFSET, (u32)START);
 
-					#ifdef GREEDY
-					/*
-					 * If we are in Greedy Policy we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
-					 * Should Know which Image Segment to Process.
-					 */					
-					segment_offset = segment_offset + (segment_rows[segment_count] * search_element->shared_repo_virtual_address->shared_image_info.columns * 4);
-					
-					/*
-					 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
-					 * in order to Get the Correct Number of Image Rows that it Should Process.
-					 */						
-					segment_count++;
-					#endif
+				/*
+				 * Unlock the case_0_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+				 */						
+				up_write(&case_0_sem);
+				
+				/*
+				 * If the Image is Processed in Segments we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
+				 * Should Know which Image Segment to Process.
+				 */
+				segment_offset = segment_offset + (segment_rows[segment_count] * accel_input_row_bytes(search_element));
+				
+				/*
+				 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
+				 * in order to Get the Correct Number of Image Rows that it Should Process.
+				 */
+				segment_count++;
 
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGI 1\n", driver_name, current->pid);
-					#endif	
-					
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
-					#endif					
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGD 0\n", driver_name, current->pid);
+				#endif
+				
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
+				#endif					
 									
-				}																	
+			
+			}
+			
+			/*
+			 * Check if the direct_1_accel Flag is Set as Occupied which Means that AGD1 is Assigned to the Current Thread.
+			 * If this is the Case then Setup and Start the AGD1.
+			 */				
+			if(direct_1_accel == OCCUPIED)
+			{	
+				/*
+				 * Lock the case_1_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+				 */					
+				down_write(&case_1_sem);
 				
+				/*
+				 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
+				 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
+				 */					
+				search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
 				
 				/*
-				 * Check if the indirect_2_accel Flag is Set as Occupied which Means that AGI2 is Assigned to the Current Thread.
-				 * If this is the Case then Setup and Start the AGI2.
-				 */						
-				if(indirect_2_accel == OCCUPIED)
-				{	
-					/*
-					 * Lock the case_4_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-					 */						
-					down_write(&case_4_sem);
-					
-					/*
-					 * Set accel_indirect_2_occupied_pid Flag with the PID of the Current Thread so that we Later Know which Thread Occupied the AGI2.
-					 */						
-					inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid = current->pid;		
-
-					/*
-					 * Set the agi2_busy Flag with Value 1 in order to Lock AGI2 for the Current Thread.
-					 */						
-					inter_process_shared_info_memory->shared_status_flags.agi2_busy	= 1;	
-					
-					/*
-					 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
-					 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
-					 */								
-					search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
-					
-					/*
-					 * Add the ACCELERATOR_INDIRECT_2_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
-					 * 
-					 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
-					 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
-					 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
-					 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
-					 */							
-					search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_INDIRECT_2_OCCUPIED;
-					
-					/*
-					 * Unlock the case_4_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-					 */					
-					up_write(&case_4_sem);
-																	
-					
-					///////////////////////////////////////////////////////////////////////////////////////////
-					// Set Up and Start Accelerator Group Indirect 2
-					///////////////////////////////////////////////////////////////////////////////////////////
-					
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI2 with the Host's Source Address where the Pre-Process Image Data is Located.
-					 * The Acceleration Scheduler Indirect will Set the AXI BAR2 Address Translation Register of the FPGA's PCIe Bridge with that Source Address.
-					 * Then the CDMA Fetch will Read the Image Data from AXI BAR 2 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_SOURCE_ADDRESS_FETCH_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
-					
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI2 with the Host's Destination Address where the Post-Process Image Data Should be Stored.
-					 * 
-					 * Typically, the Driver Creates a Post-Process Data Kernel Memory to Store the Processed Data But in order to Reduce Memory Usage the Processed Data are Stored Back to
-					 * the Pre-Process Data Kernel Memory.
-					 * 
-					 * The Acceleration Scheduler Indirect will Set the AXI BAR3 Address Translation Register of the FPGA's PCIe Bridge with that Destination Address.
-					 * Then the CDMA Send will Write the Processed Image Data to AXI BAR 3 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_DESTINATION_ADDRESS_SEND_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
+				 * Add the ACCELERATOR_DIRECT_1_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
+				 * 
+				 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
+				 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
+				 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
+				 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
+				 */					
+				search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_DIRECT_1_OCCUPIED;
 				
-					/*
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI2 with the Offset of the Source Address where the Image Segment that the AGI2 will Process is Located.
-					 * 
-					 * @note This is Applicable ONLY for the Greedy Policy.
-					 * @note The Best Available Policy Assigns a whole Image in the AGI2 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
-					 */	
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_FETCH_REGISTER_OFFSET, (u32)segment_offset);
 				
-					/*
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI2 with the Offset of the Destination Address
-					 * where the Image Segment that the AGI2 will Process Should be Stored.
-					 * 
-					 * @note This is Applicable ONLY for the Greedy Policy.
-					 * @note The Best Available Policy Assigns a whole Image in the AGI2 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
-					 */					
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_SEND_REGISTER_OFFSET, (u32)segment_offset);
-					
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI2 (through the PCIe Bus) with the Number of Image Columns that the AGI2 will Process.
-					 */							
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
-					
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI2 (through the PCIe Bus) with the Number of Image Rows that the AGI2 will Process.
-					 */							
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
+				
+				
+				///////////////////////////////////////////////////////////////////////////////////////////
+				// Set Up and Start Accelerator Group Direct 1
+				///////////////////////////////////////////////////////////////////////////////////////////
+				
+				/*
+				 * Set (through the PCIe Bus) the AXI BAR1 Address Translation Register of the FPGA's PCIe Bridge
+				 * with the  Physical Address of the Pre-Process Data Kernel Memory (pre_process_mmap_physical_address).
+				 * This Way the DMA of the AGD1 that Uses AXI BAR1 for Accessing the Host Memory Can Directly Target the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */					
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_PCIE_CTL + AXI_BAR1_LOWER_ADDRESS_OFFSET, (u32)search_element->pre_process_mmap_physical_address);
 
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI2 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Direct of the AGD1 with the Host's Source Address where the Pre-Process Image Data is Located which is AXI BAR1.
+				 * By Extension AXI BAR1 Targets the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 * 
+				 * If the Image is Segmented in order to be Processed by Multiple Acceleration Groups (Greedy, Size Aware or Fair Share Policy) then the Source Address Points to an Offset of AXI BAR1
+				 * According to the segment_offset Variable where the Segment that AGD1 will Process is Located.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_HOST_SOURCE_ADDRESS_REGISTER_OFFSET, (u32)(AXI_BAR_1_OFFSET + segment_offset));
+				
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Direct of the AGD1 with the Host's Destination Address where
+				 * the Post-Process Image Data Should be Located which is AXI BAR1.
+				 * By Extension AXI BAR1 Targets the Pre-Process Data Kernel Memory which is, also, Used as the Destination Memory for the Post-Processed Data.
+				 * Typically, the Driver Creates a Post-Process Data Kernel Memory but Using it Would Require the Usage of Additional AXI BAR.
+				 * In Order to Reduce the AXI BARs that are Required for Data Acceleration we Use ONLY the Pre-Process Data Kernel Memory
+				 * both to Read the Initial Image Data from and Write the Processed Image Data to.
+				 * 
+				 * 
+				 * If the Image is Segmented in order to be Processed by Multiple Acceleration Groups (Greedy, Size Aware or Fair Share Policy) then the Destination Address Points to an Offset of AXI BAR1
+				 * According to the segment_offset Variable where the Segment that AGD1 will Process is Located.
+				 */					
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_HOST_DESTINATION_ADDRESS_REGISTER_OFFSET, (u32)(AXI_BAR_1_OFFSET + segment_offset));
 			
-					#ifdef GREEDY
-					/*
-					 * If we are in Greedy Policy we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
-					 * Should Know which Image Segment to Process.
-					 */						
-					segment_offset = segment_offset + (segment_rows[segment_count] * search_element->shared_repo_virtual_address->shared_image_info.columns * 4);	
-					
-					/*
-					 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
-					 * in order to Get the Correct Number of Image Rows that it Should Process.
-					 */	
-					segment_count++;
-					#endif
+				/*
+				 * Set the FPGA's Acceleration Scheduler Direct of the AGD1 (through the PCIe Bus) with the Number of Image Columns that the AGD1 will Process.
+				 */					
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
 			
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGI 2\n", driver_name, current->pid);
-					#endif	
-					
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
-					#endif					
-												
-				}	
+				/*
+				 * Set the FPGA's Acceleration Scheduler Direct of the AGD1 (through the PCIe Bus) with the Number of Image Rows that the AGD1 will Process.
+				 */				
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
+
+				/*
+				 * Set the FPGA's Acceleration Scheduler Direct of the AGD1 (through the PCIe Bus) with the Packed Output Mode and the Input Format that the Sobel Filter of the AGD1 will Use.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_PACKED_OUTPUT_REGISTER_OFFSET, accel_packed_output(search_element));
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_INPUT_FORMAT_REGISTER_OFFSET, accel_input_format(search_element));
 				
 				/*
-				 * Check if the indirect_3_accel Flag is Set as Occupied which Means that AGI3 is Assigned to the Current Thread.
-				 * If this is the Case then Setup and Start the AGI3.
-				 */					
-				if(indirect_3_accel == OCCUPIED)
-				{	
-					/*
-					 * Lock the case_5_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-					 */					
-					down_write(&case_5_sem);
-					
-					/*
-					 * Set accel_indirect_3_occupied_pid Flag with the PID of the Current Thread so that we Later Know which Thread Occupied the AGI3.
-					 */						
-					inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid = current->pid;	
-					
-					/*
-					 * Set the agi3_busy Flag with Value 1 in order to Lock AGI3 for the Current Thread.
-					 */							
-					inter_process_shared_info_memory->shared_status_flags.agi3_busy	= 1;			
-					
-					/*
-					 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
-					 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
-					 */						
-					search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
-					
-					/*
-					 * Add the ACCELERATOR_INDIRECT_3_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
-					 * 
-					 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
-					 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
-					 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
-					 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
-					 */						
-					search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_INDIRECT_3_OCCUPIED;
-					
-					/*
-					 * Unlock the case_5_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-					 */					
-					up_write(&case_5_sem);
-																						
-
-					///////////////////////////////////////////////////////////////////////////////////////////
-					// Set Up and Start Accelerator Group Indirect 3
-					///////////////////////////////////////////////////////////////////////////////////////////
-					
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI3 with the Host's Source Address where the Pre-Process Image Data is Located.
-					 * The Acceleration Scheduler Indirect will Set the AXI BAR2 Address Translation Register of the FPGA's PCIe Bridge with that Source Address.
-					 * Then the CDMA Fetch will Read the Image Data from AXI BAR 2 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_SOURCE_ADDRESS_FETCH_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
-					
-					/* 
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI3 with the Host's Destination Address where the Post-Process Image Data Should be Stored.
-					 * 
-					 * Typically, the Driver Creates a Post-Process Data Kernel Memory to Store the Processed Data But in order to Reduce Memory Usage the Processed Data are Stored Back to
-					 * the Pre-Process Data Kernel Memory.
-					 * 
-					 * The Acceleration Scheduler Indirect will Set the AXI BAR3 Address Translation Register of the FPGA's PCIe Bridge with that Destination Address.
-					 * Then the CDMA Send will Write the Processed Image Data to AXI BAR 3 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_DESTINATION_ADDRESS_SEND_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
-
-					/*
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI3 with the Offset of the Source Address where the Image Segment that the AGI3 will Process is Located.
-					 * 
-					 * @note This is Applicable ONLY for the Greedy Policy.
-					 * @note The Best Available Policy Assigns a whole Image in the AGI3 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
-					 */	
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_FETCH_REGISTER_OFFSET, (u32)segment_offset);
-					
-					/*
-					 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI3 with the Offset of the Destination Address
-					 * where the Image Segment that the AGI3 will Process Should be Stored.
-					 * 
-					 * @note This is Applicable ONLY for the Greedy Policy.
-					 * @note The Best Available Policy Assigns a whole Image in the AGI3 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_SEND_REGISTER_OFFSET, (u32)segment_offset);
-					
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI3 (through the PCIe Bus) with the Number of Image Columns that the AGI3 will Process.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
-					
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI3 (through the PCIe Bus) with the Number of Image Rows that the AGI3 will Process.
-					 */						
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
-
-					/*
-					 * Set the FPGA's Acceleration Scheduler Indirect of the AGI3 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
-					 */
-					write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
+				 * Set the Sobel Filter of the AGD1 (through the PCIe Bus) with the Filter that the Thread Requested.
+				 */
+				accel_set_filter(BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_SOBEL_FILTER, search_element);
 
-					#ifdef GREEDY
-					/*
-					 * If we are in Greedy Policy we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
-					 * Should Know which Image Segment to Process.
-					 */						
-					segment_offset = segment_offset + (segment_rows[segment_count] * search_element->shared_repo_virtual_address->shared_image_info.columns * 4);
-					
-					/*
-					 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
-					 * in order to Get the Correct Number of Image Rows that it Should Process.
-					 */						
-					segment_count++;
-					#endif
+				/*
+				 * Set the FPGA's Acceleration Scheduler Direct of the AGD1 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
+				 */	
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT + ACCELERATION_SCHEDULER_DIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
 
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGI 3\n", driver_name, current->pid);
-					#endif	
-					
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
-					#endif		
-									
-				}	
+				/*
+				 * Unlock the case_1_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+				 */						
+				up_write(&case_1_sem);
 				
 				/*
-				 * Check if the sg_accel Flag is Set as Occupied which Means that AGSG is Assigned to the Current Thread.
-				 * If this is the Case then Setup and Start the AGSG.
+				 * If the Image is Processed in Segments we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
+				 * Should Know which Image Segment to Process.
 				 */					
-				if(sg_accel == OCCUPIED)
-				{		
-					/*
-					 * Lock the case_6_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-					 */	
-					down_write(&case_6_sem);
-					
-					/*
-					 * Set accel_sg_0_occupied_pid Flag with the PID of the Current Thread so that we Later Know which Thread Occupied the AGSG.
-					 */						
-					inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid = current->pid;
-										
-					/*
-					 * Set the agsg_busy Flag with Value 1 in order to Lock AGSG for the Current Thread.
-					 */											
-					inter_process_shared_info_memory->shared_status_flags.agsg_busy	= 1;
-					
-					/*
-					 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
-					 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
-					 */					
-					search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
-					
-					/*
-					 * Add the ACCELERATOR_SG_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
-					 * 
-					 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
-					 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread.
-					 * 
-					 * The Difference Between the AGSG and the Rest Acceleration Groups is that if the accel_occupied Mask is Set with the ACCELERATOR_SG_OCCUPIED Flag
-					 * the Current Userspace Thread Has to Make a Request to the Driver to Create Scatter/Gather Lists before Requesting to Occupy the AGSG.
-					 */		
-					search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_SG_OCCUPIED;
-					
-					/*
-					 * Unlock the case_6_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-					 */						
-					up_write(&case_6_sem);
-					
-												
-							
-					#ifdef DEBUG_MESSAGES
-					printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Request from Process to Allocate Usersapce Memory for Using AGSG\n", driver_name, current->pid);
-					#endif	
-				
-				}														
-
-			}
-				 
-			/*
-			 * Set the search_element Pointer to Point at the Next List Node.
-			 */			 
-			search_element = search_element->next_pid;
-		}
-		
-				
-		break;
-	
-	/*
-	 * This Case is Used when a Userspace Thread Requests to Create Scatter/Gather Lists.
-	 * 
-	 * The AGSG is Used in Cases where the Initial Image Data are Read Directly from the Userspace Memory and the Processed Data are Written Directly to the Userspace Memory.
-	 * The Particularity of a Userspace Memory is that its Allocation is Chunked in Pages of 4K rather than being Contiguous Memory.
-	 * In Order for the AGSG to Access the Source and Destination Userspace Memories it Has to be Aware of the Physical Addresses of all the Pages that Constitute the Source and Destination Memories.
-	 * This is Accomplished in Driver Level by Creating the Scatter/Gather Lists of the Previous Memories.
-	 * 
-	 * When a Userspace Thread is Assigned the AGSG it Makes a IOCtl Call with the COMMAND_SET_PAGES Flag in Order to Create the Scatter/Gather Lists for its Source and Destination Memories.
-	 */		
-	case COMMAND_SET_PAGES:
-
-		/*
-		 * Lock the set_pages_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-		 */
-		down_write(&set_pages_sem);
-
-		/*
-		 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-		 */
-		search_element = pid_list_head;
-		 
-		/*
-		 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-		 * 
-		 * The Reason for Searching the Singly Linked List at this Point is to Find the List Node that Belongs to the Current Userspace Thread.
-		 * The Structure Fields of the Current Thread's Node will be Needed During the Creation of the Scatter/Gather List.
-		 */			 
-		 while(search_element != NULL)
-		 {
-			
-			/*
-			 * Check if the Current Node's PID Value is Equal to the Current Userspace Thread's PID.
-			 * If this is the Case then we Can Proceed to Create the Scatter/Gather Lists.
-			 */				
-			if(search_element->pid == current->pid)
-			{
+				segment_offset = segment_offset + (segment_rows[segment_count] * accel_input_row_bytes(search_element));
 				
 				/*
-				 * Calculate the Number of Pages According to the Image Size and the Page Size for the Userspace Source and Destination Memories.
-				 * 
-				 * For Example, an Image of 1920x1080 Resolution Has Size 8294400 Bytes (1920 x 1080 x 4Bytes).
-				 * For an Image Size of 8294400 Bytes and a Page Size of 4096 Bytes we Require 2025 Pages (8294400/4096).
-				 */
-				buffer_entries_source = search_element->shared_repo_virtual_address->shared_image_info.size / PAGE_SIZE;
-				buffer_entries_destination = search_element->shared_repo_virtual_address->shared_image_info.size / PAGE_SIZE;
-
+				 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
+				 * in order to Get the Correct Number of Image Rows that it Should Process.
+				 */					
+				segment_count++;
 				
 				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Set Scatter/Gather Pages\n", driver_name, current->pid);
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGD 1\n", driver_name, current->pid);
 				#endif	
-
-				/*
-				 * The userspace_value is a Variable with Data from the Current Userspace Thread that are Carried Along with the IOCtl Command.
-				 * The Data of the userspace_value herein is a Pointer to a Structure of Type struct sg_list_addresses which Contains the Pointers of the Source and Destination Userspace Memories
-				 * that the Current Userspace Thread Created in order to Occupy the AGSG.
-				 * 
-				 * We Cast the Remote Pointer that is Carried by the userspace_value Variable to the Local sg_list_src_dst_addresses Pointer of Structure Type struct sg_list_addresses.
-				 * This Way we Can Access the Virtual Addresses of the Userspace Source and Destination Memories in order to Create their Scatter/Gather Lists.
-				 */
-				sg_list_src_dst_addresses = (struct sg_list_addresses *)userspace_value;
+				
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
+				#endif																
+			}		
 			
 			/*
-			 * Check to Make Sure that the Pointers of the Userspace Source and Destination Memories is not NULL.
-			 * This is the Way to Validate that the Memories are Allocated Succesfully Before Trying to Create Their Scatter/Gather Lists.
-			 */
-			if(sg_list_src_dst_addresses->sg_list_source_address != NULL && sg_list_src_dst_addresses->sg_list_destination_address != NULL)
-			{
+			 * Check if the indirect_0_accel Flag is Set as Occupied which Means that AGI0 is Assigned to the Current Thread.
+			 * If this is the Case then Setup and Start the AGI0.
+			 */					
+			if(indirect_0_accel == OCCUPIED)
+			{	
 				/*
-				 * Allocate a Kernel Memory Large Enough to Fit as many Structures of Type struct page as the Number of Pages that we Earlier Calculated in the buffer_entries_source Variable
-				 * and Set the buffer_page_array_source to Point at this Memory Allocation.
-				 * 
-				 * This is a Page Array.
-				 */
-				buffer_page_array_source = kmalloc(sizeof(struct page *) * buffer_entries_source, GFP_KERNEL);
+				 * Lock the case_2_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+				 */						
+				down_write(&case_2_sem);
 				
 				/*
-				 * Allocate a Kernel Memory Large Enough to Fit as many Structures of Type struct page as the Number of Pages that we Earlier Calculated in the buffer_entries_destination Variable
-				 * and Set the buffer_page_array_destination to Point at this Memory Allocation.
-				 * 
-				 * This is a Page Array.
-				 */				
-				buffer_page_array_destination = kmalloc(sizeof(struct page *) * buffer_entries_destination, GFP_KERNEL);
+				 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
+				 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
+				 */									
+				search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
 				
 				/*
-				 * Lock the mmap_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-				 */					
-				down_read(&current->mm->mmap_sem);
+				 * Add the ACCELERATOR_INDIRECT_0_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
+				 * 
+				 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
+				 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
+				 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
+				 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
+				 */						
+				search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_INDIRECT_0_OCCUPIED;
 				
-				/*
-				 * Pin the the Source User Pages in Memory.
-				 * Upon Successful Completion, the Caller of get_user_pages() Has a Pages Array (buffer_page_array_source) Pointing to the Source Userspace Memory Allocation, which is Locked into Memory.
+				
+							
+				
+				///////////////////////////////////////////////////////////////////////////////////////////
+				// Set Up and Start Accelerator Group Indirect 0
+				///////////////////////////////////////////////////////////////////////////////////////////
+				 
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI0 with the Host's Source Address where the Pre-Process Image Data is Located.
+				 * The Acceleration Scheduler Indirect will Set the AXI BAR2 Address Translation Register of the FPGA's PCIe Bridge with that Source Address.
+				 * Then the CDMA Fetch will Read the Image Data from AXI BAR 2 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */					 
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_SOURCE_ADDRESS_FETCH_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
+
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI0 with the Host's Destination Address where the Post-Process Image Data Should be Stored.
 				 * 
-				 * The get_user_pages() Returns the Number of Pages that were Succesfully Pinned(search_element->buffer_mapped_pages_source)
-				 * which is not Necessarily Equal to the Requested Pages(buffer_entries_source).
-				 */
-				search_element->buffer_mapped_pages_source = get_user_pages(current, current->mm, (unsigned long)(sg_list_src_dst_addresses->sg_list_source_address), buffer_entries_source, 1, 1, buffer_page_array_source, NULL);
+				 * Typically, the Driver Creates a Post-Process Data Kernel Memory to Store the Processed Data But in order to Reduce Memory Usage the Processed Data are Stored Back to
+				 * the Pre-Process Data Kernel Memory.
+				 * 
+				 * The Acceleration Scheduler Indirect will Set the AXI BAR3 Address Translation Register of the FPGA's PCIe Bridge with that Destination Address.
+				 * Then the CDMA Send will Write the Processed Image Data to AXI BAR 3 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */	
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_DESTINATION_ADDRESS_SEND_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
 				
 				/*
-				 * Pin the the Destination User Pages in Memory.
-				 * Upon Successful Completion, the Caller of get_user_pages() Has a Pages Array (buffer_page_array_destination) Pointing to the Destination Userspace Memory Allocation, which is Locked into Memory.
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI0 with the Offset of the Source Address where the Image Segment that the AGI0 will Process is Located.
 				 * 
-				 * The get_user_pages() Returns the Number of Pages that were Succesfully Pinned(search_element->buffer_mapped_pages_destination)
-				 * which is not Necessarily Equal to the Requested Pages(buffer_entries_destination).
-				 */				
-				search_element->buffer_mapped_pages_destination = get_user_pages(current, current->mm, (unsigned long)(sg_list_src_dst_addresses->sg_list_destination_address), buffer_entries_destination, 1, 1, buffer_page_array_destination, NULL);
+				 * @note This is Applicable ONLY when the Image is Processed in Segments.
+				 * @note The Best Available Policy Assigns a whole Image in the AGI0 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_FETCH_REGISTER_OFFSET, (u32)segment_offset);
 
 				/*
-				 * Now that we Got the Source Page Array (buffer_page_array_source) we Can Release the Source Pages.
-				 * Loop for as Many Times as the Number of Pinned Pages of the Source Userspace Memory.
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI0 with the Offset of the Destination Address
+				 * where the Image Segment that the AGI0 will Process Should be Stored.
+				 * 
+				 * @note This is Applicable ONLY when the Image is Processed in Segments.
+				 * @note The Best Available Policy Assigns a whole Image in the AGI0 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
 				 */
-				for(repeat = 0; repeat < search_element->buffer_mapped_pages_source; repeat++)	
-				{
-					/*
-					 * Release the Page of the Current Field of the Source Page Array.
-					 */
-					put_page(buffer_page_array_source[repeat]);
-			
-				}
-				
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_SEND_REGISTER_OFFSET, (u32)segment_offset);
+						
 				/*
-				 * Now that we Got the Destination Page Array (buffer_page_array_destination) we Can Release the Destination Pages.
-				 * Loop for as Many Times as the Number of Pinned Pages of the Destinaton Userspace Memory.
-				 */				
-				for(repeat = 0; repeat < search_element->buffer_mapped_pages_destination; repeat++)	
-				{
-					/*
-					 * Release the Page of the Current Field of the Destination Page Array.
-					 */
-					put_page(buffer_page_array_destination[repeat]);
-				}				
-					
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI0 (through the PCIe Bus) with the Number of Image Columns that the AGI0 will Process.
+				 */								
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
+
 				/*
-				 * Unlock the mmap_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-				 */							
-				up_read(&current->mm->mmap_sem);
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI0 (through the PCIe Bus) with the Number of Image Rows that the AGI0 will Process.
+				 */	
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
 
 				/*
-				 * Allocate Memory of Size Equal to struct sg_table.
-				 * Set the search_element->dma_sg_table_source to Point at this Memory Allocation.
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI0 (through the PCIe Bus) with the Packed Output Mode and the Input Format that the Sobel Filter of the AGI0 will Use.
 				 */
-				search_element->dma_sg_table_source = kmalloc(sizeof(struct sg_table), GFP_KERNEL);
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_PACKED_OUTPUT_REGISTER_OFFSET, accel_packed_output(search_element));
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_INPUT_FORMAT_REGISTER_OFFSET, accel_input_format(search_element));
 				
 				/*
-				 * Allocate Memory of Size Equal to struct sg_table.
-				 * Set the search_element->dma_sg_table_destinaiton to Point at this Memory Allocation.
-				 */				
-				search_element->dma_sg_table_destination = kmalloc(sizeof(struct sg_table), GFP_KERNEL);
+				 * Set the Sobel Filter of the AGI0 (through the PCIe Bus) with the Filter that the Thread Requested.
+				 */
+				accel_set_filter(BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_SOBEL_FILTER, search_element);
 
 				/*
-				 * The sg_alloc_table Allocates the Memory to Use for the Actual Scatterlist Arrays of the Source Userspace Memory and Deals with the Process of Chaining them all Together.
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI0 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
 				 */
-				sg_table_value_source = sg_alloc_table(search_element->dma_sg_table_source, search_element->buffer_mapped_pages_source, GFP_KERNEL);
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
+
+				/*
+				 * Unlock the case_2_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+				 */						
+				up_write(&case_2_sem);
+	
+				/*
+				 * If the Image is Processed in Segments we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
+				 * Should Know which Image Segment to Process.
+				 */						
+				segment_offset = segment_offset + (segment_rows[segment_count] * accel_input_row_bytes(search_element));
 				
 				/*
-				 * The sg_alloc_table Allocates the Memory to Use for the Actual Scatterlist Arrays of the Destinaiton Userspace Memory and Deals with the Process of Chaining them all Together.
-				 */				
-				sg_table_value_destination = sg_alloc_table(search_element->dma_sg_table_destination, search_element->buffer_mapped_pages_destination, GFP_KERNEL);
+				 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
+				 * in order to Get the Correct Number of Image Rows that it Should Process.
+				 */						
+				segment_count++;
+	
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGI 0\n", driver_name, current->pid);
+				#endif								
+					
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
+				#endif	
+			}	
+			
+			/*
+			 * Check if the indirect_1_accel Flag is Set as Occupied which Means that AGI1 is Assigned to the Current Thread.
+			 * If this is the Case then Setup and Start the AGI1.
+			 */					
+			if(indirect_1_accel == OCCUPIED)
+			{	
+				/*
+				 * Lock the case_3_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+				 */					
+				down_write(&case_3_sem);
 				
 				/*
-				 * The search_element->dma_sg_table_source->sgl Points to the Memory where the Source Scatter/Gather List will be Stored.
-				 * Set the search_element->scatterlist_pointer_source Pointer that Belongs to the Current Thread to Point at the Same Memory where the Source Scatter/Gather List will be Stored.
-				 */
-				search_element->scatterlist_pointer_source = search_element->dma_sg_table_source->sgl;
+				 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
+				 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
+				 */								
+				search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
 				
 				/*
-				 * The search_element->dma_sg_table_destination->sgl Points to the Memory where the Destination Scatter/Gather List will be Stored.
-				 * Set the search_element->scatterlist_pointer_destination Pointer that Belongs to the Current Thread to Point at the Same Memory where the Destination Scatter/Gather List will be Stored.
-				 */				
-				search_element->scatterlist_pointer_destination = search_element->dma_sg_table_destination->sgl;	
+				 * Add the ACCELERATOR_INDIRECT_1_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
+				 * 
+				 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
+				 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
+				 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
+				 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
+				 */						
+				search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_INDIRECT_1_OCCUPIED;
+				
+				
+											
+				
+				///////////////////////////////////////////////////////////////////////////////////////////
+				// Set Up and Start Accelerator Group Indirect 1
+				///////////////////////////////////////////////////////////////////////////////////////////
+				
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI1 with the Host's Source Address where the Pre-Process Image Data is Located.
+				 * The Acceleration Scheduler Indirect will Set the AXI BAR2 Address Translation Register of the FPGA's PCIe Bridge with that Source Address.
+				 * Then the CDMA Fetch will Read the Image Data from AXI BAR 2 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_SOURCE_ADDRESS_FETCH_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
+				
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI1 with the Host's Destination Address where the Post-Process Image Data Should be Stored.
+				 * 
+				 * Typically, the Driver Creates a Post-Process Data Kernel Memory to Store the Processed Data But in order to Reduce Memory Usage the Processed Data are Stored Back to
+				 * the Pre-Process Data Kernel Memory.
+				 * 
+				 * The Acceleration Scheduler Indirect will Set the AXI BAR3 Address Translation Register of the FPGA's PCIe Bridge with that Destination Address.
+				 * Then the CDMA Send will Write the Processed Image Data to AXI BAR 3 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_DESTINATION_ADDRESS_SEND_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
 				
 				/*
-				 * Loop for as Many Times as the Number of Pinned Pages of the Source Userspace Memory.
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI1 with the Offset of the Source Address where the Image Segment that the AGI1 will Process is Located.
+				 * 
+				 * @note This is Applicable ONLY when the Image is Processed in Segments.
+				 * @note The Best Available Policy Assigns a whole Image in the AGI1 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
 				 */					
-				for(repeat = 0; repeat < search_element->buffer_mapped_pages_source; repeat++)
-				{
-					/*
-					 * Get the Current Page from the Source Page Array and Set Accordingly the Current Scatter/Gather List Entry (search_element->scatterlist_pointer_source) of that Page.
-					 */
-					sg_set_page(search_element->scatterlist_pointer_source, buffer_page_array_source[repeat], PAGE_SIZE, 0);
-					
-					/*
-					 * Use sg_next() to Walk to the Next Scatter/Gather List Entry that will be Set in the Next Iteration.
-					 */
-					search_element->scatterlist_pointer_source = sg_next(search_element->scatterlist_pointer_source);
-				}
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_FETCH_REGISTER_OFFSET, (u32)segment_offset);
 				
-		
 				/*
-				 * Loop for as Many Times as the Number of Pinned Pages of the Destination Userspace Memory.
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI1 with the Offset of the Destination Address
+				 * where the Image Segment that the AGI1 will Process Should be Stored.
+				 * 
+				 * @note This is Applicable ONLY when the Image is Processed in Segments.
+				 * @note The Best Available Policy Assigns a whole Image in the AGI1 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
 				 */					
-				for(repeat = 0; repeat < search_element->buffer_mapped_pages_destination; repeat++)
-				{
-					/*
-					 * Get the Current Page from the Destination Page Array and Set Accordingly the Current Scatter/Gather List Entry (search_element->scatterlist_pointer_destinaiton) of that Page.
-					 */					
-					sg_set_page(search_element->scatterlist_pointer_destination, buffer_page_array_destination[repeat], PAGE_SIZE, 0);
-					
-					/*
-					 * Use sg_next() to Walk to the Next Scatter/Gather List Entry that will be Set in the Next Iteration.
-					 */					
-					search_element->scatterlist_pointer_destination = sg_next(search_element->scatterlist_pointer_destination);
-				}		
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_SEND_REGISTER_OFFSET, (u32)segment_offset);					
 				
 				/*
-				 * The Usage of sg_next() Made the search_element->scatterlist_pointer_source Pointer to Point at the Last Scatter/Gather List Entry.
-				 * So, Set the search_element->scatterlist_pointer_source to Point again at the Beginning of the Scatter/Gathet List (search_element->dma_sg_table_source->sgl)
-				 */
-				search_element->scatterlist_pointer_source = search_element->dma_sg_table_source->sgl;
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI1 (through the PCIe Bus) with the Number of Image Columns that the AGI1 will Process.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
 				
 				/*
-				 * The Usage of sg_next() Made the search_element->scatterlist_pointer_destination Pointer to Point at the Last Scatter/Gather List Entry.
-				 * So, Set the search_element->scatterlist_pointer_destination to Point again at the Beginning of the Scatter/Gathet List (search_element->dma_sg_table_destination->sgl)
-				 */				
-				search_element->scatterlist_pointer_destination = search_element->dma_sg_table_destination->sgl;
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI1 (through the PCIe Bus) with the Number of Image Rows that the AGI1 will Process.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
+
+				/*
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI1 (through the PCIe Bus) with the Packed Output Mode and the Input Format that the Sobel Filter of the AGI1 will Use.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_PACKED_OUTPUT_REGISTER_OFFSET, accel_packed_output(search_element));
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_INPUT_FORMAT_REGISTER_OFFSET, accel_input_format(search_element));
 				
 				/*
-				 * Use dma_map_sg() which Fills the dma_address Field of each Entry of the Source Scatter/Gather List with the Physical Address of each Page of the Source Userspace Memory.
-				 * The Physical Address Can be Later Passed to the AGSG in Order to Access the Userspace Source Memory.
+				 * Set the Sobel Filter of the AGI1 (through the PCIe Bus) with the Filter that the Thread Requested.
 				 */
-				search_element->buffer_dma_buffers_source = dma_map_sg(&dev->dev, search_element->scatterlist_pointer_source, search_element->buffer_mapped_pages_source, DMA_BIDIRECTIONAL);
+				accel_set_filter(BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_SOBEL_FILTER, search_element);
 
 				/*
-				 * Use dma_map_sg() which Fills the dma_address Field of each Entry of the Destination Scatter/Gather List with the Physical Address of each Page of the Destination Userspace Memory.
-				 * The Physical Address Can be Later Passed to the AGSG in Order to Access the Userspace Destination Memory.
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI1 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
 				 */
-				search_element->buffer_dma_buffers_destination = dma_map_sg(&dev->dev, search_element->scatterlist_pointer_destination, search_element->buffer_mapped_pages_destination, DMA_BIDIRECTIONAL);
-				
-				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] DMA Source SG Pages Number: %d\n", driver_name, current->pid, search_element->buffer_dma_buffers_source);
-				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] DMA Destination SG Pages Number: %d\n", driver_name, current->pid, search_element->buffer_dma_buffers_destination);
-				#endif
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
+
+				/*
+				 * Unlock the case_3_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+				 */						
+				up_write(&case_3_sem);
+
+				/*
+				 * If the Image is Processed in Segments we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
+				 * Should Know which Image Segment to Process.
+				 */					
+				segment_offset = segment_offset + (segment_rows[segment_count] * accel_input_row_bytes(search_element));
 				
 				/*
-				 * Clear the Pages Array of the Source Userspace Memory as it is no Longer Needed.
-				 */
-				kfree(buffer_page_array_source);
+				 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
+				 * in order to Get the Correct Number of Image Rows that it Should Process.
+				 */						
+				segment_count++;
+
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGI 1\n", driver_name, current->pid);
+				#endif	
 				
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
+				#endif					
+								
+			}																	
+			
+			
+			/*
+			 * Check if the indirect_2_accel Flag is Set as Occupied which Means that AGI2 is Assigned to the Current Thread.
+			 * If this is the Case then Setup and Start the AGI2.
+			 */						
+			if(indirect_2_accel == OCCUPIED)
+			{	
 				/*
-				 * Clear the Pages Array of the Destination Userspace Memory as it is no Longer Needed.
-				 */				
-				kfree(buffer_page_array_destination);
+				 * Lock the case_4_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+				 */						
+				down_write(&case_4_sem);
 				
 				/*
-				 * Allocate Memory (64K) that will be Used as an Array to Store all the Physical Addresses of the Pages that Belong to the Source Userspace Memory.
-				 * The Allocation Size is Large Enough to Support Images of 4K Resolution that Require 8100 Pages.
-				 * 
-				 * The Physical Addresses of this Allocation will be Copied in the FPGA BRAM so that the AGSG Can Use them to Fetch the Initial Image Data from the Source Userspace Memory.
-				 */
-				search_element->u64_sg_list_source = (uint64_t *)kmalloc( 64 * KBYTE, GFP_KERNEL);
+				 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
+				 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
+				 */								
+				search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
 				
 				/*
-				 * Allocate Memory (64K) that will be Used as an Array to Store all the Physical Addresses of the Pages that Belong to the Destination Userspace Memory.
-				 * The Allocation Size is Large Enough to Support Images of 4K Resolution that Require 8100 Pages.
+				 * Add the ACCELERATOR_INDIRECT_2_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
 				 * 
-				 * The Physical Addresses of this Allocation will be Copied in the FPGA BRAM so that the AGSG Can Use them to Send the Processed Image Data to the Destination Userspace Memory.
-				 */				
-				search_element->u64_sg_list_destination = (uint64_t *)kmalloc( 64 * KBYTE, GFP_KERNEL);
-
-
-				for(repeat = 0; repeat < search_element->buffer_dma_buffers_source; repeat++)
-				{
-					/*
-					 * Use sg_dma_address() to Get the Physical Address of the Source Page of the Current Source Scatter/Gather List Entry.
-					 * Store the Physical Address to the Current Field of the search_element->u64_sg_list_source Array Pointer.
-					 */
-					search_element->u64_sg_list_source[repeat] = sg_dma_address(search_element->scatterlist_pointer_source);
-					
-					/*
-					 * The sg_dma_len() is Useful If we Needed to Know the Data Size in Each Page.
-					 * It is not Currently Used but it is Kept for Future Implementations.
-					 */
-					//sg_list_length_source_base_address[repeat] = sg_dma_len(scatterlist_pointer_source);
+				 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
+				 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
+				 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
+				 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
+				 */							
+				search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_INDIRECT_2_OCCUPIED;
 				
-					/*
-					 * Use sg_next() to Walk to the Next Scatter/Gather List Entry.
-					 */					
-					search_element->scatterlist_pointer_source = sg_next(search_element->scatterlist_pointer_source);
-							
-				}					
+																
 				
+				///////////////////////////////////////////////////////////////////////////////////////////
+				// Set Up and Start Accelerator Group Indirect 2
+				///////////////////////////////////////////////////////////////////////////////////////////
 				
-				for(repeat = 0; repeat < search_element->buffer_dma_buffers_destination; repeat++)
-				{
-					/*
-					 * Use sg_dma_address() to Get the Physical Address of the Destination Page of the Current Destination Scatter/Gather List Entry.
-					 * Store the Physical Address to the Current Field of the search_element->u64_sg_list_destination Array Pointer.
-					 */					
-					search_element->u64_sg_list_destination[repeat] = sg_dma_address(search_element->scatterlist_pointer_destination);
-					
-					/*
-					 * The sg_dma_len() is Useful If we Needed to Know the Data Size in Each Page.
-					 * It is not Currently Used but it is Kept for Future Implementations.
-					 */					
-					//sg_list_length_destination_base_address[repeat] = sg_dma_len(scatterlist_pointer_destination);
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI2 with the Host's Source Address where the Pre-Process Image Data is Located.
+				 * The Acceleration Scheduler Indirect will Set the AXI BAR2 Address Translation Register of the FPGA's PCIe Bridge with that Source Address.
+				 * Then the CDMA Fetch will Read the Image Data from AXI BAR 2 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_SOURCE_ADDRESS_FETCH_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
 				
-					/*
-					 * Use sg_next() to Walk to the Next Scatter/Gather List Entry.
-					 */					
-					search_element->scatterlist_pointer_destination = sg_next(search_element->scatterlist_pointer_destination);
-							
-				}	
-	
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI2 with the Host's Destination Address where the Post-Process Image Data Should be Stored.
+				 * 
+				 * Typically, the Driver Creates a Post-Process Data Kernel Memory to Store the Processed Data But in order to Reduce Memory Usage the Processed Data are Stored Back to
+				 * the Pre-Process Data Kernel Memory.
+				 * 
+				 * The Acceleration Scheduler Indirect will Set the AXI BAR3 Address Translation Register of the FPGA's PCIe Bridge with that Destination Address.
+				 * Then the CDMA Send will Write the Processed Image Data to AXI BAR 3 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_DESTINATION_ADDRESS_SEND_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
+			
 				/*
-				 * The Usage of sg_next() Made the search_element->scatterlist_pointer_source Pointer to Point at the Last Scatter/Gather List Entry.
-				 * So, Set the search_element->scatterlist_pointer_source to Point again at the Beginning of the Scatter/Gathet List (search_element->dma_sg_table_source->sgl)
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI2 with the Offset of the Source Address where the Image Segment that the AGI2 will Process is Located.
+				 * 
+				 * @note This is Applicable ONLY when the Image is Processed in Segments.
+				 * @note The Best Available Policy Assigns a whole Image in the AGI2 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
 				 */	
-				search_element->scatterlist_pointer_source = search_element->dma_sg_table_source->sgl;
-				
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_FETCH_REGISTER_OFFSET, (u32)segment_offset);
+			
 				/*
-				 * The Usage of sg_next() Made the search_element->scatterlist_pointer_destination Pointer to Point at the Last Scatter/Gather List Entry.
-				 * So, Set the search_element->scatterlist_pointer_destination to Point again at the Beginning of the Scatter/Gathet List (search_element->dma_sg_table_destination->sgl)
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI2 with the Offset of the Destination Address
+				 * where the Image Segment that the AGI2 will Process Should be Stored.
+				 * 
+				 * @note This is Applicable ONLY when the Image is Processed in Segments.
+				 * @note The Best Available Policy Assigns a whole Image in the AGI2 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
 				 */					
-				search_element->scatterlist_pointer_destination = search_element->dma_sg_table_destination->sgl;
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_SEND_REGISTER_OFFSET, (u32)segment_offset);
 				
+				/*
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI2 (through the PCIe Bus) with the Number of Image Columns that the AGI2 will Process.
+				 */							
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
 				
 				/*
-				 * Use pci_dma_sync_sg_for_device() that Synchronizes the Source Userspace Memory so that the Device Can See the Most Up to Date Data.
-				 * This Step Should Take Place Before Actually Giving the Physical Addresses of the Scatter/Gather List to the Hardware (AGSG).
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI2 (through the PCIe Bus) with the Number of Image Rows that the AGI2 will Process.
+				 */							
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
+
+				/*
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI2 (through the PCIe Bus) with the Packed Output Mode and the Input Format that the Sobel Filter of the AGI2 will Use.
 				 */
-				pci_dma_sync_sg_for_device(dev, search_element->scatterlist_pointer_source, search_element->buffer_dma_buffers_source, PCI_DMA_TODEVICE);
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_PACKED_OUTPUT_REGISTER_OFFSET, accel_packed_output(search_element));
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_INPUT_FORMAT_REGISTER_OFFSET, accel_input_format(search_element));
 				
 				/*
-				 * Use pci_dma_sync_sg_for_device() that Synchronizes the Destination Userspace Memory so that the Device Can See the Most Up to Date Data.
-				 * This Step Should Take Place Before Actually Giving the Physical Addresses of the Scatter/Gather List to the Hardware (AGSG).
-				 */				
-				pci_dma_sync_sg_for_device(dev, search_element->scatterlist_pointer_destination, search_element->buffer_dma_buffers_destination, PCI_DMA_TODEVICE);
-								
-				}				
-			}
-			
-			/*
-			 * Set the search_element Pointer to Point at the Next List Node.
-			 */			
-			search_element = search_element->next_pid;			
-		}
-		
-		/*
-		 * Unlock the set_pages_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-		 */			
-		up_write(&set_pages_sem);
-	
-		
-		break;	
-		
-		
-		/*
-		 * This Case is Used when the Current Thread of the Userspace Application Requests to Unmap the Pages that were Mapped
-		 * when Creating the Scatter/Gather Lists for the Need of the Current Thread.
-		 * 
-		 * It, also, Releases the Scatter/Gather Lists and any Resources that were Required for the Scatter/Gather Operations of the Current Thread.
-		 */			
-		case COMMAND_UNMAP_PAGES:
-	
-		/*
-		 * Lock the unmap_pages_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-		 */		
-		down_write(&unmap_pages_sem);
+				 * Set the Sobel Filter of the AGI2 (through the PCIe Bus) with the Filter that the Thread Requested.
+				 */
+				accel_set_filter(BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_SOBEL_FILTER, search_element);
+
+				/*
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI2 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
+
+				/*
+				 * Unlock the case_4_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+				 */					
+				up_write(&case_4_sem);
 		
-		#ifdef DEBUG_MESSAGES
-		printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Going to Unmap Scatter/Gather Pages\n", driver_name, current->pid);
-		#endif	
+				/*
+				 * If the Image is Processed in Segments we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
+				 * Should Know which Image Segment to Process.
+				 */						
+				segment_offset = segment_offset + (segment_rows[segment_count] * accel_input_row_bytes(search_element));	
+				
+				/*
+				 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
+				 * in order to Get the Correct Number of Image Rows that it Should Process.
+				 */	
+				segment_count++;
 		
-		/*
-		 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-		 */		
-		search_element = pid_list_head;
-		 
-		/*
-		 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-		 * 
-		 * The Reason for Searching the Singly Linked List at this Point is to Find the List Node that Belongs to the Current Userspace Thread.
-		 * The Structure Fields of the Current Thread's Node will be Needed in order to Unmap the Pages from the Kernel Space and Free the Scatter/Gather Lists and the Resources
-		 * that were Created when Setting the Scatter/Gather Lists for the Userspace Memories of the Current Thread.
-		 */			 
-		 while(search_element != NULL)
-		 {
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGI 2\n", driver_name, current->pid);
+				#endif	
+				
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
+				#endif					
+											
+			}	
+			
 			/*
-			 * Check if the Current Node's PID Value is Equal to the Current Userspace Thread's PID.
-			 * If this is the Case then we Can Proceed to Unmapping and Releasing.
-			 */				
-			if(search_element->pid == current->pid)
-			{		
+			 * Check if the indirect_3_accel Flag is Set as Occupied which Means that AGI3 is Assigned to the Current Thread.
+			 * If this is the Case then Setup and Start the AGI3.
+			 */					
+			if(indirect_3_accel == OCCUPIED)
+			{	
 				/*
-				 * Unmap the Scatter/Gather List of the Userspace Source Memory.
-				 * If we Avoid Unmapping, the Userspace Thread will not be able to Use the Source Memory Correctly.
-				 */
-				dma_unmap_sg(&dev->dev, search_element->scatterlist_pointer_source, search_element->buffer_mapped_pages_source, DMA_BIDIRECTIONAL);
+				 * Lock the case_5_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+				 */					
+				down_write(&case_5_sem);
 				
 				/*
-				 * Unmap the Scatter/Gather List of the Userspace Destination Memory.
-				 * If we Avoid Unmapping, the Userspace Thread will not be able to Use the Destination Memory Correctly.
-				 */				
-				dma_unmap_sg(&dev->dev, search_element->scatterlist_pointer_destination, search_element->buffer_mapped_pages_destination, DMA_BIDIRECTIONAL);
+				 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
+				 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
+				 */						
+				search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
 				
 				/*
-				 * Free the Scatter/Gather List Table of the Source Userspace Memory.
-				 */
-				sg_free_table(search_element->dma_sg_table_source);
+				 * Add the ACCELERATOR_INDIRECT_3_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
+				 * 
+				 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
+				 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread and Compared with the accel_completed Mask.
+				 * The accel_completed Mask is Set inside the Interrupt Handlers when the Interrupt Manager of the FPGA Sends MSI Completion Interupts.
+				 * When both Masks Have the Same Value the Userspace Thread Knows that the Acceleration Has Completed by All the Acceleration Groups that Participated in Processing a Single Image.
+				 */						
+				search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_INDIRECT_3_OCCUPIED;
+				
+																					
+
+				///////////////////////////////////////////////////////////////////////////////////////////
+				// Set Up and Start Accelerator Group Indirect 3
+				///////////////////////////////////////////////////////////////////////////////////////////
+				
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI3 with the Host's Source Address where the Pre-Process Image Data is Located.
+				 * The Acceleration Scheduler Indirect will Set the AXI BAR2 Address Translation Register of the FPGA's PCIe Bridge with that Source Address.
+				 * Then the CDMA Fetch will Read the Image Data from AXI BAR 2 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_SOURCE_ADDRESS_FETCH_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
 				
+				/* 
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI3 with the Host's Destination Address where the Post-Process Image Data Should be Stored.
+				 * 
+				 * Typically, the Driver Creates a Post-Process Data Kernel Memory to Store the Processed Data But in order to Reduce Memory Usage the Processed Data are Stored Back to
+				 * the Pre-Process Data Kernel Memory.
+				 * 
+				 * The Acceleration Scheduler Indirect will Set the AXI BAR3 Address Translation Register of the FPGA's PCIe Bridge with that Destination Address.
+				 * Then the CDMA Send will Write the Processed Image Data to AXI BAR 3 and by Extension the Pre-Process Data Kernel Memory that Belongs to the Current Userspace Thread.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_DESTINATION_ADDRESS_SEND_REGISTER_OFFSET, (u32)(search_element->pre_process_mmap_physical_address));
+
 				/*
-				 * Free the Scatter/Gather List Table of the Destination Userspace Memory.
-				 */				
-				sg_free_table(search_element->dma_sg_table_destination);
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI3 with the Offset of the Source Address where the Image Segment that the AGI3 will Process is Located.
+				 * 
+				 * @note This is Applicable ONLY when the Image is Processed in Segments.
+				 * @note The Best Available Policy Assigns a whole Image in the AGI3 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
+				 */	
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_FETCH_REGISTER_OFFSET, (u32)segment_offset);
 				
 				/*
-				 * Free the Memory Allocation where the Scatter/Gather List Table of the Source Memory was Stored.
-				 */
-				kfree(search_element->dma_sg_table_source);
+				 * Set (through the PCIe Bus) the FPGA's Acceleration Scheduler Indirect of the AGI3 with the Offset of the Destination Address
+				 * where the Image Segment that the AGI3 will Process Should be Stored.
+				 * 
+				 * @note This is Applicable ONLY when the Image is Processed in Segments.
+				 * @note The Best Available Policy Assigns a whole Image in the AGI3 so there is no Need for an Offset(The segment_offset Variable Has Zero Value).
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_SEND_REGISTER_OFFSET, (u32)segment_offset);
 				
 				/*
-				 * Free the Memory Allocation where the Scatter/Gather List Table of the Destination Memory was Stored.
-				 */				
-				kfree(search_element->dma_sg_table_destination);
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI3 (through the PCIe Bus) with the Number of Image Columns that the AGI3 will Process.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns);
 				
 				/*
-				 * Free the Memory Allocation where the 64 Bit Physical Addresses of the Pages of the Source Userspace Memory were Stored.
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI3 (through the PCIe Bus) with the Number of Image Rows that the AGI3 will Process.
+				 */						
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)segment_rows[segment_count]);				
+
+				/*
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI3 (through the PCIe Bus) with the Packed Output Mode and the Input Format that the Sobel Filter of the AGI3 will Use.
 				 */
-				kfree(search_element->u64_sg_list_source);
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_PACKED_OUTPUT_REGISTER_OFFSET, accel_packed_output(search_element));
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_INPUT_FORMAT_REGISTER_OFFSET, accel_input_format(search_element));
 				
 				/*
-				 * Free the Memory Allocation where the 64 Bit Physical Addresses of the Pages of the Destination Userspace Memory were Stored.
-				 */				
-				kfree(search_element->u64_sg_list_destination);
-					
-			}
-			
-			/*
-			 * Set the search_element Pointer to Point at the Next List Node.
-			 */					
-			search_element = search_element->next_pid;
-			
-		}	
-		
-		/*
-		 * Unlock the unmap_pages_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-		 */			
-		up_write(&unmap_pages_sem);
-				
-		break;	
-	
-		/*
-		 * This Case is Used when a Userspace Thread Requests to Reset the Acceleration Flags that are Used to Indicate which Threads (PIDs) Use the Acceleration Groups.
-		 * It is, also, Used to Reset the accelerator_busy Mask.
-		 */			
-		case COMMAND_RESET_VARIABLES:
-		
-		
-		#ifdef DEBUG_MESSAGES
-		printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Going to Reset Driver Variables\n", driver_name, current->pid);
-		#endif	
-		
-		/*
-		 * Reset the accelerator_busy Mask.
-		 */
-		inter_process_shared_info_memory->shared_status_flags.accelerator_busy = 0;
+				 * Set the Sobel Filter of the AGI3 (through the PCIe Bus) with the Filter that the Thread Requested.
+				 */
+				accel_set_filter(BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_SOBEL_FILTER, search_element);
 
-		/*
-		 * Reset the accel_direct_0_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGD0.
-		 */		
-		inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid = 0;
-		
-		/*
-		 * Reset the accel_direct_1_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGD1.
-		 */				
-		inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid = 0;
-		
-		/*
-		 * Reset the accel_indirect_0_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGI0.
-		 */		
-		inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid = 0;
-		
-		/*
-		 * Reset the accel_indirect_1_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGI1.
-		 */		
-		inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid = 0;
-		
-		/*
-		 * Reset the accel_indirect_2_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGI2.
-		 */		
-		inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid = 0;
-		
-		/*
-		 * Reset the accel_indirect_3_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGI3.
-		 */		
-		inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid = 0;
-				
-		/*
-		 * Reset the accel_sg_0_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGSG.
-		 */		
-		inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid = 0;
+				/*
+				 * Set the FPGA's Acceleration Scheduler Indirect of the AGI3 (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
+				 */
+				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT + ACCELERATION_SCHEDULER_INDIRECT_CONTROL_REGISTER_OFFSET, (u32)START);				
+
+				/*
+				 * Unlock the case_5_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+				 */					
+				up_write(&case_5_sem);
+
+				/*
+				 * If the Image is Processed in Segments we Have to Calculate the Offset where the Next Image Segment is Located so that the Next Acceleration Group 
+				 * Should Know which Image Segment to Process.
+				 */						
+				segment_offset = segment_offset + (segment_rows[segment_count] * accel_input_row_bytes(search_element));
 				
-		break;		
-		
-	/*
-	 * This IOCtl Call is Made After the Current Thread Has Called the COMMAND_REQUEST_ACCELERATOR_ACCESS IOCtl Call and the Driver Assigned AGSG to the Current Thread.
-	 * Then, the Current Thread Had to Make the COMMAND_SET_PAGES IOCtl Call to Create the Scatter/Gather Lists that are Required for the AGSG to Operate.
-	 * Finally the Current Userspace Thread Makes the COMMAND_REQUEST_ACCELERATOR_SG_ACCESS IOCtl Call in order to Start the AGSG.
-	 */		
-	case COMMAND_REQUEST_ACCELERATOR_SG_ACCESS:
+				/*
+				 * Increment the segment_count Variable so that the Next Acceleration Group will Read the Correct Field of the segment_rows Array
+				 * in order to Get the Correct Number of Image Rows that it Should Process.
+				 */						
+				segment_count++;
 
-		/*
-		 * Lock the sg_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-		 */
-		down_write(&sg_sem);
-		
-		/*
-		 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-		 */						
-		search_element = pid_list_head;
-		 
-		/*
-		 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-		 * 
-		 * The Reason for Searching the Singly Linked List at this Point is to Find the List Node that Belongs to the Current Userspace Thread.
-		 * The Structure Fields of the Current Thread's Node will be Needed in order to Get the Source and Destination Scatter/Gather Lists of the Current Thread.
-		 * The Scatter/Gather Lists will be Transferred to the FPGA's BRAM so that the AGSG Can Use them to Start the Acceleration.
-		 */			 
-		 while(search_element != NULL)
-		 {
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGI 3\n", driver_name, current->pid);
+				#endif	
+				
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] OFFSET %d\n", driver_name, current->pid, segment_offset);
+				#endif		
+								
+			}	
 			
 			/*
-			 * Check if the Current Node's PID Value is Equal to the Current Userspace Thread's PID.
-			 * If this is the Case then we Can Proceed to Acceleration.
+			 * Check if the sg_accel Flag is Set as Occupied which Means that AGSG is Assigned to the Current Thread.
+			 * If this is the Case then Setup and Start the AGSG.
 			 */					
-			if(search_element->pid == current->pid)
-			{
-
+			if(sg_accel == OCCUPIED)
+			{		
 				/*
 				 * Lock the case_6_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
-				 */				
+				 */	
 				down_write(&case_6_sem);
 				
 				/*
@@ -2481,85 +2081,2110 @@ switch(command)
 				 */					
 				search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
 				
+				/*
+				 * Add the ACCELERATOR_SG_OCCUPIED Flag in the accel_occupied Mask of the Metrics Kernel Memory.
+				 * 
+				 * The Metrics Kernel Memory that the search_element->shared_repo_virtual_address Pointer Refers to is Shared Only with the Current Userspace Thread.
+				 * As a Result, the accel_occupied Mask is Read in Polling Mode by the Current Userspace Thread.
+				 * 
+				 * The Difference Between the AGSG and the Rest Acceleration Groups is that if the accel_occupied Mask is Set with the ACCELERATOR_SG_OCCUPIED Flag
+				 * the Current Userspace Thread Has to Make a Request to the Driver to Create Scatter/Gather Lists before Requesting to Occupy the AGSG.
+				 */		
+				search_element->shared_repo_virtual_address->accel_occupied |= ACCELERATOR_SG_OCCUPIED;
+				
 				/*
 				 * Unlock the case_6_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-				 */					
+				 */						
 				up_write(&case_6_sem);
-		
-				/////////////////////////////////////////////////////////////////////////////////////////
-				//Set Up and Start Accelerator Group SG
-				/////////////////////////////////////////////////////////////////////////////////////////
-	
-				/*
-				 * Loop for as Many Times as the Number of Pinned Pages of the Source Userspace Memory.
-				 */			
-				for(repeat = 0; repeat < search_element->buffer_dma_buffers_source; repeat++)
-				{
-					/*
-					 * Write the 64 Bit SG List Source Addresses of the Current Thread to FPGA BRAM at 32K Offset.
-					 */ 					 
-					writeq(search_element->u64_sg_list_source[repeat], (u64 *) bar1_address_virtual + repeat + 8192);					
-				}	
 				
+											
+						
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Request from Process to Allocate Usersapce Memory for Using AGSG\n", driver_name, current->pid);
+				#endif	
+			
+			}														
+		}
+		
+		/*
+		 * Unlock the allocation_sem Semaphore in Case no List Node was Found for the Current Thread.
+		 */
+		if(allocation_locked == 1)
+		{
+			up_write(&allocation_sem);
+		}
 				
-				/*
-				 * Loop for as Many Times as the Number of Pinned Pages of the Destination Userspace Memory.
-				 */						
-				for(repeat = 0; repeat < search_element->buffer_dma_buffers_destination; repeat++)
-				{
-					/*
-					 * Write the 64 Bit SG List Destination Addresses of the Current Thread to FPGA BRAM at 64K Offset.
-					 */ 	
-					writeq(search_element->u64_sg_list_destination[repeat], (u64 *) bar1_address_virtual + repeat + 16384);						 
-					 						
-				}
-
-				/*
-				 * Set the FPGA's Acceleration Scheduler Scatter/Gather of the AGSG (through the PCIe Bus) with the Number of Image Columns that the AGSG will Process.
-				 */		
-				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_SG_ACCELERATION_SCHEDULER_SG + XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_IMAGE_COLS_DATA, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns); 
+		break;
+	
+	/*
+	 * This Case is Used when a Userspace Thread Requests to Create Scatter/Gather Lists.
+	 * 
+	 * The AGSG is Used in Cases where the Initial Image Data are Read Directly from the Userspace Memory and the Processed Data are Written Directly to the Userspace Memory.
+	 * The Particularity of a Userspace Memory is that its Allocation is Chunked in Pages of 4K rather than being Contiguous Memory.
+	 * In Order for the AGSG to Access the Source and Destination Userspace Memories it Has to be Aware of the Physical Addresses of all the Pages that Constitute the Source and Destination Memories.
+	 * This is Accomplished in Driver Level by Creating the Scatter/Gather Lists of the Previous Memories.
+	 * 
+	 * When a Userspace Thread is Assigned the AGSG it Makes a IOCtl Call with the COMMAND_SET_PAGES Flag in Order to Create the Scatter/Gather Lists for its Source and Destination Memories.
+	 */		
+	case COMMAND_SET_PAGES:
 
-				/*
-				 * Set the FPGA's Acceleration Scheduler Scatter/Gather of the AGSG (through the PCIe Bus) with the Number of Image Rows that the AGSG will Process.
-				 */	
-				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_SG_ACCELERATION_SCHEDULER_SG + XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_IMAGE_ROWS_DATA, (u32)search_element->shared_repo_virtual_address->shared_image_info.rows); 							
+		/*
+		 * Lock the set_pages_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+		 */
+		down_write(&set_pages_sem);
+
+		/*
+		 * Get the Node of the Current Thread from the private_data of the Driver File where it was Stored when the Thread Opened the Driver File.
+		 */
+		search_element = (struct pid_reserved_memories *)file_pointer->private_data;
+
+		if(search_element != NULL)
+		{
+			
+			/*
+			 * Calculate the Number of Pages that the AGSG Accesses in the Userspace Source and Destination Memories According to the Image Rows,
+			 * the Input Format and the Packed Output Mode (See accel_sg_job_pages()) so that only these Pages are Pinned, Mapped and Written to the FPGA BRAM.
+			 * 
+			 * For Example, an Image of 1920x1080 Resolution in the Default Format Has Size 8294400 Bytes (1920 x 1080 x 4Bytes).
+			 * For an Image Size of 8294400 Bytes and a Page Size of 4096 Bytes we Require 2025 Pages (8294400/4096).
+			 */
+			buffer_entries_source = min(accel_sg_job_pages(search_element, 0), SG_LIST_ENTRIES);
+			buffer_entries_destination = min(accel_sg_job_pages(search_element, 1), SG_LIST_ENTRIES);
+
+			
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Set Scatter/Gather Pages\n", driver_name, current->pid);
+			#endif	
+
+			/*
+			 * The userspace_value is a Variable with Data from the Current Userspace Thread that are Carried Along with the IOCtl Command.
+			 * The Data of the userspace_value herein is a Pointer to a Structure of Type struct sg_list_addresses which Contains the Pointers of the Source and Destination Userspace Memories
+			 * that the Current Userspace Thread Created in order to Occupy the AGSG.
+			 * 
+			 * The Structure is Copied with copy_from_user() to the Local sg_registration_request (as in the COMMAND_REGISTER_PAGES Case) and the sg_list_src_dst_addresses Pointer is Set to the Copy.
+			 * This Way we Can Access the Virtual Addresses of the Userspace Source and Destination Memories in order to Create their Scatter/Gather Lists.
+			 */
+			if(copy_from_user(&sg_registration_request, (void __user *)userspace_value, sizeof(struct sg_list_addresses)) != 0)
+			{
+				up_write(&set_pages_sem);
+				
+				return FAILURE;
+			}
+			
+			sg_list_src_dst_addresses = &sg_registration_request;
+			
+			/*
+			 * Never Pin Pages beyond the Sizes of the Userspace Memories if the Current Thread Gave them.
+			 */
+			if(sg_list_src_dst_addresses->source_size != 0)
+			{
+				buffer_entries_source = min(buffer_entries_source, accel_sg_pages(sg_list_src_dst_addresses->source_size));
+			}
+			
+			if(sg_list_src_dst_addresses->destination_size != 0)
+			{
+				buffer_entries_destination = min(buffer_entries_destination, accel_sg_pages(sg_list_src_dst_addresses->destination_size));
+			}
+		
+		/*
+		 * Check to Make Sure that the Pointers of the Userspace Source and Destination Memories is not NULL.
+		 * This is the Way to Validate that the Memories are Allocated Succesfully Before Trying to Create Their Scatter/Gather Lists.
+		 */
+		if(sg_list_src_dst_addresses->sg_list_source_address != NULL && sg_list_src_dst_addresses->sg_list_destination_address != NULL)
+		{
+			/*
+			 * Allocate a Kernel Memory Large Enough to Fit as many Structures of Type struct page as the Number of Pages that we Earlier Calculated in the buffer_entries_source Variable
+			 * and Set the buffer_page_array_source to Point at this Memory Allocation.
+			 * 
+			 * This is a Page Array.
+			 */
+			buffer_page_array_source = kmalloc(sizeof(struct page *) * buffer_entries_source, GFP_KERNEL);
+			
+			/*
+			 * Allocate a Kernel Memory Large Enough to Fit as many Structures of Type struct page as the Number of Pages that we Earlier Calculated in the buffer_entries_destination Variable
+			 * and Set the buffer_page_array_destination to Point at this Memory Allocation.
+			 * 
+			 * This is a Page Array.
+			 */				
+			buffer_page_array_destination = kmalloc(sizeof(struct page *) * buffer_entries_destination, GFP_KERNEL);
+			
+			/*
+			 * Lock the mmap_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+			 */					
+			down_read(&current->mm->mmap_sem);
+			
+			/*
+			 * Pin the the Source User Pages in Memory.
+			 * Upon Successful Completion, the Caller of get_user_pages() Has a Pages Array (buffer_page_array_source) Pointing to the Source Userspace Memory Allocation, which is Locked into Memory.
+			 * 
+			 * The get_user_pages() Returns the Number of Pages that were Succesfully Pinned(search_element->buffer_mapped_pages_source)
+			 * which is not Necessarily Equal to the Requested Pages(buffer_entries_source).
+			 */
+			search_element->buffer_mapped_pages_source = get_user_pages(current, current->mm, (unsigned long)(sg_list_src_dst_addresses->sg_list_source_address), buffer_entries_source, 1, 1, buffer_page_array_source, NULL);
+			
+			/*
+			 * Pin the the Destination User Pages in Memory.
+			 * Upon Successful Completion, the Caller of get_user_pages() Has a Pages Array (buffer_page_array_destination) Pointing to the Destination Userspace Memory Allocation, which is Locked into Memory.
+			 * 
+			 * The get_user_pages() Returns the Number of Pages that were Succesfully Pinned(search_element->buffer_mapped_pages_destination)
+			 * which is not Necessarily Equal to the Requested Pages(buffer_entries_destination).
+			 */				
+			search_element->buffer_mapped_pages_destination = get_user_pages(current, current->mm, (unsigned long)(sg_list_src_dst_addresses->sg_list_destination_address), buffer_entries_destination, 1, 1, buffer_page_array_destination, NULL);
+
+			/*
+			 * Now that we Got the Source Page Array (buffer_page_array_source) we Can Release the Source Pages.
+			 * Loop for as Many Times as the Number of Pinned Pages of the Source Userspace Memory.
+			 */
+			for(repeat = 0; repeat < search_element->buffer_mapped_pages_source; repeat++)	
+			{
+				/*
+				 * Release the Page of the Current Field of the Source Page Array.
+				 */
+				put_page(buffer_page_array_source[repeat]);
+		
+			}
+			
+			/*
+			 * Now that we Got the Destination Page Array (buffer_page_array_destination) we Can Release the Destination Pages.
+			 * Loop for as Many Times as the Number of Pinned Pages of the Destinaton Userspace Memory.
+			 */				
+			for(repeat = 0; repeat < search_element->buffer_mapped_pages_destination; repeat++)	
+			{
+				/*
+				 * Release the Page of the Current Field of the Destination Page Array.
+				 */
+				put_page(buffer_page_array_destination[repeat]);
+			}				
+				
+			/*
+			 * Unlock the mmap_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+			 */							
+			up_read(&current->mm->mmap_sem);
+
+			/*
+			 * Allocate Memory of Size Equal to struct sg_table.
+			 * Set the search_element->dma_sg_table_source to Point at this Memory Allocation.
+			 */
+			search_element->dma_sg_table_source = kmalloc(sizeof(struct sg_table), GFP_KERNEL);
+			
+			/*
+			 * Allocate Memory of Size Equal to struct sg_table.
+			 * Set the search_element->dma_sg_table_destinaiton to Point at this Memory Allocation.
+			 */				
+			search_element->dma_sg_table_destination = kmalloc(sizeof(struct sg_table), GFP_KERNEL);
+
+			/*
+			 * The sg_alloc_table Allocates the Memory to Use for the Actual Scatterlist Arrays of the Source Userspace Memory and Deals with the Process of Chaining them all Together.
+			 */
+			sg_table_value_source = sg_alloc_table(search_element->dma_sg_table_source, search_element->buffer_mapped_pages_source, GFP_KERNEL);
+			
+			/*
+			 * The sg_alloc_table Allocates the Memory to Use for the Actual Scatterlist Arrays of the Destinaiton Userspace Memory and Deals with the Process of Chaining them all Together.
+			 */				
+			sg_table_value_destination = sg_alloc_table(search_element->dma_sg_table_destination, search_element->buffer_mapped_pages_destination, GFP_KERNEL);
+			
+			/*
+			 * The search_element->dma_sg_table_source->sgl Points to the Memory where the Source Scatter/Gather List will be Stored.
+			 * Set the search_element->scatterlist_pointer_source Pointer that Belongs to the Current Thread to Point at the Same Memory where the Source Scatter/Gather List will be Stored.
+			 */
+			search_element->scatterlist_pointer_source = search_element->dma_sg_table_source->sgl;
+			
+			/*
+			 * The search_element->dma_sg_table_destination->sgl Points to the Memory where the Destination Scatter/Gather List will be Stored.
+			 * Set the search_element->scatterlist_pointer_destination Pointer that Belongs to the Current Thread to Point at the Same Memory where the Destination Scatter/Gather List will be Stored.
+			 */				
+			search_element->scatterlist_pointer_destination = search_element->dma_sg_table_destination->sgl;	
+			
+			/*
+			 * Loop for as Many Times as the Number of Pinned Pages of the Source Userspace Memory.
+			 */					
+			for(repeat = 0; repeat < search_element->buffer_mapped_pages_source; repeat++)
+			{
+				/*
+				 * Get the Current Page from the Source Page Array and Set Accordingly the Current Scatter/Gather List Entry (search_element->scatterlist_pointer_source) of that Page.
+				 */
+				sg_set_page(search_element->scatterlist_pointer_source, buffer_page_array_source[repeat], PAGE_SIZE, 0);
+				
+				/*
+				 * Use sg_next() to Walk to the Next Scatter/Gather List Entry that will be Set in the Next Iteration.
+				 */
+				search_element->scatterlist_pointer_source = sg_next(search_element->scatterlist_pointer_source);
+			}
 			
+	
+			/*
+			 * Loop for as Many Times as the Number of Pinned Pages of the Destination Userspace Memory.
+			 */					
+			for(repeat = 0; repeat < search_element->buffer_mapped_pages_destination; repeat++)
+			{
 				/*
-				 * Set the FPGA's Acceleration Scheduler Scatter/Gather of the AGSG (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
+				 * Get the Current Page from the Destination Page Array and Set Accordingly the Current Scatter/Gather List Entry (search_element->scatterlist_pointer_destinaiton) of that Page.
 				 */					
-				write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_SG_ACCELERATION_SCHEDULER_SG + XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_AP_CTRL, (u32)START);
+				sg_set_page(search_element->scatterlist_pointer_destination, buffer_page_array_destination[repeat], PAGE_SIZE, 0);
+				
+				/*
+				 * Use sg_next() to Walk to the Next Scatter/Gather List Entry that will be Set in the Next Iteration.
+				 */					
+				search_element->scatterlist_pointer_destination = sg_next(search_element->scatterlist_pointer_destination);
+			}		
+			
+			/*
+			 * The Usage of sg_next() Made the search_element->scatterlist_pointer_source Pointer to Point at the Last Scatter/Gather List Entry.
+			 * So, Set the search_element->scatterlist_pointer_source to Point again at the Beginning of the Scatter/Gathet List (search_element->dma_sg_table_source->sgl)
+			 */
+			search_element->scatterlist_pointer_source = search_element->dma_sg_table_source->sgl;
+			
+			/*
+			 * The Usage of sg_next() Made the search_element->scatterlist_pointer_destination Pointer to Point at the Last Scatter/Gather List Entry.
+			 * So, Set the search_element->scatterlist_pointer_destination to Point again at the Beginning of the Scatter/Gathet List (search_element->dma_sg_table_destination->sgl)
+			 */				
+			search_element->scatterlist_pointer_destination = search_element->dma_sg_table_destination->sgl;
+			
+			/*
+			 * Use dma_map_sg() which Fills the dma_address Field of each Entry of the Source Scatter/Gather List with the Physical Address of each Page of the Source Userspace Memory.
+			 * The Physical Address Can be Later Passed to the AGSG in Order to Access the Userspace Source Memory.
+			 */
+			search_element->buffer_dma_buffers_source = dma_map_sg(&dev->dev, search_element->scatterlist_pointer_source, search_element->buffer_mapped_pages_source, DMA_BIDIRECTIONAL);
 
-				#ifdef DEBUG_MESSAGES
-				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGSG\n", driver_name, current->pid);
-				#endif
+			/*
+			 * Use dma_map_sg() which Fills the dma_address Field of each Entry of the Destination Scatter/Gather List with the Physical Address of each Page of the Destination Userspace Memory.
+			 * The Physical Address Can be Later Passed to the AGSG in Order to Access the Userspace Destination Memory.
+			 */
+			search_element->buffer_dma_buffers_destination = dma_map_sg(&dev->dev, search_element->scatterlist_pointer_destination, search_element->buffer_mapped_pages_destination, DMA_BIDIRECTIONAL);
+			
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] DMA Source SG Pages Number: %d\n", driver_name, current->pid, search_element->buffer_dma_buffers_source);
+			printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] DMA Destination SG Pages Number: %d\n", driver_name, current->pid, search_element->buffer_dma_buffers_destination);
+			#endif
+			
+			/*
+			 * Clear the Pages Array of the Source Userspace Memory as it is no Longer Needed.
+			 */
+			kfree(buffer_page_array_source);
+			
+			/*
+			 * Clear the Pages Array of the Destination Userspace Memory as it is no Longer Needed.
+			 */				
+			kfree(buffer_page_array_destination);
+			
+			/*
+			 * Allocate Memory (64K) that will be Used as an Array to Store all the Physical Addresses of the Pages that Belong to the Source Userspace Memory.
+			 * The Allocation Size is Large Enough to Support Images of 4K Resolution that Require 8100 Pages.
+			 * 
+			 * The Physical Addresses of this Allocation will be Copied in the FPGA BRAM so that the AGSG Can Use them to Fetch the Initial Image Data from the Source Userspace Memory.
+			 */
+			search_element->u64_sg_list_source = (uint64_t *)kmalloc( 64 * KBYTE, GFP_KERNEL);
+			
+			/*
+			 * Allocate Memory (64K) that will be Used as an Array to Store all the Physical Addresses of the Pages that Belong to the Destination Userspace Memory.
+			 * The Allocation Size is Large Enough to Support Images of 4K Resolution that Require 8100 Pages.
+			 * 
+			 * The Physical Addresses of this Allocation will be Copied in the FPGA BRAM so that the AGSG Can Use them to Send the Processed Image Data to the Destination Userspace Memory.
+			 */				
+			search_element->u64_sg_list_destination = (uint64_t *)kmalloc( 64 * KBYTE, GFP_KERNEL);
+
+
+			for(repeat = 0; repeat < search_element->buffer_dma_buffers_source; repeat++)
+			{
+				/*
+				 * Use sg_dma_address() to Get the Physical Address of the Source Page of the Current Source Scatter/Gather List Entry.
+				 * Store the Physical Address to the Current Field of the search_element->u64_sg_list_source Array Pointer.
+				 */
+				search_element->u64_sg_list_source[repeat] = sg_dma_address(search_element->scatterlist_pointer_source);
+				
+				/*
+				 * The sg_dma_len() is Useful If we Needed to Know the Data Size in Each Page.
+				 * It is not Currently Used but it is Kept for Future Implementations.
+				 */
+				//sg_list_length_source_base_address[repeat] = sg_dma_len(scatterlist_pointer_source);
+			
+				/*
+				 * Use sg_next() to Walk to the Next Scatter/Gather List Entry.
+				 */					
+				search_element->scatterlist_pointer_source = sg_next(search_element->scatterlist_pointer_source);
+						
+			}					
+			
+			
+			for(repeat = 0; repeat < search_element->buffer_dma_buffers_destination; repeat++)
+			{
+				/*
+				 * Use sg_dma_address() to Get the Physical Address of the Destination Page of the Current Destination Scatter/Gather List Entry.
+				 * Store the Physical Address to the Current Field of the search_element->u64_sg_list_destination Array Pointer.
+				 */					
+				search_element->u64_sg_list_destination[repeat] = sg_dma_address(search_element->scatterlist_pointer_destination);
+				
+				/*
+				 * The sg_dma_len() is Useful If we Needed to Know the Data Size in Each Page.
+				 * It is not Currently Used but it is Kept for Future Implementations.
+				 */					
+				//sg_list_length_destination_base_address[repeat] = sg_dma_len(scatterlist_pointer_destination);
+			
+				/*
+				 * Use sg_next() to Walk to the Next Scatter/Gather List Entry.
+				 */					
+				search_element->scatterlist_pointer_destination = sg_next(search_element->scatterlist_pointer_destination);
+						
+			}	
+
+			/*
+			 * The Usage of sg_next() Made the search_element->scatterlist_pointer_source Pointer to Point at the Last Scatter/Gather List Entry.
+			 * So, Set the search_element->scatterlist_pointer_source to Point again at the Beginning of the Scatter/Gathet List (search_element->dma_sg_table_source->sgl)
+			 */	
+			search_element->scatterlist_pointer_source = search_element->dma_sg_table_source->sgl;
+			
+			/*
+			 * The Usage of sg_next() Made the search_element->scatterlist_pointer_destination Pointer to Point at the Last Scatter/Gather List Entry.
+			 * So, Set the search_element->scatterlist_pointer_destination to Point again at the Beginning of the Scatter/Gathet List (search_element->dma_sg_table_destination->sgl)
+			 */					
+			search_element->scatterlist_pointer_destination = search_element->dma_sg_table_destination->sgl;
+			
+			
+			/*
+			 * Use pci_dma_sync_sg_for_device() that Synchronizes the Source Userspace Memory so that the Device Can See the Most Up to Date Data.
+			 * This Step Should Take Place Before Actually Giving the Physical Addresses of the Scatter/Gather List to the Hardware (AGSG).
+			 */
+			pci_dma_sync_sg_for_device(dev, search_element->scatterlist_pointer_source, search_element->buffer_dma_buffers_source, PCI_DMA_TODEVICE);
+			
+			/*
+			 * Use pci_dma_sync_sg_for_device() that Synchronizes the Destination Userspace Memory so that the Device Can See the Most Up to Date Data.
+			 * This Step Should Take Place Before Actually Giving the Physical Addresses of the Scatter/Gather List to the Hardware (AGSG).
+			 */				
+			pci_dma_sync_sg_for_device(dev, search_element->scatterlist_pointer_destination, search_element->buffer_dma_buffers_destination, PCI_DMA_TODEVICE);
+							
+			}				
+		}
+		
+		/*
+		 * Unlock the set_pages_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+		 */			
+		up_write(&set_pages_sem);
+	
+		
+		break;	
+		
+		
+		/*
+		 * This Case is Used when the Current Thread of the Userspace Application Requests to Unmap the Pages that were Mapped
+		 * when Creating the Scatter/Gather Lists for the Need of the Current Thread.
+		 * 
+		 * It, also, Releases the Scatter/Gather Lists and any Resources that were Required for the Scatter/Gather Operations of the Current Thread.
+		 */			
+		case COMMAND_UNMAP_PAGES:
+	
+		/*
+		 * Lock the unmap_pages_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+		 */		
+		down_write(&unmap_pages_sem);
+		
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Going to Unmap Scatter/Gather Pages\n", driver_name, current->pid);
+		#endif	
+		
+		/*
+		 * Get the Node of the Current Thread from the private_data of the Driver File where it was Stored when the Thread Opened the Driver File.
+		 */
+		search_element = (struct pid_reserved_memories *)file_pointer->private_data;
+
+		if(search_element != NULL)
+		{
+			/*
+			 * Unmap the Scatter/Gather List of the Userspace Source Memory.
+			 * If we Avoid Unmapping, the Userspace Thread will not be able to Use the Source Memory Correctly.
+			 */
+			dma_unmap_sg(&dev->dev, search_element->scatterlist_pointer_source, search_element->buffer_mapped_pages_source, DMA_BIDIRECTIONAL);
+			
+			/*
+			 * Unmap the Scatter/Gather List of the Userspace Destination Memory.
+			 * If we Avoid Unmapping, the Userspace Thread will not be able to Use the Destination Memory Correctly.
+			 */				
+			dma_unmap_sg(&dev->dev, search_element->scatterlist_pointer_destination, search_element->buffer_mapped_pages_destination, DMA_BIDIRECTIONAL);
+			
+			/*
+			 * Free the Scatter/Gather List Table of the Source Userspace Memory.
+			 */
+			sg_free_table(search_element->dma_sg_table_source);
+			
+			/*
+			 * Free the Scatter/Gather List Table of the Destination Userspace Memory.
+			 */				
+			sg_free_table(search_element->dma_sg_table_destination);
+			
+			/*
+			 * Free the Memory Allocation where the Scatter/Gather List Table of the Source Memory was Stored.
+			 */
+			kfree(search_element->dma_sg_table_source);
+			
+			/*
+			 * Free the Memory Allocation where the Scatter/Gather List Table of the Destination Memory was Stored.
+			 */				
+			kfree(search_element->dma_sg_table_destination);
+			
+			/*
+			 * Free the Memory Allocation where the 64 Bit Physical Addresses of the Pages of the Source Userspace Memory were Stored.
+			 */
+			kfree(search_element->u64_sg_list_source);
+			
+			/*
+			 * Free the Memory Allocation where the 64 Bit Physical Addresses of the Pages of the Destination Userspace Memory were Stored.
+			 */				
+			kfree(search_element->u64_sg_list_destination);
+		}
+		
+		/*
+		 * Unlock the unmap_pages_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+		 */			
+		up_write(&unmap_pages_sem);
+				
+		break;	
+	
+		/*
+		 * This Case is Used when the Current Thread Requests to Register a Pair of Source and Destination Userspace Memories for the AGSG.
+		 * 
+		 * The userspace_value is a Pointer to a struct sg_list_addresses with the Memories and their size.
+		 * The Memories Stay Pinned and DMA Mapped (See accel_sg_register()) and the handle that is Written Back to the Structure
+		 * is Given to the COMMAND_REQUEST_ACCELERATOR_SG_ACCESS IOCtl Call instead of Making the COMMAND_SET_PAGES and COMMAND_UNMAP_PAGES IOCtl Calls for each Job.
+		 */
+		case COMMAND_REGISTER_PAGES:
+		
+		search_element = (struct pid_reserved_memories *)file_pointer->private_data;
+		
+		if(search_element == NULL || copy_from_user(&sg_registration_request, (void __user *)userspace_value, sizeof(struct sg_list_addresses)) != 0)
+		{
+			return FAILURE;
+		}
+		
+		down_write(&set_pages_sem);
+		
+		sg_registration_request.handle = accel_sg_register(search_element, &sg_registration_request);
+		
+		up_write(&set_pages_sem);
+		
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Registered Scatter/Gather Pages with Handle %d\n", driver_name, current->pid, sg_registration_request.handle);
+		#endif
+		
+		if(copy_to_user((void __user *)userspace_value, &sg_registration_request, sizeof(struct sg_list_addresses)) != 0 || sg_registration_request.handle == 0)
+		{
+			return FAILURE;
+		}
+		
+		break;
+		
+		/*
+		 * This Case is Used when the Current Thread Requests to Unregister the Memories of the handle that is Carried by the userspace_value.
+		 */
+		case COMMAND_UNREGISTER_PAGES:
+		
+		search_element = (struct pid_reserved_memories *)file_pointer->private_data;
+		
+		if(search_element == NULL)
+		{
+			return FAILURE;
+		}
+		
+		down_write(&set_pages_sem);
+		
+		if(accel_sg_unregister(search_element, (int)userspace_value) != SUCCESS)
+		{
+			up_write(&set_pages_sem);
+			
+			return FAILURE;
+		}
+		
+		up_write(&set_pages_sem);
+		
+		break;
+		
+		/*
+		 * This Case is Used when a Userspace Thread Requests to Reset the Acceleration Flags that are Used to Indicate which Threads (PIDs) Use the Acceleration Groups.
+		 * It is, also, Used to Reset the accelerator_busy Mask.
+		 */			
+		case COMMAND_RESET_VARIABLES:
+		
+		
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Going to Reset Driver Variables\n", driver_name, current->pid);
+		#endif	
+		
+		/*
+		 * Reset the accelerator_busy Mask.
+		 */
+		inter_process_shared_info_memory->shared_status_flags.accelerator_busy = 0;
+
+		/*
+		 * Reset the accel_direct_0_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGD0.
+		 */		
+		inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid = 0;
+		
+		/*
+		 * Reset the accel_direct_1_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGD1.
+		 */				
+		inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid = 0;
+		
+		/*
+		 * Reset the accel_indirect_0_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGI0.
+		 */		
+		inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid = 0;
+		
+		/*
+		 * Reset the accel_indirect_1_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGI1.
+		 */		
+		inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid = 0;
+		
+		/*
+		 * Reset the accel_indirect_2_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGI2.
+		 */		
+		inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid = 0;
+		
+		/*
+		 * Reset the accel_indirect_3_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGI3.
+		 */		
+		inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid = 0;
+				
+		/*
+		 * Reset the accel_sg_0_occupied_pid Flag that Indicates which Thread (PID) Occupies the AGSG.
+		 */		
+		inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid = 0;
+				
+		break;		
+		
+	/*
+	 * This IOCtl Call is Made After the Current Thread Has Called the COMMAND_REQUEST_ACCELERATOR_ACCESS IOCtl Call and the Driver Assigned AGSG to the Current Thread.
+	 * Then, the Current Thread Had to Make the COMMAND_SET_PAGES IOCtl Call to Create the Scatter/Gather Lists that are Required for the AGSG to Operate.
+	 * Finally the Current Userspace Thread Makes the COMMAND_REQUEST_ACCELERATOR_SG_ACCESS IOCtl Call in order to Start the AGSG.
+	 */		
+	case COMMAND_REQUEST_ACCELERATOR_SG_ACCESS:
+
+		/*
+		 * Lock the sg_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+		 */
+		down_write(&sg_sem);
+		
+		/*
+		 * Get the Node of the Current Thread from the private_data of the Driver File where it was Stored when the Thread Opened the Driver File.
+		 */
+		search_element = (struct pid_reserved_memories *)file_pointer->private_data;
+
+		if(search_element != NULL)
+		{
+
+			/*
+			 * Lock the case_6_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
+			 */				
+			down_write(&case_6_sem);
+			
+			/*
+			 * Read a 64 Bit Time Value from the FPGA's Shared Timer (Shared APM) which is the Time Moment that the Sleep State (If the Thread was in Sleep State) of the Current Thread Has Ended.
+			 * Store this Time Value in the Metrics Structure which is inside the Metrics Kernel Memory of the Current Thread.
+			 */					
+			search_element->shared_repo_virtual_address->process_metrics.sleep_time_end = readq((u64 *)bar0_address_virtual + BAR0_OFFSET_TIMER / 8);
+			
+			/*
+			 * Unlock the case_6_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+			 */					
+			up_write(&case_6_sem);
+	
+			/////////////////////////////////////////////////////////////////////////////////////////
+			//Set Up and Start Accelerator Group SG
+			/////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+			 * The userspace_value is the handle of a Registration of the COMMAND_REGISTER_PAGES Case or 0 to Use the Scatter/Gather Lists of the COMMAND_SET_PAGES Case.
+			 */
+			sg_registration = accel_sg_lookup(search_element, (int)userspace_value);
+			
+			if(sg_registration != NULL)
+			{
+				sg_source_pages = accel_sg_job_pages(search_element, 0);
+				sg_destination_pages = accel_sg_job_pages(search_element, 1);
+				
+				/*
+				 * An Image that does not Fit in the Registered Memories is not Started.
+				 * The AGSG is Released and Marked Completed so that the Thread does not Wait for an Interrupt that will not Come.
+				 */
+				if(sg_source_pages > sg_registration->source.pinned_pages || sg_destination_pages > sg_registration->destination.pinned_pages)
+				{
+					search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_SG_OCCUPIED;
+					
+					inter_process_shared_info_memory->shared_status_flags.agsg_busy = 0;
+					inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid = 0;
+					
+					up_write(&sg_sem);
+					
+					wake_up_interruptible(&ioctl_queue);
+					wake_up_interruptible(&completion_queue);
+					
+					return FAILURE;
+				}
+				
+				/*
+				 * The Pages Stay Mapped between the Jobs so only the CPU Caches are Synchronized before the AGSG Reads the Source and Writes the Destination Memory.
+				 * The Scatterlists of a Registration Have one Entry per Page so only the First Entries that Cover the Pages of the Job are Synchronized.
+				 * The Destination Memory is Synchronized for the CPU by the irq_handler_6() through the sg_active_registration and the sg_active_destination_pages.
+				 */
+				dma_sync_sg_for_device(&dev->dev, sg_registration->source.sg_table->sgl, sg_source_pages, DMA_BIDIRECTIONAL);
+				dma_sync_sg_for_device(&dev->dev, sg_registration->destination.sg_table->sgl, sg_destination_pages, DMA_BIDIRECTIONAL);
+				
+				/*
+				 * The sg_active_registration is Protected by the msi_7_sem Semaphore as in the irq_handler_6() and the accel_sg_unregister().
+				 */
+				down_write(&msi_7_sem);
+				
+				search_element->sg_active_registration = sg_registration;
+				search_element->sg_active_destination_pages = sg_destination_pages;
+				
+				up_write(&msi_7_sem);
+				
+				/*
+				 * Write only the Extents that Cover the Pages that the AGSG will Access and only if the FPGA BRAM does not Already Hold them from a Previous Job of the Same Registration.
+				 */
+				if(sg_bram_registration != sg_registration || sg_bram_source_pages < sg_source_pages || sg_bram_destination_pages < sg_destination_pages)
+				{
+					sg_source_extents = accel_sg_extent_count(&sg_registration->source, sg_source_pages);
+					sg_destination_extents = accel_sg_extent_count(&sg_registration->destination, sg_destination_pages);
+					
+					for(repeat = 0; repeat < sg_source_extents; repeat++)
+					{
+						writeq(sg_registration->source.u64_sg_list[repeat], (u64 *) bar1_address_virtual + repeat + 8192);
+					}
+					
+					for(repeat = 0; repeat < sg_destination_extents; repeat++)
+					{
+						writeq(sg_registration->destination.u64_sg_list[repeat], (u64 *) bar1_address_virtual + repeat + 16384);
+					}
+					
+					sg_bram_registration = sg_registration;
+					sg_bram_source_pages = sg_source_pages;
+					sg_bram_destination_pages = sg_destination_pages;
+				}
+			}
+			else
+			{
+				/*
+				 * Loop for as Many Times as the Number of Pinned Pages of the Source Userspace Memory.
+				 */			
+				for(repeat = 0; repeat < search_element->buffer_dma_buffers_source; repeat++)
+				{
+					/*
+					 * Write the 64 Bit SG List Source Addresses of the Current Thread to FPGA BRAM at 32K Offset.
+					 */ 					 
+					writeq(search_element->u64_sg_list_source[repeat], (u64 *) bar1_address_virtual + repeat + 8192);					
+				}	
+			
+			
+				/*
+				 * Loop for as Many Times as the Number of Pinned Pages of the Destination Userspace Memory.
+				 */						
+				for(repeat = 0; repeat < search_element->buffer_dma_buffers_destination; repeat++)
+				{
+					/*
+					 * Write the 64 Bit SG List Destination Addresses of the Current Thread to FPGA BRAM at 64K Offset.
+					 */ 	
+					writeq(search_element->u64_sg_list_destination[repeat], (u64 *) bar1_address_virtual + repeat + 16384);						 
+				 						
+				}
+				
+				sg_bram_registration = NULL;
+			}
+
+			/*
+			 * Set the FPGA's Acceleration Scheduler Scatter/Gather of the AGSG (through the PCIe Bus) with the Number of Image Columns that the AGSG will Process.
+			 */		
+			write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_SG_ACCELERATION_SCHEDULER_SG + XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_IMAGE_COLS_DATA, (u32)search_element->shared_repo_virtual_address->shared_image_info.columns); 
+
+			/*
+			 * Set the FPGA's Acceleration Scheduler Scatter/Gather of the AGSG (through the PCIe Bus) with the Number of Image Rows that the AGSG will Process.
+			 */	
+			write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_SG_ACCELERATION_SCHEDULER_SG + XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_IMAGE_ROWS_DATA, (u32)search_element->shared_repo_virtual_address->shared_image_info.rows); 							
+
+			/*
+			 * Set the FPGA's Acceleration Scheduler Scatter/Gather of the AGSG (through the PCIe Bus) with the Packed Output Mode and the Input Format that the Sobel Filter of the AGSG will Use.
+			 */
+			write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_SG_ACCELERATION_SCHEDULER_SG + XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_PACKED_OUTPUT_DATA, accel_packed_output(search_element));
+			write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_SG_ACCELERATION_SCHEDULER_SG + XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_INPUT_FORMAT_DATA, accel_input_format(search_element));
+			
+			/*
+			 * Set the Sobel Filter of the AGSG (through the PCIe Bus) with the Filter that the Thread Requested.
+			 */
+			accel_set_filter(BAR0_OFFSET_ACCEL_GROUP_SG_SOBEL_FILTER_4K, search_element);
+		
+			/*
+			 * Set the FPGA's Acceleration Scheduler Scatter/Gather of the AGSG (through the PCIe Bus) with the START Flag in Order to Start the Acceleration Procedure.
+			 */					
+			write_remote_register(bar0_address_virtual, BAR0_OFFSET_ACCEL_GROUP_SG_ACCELERATION_SCHEDULER_SG + XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_AP_CTRL, (u32)START);
+
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Sending Start Request to AGSG\n", driver_name, current->pid);
+			#endif
+		}
+		
+		/*
+		 * Unlock the sg_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+		 */		
+		up_write(&sg_sem);
+		
+		break;	
+		
+	/*
+	 * This Case is Used when a Userspace Thread Requests to Start Using the Submission Ring of its Metrics Kernel Memory.
+	 * The Ring Indices are Cleared so the Thread Should Make this IOCtl Call before Queueing its First Job and while it Has no Ring Jobs in Progress.
+	 */
+	case COMMAND_RING_SETUP:
+	
+		/*
+		 * Lock the ring_sem Semaphore so that the Ring Indices are not Accessed by the Interrupt Handlers while they are Cleared.
+		 */
+		down_write(&ring_sem);
+		
+		/*
+		 * Get the Node of the Current Thread from the private_data of the Driver File where it was Stored when the Thread Opened the Driver File.
+		 */
+		search_element = (struct pid_reserved_memories *)file_pointer->private_data;
+
+		if(search_element != NULL)
+		{
+			if(search_element->shared_repo_virtual_address != NULL && search_element->ring_in_flight == 0)
+			{
+				search_element->ring_submission_head = 0;
+				search_element->ring_completion_tail = 0;
+				
+				search_element->shared_repo_virtual_address->ring.submission_head = 0;
+				search_element->shared_repo_virtual_address->ring.submission_tail = 0;
+				search_element->shared_repo_virtual_address->ring.completion_head = 0;
+				search_element->shared_repo_virtual_address->ring.completion_tail = 0;
+				
+				search_element->ring_enabled = 1;
+				
+				#ifdef DEBUG_MESSAGES
+				printk(KERN_ALERT "[%s-DBG -> UNLOCKED IOCTL (PID %d)] Submission Ring is Set\n", driver_name, current->pid);
+				#endif
+			}
+		}
+		
+		/*
+		 * Unlock the ring_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
+		 */
+		up_write(&ring_sem);
+		
+		break;
+		
+	/*
+	 * This Case is Used when a Userspace Thread Has Queued new Jobs in its Submission Ring.
+	 * The Call does not Wait for the Jobs to Complete. The Driver Dispatches as many Queued Jobs (of any Thread) as there are Available Acceleration Groups
+	 * and the Rest of the Queued Jobs are Dispatched by the Interrupt Handlers as soon as the Acceleration Groups Complete.
+	 */
+	case COMMAND_RING_SUBMIT:
+	
+		down_write(&allocation_sem);
+		down_write(&ring_sem);
+		
+		accel_ring_dispatch();
+		
+		up_write(&ring_sem);
+		up_write(&allocation_sem);
+		
+		break;
+
+	default:
+		break;
+}
+
+return(SUCCESS);
+}
+
+/** OK
+  * xilinx_pci_driver_poll()
+  * 
+  * It is Called when a Userspace Thread Makes a poll() or select() File Operation on the Driver File.
+  * 
+  * It Allows the Userspace Thread to Sleep until the Acceleration Groups that it Occupied Have Completed instead of Reading the accel_completed Mask in Polling Mode.
+  * The Driver File is Reported as Readable (POLLIN) when the accel_completed Mask of the Current Thread is Equal to its accel_occupied Mask
+  * which is the Same Condition that the Userspace Thread Checks when Polling the Metrics Kernel Memory.
+  * For a Thread that Uses its Submission Ring the Driver File is Readable when its Completion Ring is not Empty.
+  */
+unsigned int xilinx_pci_driver_poll(struct file *file_pointer, poll_table *wait)
+{
+	/*
+	 * Pointer of Type struct pid_reserved_memories.
+	 * Used to Access the Singly Linked List where each Node Hold Metrics Information and Pointers for each Userspace Thread.
+	 */	
+	struct pid_reserved_memories *search_element = NULL;
+	
+	unsigned int mask = 0;
+	
+	/*
+	 * Add the completion_queue in the Poll Table so that the Current Thread is Woken Up by the Interrupt Handlers.
+	 */
+	poll_wait(file_pointer, &completion_queue, wait);
+	
+	/*
+	 * Get the Node of the Current Thread from the private_data of the Driver File where it was Stored when the Thread Opened the Driver File.
+	 */
+	search_element = (struct pid_reserved_memories *)file_pointer->private_data;
+
+	if(search_element != NULL)
+	{
+		if(search_element->shared_repo_virtual_address != NULL)
+		{
+			/*
+			 * If the Current Thread Uses its Submission Ring then the Driver File is Readable when there are Completions that the Thread Has not Reaped yet.
+			 */
+			if(search_element->ring_enabled == 1)
+			{
+				if(READ_ONCE(search_element->shared_repo_virtual_address->ring.completion_tail) != READ_ONCE(search_element->shared_repo_virtual_address->ring.completion_head))
+				{
+					mask |= POLLIN | POLLRDNORM;
+				}
+			}
+			else if(search_element->shared_repo_virtual_address->accel_completed == search_element->shared_repo_virtual_address->accel_occupied)
+			{
+				mask |= POLLIN | POLLRDNORM;
+			}
+		}
+	}
+	
+	return mask;
+}
+
+/** OK
+  * accel_ring_busy_flag()
+  * 
+  * Returns a Pointer to the Busy Flag (FPGA BRAM) of the Acceleration Group with Index group (0 for AGD0 up to 5 for AGI3).
+  */
+u32 *accel_ring_busy_flag(int group)
+{
+	switch(group)
+	{
+		case 0: return &inter_process_shared_info_memory->shared_status_flags.agd0_busy;
+		case 1: return &inter_process_shared_info_memory->shared_status_flags.agd1_busy;
+		case 2: return &inter_process_shared_info_memory->shared_status_flags.agi0_busy;
+		case 3: return &inter_process_shared_info_memory->shared_status_flags.agi1_busy;
+		case 4: return &inter_process_shared_info_memory->shared_status_flags.agi2_busy;
+		default: return &inter_process_shared_info_memory->shared_status_flags.agi3_busy;
+	}
+}
+
+/** OK
+  * accel_ring_occupied_pid()
+  * 
+  * Returns a Pointer to the Occupied PID Flag (FPGA BRAM) of the Acceleration Group with Index group (0 for AGD0 up to 5 for AGI3).
+  */
+u32 *accel_ring_occupied_pid(int group)
+{
+	switch(group)
+	{
+		case 0: return &inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid;
+		case 1: return &inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid;
+		case 2: return &inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid;
+		case 3: return &inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid;
+		case 4: return &inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid;
+		default: return &inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid;
+	}
+}
+
+/** OK
+  * accel_ring_pending()
+  * 
+  * Checks if the Submission Ring of a Node Has a Queued Job that Can be Dispatched.
+  * A Job is only Dispatched if there is Room in the Completion Ring for its Completion as well as for the Completions of the Jobs that are Still Processed.
+  * The Indices Written by the Userspace Thread are not Trusted so a Ring with more than RING_ENTRIES Queued Jobs is Ignored.
+  * 
+  * The Caller Must Hold the ring_sem Semaphore.
+  */
+int accel_ring_pending(struct pid_reserved_memories *element)
+{
+	struct submission_ring *ring;
+	
+	u32 queued;
+	u32 reserved;
+	
+	if(element->ring_enabled == 0 || element->shared_repo_virtual_address == NULL)
+	{
+		return 0;
+	}
+	
+	ring = &element->shared_repo_virtual_address->ring;
+	
+	queued = READ_ONCE(ring->submission_tail) - element->ring_submission_head;
+	
+	if(queued == 0 || queued > RING_ENTRIES)
+	{
+		return 0;
+	}
+	
+	reserved = element->ring_completion_tail + element->ring_in_flight - READ_ONCE(ring->completion_head);
+	
+	if(reserved >= RING_ENTRIES)
+	{
+		return 0;
+	}
+	
+	return 1;
+}
+
+/** OK
+  * accel_ring_next_element()
+  * 
+  * Returns the Node whose Queued Job Should be Dispatched Next or NULL if no Node Has a Queued Job.
+  * The Search Starts after the Node of ring_last_pid so that the Submission Rings of the Threads are Served in Round Robin.
+  * 
+  * The Caller Must Hold the ring_sem Semaphore.
+  */
+struct pid_reserved_memories *accel_ring_next_element(void)
+{
+	struct pid_reserved_memories *search_element = NULL;
+	struct pid_reserved_memories *first_pending = NULL;
+	
+	int passed_last = 0;
+	
+	down_read(&search_element_sem);
+	
+	search_element = pid_list_head;
+	
+	while(search_element != NULL)
+	{
+		if(accel_ring_pending(search_element))
+		{
+			if(passed_last == 1)
+			{
+				up_read(&search_element_sem);
+				
+				return search_element;
+			}
+			
+			if(first_pending == NULL)
+			{
+				first_pending = search_element;
+			}
+		}
+		
+		if(search_element->pid == ring_last_pid)
+		{
+			passed_last = 1;
+		}
+		
+		search_element = search_element->next_pid;
+	}
+	
+	up_read(&search_element_sem);
+	
+	return first_pending;
+}
+
+/** OK
+  * accel_ring_post_completion()
+  * 
+  * Posts a Completion to the Completion Ring of a Node.
+  * The Completion Entry is Written before the completion_tail is Advanced so that the Userspace Thread never Reads an Incomplete Entry.
+  * 
+  * The Caller Must Hold the ring_sem Semaphore.
+  */
+void accel_ring_post_completion(struct pid_reserved_memories *element, u32 job_id, u32 accel_group, u32 status)
+{
+	struct submission_ring *ring = &element->shared_repo_virtual_address->ring;
+	struct ring_completion *completion = &ring->completions[element->ring_completion_tail & RING_ENTRIES_MASK];
+	
+	completion->job_id = job_id;
+	completion->accel_group = accel_group;
+	completion->status = status;
+	completion->reserved = 0;
+	
+	smp_wmb();
+	
+	element->ring_completion_tail++;
+	
+	WRITE_ONCE(ring->completion_tail, element->ring_completion_tail);
+}
+
+/** OK
+  * accel_ring_start_job()
+  * 
+  * Takes the Next Queued Job from the Submission Ring of a Node and Starts the Acceleration Group with Index group to Process it.
+  * The Acceleration Group is Set Up as in the COMMAND_REQUEST_ACCELERATOR_ACCESS Case of the xilinx_pci_driver_unlocked_ioctl()
+  * but the Source and Destination Addresses Point at the buffer_offset of the Job inside the Pre-Process Data Kernel Memory.
+  * 
+  * A Job whose Image does not Fit in the Pre-Process Data Kernel Memory is Completed at Once with the RING_STATUS_INVALID Status.
+  * In such Case the Acceleration Group is not Occupied and FAILURE is Returned.
+  * 
+  * The Caller Must Hold the ring_sem Semaphore and Must Own the Acceleration Group (Free Acceleration Group while Holding the allocation_sem Semaphore or Acceleration Group that just Completed a Ring Job).
+  */
+int accel_ring_start_job(int group, struct pid_reserved_memories *element)
+{
+	struct submission_ring *ring = &element->shared_repo_virtual_address->ring;
+	struct ring_submission submission;
+	
+	u64 image_size;
+	u64 scheduler;
+	u64 sobel_filter;
+	
+	/*
+	 * The Submission Entry is Read after the submission_tail that Published it (See accel_ring_pending()).
+	 */
+	smp_rmb();
+	
+	submission = ring->submissions[element->ring_submission_head & RING_ENTRIES_MASK];
+	
+	element->ring_submission_head++;
+	
+	WRITE_ONCE(ring->submission_head, element->ring_submission_head);
+	
+	/*
+	 * The Job is Processed in Place so the Larger of its Input and Output Rows (According to the Input Format and the Packed Output Mode of the Thread) Must Fit.
+	 * The Row Sizes are 32 Bit so Jobs with more Columns than Fit in a Single Row of the Pre-Process Data Kernel Memory are Rejected as well.
+	 */
+	image_size = (u64)submission.rows * (u64)max(accel_row_bytes(element, submission.columns, 0), accel_row_bytes(element, submission.columns, 1));
+	
+	if(submission.rows == 0 || submission.columns == 0 || submission.columns > MMAP_ALLOCATION_SIZE / 4 || element->pre_process_mmap_virtual_address == NULL || (u64)submission.buffer_offset + image_size > MMAP_ALLOCATION_SIZE)
+	{
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> RING (PID %d)] Rejected Invalid Job %u of PID %d\n", driver_name, current->pid, submission.job_id, element->pid);
+		#endif
+		
+		accel_ring_post_completion(element, submission.job_id, 0, RING_STATUS_INVALID);
+		
+		return FAILURE;
+	}
+	
+	ring_group_active[group] = 1;
+	ring_group_owner[group] = element;
+	ring_group_job_id[group] = submission.job_id;
+	
+	element->ring_in_flight++;
+	
+	*accel_ring_busy_flag(group) = 1;
+	*accel_ring_occupied_pid(group) = element->pid;
+	
+	/*
+	 * The AGD0 and AGD1 Access the Pre-Process Data Kernel Memory through the AXI BAR0 and AXI BAR1 Respectively.
+	 */
+	if(group == 0 || group == 1)
+	{
+		scheduler = (group == 0) ? BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_ACCELERATION_SCHEDULER_DIRECT : BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_ACCELERATION_SCHEDULER_DIRECT;
+		
+		write_remote_register(bar0_address_virtual, BAR0_OFFSET_PCIE_CTL + ((group == 0) ? AXI_BAR0_LOWER_ADDRESS_OFFSET : AXI_BAR1_LOWER_ADDRESS_OFFSET), (u32)element->pre_process_mmap_physical_address);
+		
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_DIRECT_HOST_SOURCE_ADDRESS_REGISTER_OFFSET, (u32)(((group == 0) ? AXI_BAR_0_OFFSET : AXI_BAR_1_OFFSET) + submission.buffer_offset));
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_DIRECT_HOST_DESTINATION_ADDRESS_REGISTER_OFFSET, (u32)(((group == 0) ? AXI_BAR_0_OFFSET : AXI_BAR_1_OFFSET) + submission.buffer_offset));
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_DIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)submission.columns);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_DIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)submission.rows);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_DIRECT_PACKED_OUTPUT_REGISTER_OFFSET, accel_packed_output(element));
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_DIRECT_INPUT_FORMAT_REGISTER_OFFSET, accel_input_format(element));
+		accel_set_filter((group == 0) ? BAR0_OFFSET_ACCEL_GROUP_DIRECT_0_SOBEL_FILTER : BAR0_OFFSET_ACCEL_GROUP_DIRECT_1_SOBEL_FILTER, element);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_DIRECT_CONTROL_REGISTER_OFFSET, (u32)START);
+	}
+	/*
+	 * The AGI0, AGI1, AGI2 and AGI3 Fetch and Send the Image Data with their CDMA from/to the Physical Address of the Pre-Process Data Kernel Memory.
+	 */
+	else
+	{
+		switch(group)
+		{
+			case 2: scheduler = BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_ACCELERATION_SCHEDULER_INDIRECT; sobel_filter = BAR0_OFFSET_ACCEL_GROUP_INDIRECT_0_SOBEL_FILTER; break;
+			case 3: scheduler = BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_ACCELERATION_SCHEDULER_INDIRECT; sobel_filter = BAR0_OFFSET_ACCEL_GROUP_INDIRECT_1_SOBEL_FILTER; break;
+			case 4: scheduler = BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_ACCELERATION_SCHEDULER_INDIRECT; sobel_filter = BAR0_OFFSET_ACCEL_GROUP_INDIRECT_2_SOBEL_FILTER; break;
+			default: scheduler = BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_ACCELERATION_SCHEDULER_INDIRECT; sobel_filter = BAR0_OFFSET_ACCEL_GROUP_INDIRECT_3_SOBEL_FILTER; break;
+		}
+		
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_INDIRECT_SOURCE_ADDRESS_FETCH_REGISTER_OFFSET, (u32)element->pre_process_mmap_physical_address);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_INDIRECT_DESTINATION_ADDRESS_SEND_REGISTER_OFFSET, (u32)element->pre_process_mmap_physical_address);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_FETCH_REGISTER_OFFSET, (u32)submission.buffer_offset);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_INDIRECT_OFFSET_SEND_REGISTER_OFFSET, (u32)submission.buffer_offset);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_COLUMNS_REGISTER_OFFSET, (u32)submission.columns);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_INDIRECT_IMAGE_ROWS_REGISTER_OFFSET, (u32)submission.rows);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_INDIRECT_PACKED_OUTPUT_REGISTER_OFFSET, accel_packed_output(element));
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_INDIRECT_INPUT_FORMAT_REGISTER_OFFSET, accel_input_format(element));
+		accel_set_filter(sobel_filter, element);
+		write_remote_register(bar0_address_virtual, scheduler + ACCELERATION_SCHEDULER_INDIRECT_CONTROL_REGISTER_OFFSET, (u32)START);
+	}
+	
+	#ifdef DEBUG_MESSAGES
+	printk(KERN_ALERT "[%s-DBG -> RING (PID %d)] Started Job %u of PID %d on Acceleration Group %d\n", driver_name, current->pid, submission.job_id, element->pid, group);
+	#endif
+	
+	return SUCCESS;
+}
+
+/** OK
+  * accel_ring_dispatch()
+  * 
+  * Dispatches Queued Ring Jobs to all the Available Acceleration Groups among the AGD0, AGD1, AGI0, AGI1, AGI2 and AGI3.
+  * 
+  * The Caller Must Hold the allocation_sem Semaphore (so that no Acceleration Group is Claimed Concurrently by the COMMAND_REQUEST_ACCELERATOR_ACCESS Case)
+  * and the ring_sem Semaphore.
+  */
+void accel_ring_dispatch(void)
+{
+	struct pid_reserved_memories *element = NULL;
+	
+	int group;
+	
+	for(group = 0; group < RING_ACCELERATION_GROUPS; group++)
+	{
+		if(*accel_ring_busy_flag(group) != 0)
+		{
+			continue;
+		}
+		
+		while((element = accel_ring_next_element()) != NULL)
+		{
+			ring_last_pid = element->pid;
+			
+			if(accel_ring_start_job(group, element) == SUCCESS)
+			{
+				break;
+			}
+		}
+		
+		/*
+		 * There are no more Queued Ring Jobs.
+		 */
+		if(element == NULL)
+		{
+			break;
+		}
+	}
+}
+
+/** OK
+  * accel_ring_complete()
+  * 
+  * Called by the Interrupt Handler of the Acceleration Group with Index group before any other Handling.
+  * If the Acceleration Group Processed a Ring Job then the Completion is Posted to the Completion Ring of the Thread that Queued the Job and 1 is Returned.
+  * Else 0 is Returned and the Interrupt Handler Continues as Usual.
+  * 
+  * Instead of Releasing the Acceleration Group the Next Queued Ring Job is Started Directly on it, unless there are Threads Sleeping in the ioctl_queue
+  * for a Free Acceleration Group which in such Case Get the Acceleration Group.
+  */
+int accel_ring_complete(int group)
+{
+	struct pid_reserved_memories *element = NULL;
+	
+	int handed_over = 0;
+	
+	down_write(&ring_sem);
+	
+	if(ring_group_active[group] == 0)
+	{
+		up_write(&ring_sem);
+		
+		return 0;
+	}
+	
+	element = ring_group_owner[group];
+	
+	/*
+	 * A Quarantined Acceleration Group (See accel_ring_shutdown()) Has no Owner since the Node of its Thread is Freed.
+	 * Its Late Interrupt Only Returns the Acceleration Group to Service.
+	 */
+	if(element != NULL)
+	{
+		accel_ring_post_completion(element, ring_group_job_id[group], (u32)(ACCELERATOR_DIRECT_0_OCCUPIED << group), RING_STATUS_SUCCESS);
+		
+		element->ring_in_flight--;
+	}
+	
+	ring_group_active[group] = 0;
+	ring_group_owner[group] = NULL;
+	
+	*accel_ring_occupied_pid(group) = 0;
+	
+	/*
+	 * Acknowledge the MSI Interrupt before the Acceleration Group is Started Again.
+	 */
+	write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);
+	
+	if(waitqueue_active(&ioctl_queue) == 0)
+	{
+		while((element = accel_ring_next_element()) != NULL)
+		{
+			ring_last_pid = element->pid;
+			
+			if(accel_ring_start_job(group, element) == SUCCESS)
+			{
+				handed_over = 1;
+				
+				break;
+			}
+		}
+	}
+	
+	if(handed_over == 0)
+	{
+		*accel_ring_busy_flag(group) = 0;
+	}
+	
+	up_write(&ring_sem);
+	
+	wake_up_interruptible(&ioctl_queue);
+	
+	/*
+	 * wake_up() is Used so that accel_ring_shutdown() (Uninterruptible Wait) is, also, Woken Up.
+	 */
+	wake_up(&completion_queue);
+	
+	return 1;
+}
+
+/** OK
+  * accel_ring_kick()
+  * 
+  * Called by the Interrupt Handlers after an Acceleration Group that was Occupied through the COMMAND_REQUEST_ACCELERATOR_ACCESS Case is Released
+  * so that Queued Ring Jobs Can Use it.
+  * 
+  * The allocation_sem Semaphore is Never Held while Sleeping in the ioctl_queue so the Interrupt Handlers Can Wait for it.
+  * The Lock Order is allocation_sem First and ring_sem Second as in the COMMAND_RING_SUBMIT Case.
+  */
+void accel_ring_kick(void)
+{
+	down_write(&allocation_sem);
+	down_write(&ring_sem);
+	
+	accel_ring_dispatch();
+	
+	up_write(&ring_sem);
+	up_write(&allocation_sem);
+}
+
+/** OK
+  * accel_ring_shutdown()
+  * 
+  * Called when a Thread Releases the Driver.
+  * It Stops Dispatching the Ring Jobs of the Node and Waits up to RING_RELEASE_TIMEOUT_MS for the Ring Jobs of the Node that are Still Processed.
+  * Every Ring Job Ends with an Interrupt that Calls accel_ring_complete() which Decrements the ring_in_flight and Wakes Up the completion_queue.
+  * 
+  * If an Acceleration Group Never Raises its Interrupt (Hung Core, DMA Error or Removed Device) the Acceleration Group is Quarantined:
+  * it is Detached from the Node but it Keeps its Busy Flag so that it is Neither Allocated nor Given Ring Jobs until its Interrupt Arrives.
+  * 
+  * Returns 0 if all the Ring Jobs Completed or 1 if any Acceleration Group was Quarantined.
+  * In the Latter Case the Quarantined Acceleration Group May Still Access the Pre-Process Data Kernel Memory of the Node so the Caller Must not Free it.
+  */
+int accel_ring_shutdown(struct pid_reserved_memories *element)
+{
+	int quarantined = 0;
+	int group;
+	
+	down_write(&ring_sem);
+	
+	element->ring_enabled = 0;
+	
+	up_write(&ring_sem);
+	
+	if(wait_event_timeout(completion_queue, READ_ONCE(element->ring_in_flight) == 0, msecs_to_jiffies(RING_RELEASE_TIMEOUT_MS)) != 0)
+	{
+		return 0;
+	}
+	
+	down_write(&ring_sem);
+	
+	for(group = 0; group < RING_ACCELERATION_GROUPS; group++)
+	{
+		if(ring_group_active[group] == 1 && ring_group_owner[group] == element)
+		{
+			ring_group_owner[group] = NULL;
+			
+			element->ring_in_flight--;
+			
+			quarantined = 1;
+			
+			#ifdef DEBUG_MESSAGES
+			printk(KERN_ALERT "[%s-DBG -> RING (PID %d)] Acceleration Group %d Quarantined after Job %u Timed Out\n", driver_name, current->pid, group, ring_group_job_id[group]);
+			#endif
+		}
+	}
+	
+	up_write(&ring_sem);
+	
+	return quarantined;
+}
+
+/** OK
+  * pid_list_lookup()
+  * 
+  * Returns the Node of the Thread with the Given PID or NULL if the Thread Has not Opened the Driver File.
+  * Only the pid_hash_table Bucket of the PID is Searched instead of the Whole Singly Linked List.
+  */
+struct pid_reserved_memories *pid_list_lookup(pid_t pid)
+{
+	struct pid_reserved_memories *search_element = NULL;
+	
+	down_read(&search_element_sem);
+	
+	search_element = pid_hash_table[pid & PID_HASH_MASK];
+	
+	while(search_element != NULL && search_element->pid != pid)
+	{
+		search_element = search_element->next_hash_pid;
+	}
+	
+	up_read(&search_element_sem);
+	
+	return search_element;
+}
+
+/** OK
+  * accel_resolve_policy()
+  * 
+  * Returns the Allocation Policy that Should be Applied to a Request for Acceleration Groups.
+  * 
+  * The requested_policy is the Policy that the Userspace Thread Selected in the IOCtl Call.
+  * ALLOCATION_POLICY_DEFAULT Selects the allocation_policy Module Parameter.
+  * The Size Aware Policy is Resolved to Greedy or Best Available According to the Size of the Image of the Node.
+  * Unknown Policies Fall Back to Greedy.
+  */
+int accel_resolve_policy(unsigned long requested_policy, struct pid_reserved_memories *element)
+{
+	int policy = (int)requested_policy;
+	
+	u64 pixels;
+	
+	if(requested_policy == ALLOCATION_POLICY_DEFAULT)
+	{
+		policy = READ_ONCE(allocation_policy);
+	}
+	
+	if(policy == ALLOCATION_POLICY_SIZE_AWARE)
+	{
+		pixels = (u64)element->shared_repo_virtual_address->shared_image_info.rows * element->shared_repo_virtual_address->shared_image_info.columns;
+		
+		if(pixels >= (u64)READ_ONCE(size_aware_split_pixels))
+		{
+			policy = ALLOCATION_POLICY_GREEDY;
+		}
+		else
+		{
+			policy = ALLOCATION_POLICY_BEST_AVAILABLE;
+		}
+	}
+	
+	if(policy < ALLOCATION_POLICY_GREEDY || policy > ALLOCATION_POLICY_FAIR_SHARE)
+	{
+		policy = ALLOCATION_POLICY_GREEDY;
+	}
+	
+	return policy;
+}
+
+/** OK
+  * accel_policy_max_groups()
+  * 
+  * Returns the Maximum Number of the AGD0, AGD1, AGI0, AGI1, AGI2, AGI3 Acceleration Groups that a Request with the Given (Resolved) Policy Can Occupy.
+  * 
+  * The Fair Share Policy Divides the SEGMENT_ACCELERATION_GROUPS Equally among the Threads that Have the Driver File Open (at Least One for each Request).
+  */
+int accel_policy_max_groups(int policy)
+{
+	int threads;
+	
+	switch(policy)
+	{
+		case ALLOCATION_POLICY_BEST_AVAILABLE:
+		
+			return 1;
+			
+		case ALLOCATION_POLICY_FAIR_SHARE:
+		
+			threads = READ_ONCE(open_threads);
+			
+			if(threads <= 1)
+			{
+				return SEGMENT_ACCELERATION_GROUPS;
+			}
+			
+			return max(SEGMENT_ACCELERATION_GROUPS / threads, 1);
+			
+		default:
+		
+			return SEGMENT_ACCELERATION_GROUPS;
+	}
+}
+
+/** OK
+  * accel_weight_segments()
+  * 
+  * Splits the rows of an Image to the segment_rows Array in Proportion to the accel_group_throughput of the Acceleration Group of each Segment.
+  * 
+  * Each Segment Gets at Least One Row and the Rows that are Left by the Integer Division are Given to the Fastest Acceleration Group.
+  * If the Weighted Split Cannot Give at Least One Row to each Segment then the Even Split of the Caller is Kept.
+  */
+void accel_weight_segments(int rows, int segments, int *segment_group, int *segment_rows)
+{
+	u64 weight[ACCELERATION_GROUPS];
+	u64 total_weight = 0;
+	
+	int weighted_rows[ACCELERATION_GROUPS];
+	int assigned_rows = 0;
+	int fastest = 0;
+	int repeat;
+	
+	if(rows < segments)
+	{
+		return;
+	}
+	
+	for(repeat = 0; repeat < segments; repeat++)
+	{
+		weight[repeat] = max_t(u32, READ_ONCE(accel_group_throughput[segment_group[repeat]]), 1);
+		
+		total_weight += weight[repeat];
+		
+		if(weight[repeat] > weight[fastest])
+		{
+			fastest = repeat;
+		}
+	}
+	
+	for(repeat = 0; repeat < segments; repeat++)
+	{
+		weighted_rows[repeat] = max_t(int, (int)div64_u64((u64)rows * weight[repeat], total_weight), 1);
+		
+		assigned_rows += weighted_rows[repeat];
+	}
+	
+	/*
+	 * The Fastest Acceleration Group Has the Most Rows so it Absorbs the Difference.
+	 */
+	weighted_rows[fastest] += rows - assigned_rows;
+	
+	if(weighted_rows[fastest] < 1)
+	{
+		return;
+	}
+	
+	for(repeat = 0; repeat < segments; repeat++)
+	{
+		segment_rows[repeat] = weighted_rows[repeat];
+	}
+}
+
+/** OK
+  * accel_calibrate_group()
+  * 
+  * Called by the Interrupt Handlers when an Acceleration Group Completes a Segment.
+  * 
+  * The Duration of the Segment is Taken from the Time Metrics that the Acceleration Group Stored to the FPGA BRAM, from the Start of the CDMA Fetch
+  * (or the Start of the Acceleration for the AGD0, AGD1 and AGSG which do not Use the CDMA) until the End of the CDMA Send (or the End of the Acceleration).
+  * The Throughput of the Segment is then Added to the accel_group_throughput of the Acceleration Group with a Moving Average of THROUGHPUT_AVERAGE_SHIFT.
+  */
+void accel_calibrate_group(int group, struct metrics *source)
+{
+	u32 timing[12];
+	
+	u64 time_start;
+	u64 time_end;
+	u64 bytes;
+	u64 sample;
+	
+	u32 throughput;
+	
+	bytes = READ_ONCE(accel_group_segment_bytes[group]);
+	
+	if(bytes == 0)
+	{
+		return;
+	}
+	
+	/*
+	 * Read the CDMA Fetch, CDMA Send and Acceleration Time Metrics (Offsets 32 to 76 Bytes of the metrics Structure) with a Single Burst.
+	 * timing[0, 1] is cdma_fetch_time_start, timing[6, 7] is cdma_send_time_end, timing[8, 9] is dma_accel_time_start and timing[10, 11] is dma_accel_time_end.
+	 */
+	memcpy_fromio(timing, &source->cdma_fetch_time_start_l, sizeof(timing));
+	
+	time_start = ((u64)timing[1] << 32) | timing[0];
+	time_end = ((u64)timing[7] << 32) | timing[6];
+	
+	if(time_start == 0 || time_end <= time_start)
+	{
+		time_start = ((u64)timing[9] << 32) | timing[8];
+		time_end = ((u64)timing[11] << 32) | timing[10];
+	}
+	
+	if(time_start == 0 || time_end <= time_start)
+	{
+		return;
+	}
+	
+	sample = div64_u64(bytes << 8, time_end - time_start);
+	
+	if(sample == 0 || sample > U32_MAX)
+	{
+		return;
+	}
+	
+	throughput = READ_ONCE(accel_group_throughput[group]);
+	
+	throughput = throughput - (throughput >> THROUGHPUT_AVERAGE_SHIFT) + ((u32)sample >> THROUGHPUT_AVERAGE_SHIFT);
+	
+	WRITE_ONCE(accel_group_throughput[group], max_t(u32, throughput, 1));
+}
+
+/** OK
+  * accel_copy_metrics()
+  * 
+  * Called by the Interrupt Handlers to Copy the Metrics of a Completed Acceleration Group from the FPGA BRAM to the Metrics Kernel Memory of the Thread that Occupied it.
+  * 
+  * The APM, CDMA and Acceleration Metrics are the First METRICS_HARDWARE_SIZE Bytes of the metrics Structure both in the FPGA BRAM and in the Metrics Kernel Memory.
+  * They are Copied with a Single memcpy_fromio() so that the PCIe Reads of the BAR1 are Made in Bursts instead of one Uncached Read Round Trip for each Field.
+  * 
+  * Nothing is Copied if the collect_metrics Module Parameter is Cleared.
+  */
+void accel_copy_metrics(struct metrics *destination, struct metrics *source)
+{
+	BUILD_BUG_ON(offsetof(struct metrics, shared_image_info) != METRICS_HARDWARE_SIZE);
+	
+	if(collect_metrics == 0)
+	{
+		return;
+	}
+	
+	memcpy_fromio(destination, source, METRICS_HARDWARE_SIZE);
+}
+
+/** OK
+  * accel_packed_output()
+  * 
+  * Returns the Value for the Packed Output Register of an Acceleration Scheduler according to the packed_output Field that the Thread Set in its Shared Repository.
+  * 
+  * The Shared Repository is Writable by the Userspace Application so any Value other than 1 Keeps the Sobel Filter in the Default 32 Bit per Pixel Output.
+  */
+u32 accel_packed_output(struct pid_reserved_memories *element)
+{
+	/*
+	 * The Gradient Output Formats Need the Whole 32 Bit Word of each Pixel so the Sobel Filter Never Packs them.
+	 */
+	if(accel_output_format(element) != OUTPUT_FORMAT_PIXEL)
+	{
+		return 0;
+	}
+	
+	if(READ_ONCE(element->shared_repo_virtual_address->packed_output) == 1)
+	{
+		return 1;
+	}
+	
+	/*
+	 * The Packed Input Formats are Processed in Place so the Processed Image Must not be Larger than the Initial Image.
+	 */
+	if(accel_input_format(element) != INPUT_FORMAT_BGRX)
+	{
+		return 1;
+	}
+	
+	return 0;
+}
+
+/** OK
+  * accel_input_format()
+  * 
+  * Returns the Value for the Input Format Register of an Acceleration Scheduler according to the input_format Field that the Thread Set in its Shared Repository.
+  * Unknown Values Fall Back to the Default INPUT_FORMAT_BGRX.
+  */
+u32 accel_input_format(struct pid_reserved_memories *element)
+{
+	int input_format = READ_ONCE(element->shared_repo_virtual_address->input_format);
+	
+	if(input_format == INPUT_FORMAT_BGR || input_format == INPUT_FORMAT_LUMA)
+	{
+		return (u32)input_format;
+	}
+	
+	return INPUT_FORMAT_BGRX;
+}
+
+/** OK
+  * accel_output_format()
+  * 
+  * Returns the Value for the Output Format Register of the Sobel Filter according to the output_format of the Filter Configuration that the Thread Set in its Shared Repository.
+  * 
+  * The Gradients are Returned as 32 Bit Words which Replace the Initial Image in the Same Memory so they Require the INPUT_FORMAT_BGRX.
+  * With the Packed Input Formats and for Unknown Values the Sobel Filter Returns the Filtered Pixels (OUTPUT_FORMAT_PIXEL).
+  */
+u32 accel_output_format(struct pid_reserved_memories *element)
+{
+	int output_format = READ_ONCE(element->shared_repo_virtual_address->filter.output_format);
+	
+	if(accel_input_format(element) != INPUT_FORMAT_BGRX)
+	{
+		return OUTPUT_FORMAT_PIXEL;
+	}
+	
+	if(output_format == OUTPUT_FORMAT_GRADIENTS || output_format == OUTPUT_FORMAT_MAGNITUDE)
+	{
+		return (u32)output_format;
+	}
+	
+	return OUTPUT_FORMAT_PIXEL;
+}
+
+/** OK
+  * accel_row_bytes()
+  * 
+  * Returns the Size in Bytes of an Image Row of columns Pixels for the Thread.
+  * With the destination Cleared the Size Follows the Input Format and with the destination Set it Follows the Packed Output Mode.
+  */
+u32 accel_row_bytes(struct pid_reserved_memories *element, u32 columns, int destination)
+{
+	if(destination)
+	{
+		return (accel_packed_output(element) == 1) ? ((columns + 3) / 4) * 4 : columns * 4;
+	}
+	
+	switch(accel_input_format(element))
+	{
+		case INPUT_FORMAT_BGR: return (((columns * 3) + 3) / 4) * 4;
+		case INPUT_FORMAT_LUMA: return ((columns + 3) / 4) * 4;
+		default: return columns * 4;
+	}
+}
+
+/** OK
+  * accel_input_row_bytes()
+  * 
+  * Returns the Size in Bytes that each Image Row of the Thread Occupies in the Pre-Process Data Kernel Memory According to its Input Format.
+  * It is Used to Locate the Image Segment of each Acceleration Group.
+  */
+u32 accel_input_row_bytes(struct pid_reserved_memories *element)
+{
+	return accel_row_bytes(element, (u32)element->shared_repo_virtual_address->shared_image_info.columns, 0);
+}
+
+/** OK
+  * accel_output_row_bytes()
+  * 
+  * Returns the Size in Bytes that each Processed Row of the Thread Occupies According to the Packed Output Mode.
+  */
+u32 accel_output_row_bytes(struct pid_reserved_memories *element)
+{
+	return accel_row_bytes(element, (u32)element->shared_repo_virtual_address->shared_image_info.columns, 1);
+}
+
+/** OK
+  * accel_sg_pages()
+  * 
+  * Returns the Number of Pages that Cover a Number of bytes.
+  * Sizes Beyond the Scatter/Gather Lists of the FPGA BRAM are Returned as SG_LIST_ENTRIES + 1 so that the Callers Can Reject them without Overflows.
+  */
+int accel_sg_pages(u64 bytes)
+{
+	if(bytes > (u64)SG_LIST_ENTRIES * PAGE_SIZE)
+	{
+		return SG_LIST_ENTRIES + 1;
+	}
+	
+	return (int)((bytes + PAGE_SIZE - 1) / PAGE_SIZE);
+}
+
+/** OK
+  * accel_sg_job_pages()
+  * 
+  * Returns the Number of Pages that the AGSG Reads from the Source (destination Cleared) or Writes to the Destination (destination Set) Userspace Memory
+  * for the Image of the Thread, According to its Input Format and Packed Output Mode.
+  * A QVGA Image in the Default Format, for Example, Covers 75 Pages and a Packed Output of the Same Image only 19.
+  */
+int accel_sg_job_pages(struct pid_reserved_memories *element, int destination)
+{
+	u64 row_bytes = (destination) ? accel_output_row_bytes(element) : accel_input_row_bytes(element);
+	
+	return accel_sg_pages((u64)element->shared_repo_virtual_address->shared_image_info.rows * row_bytes);
+}
+
+/** OK
+  * accel_set_filter()
+  * 
+  * Writes the Filter Mode, the Coefficients, the Shift and the Thresholds that the Thread Set in its Shared Repository
+  * to the Sobel Filter at the sobel_filter_offset of the PCIe BAR0.
+  * 
+  * The Acceleration Schedulers only Set the Image Registers of the Sobel Filter so the Filter Registers are Written Directly by the Driver
+  * while the Acceleration Group is Owned by the Thread and before its Acceleration Scheduler is Started.
+  * The Shared Repository is Writable by the Userspace Application so Unknown Filter Modes Fall Back to the FILTER_MODE_SOBEL.
+  * 
+  * The Output Format and the Pipeline Stages are Written in Every Mode since they Apply to the Sobel Edge Detection as well.
+  * The sobel_filter Core Has no Pipeline Stages Register and Ignores that Write.
+  */
+void accel_set_filter(u64 sobel_filter_offset, struct pid_reserved_memories *element)
+{
+	struct filter_config filter;
+	
+	u32 x_word;
+	u32 y_word;
+	
+	int word;
+	int byte;
+	int tap;
+	
+	memcpy(&filter, &element->shared_repo_virtual_address->filter, sizeof(struct filter_config));
+	
+	if(filter.mode != FILTER_MODE_LINEAR && filter.mode != FILTER_MODE_GRADIENT)
+	{
+		filter.mode = FILTER_MODE_SOBEL;
+	}
+	
+	write_remote_register(bar0_address_virtual, sobel_filter_offset + SOBEL_FILTER_FILTER_MODE_REGISTER_OFFSET, (u32)filter.mode);
+	write_remote_register(bar0_address_virtual, sobel_filter_offset + SOBEL_FILTER_OUTPUT_FORMAT_REGISTER_OFFSET, accel_output_format(element));
+	write_remote_register(bar0_address_virtual, sobel_filter_offset + SOBEL_FILTER_PIPELINE_STAGES_REGISTER_OFFSET, (u32)filter.stages & PIPELINE_STAGES_MASK);
+	
+	/*
+	 * The Sobel Filter Ignores the Rest Registers in the FILTER_MODE_SOBEL.
+	 */
+	if(filter.mode == FILTER_MODE_SOBEL)
+	{
+		return;
+	}
+	
+	/*
+	 * Each Register Holds 4 Coefficients where the First Coefficient is in the Least Significant Byte.
+	 */
+	for(word = 0; word < FILTER_COEFFICIENT_WORDS; word++)
+	{
+		x_word = 0;
+		y_word = 0;
+		
+		for(byte = 0; byte < 4; byte++)
+		{
+			tap = (word * 4) + byte;
+			
+			if(tap < FILTER_TAPS * FILTER_TAPS)
+			{
+				x_word |= ((u32)(u8)filter.x_coefficients[tap]) << (8 * byte);
+				y_word |= ((u32)(u8)filter.y_coefficients[tap]) << (8 * byte);
+			}
+		}
+		
+		write_remote_register(bar0_address_virtual, sobel_filter_offset + SOBEL_FILTER_X_COEFFICIENTS_REGISTER_OFFSET + (word * 4), x_word);
+		write_remote_register(bar0_address_virtual, sobel_filter_offset + SOBEL_FILTER_Y_COEFFICIENTS_REGISTER_OFFSET + (word * 4), y_word);
+	}
+	
+	write_remote_register(bar0_address_virtual, sobel_filter_offset + SOBEL_FILTER_COEFFICIENT_SHIFT_REGISTER_OFFSET, (u32)filter.shift & 0x1F);
+	write_remote_register(bar0_address_virtual, sobel_filter_offset + SOBEL_FILTER_THRESHOLD_LOW_REGISTER_OFFSET, (u32)filter.threshold_low);
+	write_remote_register(bar0_address_virtual, sobel_filter_offset + SOBEL_FILTER_THRESHOLD_HIGH_REGISTER_OFFSET, (u32)filter.threshold_high);
+}
+
+/** OK
+  * accel_sg_map_buffer()
+  * 
+  * Pins the pages Pages of a Userspace Memory that Starts at the Page Aligned address, Builds its Scatter/Gather Table, Maps it for DMA
+  * and Fills the u64_sg_list of the buffer with the Extents of Contiguous DMA Addresses in the Format that the AGSG Reads from the FPGA BRAM.
+  * 
+  * Unlike the COMMAND_SET_PAGES Case the Page References Taken by get_user_pages() are Kept until accel_sg_unmap_buffer()
+  * so the Pages Cannot be Migrated or Reclaimed while the AGSG Holds their DMA Addresses.
+  * 
+  * Each Page whose DMA Address Continues the Last Extent is Added to that Extent (up to SG_EXTENT_PAGES_MASK + 1 Pages) so a Memory Backed by
+  * Huge Pages or Merged by the IOMMU in Few DMA Segments is Described by Few Entries and the DMA SG PCIe Scheduler Issues Fewer and Longer Transfers.
+  * 
+  * Returns SUCCESS or FAILURE and in Case of Failure Everything that was Acquired is Released.
+  */
+int accel_sg_map_buffer(struct sg_buffer *buffer, unsigned long address, int pages)
+{
+	struct scatterlist *scatterlist_pointer;
+	
+	dma_addr_t segment_address;
+	unsigned int segment_length;
+	unsigned int offset;
+	
+	uint64_t page_address;
+	uint64_t extent_end = 0;
+	
+	int entries = 0;
+	int repeat;
+	
+	memset(buffer, 0, sizeof(struct sg_buffer));
+	
+	buffer->address = address;
+	buffer->page_array = kcalloc(pages, sizeof(struct page *), GFP_KERNEL);
+	buffer->sg_table = kzalloc(sizeof(struct sg_table), GFP_KERNEL);
+	buffer->u64_sg_list = kcalloc(pages, sizeof(uint64_t), GFP_KERNEL);
+	
+	if(buffer->page_array == NULL || buffer->sg_table == NULL || buffer->u64_sg_list == NULL)
+	{
+		accel_sg_unmap_buffer(buffer, 0);
+		
+		return FAILURE;
+	}
+	
+	down_read(&current->mm->mmap_sem);
+	
+	buffer->pinned_pages = get_user_pages(current, current->mm, address, pages, 1, 0, buffer->page_array, NULL);
+	
+	up_read(&current->mm->mmap_sem);
+	
+	if(buffer->pinned_pages != pages || sg_alloc_table(buffer->sg_table, pages, GFP_KERNEL) != 0)
+	{
+		accel_sg_unmap_buffer(buffer, 0);
+		
+		return FAILURE;
+	}
+	
+	for_each_sg(buffer->sg_table->sgl, scatterlist_pointer, pages, repeat)
+	{
+		sg_set_page(scatterlist_pointer, buffer->page_array[repeat], PAGE_SIZE, 0);
+	}
+	
+	buffer->dma_buffers = dma_map_sg(&dev->dev, buffer->sg_table->sgl, pages, DMA_BIDIRECTIONAL);
+	
+	for_each_sg(buffer->sg_table->sgl, scatterlist_pointer, buffer->dma_buffers, repeat)
+	{
+		segment_address = sg_dma_address(scatterlist_pointer);
+		segment_length = sg_dma_len(scatterlist_pointer);
+		
+		/*
+		 * A Segment that is not Page Aligned Cannot be Described by the Extents so the Registration Fails.
+		 * The Page Count of an Extent is Kept in the Offset Bits of its Page Aligned Address so SG_EXTENT_PAGES_MASK Must Cover Exactly the Page Offset.
+		 */
+		BUILD_BUG_ON(SG_EXTENT_PAGES_MASK != PAGE_SIZE - 1);
+		
+		if((segment_address & (PAGE_SIZE - 1)) != 0)
+		{
+			accel_sg_unmap_buffer(buffer, 0);
+			
+			return FAILURE;
+		}
+		
+		for(offset = 0; offset < segment_length && entries < pages; offset += PAGE_SIZE)
+		{
+			page_address = (uint64_t)(segment_address + offset);
+			
+			/*
+			 * Extend the Last Extent if the Page Follows it and the Extent has not Reached its Maximum Number of Pages or Start a New Extent.
+			 */
+			if(buffer->extents > 0 && page_address == extent_end && (buffer->u64_sg_list[buffer->extents - 1] & SG_EXTENT_PAGES_MASK) < SG_EXTENT_PAGES_MASK)
+			{
+				buffer->u64_sg_list[buffer->extents - 1]++;
+			}
+			else
+			{
+				buffer->u64_sg_list[buffer->extents++] = page_address;
+			}
+			
+			extent_end = page_address + PAGE_SIZE;
+			entries++;
+		}
+	}
+	
+	if(entries != pages)
+	{
+		accel_sg_unmap_buffer(buffer, 0);
+		
+		return FAILURE;
+	}
+	
+	#ifdef DEBUG_MESSAGES
+	printk(KERN_ALERT "[%s-DBG -> SG MAP BUFFER (PID %d)] Pinned %d Pages in %d DMA Segments and %d Extents\n", driver_name, current->pid, pages, buffer->dma_buffers, buffer->extents);
+	#endif
+	
+	return SUCCESS;
+}
+
+/** OK
+  * accel_sg_unmap_buffer()
+  * 
+  * Releases whatever accel_sg_map_buffer() Acquired for the buffer.
+  * The dirty Flag is Set for Memories that the AGSG Wrote so that their Pages are Marked Dirty before their References are Dropped.
+  */
+void accel_sg_unmap_buffer(struct sg_buffer *buffer, int dirty)
+{
+	int repeat;
+	
+	if(buffer->dma_buffers > 0)
+	{
+		dma_unmap_sg(&dev->dev, buffer->sg_table->sgl, buffer->pinned_pages, DMA_BIDIRECTIONAL);
+	}
+	
+	if(buffer->sg_table != NULL)
+	{
+		sg_free_table(buffer->sg_table);
+		kfree(buffer->sg_table);
+	}
+	
+	for(repeat = 0; repeat < buffer->pinned_pages; repeat++)
+	{
+		if(dirty)
+		{
+			set_page_dirty_lock(buffer->page_array[repeat]);
+		}
+		
+		put_page(buffer->page_array[repeat]);
+	}
+	
+	kfree(buffer->page_array);
+	kfree(buffer->u64_sg_list);
+	
+	memset(buffer, 0, sizeof(struct sg_buffer));
+}
+
+/** OK
+  * accel_sg_extent_count()
+  * 
+  * Returns the Number of the First Extents of the u64_sg_list of the buffer that Cover the First pages Pages of the Memory.
+  * These are the only Entries that the COMMAND_REQUEST_ACCELERATOR_SG_ACCESS Case Needs to Write to the FPGA BRAM for a Job.
+  */
+int accel_sg_extent_count(struct sg_buffer *buffer, int pages)
+{
+	int covered_pages = 0;
+	int extents = 0;
+	
+	while(extents < buffer->extents && covered_pages < pages)
+	{
+		covered_pages += (int)(buffer->u64_sg_list[extents] & SG_EXTENT_PAGES_MASK) + 1;
+		extents++;
+	}
+	
+	return extents;
+}
+
+/** OK
+  * accel_sg_lookup()
+  * 
+  * Returns the Registration of the Node that Corresponds to a handle of the COMMAND_REGISTER_PAGES IOCtl Call or NULL if the handle is not Registered.
+  */
+struct sg_registration *accel_sg_lookup(struct pid_reserved_memories *element, int handle)
+{
+	if(handle < 1 || handle > SG_REGISTRATIONS)
+	{
+		return NULL;
+	}
+	
+	return element->sg_registrations[handle - 1];
+}
 
-			}
-			 	
-			/*
-			 * Set the search_element Pointer to Point at the Next List Node.
-			 */					 			 
-			search_element = search_element->next_pid;
+/** OK
+  * accel_sg_register()
+  * 
+  * Pins and Maps the source_size Bytes of the Source and the destination_size Bytes of the Destination Userspace Memory of the addresses Structure
+  * in a Free Registration Slot of the Node.
+  * 
+  * The Memories Have to be Page Aligned (as the posix_memalign() Allocations of the Userspace Application) and Fit in the SG_LIST_ENTRIES of the FPGA BRAM.
+  * 
+  * Returns the handle of the Registration (1 up to SG_REGISTRATIONS) or 0 if the Registration Failed.
+  */
+int accel_sg_register(struct pid_reserved_memories *element, struct sg_list_addresses *addresses)
+{
+	struct sg_registration *registration;
+	
+	int source_pages = accel_sg_pages(addresses->source_size);
+	int destination_pages = accel_sg_pages(addresses->destination_size);
+	int slot;
+	
+	if(source_pages == 0 || source_pages > SG_LIST_ENTRIES || destination_pages == 0 || destination_pages > SG_LIST_ENTRIES)
+	{
+		return 0;
+	}
+	
+	if(((unsigned long)addresses->sg_list_source_address % PAGE_SIZE) != 0 || ((unsigned long)addresses->sg_list_destination_address % PAGE_SIZE) != 0)
+	{
+		return 0;
+	}
+	
+	for(slot = 0; slot < SG_REGISTRATIONS; slot++)
+	{
+		if(element->sg_registrations[slot] == NULL)
+		{
+			break;
 		}
+	}
+	
+	if(slot == SG_REGISTRATIONS)
+	{
+		return 0;
+	}
+	
+	registration = kzalloc(sizeof(struct sg_registration), GFP_KERNEL);
+	
+	if(registration == NULL)
+	{
+		return 0;
+	}
+	
+	if(accel_sg_map_buffer(&registration->source, (unsigned long)addresses->sg_list_source_address, source_pages) != SUCCESS)
+	{
+		kfree(registration);
 		
-		/*
-		 * Unlock the sg_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
-		 */		
-		up_write(&sg_sem);
-		
-		break;	
+		return 0;
+	}
+	
+	if(accel_sg_map_buffer(&registration->destination, (unsigned long)addresses->sg_list_destination_address, destination_pages) != SUCCESS)
+	{
+		accel_sg_unmap_buffer(&registration->source, 0);
+		kfree(registration);
 		
+		return 0;
+	}
 	
-
-	default:
-		break;
+	element->sg_registrations[slot] = registration;
+	
+	return slot + 1;
 }
 
-/*
- * Unlock the ioctl_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
- */
-up_write(&ioctl_sem);
+/** OK
+  * accel_sg_unregister()
+  * 
+  * Unmaps, Unpins and Frees the Registration of a handle.
+  * 
+  * It Fails while the AGSG Still Processes a Job of the Registration (until the irq_handler_6() Clears the sg_active_registration of the Node).
+  * The Registration is, also, Forgotten as the Owner of the FPGA BRAM Lists since a Later Registration May be Allocated at the Same Address.
+  */
+int accel_sg_unregister(struct pid_reserved_memories *element, int handle)
+{
+	struct sg_registration *registration = accel_sg_lookup(element, handle);
+	
+	int active;
+	
+	if(registration == NULL)
+	{
+		return FAILURE;
+	}
+	
+	down_read(&msi_7_sem);
+	
+	active = (element->sg_active_registration == registration);
+	
+	up_read(&msi_7_sem);
+	
+	if(active)
+	{
+		return FAILURE;
+	}
+	
+	down_write(&sg_sem);
+	
+	if(sg_bram_registration == registration)
+	{
+		sg_bram_registration = NULL;
+	}
+	
+	up_write(&sg_sem);
+	
+	accel_sg_unmap_buffer(&registration->source, 0);
+	accel_sg_unmap_buffer(&registration->destination, 1);
+	
+	kfree(registration);
+	
+	element->sg_registrations[handle - 1] = NULL;
+	
+	return SUCCESS;
+}
 
-return(SUCCESS);
+/** OK
+  * accel_sg_unregister_all()
+  * 
+  * Called by the xilinx_pci_driver_release() to Free the Registrations that the Thread did not Unregister.
+  * 
+  * If the AGSG Still Processes a Job of the Thread then it Waits until the irq_handler_6() Clears the sg_active_registration of the Node
+  * so that no Destination Page is Unpinned while the AGSG May Still Write to it.
+  * The Caller Must not Have Detached the Node from the accel_group_owner Array Yet since the irq_handler_6() Finds the Node through it.
+  */
+void accel_sg_unregister_all(struct pid_reserved_memories *element)
+{
+	int slot;
+	
+	wait_event(completion_queue, READ_ONCE(element->sg_active_registration) == NULL);
+	
+	for(slot = 0; slot < SG_REGISTRATIONS; slot++)
+	{
+		if(element->sg_registrations[slot] != NULL)
+		{
+			accel_sg_unregister(element, slot + 1);
+		}
+	}
 }
 
 /** OK
@@ -2572,6 +4197,7 @@ struct file_operations xilinx_kc705_driver_file_operations = {
     unlocked_ioctl: xilinx_pci_driver_unlocked_ioctl,
     open:           xilinx_pci_driver_open,
     release:        xilinx_pci_driver_release,
+    poll:           xilinx_pci_driver_poll,
 };
 
 
@@ -2758,40 +4384,23 @@ static int shared_repo_mmap(struct file *file, struct vm_area_struct *vma)
 	down_write(&shared_repo_mmap_sem);
 	
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */		
-	search_element = pid_list_head;
-	 
-	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 */		 
-	 while(search_element != NULL)
-	 {
-		
+	 * Find the Node of the PID that Made the MMap File Operation Call in the pid_hash_table.
+	 */
+	search_element = pid_list_lookup(current->pid);
+
+	if(search_element != NULL)
+	{
 		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Made the MMap File Operation Call.
-		 */		
-		if(search_element->pid == current->pid)
-		{
-			/*
-			 * Save the shared_repo_mmap_virtual_address Virtual Pointer inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
-			 * From this Moment the Virtual Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
-			 */
-			search_element->shared_repo_virtual_address = (struct shared_repository_process *)shared_repo_mmap_virtual_address;
-			
-			/*
-			 * Save the shared_repo_mmap_physical_address Physical Address inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
-			 * From this Moment the Physical Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
-			 */			
-			search_element->shared_repo_physical_address = (u32)shared_repo_mmap_physical_address;
-			
-			break;
-		}
-		 
+		 * Save the shared_repo_mmap_virtual_address Virtual Pointer inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
+		 * From this Moment the Virtual Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
+		 */
+		search_element->shared_repo_virtual_address = (struct shared_repository_process *)shared_repo_mmap_virtual_address;
+		
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */				 
-		search_element = search_element->next_pid;
+		 * Save the shared_repo_mmap_physical_address Physical Address inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
+		 * From this Moment the Physical Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
+		 */			
+		search_element->shared_repo_physical_address = (u32)shared_repo_mmap_physical_address;
 	}
 	
 	/*
@@ -2996,41 +4605,23 @@ static int pre_process_mmap_mmap(struct file *file, struct vm_area_struct *vma)
 	down_write(&pre_process_mmap_sem);
 	 
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */		 
-	search_element = pid_list_head;
-	 
-	 
-	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 */		 
-	 while(search_element != NULL)
-	 {
-		
+	 * Find the Node of the PID that Made the MMap File Operation Call in the pid_hash_table.
+	 */
+	search_element = pid_list_lookup(current->pid);
+
+	if(search_element != NULL)
+	{
 		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Made the MMap File Operation Call.
+		 * Save the pre_process_mmap_virtual_address Virtual Pointer inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
+		 * From this Moment the Virtual Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
 		 */			
-		if(search_element->pid == current->pid)
-		{
-			/*
-			 * Save the pre_process_mmap_virtual_address Virtual Pointer inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
-			 * From this Moment the Virtual Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
-			 */			
-			search_element->pre_process_mmap_virtual_address = pre_process_mmap_virtual_address;
-			
-			/*
-			 * Save the pre_process_mmap_physical_address Physical Address inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
-			 * From this Moment the Physical Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
-			 */				
-			search_element->pre_process_mmap_physical_address = (u32)pre_process_mmap_physical_address;
-			
-			break;
-		}
-		 
+		search_element->pre_process_mmap_virtual_address = pre_process_mmap_virtual_address;
+		
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */			 
-		search_element = search_element->next_pid;
+		 * Save the pre_process_mmap_physical_address Physical Address inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
+		 * From this Moment the Physical Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
+		 */				
+		search_element->pre_process_mmap_physical_address = (u32)pre_process_mmap_physical_address;
 	}
 	
 	/*
@@ -3235,40 +4826,23 @@ static int post_process_mmap_mmap(struct file *file, struct vm_area_struct *vma)
 	down_write(&post_process_mmap_sem);
 	 
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */			 
-	search_element = pid_list_head;
-	 
-	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 */			 
-	 while(search_element != NULL)
-	 {
-		
+	 * Find the Node of the PID that Made the MMap File Operation Call in the pid_hash_table.
+	 */
+	search_element = pid_list_lookup(current->pid);
+
+	if(search_element != NULL)
+	{
 		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Made the MMap File Operation Call.
-		 */			
-		if(search_element->pid == current->pid)
-		{
-			/*
-			 * Save the post_process_mmap_virtual_address Virtual Pointer inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
-			 * From this Moment the Virtual Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
-			 */					
-			search_element->post_process_mmap_virtual_address = post_process_mmap_virtual_address;
-			
-			/*
-			 * Save the post_process_mmap_physical_address Physical Address inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
-			 * From this Moment the Physical Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
-			 */				
-			search_element->post_process_mmap_physical_address = (u32)post_process_mmap_physical_address;
-			
-			break;
-		}
-		 
+		 * Save the post_process_mmap_virtual_address Virtual Pointer inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
+		 * From this Moment the Virtual Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
+		 */					
+		search_element->post_process_mmap_virtual_address = post_process_mmap_virtual_address;
+		
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */			 
-		search_element = search_element->next_pid;
+		 * Save the post_process_mmap_physical_address Physical Address inside the Singly Linked List Node of the Current PID so that we Know that the Kernel Allocated Memory Belongs to the Current PID.
+		 * From this Moment the Physical Address of that Kernel Memory can be Accessed only through the Current Singly List Node and Only on Behalf of the PID that this Node Belongs to.
+		 */				
+		search_element->post_process_mmap_physical_address = (u32)post_process_mmap_physical_address;
 	}
 	     
 	/*
@@ -3307,11 +4881,12 @@ static int xilinx_pci_driver_init(void)
 	 * Initialize the Wait Queue.
 	 */
 	init_waitqueue_head(&ioctl_queue);
+	init_waitqueue_head(&completion_queue);
 	
 	/*
 	 * Initialize the Read/Write Semaphores Present in the Driver.
 	 */
-	init_rwsem(&ioctl_sem);
+	init_rwsem(&allocation_sem);
 	
 	init_rwsem(&case_0_sem);
 	init_rwsem(&case_1_sem);
@@ -3332,6 +4907,7 @@ static int xilinx_pci_driver_init(void)
 	init_rwsem(&set_pages_sem);
 	init_rwsem(&unmap_pages_sem);
 	init_rwsem(&sg_sem);
+	init_rwsem(&ring_sem);
 	
 	init_rwsem(&write_sem);
 	init_rwsem(&search_element_sem);
@@ -4034,6 +5610,18 @@ module_exit(xilinx_pci_driver_exit);
 module_param(signal_to_pid, short, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
 MODULE_PARM_DESC(signal_to_pid, "Signal to Send");
 
+module_param(allocation_policy, int, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+MODULE_PARM_DESC(allocation_policy, "Default Allocation Policy: 1 Greedy, 2 Best Available, 3 Size Aware, 4 Fair Share");
+
+module_param(size_aware_split_pixels, int, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+MODULE_PARM_DESC(size_aware_split_pixels, "Number of Image Pixels from which the Size Aware Policy Splits an Image");
+
+module_param(weighted_split, int, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+MODULE_PARM_DESC(weighted_split, "Split the Image Rows in Proportion to the Measured Throughput of the Acceleration Groups (1) or Evenly (0)");
+
+module_param(collect_metrics, int, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+MODULE_PARM_DESC(collect_metrics, "Copy the Per Job Metrics of the Acceleration Groups from the FPGA BRAM (1) or Skip them (0)");
+
 
 /** OK
   * irq_fast_handler_0()
@@ -4140,174 +5728,80 @@ irqreturn_t irq_handler_0(int irq, void *dev_id, struct pt_regs *regs)
 	printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Acceleration Group Direct 0 Completed\n", driver_name, current->pid);
 	#endif	
 	
+	/*
+	 * If the AGD0 Processed a Job that was Queued in a Submission Ring then accel_ring_complete() Handles the Interrupt.
+	 */
+	if(accel_ring_complete(0))
+	{
+		return IRQ_HANDLED;
+	}
+
 	/*
 	 * Lock the msi_1_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
 	 */
 	down_write(&msi_1_sem);
 	
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */
-	search_element = pid_list_head;
-	 
-	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
+	 * Lock the allocation_sem Semaphore for Reading so that the Node of the accel_group_owner Array is not Freed by xilinx_pci_driver_release() while it is Accessed.
 	 */
-	while(search_element != NULL)
-	{
-		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Occupied the Acceleration Group Direct 0 (AGD0).
-		 * If this is the Case then we can Copy the AGDO Metrics Information from the FPGA BRAM to the Kernel Metrics Memory.
-		 * 
-		 * The search_element->shared_repo_virtual_address is a Pointer of the Current Node that Points to a Metrics Kernel Memory Allocation which is
-		 * Allocated Specifically for the Userspace Thread with PID Equal to the Current Node's PID (search_element->pid).
-		 */
-		if(search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid)
-		{
-			#ifdef DEBUG_MESSAGES
-			printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
-			#endif			
-
-			/*
-			 * Copy the "Read Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */
-			search_element->shared_repo_virtual_address->process_metrics.agd0.apm_read_transactions = inter_process_shared_info_memory->accel_direct_0_shared_metrics.apm_read_transactions;
-			
-			/*
-			 * Copy the "Read Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd0.apm_read_bytes = inter_process_shared_info_memory->accel_direct_0_shared_metrics.apm_read_bytes;
-			
-			/*
-			 * Copy the "Write Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */
-			search_element->shared_repo_virtual_address->process_metrics.agd0.apm_write_transactions = inter_process_shared_info_memory->accel_direct_0_shared_metrics.apm_write_transactions;
-			
-			/*
-			 * Copy the "Write Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd0.apm_write_bytes = inter_process_shared_info_memory->accel_direct_0_shared_metrics.apm_write_bytes;
-			
-			/*
-			 * Copy the "Stream Packets" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd0.apm_packets = inter_process_shared_info_memory->accel_direct_0_shared_metrics.apm_packets;
-			
-			/*
-			 * Copy the "Stream Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */						
-			search_element->shared_repo_virtual_address->process_metrics.agd0.apm_bytes = inter_process_shared_info_memory->accel_direct_0_shared_metrics.apm_bytes;
+	down_read(&allocation_sem);
 
-			/*
-			 * Copy the "Global Clock Counter Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd0.apm_gcc_l = inter_process_shared_info_memory->accel_direct_0_shared_metrics.apm_gcc_l;
-			
-			/*
-			 * Copy the "Global Clock Counter Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd0.apm_gcc_u = inter_process_shared_info_memory->accel_direct_0_shared_metrics.apm_gcc_u;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd0.cdma_fetch_time_start_l = inter_process_shared_info_memory->accel_direct_0_shared_metrics.cdma_fetch_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd0.cdma_fetch_time_start_u = inter_process_shared_info_memory->accel_direct_0_shared_metrics.cdma_fetch_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd0.cdma_fetch_time_end_l = inter_process_shared_info_memory->accel_direct_0_shared_metrics.cdma_fetch_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agd0.cdma_fetch_time_end_u = inter_process_shared_info_memory->accel_direct_0_shared_metrics.cdma_fetch_time_end_u;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd0.cdma_send_time_start_l = inter_process_shared_info_memory->accel_direct_0_shared_metrics.cdma_send_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agd0.cdma_send_time_start_u = inter_process_shared_info_memory->accel_direct_0_shared_metrics.cdma_send_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agd0.cdma_send_time_end_l = inter_process_shared_info_memory->accel_direct_0_shared_metrics.cdma_send_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agd0.cdma_send_time_end_u = inter_process_shared_info_memory->accel_direct_0_shared_metrics.cdma_send_time_end_u;	
-			
-			/*
-			 * Copy the "Acceleration Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agd0.dma_accel_time_start_l = inter_process_shared_info_memory->accel_direct_0_shared_metrics.dma_accel_time_start_l;
-			
-			/*
-			 * Copy the "Acceleration Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd0.dma_accel_time_start_u = inter_process_shared_info_memory->accel_direct_0_shared_metrics.dma_accel_time_start_u;	
-			
-			/*
-			 * Copy the "Acceleration Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd0.dma_accel_time_end_l = inter_process_shared_info_memory->accel_direct_0_shared_metrics.dma_accel_time_end_l;
-			
-			/*
-			 * Copy the "Acceleration Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd0.dma_accel_time_end_u = inter_process_shared_info_memory->accel_direct_0_shared_metrics.dma_accel_time_end_u;	
-			
-			/*
-			 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGD0 
-			 * to Indicate the Completion of the Acceleration Procedure by the AGD0.
-			 * 
-			 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
-			 * It is Reserved, though, for Possible Future Usage.
-			 */
-			//setup_and_send_signal(DEFAULT_SIGNAL_0, inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid);	
-			
-			/*
-			 * Set the Current Node's accel_completed Field with the ACCELERATOR_DIRECT_0_OCCUPIED Value which, also, Indicates the Completion of AGD0.
-			 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
-			 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGD0 has Completed.
-			 */
-			search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_DIRECT_0_OCCUPIED;
-			
-			/*
-			 * Clear the agd0_busy Field of the BRAM to Indicate that the AGD0 is Available.
-			 */
-			inter_process_shared_info_memory->shared_status_flags.agd0_busy	= 0;	
-			
-			/*
-			 * Clear the accel_direct_0_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGD0.
-			 */			
-			inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid = 0;
-			
-			/*
-			 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
-			 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGD0.
-			 */
-			write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);
-					
-		}
+	/*
+	 * Get the Node of the Thread that Occupied the AGD0 from the accel_group_owner Array.
+	 */
+	search_element = accel_group_owner[0];
+
+	if(search_element != NULL && search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid)
+	{
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
+		#endif			
+
+		/*
+		 * Copy the Metrics that the AGD0 Stored to the FPGA BRAM to the Current Node's Kernel Memory Allocation in the agd0 Structure Field.
+		 */
+		accel_copy_metrics(&search_element->shared_repo_virtual_address->process_metrics.agd0, &inter_process_shared_info_memory->accel_direct_0_shared_metrics);
 		
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
+		 * Update the Measured Throughput of the AGD0 with the Segment that it Just Completed.
 		 */
-		search_element = search_element->next_pid;
+		accel_calibrate_group(0, &inter_process_shared_info_memory->accel_direct_0_shared_metrics);
+		
+		/*
+		 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGD0 
+		 * to Indicate the Completion of the Acceleration Procedure by the AGD0.
+		 * 
+		 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
+		 * It is Reserved, though, for Possible Future Usage.
+		 */
+		//setup_and_send_signal(DEFAULT_SIGNAL_0, inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid);	
+		
+		/*
+		 * Set the Current Node's accel_completed Field with the ACCELERATOR_DIRECT_0_OCCUPIED Value which, also, Indicates the Completion of AGD0.
+		 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
+		 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGD0 has Completed.
+		 */
+		search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_DIRECT_0_OCCUPIED;
+		
+		/*
+		 * Clear the agd0_busy Field of the BRAM to Indicate that the AGD0 is Available.
+		 */
+		inter_process_shared_info_memory->shared_status_flags.agd0_busy	= 0;	
+		
+		/*
+		 * Clear the accel_direct_0_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGD0.
+		 */			
+		inter_process_shared_info_memory->shared_status_flags.accel_direct_0_occupied_pid = 0;
+		
+		/*
+		 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
+		 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGD0.
+		 */
+		write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);
 	}
 
+	up_read(&allocation_sem);
+
 	/*
 	 * Unlock the msi_1_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
 	 */
@@ -4318,6 +5812,16 @@ irqreturn_t irq_handler_0(int irq, void *dev_id, struct pt_regs *regs)
 	 * Wake up the Sleeping Userspace Threads of the ioctl_queue Queue so that they can Claim the AGD0.
 	 */
 	wake_up_interruptible(&ioctl_queue);
+	
+	/*
+	 * Wake up the Userspace Threads that Wait in poll() for their Acceleration to Complete so that they Re-evaluate their accel_completed Mask.
+	 */
+	wake_up_interruptible(&completion_queue);
+
+	/*
+	 * Let the Queued Ring Jobs Use the AGD0 if it was Released.
+	 */
+	accel_ring_kick();
 
 	return IRQ_HANDLED;
 }
@@ -4349,175 +5853,80 @@ irqreturn_t irq_handler_1(int irq, void *dev_id, struct pt_regs *regs)
 	printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Acceleration Group Direct 1 Completed\n", driver_name, current->pid);
 	#endif
 		
+	/*
+	 * If the AGD1 Processed a Job that was Queued in a Submission Ring then accel_ring_complete() Handles the Interrupt.
+	 */
+	if(accel_ring_complete(1))
+	{
+		return IRQ_HANDLED;
+	}
+
 	/*
 	 * Lock the msi_2_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
 	 */	
 	down_write(&msi_2_sem);
 	
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */	
-	search_element = pid_list_head;
-	 
+	 * Lock the allocation_sem Semaphore for Reading so that the Node of the accel_group_owner Array is not Freed by xilinx_pci_driver_release() while it is Accessed.
+	 */
+	down_read(&allocation_sem);
+
 	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 */	 
-	while(search_element != NULL)
-	{
+	 * Get the Node of the Thread that Occupied the AGD1 from the accel_group_owner Array.
+	 */
+	search_element = accel_group_owner[1];
 
+	if(search_element != NULL && search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid)
+	{
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
+		#endif			
+		
+		/*
+		 * Copy the Metrics that the AGD1 Stored to the FPGA BRAM to the Current Node's Kernel Memory Allocation in the agd1 Structure Field.
+		 */
+		accel_copy_metrics(&search_element->shared_repo_virtual_address->process_metrics.agd1, &inter_process_shared_info_memory->accel_direct_1_shared_metrics);
+		
+		/*
+		 * Update the Measured Throughput of the AGD1 with the Segment that it Just Completed.
+		 */
+		accel_calibrate_group(1, &inter_process_shared_info_memory->accel_direct_1_shared_metrics);
+		
 		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Occupied the Acceleration Group Direct 1 (AGD1).
-		 * If this is the Case then we can Copy the AGD1 Metrics Information from the FPGA BRAM to the Kernel Metrics Memory.
+		 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGD1 
+		 * to Indicate the Completion of the Acceleration Procedure by the AGD1.
 		 * 
-		 * The search_element->shared_repo_virtual_address is a Pointer of the Current Node that Points to a Metrics Kernel Memory Allocation which is
-		 * Allocated Specifically for the Userspace Thread with PID Equal to the Current Node's PID (search_element->pid).
-		 */		
-		if(search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid)
-		{
-			#ifdef DEBUG_MESSAGES
-			printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
-			#endif			
-			
-			/*
-			 * Copy the "Read Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd1.apm_read_transactions = inter_process_shared_info_memory->accel_direct_1_shared_metrics.apm_read_transactions;
-			
-			/*
-			 * Copy the "Read Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.apm_read_bytes = inter_process_shared_info_memory->accel_direct_1_shared_metrics.apm_read_bytes;
-			
-			/*
-			 * Copy the "Write Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd1.apm_write_transactions = inter_process_shared_info_memory->accel_direct_1_shared_metrics.apm_write_transactions;
+		 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
+		 * It is Reserved, though, for Possible Future Usage.
+		 */			
+		//setup_and_send_signal(DEFAULT_SIGNAL_1, inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid);		
 		
-			/*
-			 * Copy the "Write Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd1.apm_write_bytes = inter_process_shared_info_memory->accel_direct_1_shared_metrics.apm_write_bytes;
-			
-			/*
-			 * Copy the "Stream Packets" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agd1.apm_packets = inter_process_shared_info_memory->accel_direct_1_shared_metrics.apm_packets;
-			
-			/*
-			 * Copy the "Stream Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.apm_bytes = inter_process_shared_info_memory->accel_direct_1_shared_metrics.apm_bytes;
-
-			/*
-			 * Copy the "Global Clock Counter Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agd1.apm_gcc_l = inter_process_shared_info_memory->accel_direct_1_shared_metrics.apm_gcc_l;
-			
-			/*
-			 * Copy the "Global Clock Counter Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.apm_gcc_u = inter_process_shared_info_memory->accel_direct_1_shared_metrics.apm_gcc_u;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.cdma_fetch_time_start_l = inter_process_shared_info_memory->accel_direct_1_shared_metrics.cdma_fetch_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.cdma_fetch_time_start_u = inter_process_shared_info_memory->accel_direct_1_shared_metrics.cdma_fetch_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.cdma_fetch_time_end_l = inter_process_shared_info_memory->accel_direct_1_shared_metrics.cdma_fetch_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.cdma_fetch_time_end_u = inter_process_shared_info_memory->accel_direct_1_shared_metrics.cdma_fetch_time_end_u;
-				
-			/*
-			 * Copy the "CDMA Send Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agd1.cdma_send_time_start_l = inter_process_shared_info_memory->accel_direct_1_shared_metrics.cdma_send_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agd1.cdma_send_time_start_u = inter_process_shared_info_memory->accel_direct_1_shared_metrics.cdma_send_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agd1.cdma_send_time_end_l = inter_process_shared_info_memory->accel_direct_1_shared_metrics.cdma_send_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agd1.cdma_send_time_end_u = inter_process_shared_info_memory->accel_direct_1_shared_metrics.cdma_send_time_end_u;	
-			
-			/*
-			 * Copy the "Acceleration Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.dma_accel_time_start_l = inter_process_shared_info_memory->accel_direct_1_shared_metrics.dma_accel_time_start_l;
-			
-			/*
-			 * Copy the "Acceleration Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.dma_accel_time_start_u = inter_process_shared_info_memory->accel_direct_1_shared_metrics.dma_accel_time_start_u;	
-
-			/*
-			 * Copy the "Acceleration Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.dma_accel_time_end_l = inter_process_shared_info_memory->accel_direct_1_shared_metrics.dma_accel_time_end_l;
-			
-			/*
-			 * Copy the "Acceleration Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agd1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agd1.dma_accel_time_end_u = inter_process_shared_info_memory->accel_direct_1_shared_metrics.dma_accel_time_end_u;
-			
-			/*
-			 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGD1 
-			 * to Indicate the Completion of the Acceleration Procedure by the AGD1.
-			 * 
-			 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
-			 * It is Reserved, though, for Possible Future Usage.
-			 */			
-			//setup_and_send_signal(DEFAULT_SIGNAL_1, inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid);		
-			
-			/*
-			 * Set the Current Node's accel_completed Field with the ACCELERATOR_DIRECT_1_OCCUPIED Value which, also, Indicates the Completion of AGD1.
-			 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
-			 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGD1 has Completed.
-			 */			
-			search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_DIRECT_1_OCCUPIED;		
-			
-			/*
-			 * Clear the agd1_busy Field of the BRAM to Indicate that the AGD1 is Available.
-			 */			
-			inter_process_shared_info_memory->shared_status_flags.agd1_busy	= 0;	
-			
-			/*
-			 * Clear the accel_direct_1_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGD1.
-			 */				
-			inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid = 0;	
-			
-			/*
-			 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
-			 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGD1.
-			 */			
-			write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);				
-
-		}
+		/*
+		 * Set the Current Node's accel_completed Field with the ACCELERATOR_DIRECT_1_OCCUPIED Value which, also, Indicates the Completion of AGD1.
+		 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
+		 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGD1 has Completed.
+		 */			
+		search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_DIRECT_1_OCCUPIED;		
 		
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */		 
-		search_element = search_element->next_pid;
+		 * Clear the agd1_busy Field of the BRAM to Indicate that the AGD1 is Available.
+		 */			
+		inter_process_shared_info_memory->shared_status_flags.agd1_busy	= 0;	
+		
+		/*
+		 * Clear the accel_direct_1_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGD1.
+		 */				
+		inter_process_shared_info_memory->shared_status_flags.accel_direct_1_occupied_pid = 0;	
+		
+		/*
+		 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
+		 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGD1.
+		 */			
+		write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);				
 	}
 
+	up_read(&allocation_sem);
+
 	/*
 	 * Unlock the msi_2_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
 	 */
@@ -4527,7 +5936,17 @@ irqreturn_t irq_handler_1(int irq, void *dev_id, struct pt_regs *regs)
 	 * The Fact that an Interrupt Occured it Means that the AGD1 Has Completed which in other Words Means that the AGD1 is Available.
 	 * Wake up the Sleeping Userspace Threads of the ioctl_queue Queue so that they can Claim the AGD1.
 	 */
-	wake_up_interruptible(&ioctl_queue);	
+	wake_up_interruptible(&ioctl_queue);
+	
+	/*
+	 * Wake up the Userspace Threads that Wait in poll() for their Acceleration to Complete so that they Re-evaluate their accel_completed Mask.
+	 */
+	wake_up_interruptible(&completion_queue);
+
+	/*
+	 * Let the Queued Ring Jobs Use the AGD1 if it was Released.
+	 */
+	accel_ring_kick();
 
 	return IRQ_HANDLED;
 }
@@ -4560,175 +5979,80 @@ irqreturn_t irq_handler_2(int irq, void *dev_id, struct pt_regs *regs)
 	printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Acceleration Group Indirect 0 Completed\n", driver_name, current->pid);
 	#endif
 	
+	/*
+	 * If the AGI0 Processed a Job that was Queued in a Submission Ring then accel_ring_complete() Handles the Interrupt.
+	 */
+	if(accel_ring_complete(2))
+	{
+		return IRQ_HANDLED;
+	}
+
 	/*
 	 * Lock the msi_3_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
 	 */
 	down_write(&msi_3_sem);
 	
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */	
-	search_element = pid_list_head;
-	 
-	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 */	 
-	while(search_element != NULL)
-	{
-		
-		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Occupied the Acceleration Group Indirect 0 (AGI0).
-		 * If this is the Case then we can Copy the AGIO Metrics Information from the FPGA BRAM to the Kernel Metrics Memory.
-		 * 
-		 * The search_element->shared_repo_virtual_address is a Pointer of the Current Node that Points to a Metrics Kernel Memory Allocation which is
-		 * Allocated Specifically for the Userspace Thread with PID Equal to the Current Node's PID (search_element->pid).
-		 */		
-		if(search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid)
-		{
-			#ifdef DEBUG_MESSAGES
-			printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
-			#endif
-					
-			/*
-			 * Copy the "Read Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */						
-			search_element->shared_repo_virtual_address->process_metrics.agi0.apm_read_transactions = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.apm_read_transactions;
-			
-			/*
-			 * Copy the "Read Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi0.apm_read_bytes = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.apm_read_bytes;
-		
-			/*
-			 * Copy the "Write Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi0.apm_write_transactions = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.apm_write_transactions;
-			
-			/*
-			 * Copy the "Write Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi0.apm_write_bytes = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.apm_write_bytes;
-			
-			/*
-			 * Copy the "Stream Packets" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi0.apm_packets = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.apm_packets;
-			
-			/*
-			 * Copy the "Stream Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi0.apm_bytes = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.apm_bytes;
+	 * Lock the allocation_sem Semaphore for Reading so that the Node of the accel_group_owner Array is not Freed by xilinx_pci_driver_release() while it is Accessed.
+	 */
+	down_read(&allocation_sem);
 
-			/*
-			 * Copy the "Global Clock Counter Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agi0.apm_gcc_l = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.apm_gcc_l;
-			
-			/*
-			 * Copy the "Global Clock Counter Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi0.apm_gcc_u = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.apm_gcc_u;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi0.cdma_fetch_time_start_l = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.cdma_fetch_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi0.cdma_fetch_time_start_u = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.cdma_fetch_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi0.cdma_fetch_time_end_l = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.cdma_fetch_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi0.cdma_fetch_time_end_u = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.cdma_fetch_time_end_u;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agi0.cdma_send_time_start_l = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.cdma_send_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi0.cdma_send_time_start_u = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.cdma_send_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi0.cdma_send_time_end_l = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.cdma_send_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi0.cdma_send_time_end_u = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.cdma_send_time_end_u;	
-					
-			/*
-			 * Copy the "Acceleration Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */						
-			search_element->shared_repo_virtual_address->process_metrics.agi0.dma_accel_time_start_l = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.dma_accel_time_start_l;
-			
-			/*
-			 * Copy the "Acceleration Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi0.dma_accel_time_start_u = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.dma_accel_time_start_u;	
-			
-			/*
-			 * Copy the "Acceleration Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi0.dma_accel_time_end_l = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.dma_accel_time_end_l;
-			
-			/*
-			 * Copy the "Acceleration Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi0 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi0.dma_accel_time_end_u = inter_process_shared_info_memory->accel_indirect_0_shared_metrics.dma_accel_time_end_u;	
-			
-			/*
-			 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGI0 
-			 * to Indicate the Completion of the Acceleration Procedure by the AGI0.
-			 * 
-			 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
-			 * It is Reserved, though, for Possible Future Usage.
-			 */			
-			//setup_and_send_signal(DEFAULT_SIGNAL_2, inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid);	
-			
-			/*
-			 * Set the Current Node's accel_completed Field with the ACCELERATOR_INDIRECT_0_OCCUPIED Value which, also, Indicates the Completion of AGI0.
-			 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
-			 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGI0 has Completed.
-			 */				
-			search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_INDIRECT_0_OCCUPIED;
-			
-			/*
-			 * Clear the agi0_busy Field of the BRAM to Indicate that the AGI0 is Available.
-			 */				
-			inter_process_shared_info_memory->shared_status_flags.agi0_busy	= 0;	
-			
-			/*
-			 * Clear the accel_indirect_0_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGI0.
-			 */				
-			inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid = 0;	
-			
-			/*
-			 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
-			 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGI0.
-			 */			
-			write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);							
-			
-		}
-		 
+	/*
+	 * Get the Node of the Thread that Occupied the AGI0 from the accel_group_owner Array.
+	 */
+	search_element = accel_group_owner[2];
+
+	if(search_element != NULL && search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid)
+	{
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
+		#endif
+				
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */		 
-		search_element = search_element->next_pid;
+		 * Copy the Metrics that the AGI0 Stored to the FPGA BRAM to the Current Node's Kernel Memory Allocation in the agi0 Structure Field.
+		 */
+		accel_copy_metrics(&search_element->shared_repo_virtual_address->process_metrics.agi0, &inter_process_shared_info_memory->accel_indirect_0_shared_metrics);
+		
+		/*
+		 * Update the Measured Throughput of the AGI0 with the Segment that it Just Completed.
+		 */
+		accel_calibrate_group(2, &inter_process_shared_info_memory->accel_indirect_0_shared_metrics);
+		
+		/*
+		 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGI0 
+		 * to Indicate the Completion of the Acceleration Procedure by the AGI0.
+		 * 
+		 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
+		 * It is Reserved, though, for Possible Future Usage.
+		 */			
+		//setup_and_send_signal(DEFAULT_SIGNAL_2, inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid);	
+		
+		/*
+		 * Set the Current Node's accel_completed Field with the ACCELERATOR_INDIRECT_0_OCCUPIED Value which, also, Indicates the Completion of AGI0.
+		 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
+		 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGI0 has Completed.
+		 */				
+		search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_INDIRECT_0_OCCUPIED;
+		
+		/*
+		 * Clear the agi0_busy Field of the BRAM to Indicate that the AGI0 is Available.
+		 */				
+		inter_process_shared_info_memory->shared_status_flags.agi0_busy	= 0;	
+		
+		/*
+		 * Clear the accel_indirect_0_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGI0.
+		 */				
+		inter_process_shared_info_memory->shared_status_flags.accel_indirect_0_occupied_pid = 0;	
+		
+		/*
+		 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
+		 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGI0.
+		 */			
+		write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);							
 	}
 
+	up_read(&allocation_sem);
+
 	/*
 	 * Unlock the msi_3_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
 	 */
@@ -4738,7 +6062,17 @@ irqreturn_t irq_handler_2(int irq, void *dev_id, struct pt_regs *regs)
 	 * The Fact that an Interrupt Occured it Means that the AGI0 Has Completed which in other Words Means that the AGI0 is Available.
 	 * Wake up the Sleeping Userspace Threads of the ioctl_queue Queue so that they can Claim the AGI0.
 	 */
-	wake_up_interruptible(&ioctl_queue);	
+	wake_up_interruptible(&ioctl_queue);
+	
+	/*
+	 * Wake up the Userspace Threads that Wait in poll() for their Acceleration to Complete so that they Re-evaluate their accel_completed Mask.
+	 */
+	wake_up_interruptible(&completion_queue);
+
+	/*
+	 * Let the Queued Ring Jobs Use the AGI0 if it was Released.
+	 */
+	accel_ring_kick();
 
 	return IRQ_HANDLED;
 }
@@ -4770,175 +6104,80 @@ irqreturn_t irq_handler_3(int irq, void *dev_id, struct pt_regs *regs)
 	printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Acceleration Group Indirect 1 Completed\n", driver_name, current->pid);
 	#endif
 	
+	/*
+	 * If the AGI1 Processed a Job that was Queued in a Submission Ring then accel_ring_complete() Handles the Interrupt.
+	 */
+	if(accel_ring_complete(3))
+	{
+		return IRQ_HANDLED;
+	}
+
 	/*
 	 * Lock the msi_4_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
 	 */
 	down_write(&msi_4_sem);
 	
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */	
-	search_element = pid_list_head;
-	 
+	 * Lock the allocation_sem Semaphore for Reading so that the Node of the accel_group_owner Array is not Freed by xilinx_pci_driver_release() while it is Accessed.
+	 */
+	down_read(&allocation_sem);
+
 	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
+	 * Get the Node of the Thread that Occupied the AGI1 from the accel_group_owner Array.
 	 */
-	while(search_element != NULL)
+	search_element = accel_group_owner[3];
+
+	if(search_element != NULL && search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid)
 	{
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
+		#endif			
+
+		/*
+		 * Copy the Metrics that the AGI1 Stored to the FPGA BRAM to the Current Node's Kernel Memory Allocation in the agi1 Structure Field.
+		 */
+		accel_copy_metrics(&search_element->shared_repo_virtual_address->process_metrics.agi1, &inter_process_shared_info_memory->accel_indirect_1_shared_metrics);
+		
+		/*
+		 * Update the Measured Throughput of the AGI1 with the Segment that it Just Completed.
+		 */
+		accel_calibrate_group(3, &inter_process_shared_info_memory->accel_indirect_1_shared_metrics);
 		
 		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Occupied the Acceleration Group Indirect 1 (AGI1).
-		 * If this is the Case then we can Copy the AGI1 Metrics Information from the FPGA BRAM to the Kernel Metrics Memory.
+		 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGI1 
+		 * to Indicate the Completion of the Acceleration Procedure by the AGI1.
 		 * 
-		 * The search_element->shared_repo_virtual_address is a Pointer of the Current Node that Points to a Metrics Kernel Memory Allocation which is
-		 * Allocated Specifically for the Userspace Thread with PID Equal to the Current Node's PID (search_element->pid).
+		 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
+		 * It is Reserved, though, for Possible Future Usage.
+		 */					
+		//setup_and_send_signal(DEFAULT_SIGNAL_3, inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid);	
+		
+		/*
+		 * Set the Current Node's accel_completed Field with the ACCELERATOR_INDIRECT_1_OCCUPIED Value which, also, Indicates the Completion of AGI1.
+		 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
+		 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGI1 has Completed.
+		 */				
+		search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_INDIRECT_1_OCCUPIED;	
+	
+		/*
+		 * Clear the agi1_busy Field of the BRAM to Indicate that the AGI1 is Available.
 		 */			
-		if(search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid)
-		{
-			#ifdef DEBUG_MESSAGES
-			printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
-			#endif			
-
-			/*
-			 * Copy the "Read Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agi1.apm_read_transactions = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.apm_read_transactions;
-			
-			/*
-			 * Copy the "Read Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi1.apm_read_bytes = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.apm_read_bytes;
-			
-			/*
-			 * Copy the "Write Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */						
-			search_element->shared_repo_virtual_address->process_metrics.agi1.apm_write_transactions = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.apm_write_transactions;
-
-			/*
-			 * Copy the "Write Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi1.apm_write_bytes = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.apm_write_bytes;
-			
-			/*
-			 * Copy the "Stream Packets" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi1.apm_packets = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.apm_packets;
-
-			/*
-			 * Copy the "Stream Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi1.apm_bytes = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.apm_bytes;
-
-			/*
-			 * Copy the "Global Clock Counter Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agi1.apm_gcc_l = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.apm_gcc_l;
-			
-			/*
-			 * Copy the "Global Clock Counter Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi1.apm_gcc_u = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.apm_gcc_u;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi1.cdma_fetch_time_start_l = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.cdma_fetch_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi1.cdma_fetch_time_start_u = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.cdma_fetch_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi1.cdma_fetch_time_end_l = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.cdma_fetch_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi1.cdma_fetch_time_end_u = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.cdma_fetch_time_end_u;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi1.cdma_send_time_start_l = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.cdma_send_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi1.cdma_send_time_start_u = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.cdma_send_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi1.cdma_send_time_end_l = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.cdma_send_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi1.cdma_send_time_end_u = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.cdma_send_time_end_u;	
-			
-			/*
-			 * Copy the "Acceleration Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi1.dma_accel_time_start_l = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.dma_accel_time_start_l;
-			
-			/*
-			 * Copy the "Acceleration Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agi1.dma_accel_time_start_u = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.dma_accel_time_start_u;	
-			
-			/*
-			 * Copy the "Acceleration Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agi1.dma_accel_time_end_l = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.dma_accel_time_end_l;
-			
-			/*
-			 * Copy the "Acceleration Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi1 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agi1.dma_accel_time_end_u = inter_process_shared_info_memory->accel_indirect_1_shared_metrics.dma_accel_time_end_u;		
-			
-			/*
-			 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGI1 
-			 * to Indicate the Completion of the Acceleration Procedure by the AGI1.
-			 * 
-			 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
-			 * It is Reserved, though, for Possible Future Usage.
-			 */					
-			//setup_and_send_signal(DEFAULT_SIGNAL_3, inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid);	
-			
-			/*
-			 * Set the Current Node's accel_completed Field with the ACCELERATOR_INDIRECT_1_OCCUPIED Value which, also, Indicates the Completion of AGI1.
-			 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
-			 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGI1 has Completed.
-			 */				
-			search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_INDIRECT_1_OCCUPIED;	
+		inter_process_shared_info_memory->shared_status_flags.agi1_busy	= 0;	
 		
-			/*
-			 * Clear the agi1_busy Field of the BRAM to Indicate that the AGI1 is Available.
-			 */			
-			inter_process_shared_info_memory->shared_status_flags.agi1_busy	= 0;	
-			
-			/*
-			 * Clear the accel_indirect_1_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGI1.
-			 */				
-			inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid = 0;	
-			
-			/*
-			 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
-			 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGI1.
-			 */			
-			write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);								
-			
-		}
-		 
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */		 
-		search_element = search_element->next_pid;
+		 * Clear the accel_indirect_1_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGI1.
+		 */				
+		inter_process_shared_info_memory->shared_status_flags.accel_indirect_1_occupied_pid = 0;	
+		
+		/*
+		 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
+		 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGI1.
+		 */			
+		write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);								
 	}
 
+	up_read(&allocation_sem);
+
 	/*
 	 * Unlock the msi_4_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
 	 */
@@ -4949,7 +6188,17 @@ irqreturn_t irq_handler_3(int irq, void *dev_id, struct pt_regs *regs)
 	 * Wake up the Sleeping Userspace Threads of the ioctl_queue Queue so that they can Claim the AGI1.
 	 */	
 	wake_up_interruptible(&ioctl_queue);
+	
+	/*
+	 * Wake up the Userspace Threads that Wait in poll() for their Acceleration to Complete so that they Re-evaluate their accel_completed Mask.
+	 */
+	wake_up_interruptible(&completion_queue);
 		
+	/*
+	 * Let the Queued Ring Jobs Use the AGI1 if it was Released.
+	 */
+	accel_ring_kick();
+
 	return IRQ_HANDLED;
 }
 
@@ -4980,176 +6229,80 @@ irqreturn_t irq_handler_4(int irq, void *dev_id, struct pt_regs *regs)
 	printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Acceleration Group Indirect 2 Completed\n", driver_name, current->pid);
 	#endif
 
+	/*
+	 * If the AGI2 Processed a Job that was Queued in a Submission Ring then accel_ring_complete() Handles the Interrupt.
+	 */
+	if(accel_ring_complete(4))
+	{
+		return IRQ_HANDLED;
+	}
+
 	/*
 	 * Lock the msi_5_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
 	 */
 	down_write(&msi_5_sem);
 	
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */	
-	search_element = pid_list_head;
-
+	 * Lock the allocation_sem Semaphore for Reading so that the Node of the accel_group_owner Array is not Freed by xilinx_pci_driver_release() while it is Accessed.
+	 */
+	down_read(&allocation_sem);
 
 	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 */	 
-	while(search_element != NULL)
+	 * Get the Node of the Thread that Occupied the AGI2 from the accel_group_owner Array.
+	 */
+	search_element = accel_group_owner[4];
+
+	if(search_element != NULL && search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid)
 	{
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
+		#endif			
+
+		/*
+		 * Copy the Metrics that the AGI2 Stored to the FPGA BRAM to the Current Node's Kernel Memory Allocation in the agi2 Structure Field.
+		 */
+		accel_copy_metrics(&search_element->shared_repo_virtual_address->process_metrics.agi2, &inter_process_shared_info_memory->accel_indirect_2_shared_metrics);
 		
 		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Occupied the Acceleration Group Indirect 2 (AGI2).
-		 * If this is the Case then we can Copy the AGI2 Metrics Information from the FPGA BRAM to the Kernel Metrics Memory.
-		 * 
-		 * The search_element->shared_repo_virtual_address is a Pointer of the Current Node that Points to a Metrics Kernel Memory Allocation which is
-		 * Allocated Specifically for the Userspace Thread with PID Equal to the Current Node's PID (search_element->pid).
-		 */			
-		if(search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid)
-		{
-			#ifdef DEBUG_MESSAGES
-			printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
-			#endif			
-
-			/*
-			 * Copy the "Read Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agi2.apm_read_transactions = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.apm_read_transactions;
-			
-			/*
-			 * Copy the "Read Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi2.apm_read_bytes = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.apm_read_bytes;
-			
-			/*
-			 * Copy the "Write Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */						
-			search_element->shared_repo_virtual_address->process_metrics.agi2.apm_write_transactions = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.apm_write_transactions;
-			
-			/*
-			 * Copy the "Write Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi2.apm_write_bytes = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.apm_write_bytes;
+		 * Update the Measured Throughput of the AGI2 with the Segment that it Just Completed.
+		 */
+		accel_calibrate_group(4, &inter_process_shared_info_memory->accel_indirect_2_shared_metrics);
+		
+		/*
+		 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGI2 
+		 * to Indicate the Completion of the Acceleration Procedure by the AGI2.
+		 * 
+		 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
+		 * It is Reserved, though, for Possible Future Usage.
+		 */					
+		//setup_and_send_signal(DEFAULT_SIGNAL_4, inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid);
 		
-			/*
-			 * Copy the "Stream Packets" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi2.apm_packets = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.apm_packets;
-			
-			/*
-			 * Copy the "Stream Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi2.apm_bytes = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.apm_bytes;
-
-			/*
-			 * Copy the "Global Clock Counter Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agi2.apm_gcc_l = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.apm_gcc_l;
-			
-			/*
-			 * Copy the "Global Clock Counter Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi2.apm_gcc_u = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.apm_gcc_u;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi2.cdma_fetch_time_start_l = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.cdma_fetch_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi2.cdma_fetch_time_start_u = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.cdma_fetch_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi2.cdma_fetch_time_end_l = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.cdma_fetch_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi2.cdma_fetch_time_end_u = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.cdma_fetch_time_end_u;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi2.cdma_send_time_start_l = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.cdma_send_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi2.cdma_send_time_start_u = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.cdma_send_time_start_u;	
-
-			/*
-			 * Copy the "CDMA Send Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi2.cdma_send_time_end_l = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.cdma_send_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi2.cdma_send_time_end_u = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.cdma_send_time_end_u;	
-			
-			/*
-			 * Copy the "Acceleration Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */					
-			search_element->shared_repo_virtual_address->process_metrics.agi2.dma_accel_time_start_l = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.dma_accel_time_start_l;
-			
-			/*
-			 * Copy the "Acceleration Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi2.dma_accel_time_start_u = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.dma_accel_time_start_u;	
-			
-			/*
-			 * Copy the "Acceleration Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi2.dma_accel_time_end_l = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.dma_accel_time_end_l;
-			
-			/*
-			 * Copy the "Acceleration Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi2 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi2.dma_accel_time_end_u = inter_process_shared_info_memory->accel_indirect_2_shared_metrics.dma_accel_time_end_u;	
-			
-			/*
-			 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGI2 
-			 * to Indicate the Completion of the Acceleration Procedure by the AGI2.
-			 * 
-			 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
-			 * It is Reserved, though, for Possible Future Usage.
-			 */					
-			//setup_and_send_signal(DEFAULT_SIGNAL_4, inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid);
-			
-			/*
-			 * Set the Current Node's accel_completed Field with the ACCELERATOR_INDIRECT_2_OCCUPIED Value which, also, Indicates the Completion of AGI2.
-			 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
-			 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGI2 has Completed.
-			 */				
-			search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_INDIRECT_2_OCCUPIED;		
-					
-			/*
-			 * Clear the agi2_busy Field of the BRAM to Indicate that the AGI2 is Available.
-			 */						
-			inter_process_shared_info_memory->shared_status_flags.agi2_busy	= 0;	
-			
-			/*
-			 * Clear the accel_indirect_2_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGI2.
-			 */				
-			inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid = 0;
-			
-			/*
-			 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
-			 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGI2.
-			 */			
-			write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);					
-			
-		}
-		 
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */		 
-		search_element = search_element->next_pid;
+		 * Set the Current Node's accel_completed Field with the ACCELERATOR_INDIRECT_2_OCCUPIED Value which, also, Indicates the Completion of AGI2.
+		 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
+		 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGI2 has Completed.
+		 */				
+		search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_INDIRECT_2_OCCUPIED;		
+				
+		/*
+		 * Clear the agi2_busy Field of the BRAM to Indicate that the AGI2 is Available.
+		 */						
+		inter_process_shared_info_memory->shared_status_flags.agi2_busy	= 0;	
+		
+		/*
+		 * Clear the accel_indirect_2_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGI2.
+		 */				
+		inter_process_shared_info_memory->shared_status_flags.accel_indirect_2_occupied_pid = 0;
+		
+		/*
+		 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
+		 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGI2.
+		 */			
+		write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);					
 	}
 
+	up_read(&allocation_sem);
+
 	/*
 	 * Unlock the msi_5_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
 	 */
@@ -5160,6 +6313,16 @@ irqreturn_t irq_handler_4(int irq, void *dev_id, struct pt_regs *regs)
 	 * Wake up the Sleeping Userspace Threads of the ioctl_queue Queue so that they can Claim the AGI2.
 	 */	
 	wake_up_interruptible(&ioctl_queue);
+	
+	/*
+	 * Wake up the Userspace Threads that Wait in poll() for their Acceleration to Complete so that they Re-evaluate their accel_completed Mask.
+	 */
+	wake_up_interruptible(&completion_queue);
+
+	/*
+	 * Let the Queued Ring Jobs Use the AGI2 if it was Released.
+	 */
+	accel_ring_kick();
 
 	return IRQ_HANDLED;
 }
@@ -5191,175 +6354,80 @@ irqreturn_t irq_handler_5(int irq, void *dev_id, struct pt_regs *regs)
 	printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Acceleration Group Indirect 3 Completed\n", driver_name, current->pid);
 	#endif	
 
+	/*
+	 * If the AGI3 Processed a Job that was Queued in a Submission Ring then accel_ring_complete() Handles the Interrupt.
+	 */
+	if(accel_ring_complete(5))
+	{
+		return IRQ_HANDLED;
+	}
+
 	/*
 	 * Lock the msi_6_sem Semaphore so that only the Current Userspace Thread can Access that part of the Code.
 	 */
 	down_write(&msi_6_sem);
 	
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */	
-	search_element = pid_list_head;
-
+	 * Lock the allocation_sem Semaphore for Reading so that the Node of the accel_group_owner Array is not Freed by xilinx_pci_driver_release() while it is Accessed.
+	 */
+	down_read(&allocation_sem);
 
 	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 */	 
-	while(search_element != NULL)
+	 * Get the Node of the Thread that Occupied the AGI3 from the accel_group_owner Array.
+	 */
+	search_element = accel_group_owner[5];
+
+	if(search_element != NULL && search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid)
 	{
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
+		#endif			
+
+		/*
+		 * Copy the Metrics that the AGI3 Stored to the FPGA BRAM to the Current Node's Kernel Memory Allocation in the agi3 Structure Field.
+		 */
+		accel_copy_metrics(&search_element->shared_repo_virtual_address->process_metrics.agi3, &inter_process_shared_info_memory->accel_indirect_3_shared_metrics);
+		
+		/*
+		 * Update the Measured Throughput of the AGI3 with the Segment that it Just Completed.
+		 */
+		accel_calibrate_group(5, &inter_process_shared_info_memory->accel_indirect_3_shared_metrics);
+		
 		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Occupied the Acceleration Group Indirect 3 (AGI3).
-		 * If this is the Case then we can Copy the AGI3 Metrics Information from the FPGA BRAM to the Kernel Metrics Memory.
+		 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGI3 
+		 * to Indicate the Completion of the Acceleration Procedure by the AGI3.
 		 * 
-		 * The search_element->shared_repo_virtual_address is a Pointer of the Current Node that Points to a Metrics Kernel Memory Allocation which is
-		 * Allocated Specifically for the Userspace Thread with PID Equal to the Current Node's PID (search_element->pid).
+		 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
+		 * It is Reserved, though, for Possible Future Usage.
+		 */					
+		//setup_and_send_signal(DEFAULT_SIGNAL_5, inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid);
+		
+		/*
+		 * Set the Current Node's accel_completed Field with the ACCELERATOR_INDIRECT_3_OCCUPIED Value which, also, Indicates the Completion of AGI3.
+		 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
+		 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGI3 has Completed.
+		 */				
+		search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_INDIRECT_3_OCCUPIED;
+	
+		/*
+		 * Clear the agi3_busy Field of the BRAM to Indicate that the AGI3 is Available.
 		 */			
-		if(search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid)
-		{
-			#ifdef DEBUG_MESSAGES
-			printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
-			#endif			
-
-			/*
-			 * Copy the "Read Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agi3.apm_read_transactions = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.apm_read_transactions;
-			
-			/*
-			 * Copy the "Read Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi3.apm_read_bytes = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.apm_read_bytes;
-			
-			/*
-			 * Copy the "Write Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */						
-			search_element->shared_repo_virtual_address->process_metrics.agi3.apm_write_transactions = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.apm_write_transactions;
-			
-			/*
-			 * Copy the "Write Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi3.apm_write_bytes = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.apm_write_bytes;
-			
-			/*
-			 * Copy the "Stream Packets" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.apm_packets = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.apm_packets;
-			
-			/*
-			 * Copy the "Stream Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi3.apm_bytes = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.apm_bytes;
-
-			/*
-			 * Copy the "Global Clock Counter Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agi3.apm_gcc_l = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.apm_gcc_l;
-			
-			/*
-			 * Copy the "Global Clock Counter Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agi3.apm_gcc_u = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.apm_gcc_u;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.cdma_fetch_time_start_l = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.cdma_fetch_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.cdma_fetch_time_start_u = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.cdma_fetch_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.cdma_fetch_time_end_l = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.cdma_fetch_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.cdma_fetch_time_end_u = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.cdma_fetch_time_end_u;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */			
-			search_element->shared_repo_virtual_address->process_metrics.agi3.cdma_send_time_start_l = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.cdma_send_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.cdma_send_time_start_u = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.cdma_send_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.cdma_send_time_end_l = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.cdma_send_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.cdma_send_time_end_u = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.cdma_send_time_end_u;	
-			
-			/*
-			 * Copy the "Acceleration Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.dma_accel_time_start_l = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.dma_accel_time_start_l;
-			
-			/*
-			 * Copy the "Acceleration Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.dma_accel_time_start_u = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.dma_accel_time_start_u;	
-			
-			/*
-			 * Copy the "Acceleration Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.dma_accel_time_end_l = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.dma_accel_time_end_l;
-			
-			/*
-			 * Copy the "Acceleration Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agi3 Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agi3.dma_accel_time_end_u = inter_process_shared_info_memory->accel_indirect_3_shared_metrics.dma_accel_time_end_u;	
-			
-			/*
-			 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGI3 
-			 * to Indicate the Completion of the Acceleration Procedure by the AGI3.
-			 * 
-			 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
-			 * It is Reserved, though, for Possible Future Usage.
-			 */					
-			//setup_and_send_signal(DEFAULT_SIGNAL_5, inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid);
-			
-			/*
-			 * Set the Current Node's accel_completed Field with the ACCELERATOR_INDIRECT_3_OCCUPIED Value which, also, Indicates the Completion of AGI3.
-			 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
-			 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGI3 has Completed.
-			 */				
-			search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_INDIRECT_3_OCCUPIED;
+		inter_process_shared_info_memory->shared_status_flags.agi3_busy	= 0;
 		
-			/*
-			 * Clear the agi3_busy Field of the BRAM to Indicate that the AGI3 is Available.
-			 */			
-			inter_process_shared_info_memory->shared_status_flags.agi3_busy	= 0;
-			
-			/*
-			 * Clear the accel_indirect_3_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGI3.
-			 */	
-			inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid = 0;		
-			
-			/*
-			 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
-			 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGI3.
-			 */			
-			write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);			
-
-		}
-		 
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */		 
-		search_element = search_element->next_pid;
+		 * Clear the accel_indirect_3_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGI3.
+		 */	
+		inter_process_shared_info_memory->shared_status_flags.accel_indirect_3_occupied_pid = 0;		
+		
+		/*
+		 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
+		 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGI3.
+		 */			
+		write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);			
 	}
 
+	up_read(&allocation_sem);
+
 	/*
 	 * Unlock the msi_6_sem Semaphore so that other Userspace Threads can Acces that Part of the Code.
 	 */
@@ -5370,6 +6438,16 @@ irqreturn_t irq_handler_5(int irq, void *dev_id, struct pt_regs *regs)
 	 * Wake up the Sleeping Userspace Threads of the ioctl_queue Queue so that they can Claim the AGI3.
 	 */	
 	wake_up_interruptible(&ioctl_queue);
+	
+	/*
+	 * Wake up the Userspace Threads that Wait in poll() for their Acceleration to Complete so that they Re-evaluate their accel_completed Mask.
+	 */
+	wake_up_interruptible(&completion_queue);
+
+	/*
+	 * Let the Queued Ring Jobs Use the AGI3 if it was Released.
+	 */
+	accel_ring_kick();
 
 	return IRQ_HANDLED;
 }
@@ -5408,169 +6486,77 @@ irqreturn_t irq_handler_6(int irq, void *dev_id, struct pt_regs *regs)
 	
 	
 	/*
-	 * Set the search_element Pointer to Point at the Head (pid_list_head) of the Singly Linked List so that we Can Search the List of Nodes from the Beginning.
-	 */	
-	search_element = pid_list_head;
-	
+	 * Lock the allocation_sem Semaphore for Reading so that the Node of the accel_group_owner Array is not Freed by xilinx_pci_driver_release() while it is Accessed.
+	 */
+	down_read(&allocation_sem);
+
 	/*
-	 * Keep Moving Forward in the Singly Linked List for as long as the search_element Pointer has not Reached a NULL Value.
-	 */	 
-	while(search_element != NULL)
+	 * Get the Node of the Thread that Occupied the AGSG from the accel_group_owner Array.
+	 */
+	search_element = accel_group_owner[6];
+
+	if(search_element != NULL && search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid)
 	{
+		#ifdef DEBUG_MESSAGES
+		printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
+		#endif			
+
+		/*
+		 * Copy the Metrics that the AGSG Stored to the FPGA BRAM to the Current Node's Kernel Memory Allocation in the agsg Structure Field.
+		 */
+		accel_copy_metrics(&search_element->shared_repo_virtual_address->process_metrics.agsg, &inter_process_shared_info_memory->accel_sg_0_shared_metrics);
 		
 		/*
-		 * Check if the Current Node's PID Value is Equal to the PID that Occupied the Acceleration Group Scatter/Gather (AGSG).
-		 * If this is the Case then we can Copy the AGSG Metrics Information from the FPGA BRAM to the Kernel Metrics Memory.
-		 * 
-		 * The search_element->shared_repo_virtual_address is a Pointer of the Current Node that Points to a Metrics Kernel Memory Allocation which is
-		 * Allocated Specifically for the Userspace Thread with PID Equal to the Current Node's PID (search_element->pid).
-		 */			
-		if(search_element->pid == inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid)
+		 * Update the Measured Throughput of the AGSG with the Segment that it Just Completed.
+		 */
+		accel_calibrate_group(6, &inter_process_shared_info_memory->accel_sg_0_shared_metrics);
+		
+		/*
+		 * If the AGSG Used a Registration then Synchronize the Destination Pages of the Job for the CPU so that the Thread Reads the Processed Image.
+		 * The Source Memory was only Read by the AGSG.
+		 */
+		if(search_element->sg_active_registration != NULL)
 		{
-			#ifdef DEBUG_MESSAGES
-			printk(KERN_ALERT "[%s-DBG -> MSI IRQ (PID %d)] Found Search Element\n", driver_name, current->pid);
-			#endif			
-
-			/*
-			 * Copy the "Read Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agsg.apm_read_transactions = inter_process_shared_info_memory->accel_sg_0_shared_metrics.apm_read_transactions;
-			
-			/*
-			 * Copy the "Read Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agsg.apm_read_bytes = inter_process_shared_info_memory->accel_sg_0_shared_metrics.apm_read_bytes;
-			
-			/*
-			 * Copy the "Write Transactions" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */						
-			search_element->shared_repo_virtual_address->process_metrics.agsg.apm_write_transactions = inter_process_shared_info_memory->accel_sg_0_shared_metrics.apm_write_transactions;
-			
-			/*
-			 * Copy the "Write Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agsg.apm_write_bytes = inter_process_shared_info_memory->accel_sg_0_shared_metrics.apm_write_bytes;
-			
-			/*
-			 * Copy the "Stream Packets" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.apm_packets = inter_process_shared_info_memory->accel_sg_0_shared_metrics.apm_packets;
-			
-			/*
-			 * Copy the "Stream Bytes" Metric from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agsg.apm_bytes = inter_process_shared_info_memory->accel_sg_0_shared_metrics.apm_bytes;
-
-			/*
-			 * Copy the "Global Clock Counter Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */	
-			search_element->shared_repo_virtual_address->process_metrics.agsg.apm_gcc_l = inter_process_shared_info_memory->accel_sg_0_shared_metrics.apm_gcc_l;
-			
-			/*
-			 * Copy the "Global Clock Counter Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */							
-			search_element->shared_repo_virtual_address->process_metrics.agsg.apm_gcc_u = inter_process_shared_info_memory->accel_sg_0_shared_metrics.apm_gcc_u;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.cdma_fetch_time_start_l = inter_process_shared_info_memory->accel_sg_0_shared_metrics.cdma_fetch_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.cdma_fetch_time_start_u = inter_process_shared_info_memory->accel_sg_0_shared_metrics.cdma_fetch_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.cdma_fetch_time_end_l = inter_process_shared_info_memory->accel_sg_0_shared_metrics.cdma_fetch_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Fetch Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.cdma_fetch_time_end_u = inter_process_shared_info_memory->accel_sg_0_shared_metrics.cdma_fetch_time_end_u;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.cdma_send_time_start_l = inter_process_shared_info_memory->accel_sg_0_shared_metrics.cdma_send_time_start_l;
-			
-			/*
-			 * Copy the "CDMA Send Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.cdma_send_time_start_u = inter_process_shared_info_memory->accel_sg_0_shared_metrics.cdma_send_time_start_u;	
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.cdma_send_time_end_l = inter_process_shared_info_memory->accel_sg_0_shared_metrics.cdma_send_time_end_l;
-			
-			/*
-			 * Copy the "CDMA Send Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.cdma_send_time_end_u = inter_process_shared_info_memory->accel_sg_0_shared_metrics.cdma_send_time_end_u;	
-			
-			/*
-			 * Copy the "Acceleration Starting Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.dma_accel_time_start_l = inter_process_shared_info_memory->accel_sg_0_shared_metrics.dma_accel_time_start_l;
-			
-			/*
-			 * Copy the "Acceleration Starting Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.dma_accel_time_start_u = inter_process_shared_info_memory->accel_sg_0_shared_metrics.dma_accel_time_start_u;	
-						
-			/*
-			 * Copy the "Acceleration Ending Point Lower Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.dma_accel_time_end_l = inter_process_shared_info_memory->accel_sg_0_shared_metrics.dma_accel_time_end_l;
-			
-			/*
-			 * Copy the "Acceleration Ending Point Upper Register" Time Value from the FPGA BRAM to the Current Node's Kernel Memory Allocation in the Appropriate agsg Structure Field.
-			 */				
-			search_element->shared_repo_virtual_address->process_metrics.agsg.dma_accel_time_end_u = inter_process_shared_info_memory->accel_sg_0_shared_metrics.dma_accel_time_end_u;
-			
-			/*
-			 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGSG 
-			 * to Indicate the Completion of the Acceleration Procedure by the AGSG.
-			 * 
-			 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
-			 * It is Reserved, though, for Possible Future Usage.
-			 */					
-			//setup_and_send_signal(DEFAULT_SIGNAL_6, inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid);	
+			dma_sync_sg_for_cpu(&dev->dev, search_element->sg_active_registration->destination.sg_table->sgl, search_element->sg_active_destination_pages, DMA_BIDIRECTIONAL);
 			
-			/*
-			 * Set the Current Node's accel_completed Field with the ACCELERATOR_SG_OCCUPIED Value which, also, Indicates the Completion of AGSG.
-			 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
-			 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGSG has Completed.
-			 */				
-			search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_SG_OCCUPIED;
-				
-			/*
-			 * Clear the agsg_busy Field of the BRAM to Indicate that the AGSG is Available.
-			 */					
-			inter_process_shared_info_memory->shared_status_flags.agsg_busy	= 0;
+			search_element->sg_active_registration = NULL;
+		}
+		
+		/*
+		 * setup_and_send_signal() is Used to Send a Signal to the Userspace Thread that Occupied the AGSG 
+		 * to Indicate the Completion of the Acceleration Procedure by the AGSG.
+		 * 
+		 * setup_and_send_signal() is no longer Used Since it is Replaced by Another Method for Informing the Userspace Thread for the Completion of the Acceleration Procedure.
+		 * It is Reserved, though, for Possible Future Usage.
+		 */					
+		//setup_and_send_signal(DEFAULT_SIGNAL_6, inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid);	
+		
+		/*
+		 * Set the Current Node's accel_completed Field with the ACCELERATOR_SG_OCCUPIED Value which, also, Indicates the Completion of AGSG.
+		 * The accel_completed Field is Stored inside the Metrics Kernel Memory Allocation that is, also, Mapped to the Corresponding Userspace Thread of the Current List Node.
+		 * As a Result, the Userspace Thread Reads the accel_completed Field in Polling Mode to Know when the AGSG has Completed.
+		 */				
+		search_element->shared_repo_virtual_address->accel_completed |= ACCELERATOR_SG_OCCUPIED;
 			
-			/*
-			 * Clear the accel_sg_0_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGSG.
-			 */	
-			inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid = 0;			
-
-			/*
-			 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
-			 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGSG.
-			 */
-			write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);	
+		/*
+		 * Clear the agsg_busy Field of the BRAM to Indicate that the AGSG is Available.
+		 */					
+		inter_process_shared_info_memory->shared_status_flags.agsg_busy	= 0;
+		
+		/*
+		 * Clear the accel_sg_0_occupied_pid Field of the BRAM which Indicates which PID has Occupied the AGSG.
+		 */	
+		inter_process_shared_info_memory->shared_status_flags.accel_sg_0_occupied_pid = 0;			
 
-		}
-		 
 		/*
-		 * Set the search_element Pointer to Point at the Next List Node.
-		 */		 
-		search_element = search_element->next_pid;
+		 * Write an Acknowledgment Value to the Data Register of the GPIO_ACK Peripheral of the FPGA.
+		 * The GPIO_ACK Peripheral will then Trigger an Interrupt to the Interrupt Manager (FPGA) to Indicate that the Driver Successfully Handled the MSI Interrupt for the AGSG.
+		 */
+		write_remote_register(bar0_address_virtual, BAR0_OFFSET_GPIO_ACK, (u32)ACK);	
 	}
 
+	up_read(&allocation_sem);
+
 	/*
 	 * Unlock the msi_7_sem Semaphore so that other Userspace Threads can Access that Part of the Code.
 	 */
@@ -5581,6 +6567,12 @@ irqreturn_t irq_handler_6(int irq, void *dev_id, struct pt_regs *regs)
 	 * Wake up the Sleeping Userspace Threads of the ioctl_queue Queue so that they can Claim the AGSG.
 	 */	
 	wake_up_interruptible(&ioctl_queue);
+	
+	/*
+	 * Wake up the Userspace Threads that Wait in poll() for their Acceleration to Complete so that they Re-evaluate their accel_completed Mask.
+	 * wake_up() is Used so that accel_sg_unregister_all() (Uninterruptible Wait) is, also, Woken Up.
+	 */
+	wake_up(&completion_queue);
 
 	return IRQ_HANDLED;
 }
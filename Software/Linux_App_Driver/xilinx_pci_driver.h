@@ -68,7 +68,8 @@
   * Remove/Add One of the '*' at the Beggining to Change the State of the Switch.
   * One '*' Enables --> BEST_AVAILABLE.
   * Two '*' Enable  --> GREEDY.
-  * This is Used to Safely Disable/Enable Specific Code Parts of the Driver.
+  * It Selects the Initial Value of the allocation_policy Module Parameter which Can be Changed at Runtime through the Sysfs
+  * or Overridden for a Single Request by the Argument of the COMMAND_REQUEST_ACCELERATOR_ACCESS IOCtl Call (ALLOCATION_POLICY_*).
   */
  
 /*/ #define BEST_AVAILABLE /*/ #define GREEDY /**/
@@ -96,10 +97,37 @@
 #define ACK 0x1
 
 
+/*
+ * The MMAP_ALLOCATION_SIZE Matches the 4M Range of the AXI BARs (See the Address Segments of the Block Design) through which the AGD0, AGD1, AGI0, AGI1, AGI2 and AGI3
+ * Access the Pre-Process Data Kernel Memory since the Address Translation of an AXI BAR Cannot Move Part of its Range.
+ * Larger Images (e.g. 3840x2160 with 32 Bits per Pixel Need 33177600 Bytes) are Split in Row Bands by the Userspace Application (See tiled_acceleration() of the ui.cpp).
+ * 
+ * The POSIX_ALLOCATED_SIZE Userspace Memories of the AGSG Fit a Whole 3840x2160 Image.
+ * They are Aligned to POSIX_ALLOCATED_ALIGNMENT (the Size of a Transparent Huge Page) so that they Can be Backed by Huge Pages
+ * whose Physically Contiguous Pages are Described by Few Extents in the Scatter/Gather Lists of the FPGA BRAM.
+ */
 #define MMAP_ALLOCATION_SIZE 4 * MBYTE
 #define POSIX_ALLOCATED_SIZE 32 * MBYTE
+#define POSIX_ALLOCATED_ALIGNMENT 2 * MBYTE
 #define KERNEL_ALLOCATION_SIZE 4 * MBYTE
 
+/*
+ * Each of the Source and Destination Scatter/Gather Lists in the FPGA BRAM Holds SG_LIST_ENTRIES 64 Bit Page Addresses (Enough for the POSIX_ALLOCATED_SIZE).
+ * 
+ * A Thread Can Keep up to SG_REGISTRATIONS Pairs of Source and Destination Userspace Memories Registered through the COMMAND_REGISTER_PAGES IOCtl Call.
+ * The Pages of a Registration Stay Pinned and DMA Mapped until the COMMAND_UNREGISTER_PAGES IOCtl Call (or the Release of the Driver File)
+ * so that Consecutive AGSG Jobs on the Same Memories do not Repeat the Page Pinning, the Scatter/Gather Table Allocation and the DMA Mapping.
+ */
+#define SG_LIST_ENTRIES 8192
+#define SG_REGISTRATIONS 4
+
+/*
+ * The Registered Memories are Written to the FPGA BRAM as Extents of Physically Contiguous Pages.
+ * The Upper Bits of each 64 Bit Entry Hold the Page Aligned Address of the Extent and the SG_EXTENT_PAGES_MASK Bits the Number of Additional Contiguous Pages.
+ * The Entries of the Page Lists of the COMMAND_SET_PAGES IOCtl Call Have these Bits Cleared so they are Read by the DMA SG PCIe Scheduler as Extents of a Single Page.
+ */
+#define SG_EXTENT_PAGES_MASK 0xFFF
+
 
 #define OPERATION_START_TIMER			0x18000000
 
@@ -126,6 +154,59 @@
 #define ACCELERATOR_ALL_OCCUPIED         0x3F
 #define ACCELERATOR_NO_OCCUPIED          0x00
 
+#define ACCELERATION_GROUPS              7 //AGD0, AGD1, AGI0, AGI1, AGI2, AGI3 and AGSG
+#define SEGMENT_ACCELERATION_GROUPS      6 //AGD0, AGD1, AGI0, AGI1, AGI2 and AGI3 Can Process Segments of the Same Image
+
+#define ALLOCATION_POLICY_DEFAULT        0 //Use the allocation_policy Module Parameter
+#define ALLOCATION_POLICY_GREEDY         1
+#define ALLOCATION_POLICY_BEST_AVAILABLE 2
+#define ALLOCATION_POLICY_SIZE_AWARE     3
+#define ALLOCATION_POLICY_FAIR_SHARE     4
+
+#define SIZE_AWARE_SPLIT_PIXELS          (1280 * 720)
+
+#define INPUT_FORMAT_BGRX                0 //4 Bytes per Pixel (Blue, Green, Red and a Padding Byte)
+#define INPUT_FORMAT_BGR                 1 //3 Bytes per Pixel with each Row Padded to a Multiple of 4 Bytes
+#define INPUT_FORMAT_LUMA                2 //1 Byte (Luminance) per Pixel with each Row Padded to a Multiple of 4 Bytes
+
+#define FILTER_MODE_SOBEL                0 //The Fixed Sobel Edge Detection (Default)
+#define FILTER_MODE_LINEAR               1 //Convolution with the X Coefficients (e.g. Gaussian Blur, Box or Sharpen)
+#define FILTER_MODE_GRADIENT             2 //Edge Detection with the X and Y Coefficients (e.g. Scharr or Prewitt)
+
+#define FILTER_TAPS                      5 //The Coefficients are Given as a 5x5 Kernel (a 3x3 Kernel is Placed in the Center)
+#define FILTER_COEFFICIENT_WORDS         7 //The 32 Bit Registers that Hold the 25 Coefficients of each Kernel
+
+#define FILTER_PRESET_SOBEL              0
+#define FILTER_PRESET_GAUSSIAN           1
+#define FILTER_PRESET_SHARPEN            2
+#define FILTER_PRESET_SCHARR             3
+#define FILTER_PRESET_PREWITT            4
+#define FILTER_PRESET_BOX                5
+
+#define OUTPUT_FORMAT_PIXEL              0 //The Sobel Filters Return the Filtered Pixels
+#define OUTPUT_FORMAT_GRADIENTS          1 //The Sobel Filters Return the Signed 12 Bit X (Bits 11-0) and Y (Bits 23-12) Gradients of each Pixel
+#define OUTPUT_FORMAT_MAGNITUDE          2 //The Sobel Filters Return the Gradient Magnitude (Bits 15-0) and Direction (Bits 17-16) of each Pixel
+
+#define DIRECTION_HORIZONTAL             0 //The Quantized Gradient Directions of the OUTPUT_FORMAT_MAGNITUDE (the Gradient Points Left/Right)
+#define DIRECTION_RISING                 1 //The Gradient Points to the Next Column of the Previous Row or the Previous Column of the Next Row
+#define DIRECTION_VERTICAL               2 //The Gradient Points Up/Down
+#define DIRECTION_FALLING                3 //The Gradient Points to the Previous Column of the Previous Row or the Next Column of the Next Row
+
+#define CANNY_THRESHOLD_LOW              80 //Gradient Magnitudes (|X| + |Y|) that the Application Keeps when they are Connected to a Strong Edge
+#define CANNY_THRESHOLD_HIGH             160 //Gradient Magnitudes (|X| + |Y|) that the Application Always Keeps as Edges
+
+#define PIPELINE_STAGE_BLUR              0x1 //The sobel_pipeline Core Applies a 3x3 Gaussian Blur before the Filter
+#define PIPELINE_STAGE_NMS               0x2 //The sobel_pipeline Core Thins the Edges with Non-Maximum Suppression after the Filter
+#define PIPELINE_STAGES_MASK             (PIPELINE_STAGE_BLUR | PIPELINE_STAGE_NMS)
+
+#define THROUGHPUT_INITIAL               1024 //Bytes per 256 Timer Cycles (One 32 Bit Pixel per Cycle)
+#define THROUGHPUT_AVERAGE_SHIFT         3 //Each new Measurement Has 1/8 Weight in the Moving Average
+
+#define PID_HASH_BUCKETS                 64
+#define PID_HASH_MASK                    (PID_HASH_BUCKETS - 1)
+
+#define METRICS_HARDWARE_SIZE            80 //The APM, CDMA and Acceleration Fields of the metrics Structure (Offsets 0 to 76 Bytes)
+
 
 #define ENABLE_GCC_MC 0x00010001 //Enable Global Clock Counter and Metrics Counter Mask
 #define RESET_GCC_MC  0x00020002 //Reset Global Clock Counter and Metrics Counter Mask
@@ -216,6 +297,8 @@
 #define ACCELERATION_SCHEDULER_DIRECT_HOST_SOURCE_ADDRESS_REGISTER_OFFSET					0X58
 #define ACCELERATION_SCHEDULER_DIRECT_HOST_DESTINATION_ADDRESS_REGISTER_OFFSET				0X60
 #define ACCELERATION_SCHEDULER_DIRECT_INITIATOR_GROUP_REGISTER_OFFSET						0X68
+#define ACCELERATION_SCHEDULER_DIRECT_PACKED_OUTPUT_REGISTER_OFFSET							0X70
+#define ACCELERATION_SCHEDULER_DIRECT_INPUT_FORMAT_REGISTER_OFFSET							0X78
 
 
 //////////////////////////////////////////////////////////////////////////////////////
@@ -250,7 +333,22 @@
 #define ACCELERATION_SCHEDULER_INDIRECT_SHARED_APM_BASE_ADDRESS_REGISTER_OFFSET					0xC0
 #define ACCELERATION_SCHEDULER_INDIRECT_SHARED_METRICS_BASE_ADDRESS_REGISTER_OFFSET				0xC8
 #define ACCELERATION_SCHEDULER_INDIRECT_APM_BASE_ADDRESS_REGISTER_OFFSET						0xD0             
+#define ACCELERATION_SCHEDULER_INDIRECT_PACKED_OUTPUT_REGISTER_OFFSET							0xD8
+#define ACCELERATION_SCHEDULER_INDIRECT_INPUT_FORMAT_REGISTER_OFFSET							0xE0
+
+
+//////////////////////////////////////////////////////////////////////////////////////
+// Sobel Filter Register Offsets
+//////////////////////////////////////////////////////////////////////////////////////
 
+#define SOBEL_FILTER_FILTER_MODE_REGISTER_OFFSET				0x48
+#define SOBEL_FILTER_X_COEFFICIENTS_REGISTER_OFFSET				0x50 //FILTER_COEFFICIENT_WORDS Registers
+#define SOBEL_FILTER_Y_COEFFICIENTS_REGISTER_OFFSET				0x70 //FILTER_COEFFICIENT_WORDS Registers
+#define SOBEL_FILTER_COEFFICIENT_SHIFT_REGISTER_OFFSET			0x90
+#define SOBEL_FILTER_THRESHOLD_LOW_REGISTER_OFFSET				0x98
+#define SOBEL_FILTER_THRESHOLD_HIGH_REGISTER_OFFSET				0xA0
+#define SOBEL_FILTER_OUTPUT_FORMAT_REGISTER_OFFSET				0xA8
+#define SOBEL_FILTER_PIPELINE_STAGES_REGISTER_OFFSET			0xB0 //Only the sobel_pipeline Core Has this Register
 
 //////////////////////////////////////////////////////////////////////////////////////
 // Acceleration Scheduler SG Register Offsets
@@ -270,6 +368,8 @@
 #define XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_IMAGE_COLS_DATA                         0x48
 #define XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_IMAGE_ROWS_DATA                         0x50
 #define XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_ACCEL_GROUP_DATA                        0x58
+#define XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_PACKED_OUTPUT_DATA                      0x60
+#define XACCELERATION_SCHEDULER_SG_XDMA_CFG_ADDR_INPUT_FORMAT_DATA                       0x68
 
 
 
@@ -319,6 +419,10 @@
 #define COMMAND_SET_PAGES 						0x0300
 #define COMMAND_UNMAP_PAGES						0x0400
 #define COMMAND_RESET_VARIABLES					0x0500
+#define COMMAND_RING_SETUP						0x0600
+#define COMMAND_RING_SUBMIT						0x0700
+#define COMMAND_REGISTER_PAGES					0x0800
+#define COMMAND_UNREGISTER_PAGES				0x0900
 
 //////////////////////////////////////////////////////////////////////////////////////
 // Scenarios
@@ -328,6 +432,48 @@
 #define SCENARIO_WORST_CASE 		2
 #define SCENARIO_WORST_CASE_CDMA	3
 
+//////////////////////////////////////////////////////////////////////////////////////
+// Image Load Modes
+//////////////////////////////////////////////////////////////////////////////////////
+
+#define LOAD_MODE_COPY			0
+#define LOAD_MODE_DIRECT		1
+#define LOAD_MODE_PRE_STAGED	2
+
+//////////////////////////////////////////////////////////////////////////////////////
+// CPU Offload
+//////////////////////////////////////////////////////////////////////////////////////
+
+#define OFFLOAD_MODE_FPGA		0
+#define OFFLOAD_MODE_AUTO		1
+#define OFFLOAD_MODE_CPU		2
+
+#define OFFLOAD_ENGINE_FPGA		0
+#define OFFLOAD_ENGINE_CPU		1
+
+#define OFFLOAD_SMALL_IMAGE_PIXELS	(320 * 240) //Images up to QVGA Start on the CPU Engine before any Latency is Measured
+#define OFFLOAD_PROBE_INTERVAL		16 //Jobs after which the Engine that was not Selected is Used Once to Refresh its Measured Latency
+#define OFFLOAD_EWMA_SHIFT			3 //Each New Latency Sample Weighs 1/8 in the Average Latency of its Engine
+#define CPU_MAX_WORKERS			64 //The Maximum Number of Threads that the CPU Engine Uses for each Image
+
+//////////////////////////////////////////////////////////////////////////////////////
+// Submission/Completion Ring
+//////////////////////////////////////////////////////////////////////////////////////
+
+#define RING_ENTRIES		64 //Must be a Power of 2
+#define RING_ENTRIES_MASK	(RING_ENTRIES - 1)
+
+#define RING_STATUS_SUCCESS		0
+#define RING_STATUS_INVALID		1
+
+#define RING_ACCELERATION_GROUPS	6 //AGD0, AGD1, AGI0, AGI1, AGI2 and AGI3
+#define RING_RELEASE_TIMEOUT_MS		1000 //How Long the xilinx_pci_driver_release() Waits for the Ring Jobs of a Thread before it Quarantines their Acceleration Groups
+#define RING_POLL_TIMEOUT_MS		10
+#define RING_COMPLETION_TIMEOUT_MS	5000 //How Long a Userspace Thread Waits for any of its Ring Jobs to Complete before it Gives Up
+
+#define TILE_SLOTS			4 //Parts of the Pre-Process Data Kernel Memory where the Row Bands of a Tiled Image are Staged
+#define TILE_HALO_ROWS		1 //Rows Above and Below each Row Band which are Needed by the 3x3 Sobel Window
+
 struct image_info
 {
 	uint32_t rows;
@@ -458,6 +604,12 @@ struct status_flags
 	uint32_t agi3_busy;
 	uint32_t agsg_busy;
 	
+	/*
+	 * The Number of Threads that Sleep in the COMMAND_REQUEST_ACCELERATOR_ACCESS Case Waiting for an Acceleration Group to be Released.
+	 * Together with the Busy Flags it Gives the Userspace Threads the Queue Depth of the Acceleration System (See the offload_decision() of the ui.cpp).
+	 */
+	uint32_t waiting_requests;
+	
 };
 
 struct shared_repository
@@ -477,6 +629,67 @@ struct shared_repository
 
 };
 
+/*
+ * A Job that the Userspace Thread Queues in its Submission Ring.
+ * The Image of the Job is Located at buffer_offset Bytes inside the Pre-Process Data Kernel Memory and it is Processed in Place.
+ */
+struct ring_submission
+{
+	uint32_t job_id;
+	uint32_t rows;
+	uint32_t columns;
+	uint32_t buffer_offset;
+};
+
+/*
+ * A Completed Job that the Driver Posts in the Completion Ring.
+ * The accel_group Field Holds the ACCELERATOR_*_OCCUPIED Flag of the Acceleration Group that Processed the Job.
+ */
+struct ring_completion
+{
+	uint32_t job_id;
+	uint32_t accel_group;
+	uint32_t status;
+	uint32_t reserved;
+};
+
+/*
+ * The Indices are Free Running and are Masked with RING_ENTRIES_MASK to Access the Entries.
+ * 
+ * submission_tail and completion_head are Advanced by the Userspace Thread.
+ * submission_head and completion_tail are Advanced by the Driver.
+ */
+struct submission_ring
+{
+	uint32_t submission_head;
+	uint32_t submission_tail;
+	uint32_t completion_head;
+	uint32_t completion_tail;
+	
+	struct ring_submission submissions[RING_ENTRIES];
+	struct ring_completion completions[RING_ENTRIES];
+};
+
+/*
+ * The Operation that the Sobel Filters Apply to the Image of a Thread.
+ * The Coefficients of each Kernel are Given in Row Major Order.
+ * The Weighted Sum is Shifted Right by shift and the Results Below threshold_low or Above threshold_high Become 0 or 255 Respectively.
+ * In the FILTER_MODE_SOBEL Mode the Coefficients, the Shift and the Thresholds are not Used.
+ * The output_format Selects whether the Sobel Filters Return the Filtered Pixels or the Gradients of each Pixel (See the OUTPUT_FORMAT_*).
+ * The stages Holds the PIPELINE_STAGE_* Bits of the Optional Stages of the sobel_pipeline Core.
+ */
+struct filter_config
+{
+	int mode;
+	int8_t x_coefficients[FILTER_TAPS * FILTER_TAPS];
+	int8_t y_coefficients[FILTER_TAPS * FILTER_TAPS];
+	int shift;
+	int threshold_low;
+	int threshold_high;
+	int output_format;
+	int stages;
+};
+
 struct shared_repository_process
 {
 	struct metrics_per_process process_metrics;
@@ -484,6 +697,24 @@ struct shared_repository_process
 	int accel_completed;
 	int accel_occupied;
 	int image_segments;
+	
+	/*
+	 * Set by the Userspace Thread to Request the Packed Output Mode of the Sobel Filter (4 Grayscale Pixels of 8 Bits per 32 Bit Word).
+	 * The segment_rows are Set by the Driver with the Rows of each of the image_segments in the Order they are Located in the Pre-Process Data Kernel Memory.
+	 * The input_format is Set by the Userspace Thread with the Format of the Staged Image (INPUT_FORMAT_BGRX, INPUT_FORMAT_BGR or INPUT_FORMAT_LUMA).
+	 * The Packed Input Formats Imply the Packed Output Mode since the Processed Image Replaces the Initial Image in the Same Memory.
+	 */
+	int packed_output;
+	int input_format;
+	int segment_rows[ACCELERATION_GROUPS];
+	
+	/*
+	 * Set by the Userspace Thread with the Operation that the Sobel Filters Apply to its Image (See the struct filter_config).
+	 * The Driver Writes it to the Sobel Filter of each Acceleration Group before Starting it.
+	 */
+	struct filter_config filter;
+	
+	struct submission_ring ring;
 
 };
 
@@ -524,6 +755,30 @@ typedef struct {
 typedef unsigned char pixel_t;
 
 
+/*
+ * A Userspace Memory of the AGSG which is Kept Pinned and DMA Mapped by the Driver (See the COMMAND_REGISTER_PAGES IOCtl Call).
+ * The u64_sg_list Holds the extents Descriptors of the Physically Contiguous Runs of Pages and it is Copied to the FPGA BRAM when the AGSG Starts.
+ */
+struct sg_buffer
+{
+	unsigned long address;
+	
+	int pinned_pages;
+	struct page **page_array;
+	
+	struct sg_table *sg_table;
+	int dma_buffers;
+	
+	uint64_t *u64_sg_list;
+	int extents;
+};
+
+struct sg_registration
+{
+	struct sg_buffer source;
+	struct sg_buffer destination;
+};
+
 struct pid_reserved_memories {
 	
 	pid_t pid;
@@ -555,7 +810,18 @@ struct pid_reserved_memories {
 	uint64_t *u64_sg_list_source;
 	uint64_t *u64_sg_list_destination;
 	
+	int ring_enabled;
+	int ring_in_flight;
+	uint32_t ring_submission_head;
+	uint32_t ring_completion_tail;
+	
+	struct sg_registration *sg_registrations[SG_REGISTRATIONS];
+	struct sg_registration *sg_active_registration;
+	int sg_active_destination_pages;
+	
+	struct pid_reserved_memories *previous_pid;
 	struct pid_reserved_memories *next_pid;
+	struct pid_reserved_memories *next_hash_pid;
 	
 };
 
@@ -566,6 +832,16 @@ struct sg_list_addresses
 	uint64_t *sg_list_source_address;
 	uint64_t *sg_list_destination_address;
 	
+	/*
+	 * The Number of Bytes of the Source and Destination Userspace Memories that the Driver May Pin.
+	 * The COMMAND_REGISTER_PAGES IOCtl Call Pins Exactly these Bytes while the COMMAND_SET_PAGES IOCtl Call Pins only the Pages of the Image (0 for no Limit).
+	 * 
+	 * The handle is Returned by the COMMAND_REGISTER_PAGES IOCtl Call (0 if the Registration Failed).
+	 */
+	uint64_t source_size;
+	uint64_t destination_size;
+	int32_t handle;
+	
 };
 
 struct per_thread_info
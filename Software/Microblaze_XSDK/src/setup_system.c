@@ -113,6 +113,28 @@
 #define PAGE_SIZE	4096
 
 
+/*
+ * The Size of the AXI BARs 4 and 5 of the PCIe Bridge that the DMA SG PCIe Scheduler Uses to Access the Source and Destination Memories.
+ * A Single DMA Transfer of the Scheduler Covers up to AXI_BAR_SG_SIZE Bytes of Physically Contiguous Pages.
+ * It Must Match the Range of the AXI BARs 4 and 5 in the Block Design.
+ */
+#define AXI_BAR_SG_SIZE	(1 * MBYTE)
+
+
+/*
+ * Set to 1 when the AGSG DMA is Built with its Scatter/Gather Engine so that the DMA SG PCIe Scheduler Feeds it with Descriptor Rings.
+ * It Must Match the agsg_descriptor_ring Variable of the Block Design Script.
+ */
+#define AGSG_DESCRIPTOR_RING	0
+
+
+/*
+ * The Address in the DDR3 Memory where the DMA SG PCIe Scheduler Builds the MM2S and S2MM Descriptor Rings.
+ * It is Placed Right After the 32MB that are Used by the AGI Acceleration Groups.
+ */
+#define AGSG_DESCRIPTOR_RING_ADDRESS	(XPAR_MIG_BASEADDR + (32 * MBYTE))
+
+
 /*
  * Mask to Isolate the Clear Data from a GPIO Data Register.
  */
@@ -649,6 +671,12 @@ int setup_dma_sg_schedulers()
 	//with the Physical Address of the Kernel Memory that the S2MM Channel of the DMA will Use as the Destination Address to Write the Processed Image Data.
     XDma_sg_pcie_scheduler_Set_axi_bar_dst_cfg_address(&dma_sg_pcie_scheduler, (XPAR_PCIE_BASEADDR + BAR5_OFFSET_L));
 
+    //Set the Size of the Source and Destination AXI BARs which is the Largest Transfer that the Scheduler Can Issue for an Extent of Contiguous Pages.
+    XDma_sg_pcie_scheduler_Set_axi_bar_size(&dma_sg_pcie_scheduler, AXI_BAR_SG_SIZE);
+
+    //Set the Address of the Descriptor Rings in the DDR3 Memory or 0 to Make the Scheduler Drive the DMA in Simple Mode.
+    XDma_sg_pcie_scheduler_Set_descriptor_ring_address(&dma_sg_pcie_scheduler, AGSG_DESCRIPTOR_RING ? AGSG_DESCRIPTOR_RING_ADDRESS : 0);
+
 
 	return XST_SUCCESS;
 }